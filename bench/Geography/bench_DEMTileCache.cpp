@@ -0,0 +1,122 @@
+// ===== BENCHMARK DEMTileCache height lookups =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using Geography::DEMTileCache;
+
+const std::size_t n = 65536;    // Number of points per iteration
+const std::size_t ns = 1201;    // SRTM3 samples per tile side
+const int tiles = 4;            // Tiles per side of the synthetic area (N45E006 to N48E009)
+
+// Synthetic SRTM3 tiles written once in the temporary directory
+std::string srtmLikeDirectory()
+{
+    static const std::string directory = []()
+    {
+        std::filesystem::path dir = std::filesystem::temp_directory_path() / "osl_bench_dem";
+        std::filesystem::create_directories(dir);
+        std::vector<std::int16_t> samples(ns * ns);
+        for (int ilat = 45 ; ilat < 45 + tiles ; ++ilat)
+            for (int ilon = 6 ; ilon < 6 + tiles ; ++ilon)
+            {
+                for (std::size_t i = 0 ; i < ns ; ++i)
+                    for (std::size_t j = 0 ; j < ns ; ++j)
+                    {
+                        double lat = (ilat + 1.0 - double(i) / (ns - 1)) * Constants::m_degtorad,
+                               lon = (ilon + double(j) / (ns - 1)) * Constants::m_degtorad;
+                        samples[i * ns + j] = Endian::swapEndian(static_cast<std::int16_t>(
+                                    std::lround(1500.0 + 1000.0 * std::sin(40.0 * lon) * std::cos(30.0 * lat))));
+                    }
+                char name[16];
+                std::snprintf(name, sizeof(name), "N%02dE%03d.hgt", ilat, ilon);
+                std::ofstream out(dir / name, std::ios::binary);
+                out.write(reinterpret_cast<const char*>(samples.data()),
+                          static_cast<std::streamsize>(samples.size() * sizeof(std::int16_t)));
+            }
+        return dir.string();
+    }();
+    return directory;
+}
+
+// Points along a track crossing the area (few tile changes)
+void trackPoints(vector &lon, vector &lat)
+{
+    lon.resize(n);
+    lat.resize(n);
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double t = double(i) / n;
+        lon[i] = 6.0 + tiles * t;
+        lat[i] = 45.0 + tiles * t * t;
+    }
+}
+
+// Random points on the area (a tile change at almost every point)
+void randomPoints(vector &lon, vector &lat)
+{
+    lon.resize(n);
+    lat.resize(n);
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> ulon(6.0, 6.0 + tiles),
+                                           ulat(45.0, 45.0 + tiles);
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        lon[i] = ulon(gen);
+        lat[i] = ulat(gen);
+    }
+}
+
+void BM_DEMTileCacheTrack(benchmark::State &state)
+{
+    DEMTileCache dem(srtmLikeDirectory(), ns);
+    vector lon, lat, h(n);
+    trackPoints(lon, lat);
+    for (auto _ : state)
+    {
+        dem.height(lon.data(), lat.data(), h.data(), n);
+        benchmark::DoNotOptimize(h.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_DEMTileCacheTrack);
+
+void BM_DEMTileCacheRandom(benchmark::State &state)
+{
+    DEMTileCache dem(srtmLikeDirectory(), ns);
+    vector lon, lat, h(n);
+    randomPoints(lon, lat);
+    for (auto _ : state)
+    {
+        dem.height(lon.data(), lat.data(), h.data(), n);
+        benchmark::DoNotOptimize(h.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_DEMTileCacheRandom);
+
+// Budget of 4 tiles for 16 tiles in use: reloads from the mapped files
+void BM_DEMTileCacheRandomEvicting(benchmark::State &state)
+{
+    DEMTileCache dem(srtmLikeDirectory(), ns, 4 * ns * ns * sizeof(float));
+    vector lon, lat, h(n / 1024);
+    randomPoints(lon, lat);
+    for (auto _ : state)
+    {
+        dem.height(lon.data(), lat.data(), h.data(), h.size());
+        benchmark::DoNotOptimize(h.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * h.size()));
+}
+BENCHMARK(BM_DEMTileCacheRandomEvicting);
+
+} // namespace
@@ -0,0 +1,99 @@
+// ===== BENCHMARK Helmert datum transforms =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using Geography::Clk80IGN;
+using Geography::WGS84;
+using Geography::GRS80;
+using Geography::GeoPoint;
+using Geography::DatumTransform;
+
+const std::size_t n = 65536; // Number of points per iteration
+
+// Random geodetic points of France on the Clarke 1880 IGN ellipsoid
+struct DatumPoints
+{
+    vector lon, lat, alt;
+
+    DatumPoints() : lon(n), lat(n), alt(n)
+    {
+        std::mt19937_64 gen(42);
+        std::uniform_real_distribution<double> ulon(-5.0, 8.0),
+                                               ulat(42.0, 51.0),
+                                               ualt(0.0, 3000.0);
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            lon[i] = ulon(gen);
+            lat[i] = ulat(gen);
+            alt[i] = ualt(gen);
+        }
+    }
+};
+
+// Clarke 1880 IGN -> WGS84 -> GRS80 chain
+DatumTransform chain()
+{
+    DatumTransform ntf(Clk80IGN, WGS84, -168.0, -60.0, 320.0),
+                   grs(WGS84, GRS80, 0.1, -0.2, 0.3, 1e-7, -2e-7, 3e-7, 1e-6);
+    return ntf.then(grs);
+}
+
+// Chain of two GeoPoint::toEllipsoid per point
+void BM_GeoPointToEllipsoidChain(benchmark::State &state)
+{
+    DatumPoints p;
+    vector lat(n);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            GeoPoint q = GeoPoint(Clk80IGN, p.lon[i], p.lat[i], p.alt[i])
+                             .toEllipsoid(WGS84, -168.0, -60.0, 320.0)
+                             .toEllipsoid(GRS80, 0.1, -0.2, 0.3, 1e-7, -2e-7, 3e-7, 1e-6);
+            lat[i] = q.getLat();
+        }
+        benchmark::DoNotOptimize(lat.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeoPointToEllipsoidChain);
+
+void BM_DatumTransformGeodetic(benchmark::State &state)
+{
+    DatumPoints p;
+    DatumTransform t = chain();
+    vector lon(n), lat(n), alt(n);
+    for (auto _ : state)
+    {
+        t.transformGeodetic(p.lon.data(), p.lat.data(), p.alt.data(),
+                            lon.data(), lat.data(), alt.data(), n);
+        benchmark::DoNotOptimize(lat.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_DatumTransformGeodetic);
+
+// Geocentric output only: no iterative geocentric to geodetic transform
+void BM_DatumTransformGeodeticToGeocentric(benchmark::State &state)
+{
+    DatumPoints p;
+    DatumTransform t = chain();
+    vector x(n), y(n), z(n);
+    for (auto _ : state)
+    {
+        t.geodeticToGeocentric(p.lon.data(), p.lat.data(), p.alt.data(),
+                               x.data(), y.data(), z.data(), n);
+        benchmark::DoNotOptimize(z.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_DatumTransformGeodeticToGeocentric);
+
+} // namespace
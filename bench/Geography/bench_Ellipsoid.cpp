@@ -0,0 +1,165 @@
+// ===== BENCHMARK Ellipsoid conversions =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using Geography::WGS84;
+
+const std::size_t n = 65536; // Number of points per iteration
+
+// Random geodetic points over the whole ellipsoid and their geocentric
+// coordinates
+struct GeodeticPoints
+{
+    vector lon, lat, alt, x, y, z;
+
+    GeodeticPoints() : lon(n), lat(n), alt(n), x(n), y(n), z(n)
+    {
+        std::mt19937_64 gen(42);
+        std::uniform_real_distribution<double> ulon(-180.0, 180.0),
+                                               ulat(-90.0, 90.0),
+                                               ualt(-500.0, 9000.0);
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            lon[i] = ulon(gen);
+            lat[i] = ulat(gen);
+            alt[i] = ualt(gen);
+        }
+        WGS84->geodeticToGeocentric(lon.data(), lat.data(), alt.data(),
+                                    x.data(), y.data(), z.data(), n);
+    }
+};
+
+void BM_GeodeticToGeocentricScalar(benchmark::State &state)
+{
+    GeodeticPoints p;
+    vector x(n), y(n), z(n);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+            WGS84->geodeticToGeocentric(p.lon[i], p.lat[i], p.alt[i], x[i], y[i], z[i]);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeodeticToGeocentricScalar);
+
+void BM_GeodeticToGeocentricBatch(benchmark::State &state)
+{
+    GeodeticPoints p;
+    vector x(n), y(n), z(n);
+    for (auto _ : state)
+    {
+        WGS84->geodeticToGeocentric(p.lon.data(), p.lat.data(), p.alt.data(),
+                                    x.data(), y.data(), z.data(), n);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeodeticToGeocentricBatch);
+
+void BM_GeocentricToGeodeticScalar(benchmark::State &state)
+{
+    GeodeticPoints p;
+    vector lon(n), lat(n), alt(n);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+            WGS84->geocentricToGeodetic(p.x[i], p.y[i], p.z[i], lon[i], lat[i], alt[i]);
+        benchmark::DoNotOptimize(lat.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeocentricToGeodeticScalar);
+
+void BM_GeocentricToGeodeticBatch(benchmark::State &state)
+{
+    GeodeticPoints p;
+    vector lon(n), lat(n), alt(n);
+    for (auto _ : state)
+    {
+        WGS84->geocentricToGeodetic(p.x.data(), p.y.data(), p.z.data(),
+                                    lon.data(), lat.data(), alt.data(), n);
+        benchmark::DoNotOptimize(lat.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeocentricToGeodeticBatch);
+
+// Latitude functions, point by point
+#define OSL_BENCH_LATITUDE(Method)                                        \
+    void BM_##Method(benchmark::State &state)                             \
+    {                                                                     \
+        GeodeticPoints p;                                                 \
+        vector r(n);                                                      \
+        for (auto _ : state)                                              \
+        {                                                                 \
+            for (std::size_t i = 0 ; i < n ; ++i)                         \
+                r[i] = WGS84->Method(p.lat[i]);                           \
+            benchmark::DoNotOptimize(r.data());                           \
+            benchmark::ClobberMemory();                                   \
+        }                                                                 \
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n)); \
+    }                                                                     \
+    BENCHMARK(BM_##Method)
+
+OSL_BENCH_LATITUDE(meridianDistance);
+OSL_BENCH_LATITUDE(rectifyingLatitude);
+OSL_BENCH_LATITUDE(inverseRectifyingLatitude);
+OSL_BENCH_LATITUDE(authalicLatitude);
+OSL_BENCH_LATITUDE(inverseAuthalicLatitude);
+OSL_BENCH_LATITUDE(conformalLatitude);
+OSL_BENCH_LATITUDE(inverseConformalLatitude);
+OSL_BENCH_LATITUDE(isometricLatitude);
+OSL_BENCH_LATITUDE(inverseIsometricLatitude);
+
+// Reference meridian distance from the elliptic integral
+void BM_meridianDistanceEllipticIntegral(benchmark::State &state)
+{
+    GeodeticPoints p;
+    vector r(n);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+            r[i] = WGS84->meridianDistance(p.lat[i], true,
+                                           Geography::MeridianDistanceMethod::fromEllipticIntegral);
+        benchmark::DoNotOptimize(r.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_meridianDistanceEllipticIntegral);
+
+// Latitude functions, batch versions
+#define OSL_BENCH_LATITUDE_BATCH(Method)                                  \
+    void BM_##Method##Batch(benchmark::State &state)                      \
+    {                                                                     \
+        GeodeticPoints p;                                                 \
+        vector r(n);                                                      \
+        for (auto _ : state)                                              \
+        {                                                                 \
+            WGS84->Method(p.lat.data(), r.data(), n);                     \
+            benchmark::DoNotOptimize(r.data());                           \
+            benchmark::ClobberMemory();                                   \
+        }                                                                 \
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n)); \
+    }                                                                     \
+    BENCHMARK(BM_##Method##Batch)
+
+OSL_BENCH_LATITUDE_BATCH(meridianDistance);
+OSL_BENCH_LATITUDE_BATCH(rectifyingLatitude);
+OSL_BENCH_LATITUDE_BATCH(inverseRectifyingLatitude);
+OSL_BENCH_LATITUDE_BATCH(inverseAuthalicLatitude);
+OSL_BENCH_LATITUDE_BATCH(conformalLatitude);
+OSL_BENCH_LATITUDE_BATCH(inverseConformalLatitude);
+OSL_BENCH_LATITUDE_BATCH(isometricLatitude);
+OSL_BENCH_LATITUDE_BATCH(inverseIsometricLatitude);
+
+} // namespace
@@ -0,0 +1,83 @@
+// ===== BENCHMARK GeoPoint / GeoPointArray storage =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using Geography::WGS84;
+using Geography::GeoPoint;
+using Geography::GeoPointArray;
+
+const std::size_t n = 65536; // Number of points per iteration
+
+// Random geocentric points near the surface of the ellipsoid
+struct GeocentricPoints
+{
+    vector x, y, z;
+
+    GeocentricPoints() : x(n), y(n), z(n)
+    {
+        std::mt19937_64 gen(42);
+        std::uniform_real_distribution<double> ulon(-180.0, 180.0),
+                                               ulat(-90.0, 90.0),
+                                               ualt(-100.0, 10000.0);
+        vector lon(n), lat(n), alt(n);
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            lon[i] = ulon(gen);
+            lat[i] = ulat(gen);
+            alt[i] = ualt(gen);
+        }
+        WGS84->geodeticToGeocentric(lon, lat, alt, x, y, z);
+    }
+};
+
+// AoS GeoPoint: the geodetic coordinates are computed on each set
+void BM_GeoPointSetGeocentric(benchmark::State &state)
+{
+    GeocentricPoints p;
+    std::vector<GeoPoint> pts(n, GeoPoint(WGS84, 0.0, 0.0, 0.0));
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+            pts[i].setGeocentricCoords(p.x[i], p.y[i], p.z[i]);
+        benchmark::DoNotOptimize(pts.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeoPointSetGeocentric);
+
+// SoA GeoPointArray: the geodetic coordinates are never read
+void BM_GeoPointArraySetGeocentric(benchmark::State &state)
+{
+    GeocentricPoints p;
+    GeoPointArray pts(WGS84);
+    for (auto _ : state)
+    {
+        pts.setGeocentricCoords(p.x, p.y, p.z);
+        benchmark::DoNotOptimize(pts.getX().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeoPointArraySetGeocentric);
+
+// SoA GeoPointArray: the geodetic coordinates are computed in bulk on access
+void BM_GeoPointArraySetGeocentricReadGeodetic(benchmark::State &state)
+{
+    GeocentricPoints p;
+    GeoPointArray pts(WGS84);
+    for (auto _ : state)
+    {
+        pts.setGeocentricCoords(p.x, p.y, p.z);
+        benchmark::DoNotOptimize(pts.getLatRad().data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeoPointArraySetGeocentricReadGeodetic);
+
+} // namespace
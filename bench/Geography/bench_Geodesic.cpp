@@ -0,0 +1,83 @@
+// ===== BENCHMARK Geodesic problems =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using Geography::WGS84;
+
+// Random points over the whole ellipsoid
+struct Points
+{
+    vector lon, lat;
+
+    Points(std::size_t n, unsigned seed) : lon(n), lat(n)
+    {
+        std::mt19937_64 gen(seed);
+        std::uniform_real_distribution<double> ulon(-180.0, 180.0),
+                                               ulat(-90.0, 90.0);
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            lon[i] = ulon(gen);
+            lat[i] = ulat(gen);
+        }
+    }
+};
+
+void BM_GeodesicInverse(benchmark::State &state)
+{
+    const std::size_t n = 4096;
+    Geography::Geodesic geod(WGS84);
+    Points p1(n, 42), p2(n, 43);
+    vector s12(n);
+    double azi1, azi2;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+            s12[i] = geod.inverse(p1.lon[i], p1.lat[i], p2.lon[i], p2.lat[i], azi1, azi2);
+        benchmark::DoNotOptimize(s12.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeodesicInverse);
+
+void BM_GeodesicDirect(benchmark::State &state)
+{
+    const std::size_t n = 4096;
+    Geography::Geodesic geod(WGS84);
+    Points p(n, 42);
+    vector lon2(n), lat2(n);
+    double azi2;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+            geod.direct(p.lon[i], p.lat[i], p.lon[i], 1.0e6, lon2[i], lat2[i], azi2);
+        benchmark::DoNotOptimize(lat2.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeodesicDirect);
+
+// Targets x ground stations distance matrix
+void BM_GeodesicDistanceMatrix(benchmark::State &state)
+{
+    const std::size_t n1 = static_cast<std::size_t>(state.range(0)),
+                      n2 = static_cast<std::size_t>(state.range(1));
+    Geography::Geodesic geod(WGS84);
+    Points p1(n1, 42), p2(n2, 43);
+    vector s12;
+    for (auto _ : state)
+    {
+        geod.distanceMatrix(p1.lon, p1.lat, p2.lon, p2.lat, s12);
+        benchmark::DoNotOptimize(s12.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n1 * n2));
+}
+BENCHMARK(BM_GeodesicDistanceMatrix)->Args({256, 16})->Args({1024, 64});
+
+} // namespace
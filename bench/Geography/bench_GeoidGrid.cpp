@@ -0,0 +1,92 @@
+// ===== BENCHMARK GeoidGrid undulation lookups =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using Geography::GeoidGrid;
+using Geography::GeoidGridType;
+using Geography::GeoidInterpolation;
+
+const std::size_t n = 65536; // Number of points per iteration
+
+// Synthetic EGM96-like 15' grid: 721 rows of 1440 big-endian int16 in cm
+const GeoidGrid &egmLikeGrid()
+{
+    static const GeoidGrid grid = []()
+    {
+        const std::size_t nlon = 1440, nlat = 721;
+        std::string path = (std::filesystem::temp_directory_path() / "osl_bench_geoid.bin").string();
+        std::ofstream out(path, std::ios::binary);
+        for (std::size_t i = 0 ; i < nlat ; ++i)
+            for (std::size_t j = 0 ; j < nlon ; ++j)
+            {
+                double lat = (90.0 - 0.25 * i) * Constants::m_degtorad,
+                       lon = 0.25 * j * Constants::m_degtorad;
+                std::int16_t v = static_cast<std::int16_t>(
+                            std::lround(3000.0 * std::sin(3.0 * lon) * std::cos(2.0 * lat)));
+                v = Endian::swapEndian(v);
+                out.write(reinterpret_cast<const char*>(&v), sizeof(v));
+            }
+        out.close();
+        return GeoidGrid(path, nlon, nlat, 0.0, 90.0, 0.25, -0.25,
+                         GeoidGridType::int16, Endian::Endianness::big, 0.01);
+    }();
+    return grid;
+}
+
+// Random points on the whole Earth
+struct GeoidPoints
+{
+    vector lon, lat;
+
+    GeoidPoints() : lon(n), lat(n)
+    {
+        std::mt19937_64 gen(42);
+        std::uniform_real_distribution<double> ulon(-180.0, 180.0),
+                                               ulat(-90.0, 90.0);
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            lon[i] = ulon(gen);
+            lat[i] = ulat(gen);
+        }
+    }
+};
+
+void BM_GeoidGridBilinear(benchmark::State &state)
+{
+    const GeoidGrid &grid = egmLikeGrid();
+    GeoidPoints p;
+    vector N(n);
+    for (auto _ : state)
+    {
+        grid.undulation(p.lon.data(), p.lat.data(), N.data(), n);
+        benchmark::DoNotOptimize(N.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeoidGridBilinear);
+
+void BM_GeoidGridBicubic(benchmark::State &state)
+{
+    const GeoidGrid &grid = egmLikeGrid();
+    GeoidPoints p;
+    vector N(n);
+    for (auto _ : state)
+    {
+        grid.undulation(p.lon.data(), p.lat.data(), N.data(), n,
+                        true, GeoidInterpolation::bicubic);
+        benchmark::DoNotOptimize(N.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeoidGridBicubic);
+
+} // namespace
@@ -0,0 +1,136 @@
+// ===== BENCHMARK LocalNED / LocalENU / LocalFramePipeline transforms =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using Geography::WGS84;
+using Geography::LocalCartesian::LocalNED;
+using Geography::LocalCartesian::LocalFramePipeline;
+
+const std::size_t n = 1 << 20; // Number of points per iteration
+
+// Random point cloud within 5 km of the origin of a local NED frame
+struct PointCloud
+{
+    LocalNED ned;
+    vector x, y, z, lon, lat, alt;
+
+    PointCloud() : ned(WGS84, 2.35, 48.85, 35.0), x(n), y(n), z(n), lon(n), lat(n), alt(n)
+    {
+        std::mt19937_64 gen(42);
+        std::uniform_real_distribution<double> u(-5000.0, 5000.0);
+        vector xn(n), yn(n), zn(n);
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            xn[i] = u(gen);
+            yn[i] = u(gen);
+            zn[i] = 0.01 * u(gen);
+        }
+        ned.NEDPointToGeocentricPoint(xn.data(), yn.data(), zn.data(),
+                                      x.data(), y.data(), z.data(), n);
+        WGS84->geocentricToGeodetic(x.data(), y.data(), z.data(),
+                                    lon.data(), lat.data(), alt.data(), n);
+    }
+};
+
+void BM_LocalNEDPointScalar(benchmark::State &state)
+{
+    PointCloud p;
+    vector xn(n), yn(n), zn(n);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+            p.ned.geocentricPointToNEDPoint(p.x[i], p.y[i], p.z[i], xn[i], yn[i], zn[i]);
+        benchmark::DoNotOptimize(zn.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_LocalNEDPointScalar);
+
+void BM_LocalNEDPointBatch(benchmark::State &state)
+{
+    PointCloud p;
+    vector xn(n), yn(n), zn(n);
+    for (auto _ : state)
+    {
+        p.ned.geocentricPointToNEDPoint(p.x.data(), p.y.data(), p.z.data(),
+                                        xn.data(), yn.data(), zn.data(), n);
+        benchmark::DoNotOptimize(zn.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_LocalNEDPointBatch);
+
+void BM_LocalNEDInversePointBatch(benchmark::State &state)
+{
+    PointCloud p;
+    vector xn(n), yn(n), zn(n), x(n), y(n), z(n);
+    p.ned.geocentricPointToNEDPoint(p.x.data(), p.y.data(), p.z.data(),
+                                    xn.data(), yn.data(), zn.data(), n);
+    for (auto _ : state)
+    {
+        p.ned.NEDPointToGeocentricPoint(xn.data(), yn.data(), zn.data(),
+                                        x.data(), y.data(), z.data(), n);
+        benchmark::DoNotOptimize(z.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_LocalNEDInversePointBatch);
+
+// Geodetic -> NED in two passes through intermediate geocentric arrays
+void BM_GeodeticToNEDTwoPass(benchmark::State &state)
+{
+    PointCloud p;
+    vector x(n), y(n), z(n), xn(n), yn(n), zn(n);
+    for (auto _ : state)
+    {
+        WGS84->geodeticToGeocentric(p.lon.data(), p.lat.data(), p.alt.data(),
+                                    x.data(), y.data(), z.data(), n);
+        p.ned.geocentricPointToNEDPoint(x.data(), y.data(), z.data(),
+                                        xn.data(), yn.data(), zn.data(), n);
+        benchmark::DoNotOptimize(zn.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeodeticToNEDTwoPass);
+
+void BM_GeodeticToNEDFused(benchmark::State &state)
+{
+    PointCloud p;
+    vector xn(n), yn(n), zn(n);
+    for (auto _ : state)
+    {
+        p.ned.geodeticPointToNEDPoint(p.lon.data(), p.lat.data(), p.alt.data(),
+                                      xn.data(), yn.data(), zn.data(), n);
+        benchmark::DoNotOptimize(zn.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeodeticToNEDFused);
+
+void BM_GeodeticToBodyPipeline(benchmark::State &state)
+{
+    PointCloud p;
+    LocalFramePipeline pipe(p.ned);
+    pipe.append(Geometry::Rotation3D("zyx", 30.0, 5.0, -2.0));
+    vector xb(n), yb(n), zb(n);
+    for (auto _ : state)
+    {
+        pipe.geodeticToOutput(p.lon.data(), p.lat.data(), p.alt.data(),
+                              xb.data(), yb.data(), zb.data(), n);
+        benchmark::DoNotOptimize(zb.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_GeodeticToBodyPipeline);
+
+} // namespace
@@ -0,0 +1,120 @@
+// ===== BENCHMARK ray / terrain intersection =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using Geography::TerrainIntersector;
+using Geography::WGS84;
+
+const std::size_t nodes = 1201;          // Nodes per side of the 2° x 2° terrain (SRTM3 spacing)
+const double lon0 = 6.0, lat0 = 45.0,
+             step = 2.0 / (nodes - 1);   // [deg]
+
+// Synthetic mountains from 0 to 3000 m
+const TerrainIntersector &mountains()
+{
+    static const TerrainIntersector terrain = []()
+    {
+        vector h(nodes * nodes);
+        for (std::size_t i = 0 ; i < nodes ; ++i)
+            for (std::size_t j = 0 ; j < nodes ; ++j)
+            {
+                double lat = lat0 + i * step, lon = lon0 + j * step;
+                h[i * nodes + j] = 1500.0 + 1200.0 * std::sin(9.0 * lon) * std::cos(7.0 * lat) +
+                                   300.0 * std::sin(40.0 * lon + 3.0 * lat);
+            }
+        return TerrainIntersector(WGS84, h, nodes, nodes, lon0, lat0, step, step);
+    }();
+    return terrain;
+}
+
+// Lines of sight from a sensor 700 km above the terrain
+struct LinesOfSight
+{
+    vector ox, oy, oz, dx, dy, dz;
+
+    explicit LinesOfSight(std::size_t n) : ox(n), oy(n), oz(n), dx(n), dy(n), dz(n)
+    {
+        double sx, sy, sz;
+        WGS84->geodeticToGeocentric(7.0, 46.0, 700e3, sx, sy, sz, true);
+        std::mt19937_64 gen(42);
+        std::uniform_real_distribution<double> ulon(6.05, 7.95),
+                                               ulat(45.05, 46.95);
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            double x, y, z;
+            WGS84->geodeticToGeocentric(ulon(gen), ulat(gen), 0.0, x, y, z, true);
+            ox[i] = sx; oy[i] = sy; oz[i] = sz;
+            dx[i] = x - sx; dy[i] = y - sy; dz[i] = z - sz;
+        }
+    }
+};
+
+// Reference: steps of half a grid cell from the sensor, then bisection
+double bruteForce(const TerrainIntersector &terrain,
+                  const double &ox, const double &oy, const double &oz,
+                  const double &dx, const double &dy, const double &dz)
+{
+    const double dn = std::sqrt(dx * dx + dy * dy + dz * dz),
+                 dt = 0.5 * step * Constants::m_degtorad * 6335439.0 *
+                      std::cos(47.0 * Constants::m_degtorad) / dn;
+    auto below = [&](const double &t)
+    {
+        double x = ox + t * dx, y = oy + t * dy, z = oz + t * dz, lon, lat, h;
+        WGS84->geocentricToGeodetic(&x, &y, &z, &lon, &lat, &h, 1, true);
+        return h < terrain.height(lon, lat); // False outside of the terrain (NaN)
+    };
+    for (double t = dt ; t < 2.0 ; t += dt)
+        if (below(t))
+        {
+            double ta = t - dt, tb = t;
+            while ((tb - ta) * dn > terrain.getTolerance())
+            {
+                double tm = 0.5 * (ta + tb);
+                (below(tm) ? tb : ta) = tm;
+            }
+            return 0.5 * (ta + tb);
+        }
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
+void BM_TerrainIntersectBruteForce(benchmark::State &state)
+{
+    const TerrainIntersector &terrain = mountains();
+    const std::size_t n = 256;
+    LinesOfSight los(n);
+    vector t(n);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+            t[i] = bruteForce(terrain, los.ox[i], los.oy[i], los.oz[i],
+                              los.dx[i], los.dy[i], los.dz[i]);
+        benchmark::DoNotOptimize(t.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_TerrainIntersectBruteForce)->Unit(benchmark::kMillisecond);
+
+void BM_TerrainIntersectPyramid(benchmark::State &state)
+{
+    const TerrainIntersector &terrain = mountains();
+    const std::size_t n = 65536;
+    LinesOfSight los(n);
+    vector t(n), px(n), py(n), pz(n);
+    for (auto _ : state)
+    {
+        terrain.intersect(los.ox.data(), los.oy.data(), los.oz.data(),
+                          los.dx.data(), los.dy.data(), los.dz.data(), n,
+                          t.data(), px.data(), py.data(), pz.data());
+        benchmark::DoNotOptimize(t.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_TerrainIntersectPyramid)->Unit(benchmark::kMillisecond);
+
+} // namespace
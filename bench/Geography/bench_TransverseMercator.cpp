@@ -0,0 +1,91 @@
+// ===== BENCHMARK Transverse Mercator projection =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using Geography::WGS84;
+
+const std::size_t n = 65536; // Number of points per iteration
+
+// Random points of the UTM zone 31 and their projected coordinates
+struct ZonePoints
+{
+    Geography::UTM utm;
+    vector lon, lat, x, y;
+
+    ZonePoints() : utm(WGS84, 31), lon(n), lat(n), x(n), y(n)
+    {
+        std::mt19937_64 gen(42);
+        std::uniform_real_distribution<double> ulon(0.0, 6.0),
+                                               ulat(-80.0, 84.0);
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            lon[i] = ulon(gen);
+            lat[i] = ulat(gen);
+        }
+        utm.forward(lon.data(), lat.data(), x.data(), y.data(), n);
+    }
+};
+
+void BM_TransverseMercatorForwardScalar(benchmark::State &state)
+{
+    ZonePoints p;
+    vector x(n), y(n);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+            p.utm.forward(p.lon[i], p.lat[i], x[i], y[i]);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_TransverseMercatorForwardScalar);
+
+void BM_TransverseMercatorForwardBatch(benchmark::State &state)
+{
+    ZonePoints p;
+    vector x(n), y(n);
+    for (auto _ : state)
+    {
+        p.utm.forward(p.lon.data(), p.lat.data(), x.data(), y.data(), n);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_TransverseMercatorForwardBatch);
+
+void BM_TransverseMercatorInverseScalar(benchmark::State &state)
+{
+    ZonePoints p;
+    vector lon(n), lat(n);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+            p.utm.inverse(p.x[i], p.y[i], lon[i], lat[i]);
+        benchmark::DoNotOptimize(lat.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_TransverseMercatorInverseScalar);
+
+void BM_TransverseMercatorInverseBatch(benchmark::State &state)
+{
+    ZonePoints p;
+    vector lon(n), lat(n);
+    for (auto _ : state)
+    {
+        p.utm.inverse(p.x.data(), p.y.data(), lon.data(), lat.data(), n);
+        benchmark::DoNotOptimize(lat.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_TransverseMercatorInverseBatch);
+
+} // namespace
@@ -0,0 +1,77 @@
+// ===== BENCHMARK attitude interpolation =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+
+namespace {
+
+using namespace Osl;
+using namespace Osl::Geometry;
+using Interpolator3D::AttitudeSpline3D;
+using Interpolator3D::AttitudeInterpolation;
+
+const std::size_t nodes = 1001;   // Attitude samples (1 Hz)
+const std::size_t npulse = 65536; // Pulses per iteration
+
+struct Attitudes
+{
+    vector t, yaw, pitch, roll, tp;
+
+    Attitudes() : t(nodes), yaw(nodes), pitch(nodes), roll(nodes), tp(npulse)
+    {
+        for (std::size_t i = 0 ; i < nodes ; ++i)
+        {
+            t[i] = static_cast<double>(i);
+            yaw[i] = 30.0 * std::sin(0.01 * t[i]);
+            pitch[i] = 5.0 * std::cos(0.02 * t[i]);
+            roll[i] = 2.0 * std::sin(0.05 * t[i]);
+        }
+        for (std::size_t k = 0 ; k < npulse ; ++k) // Sorted pulse times
+            tp[k] = (nodes - 1) * static_cast<double>(k) / npulse;
+    }
+};
+
+// Reference: Euler angles interpolated by cubic splines, rotation built per pulse
+void BM_AttitudeEulerCubicSplines(benchmark::State &state)
+{
+    Attitudes att;
+    Maths::Interpolator::CubicSpline syaw(att.t, att.yaw), spitch(att.t, att.pitch),
+                                     sroll(att.t, att.roll);
+    std::vector<Rotation3D> rot(npulse);
+    for (auto _ : state)
+    {
+        for (std::size_t k = 0 ; k < npulse ; ++k)
+        {
+            double y, p, r;
+            syaw(att.tp[k], y);
+            spitch(att.tp[k], p);
+            sroll(att.tp[k], r);
+            rot[k] = Rotation3D("zyx", y, p, r);
+        }
+        benchmark::DoNotOptimize(rot.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * npulse));
+}
+BENCHMARK(BM_AttitudeEulerCubicSplines)->Unit(benchmark::kMillisecond);
+
+void BM_AttitudeSpline3D(benchmark::State &state)
+{
+    Attitudes att;
+    std::vector<Quaternion> q(nodes);
+    for (std::size_t i = 0 ; i < nodes ; ++i)
+        q[i] = Quaternion("zyx", att.yaw[i], att.pitch[i], att.roll[i]);
+    AttitudeSpline3D spline(att.t, q, static_cast<AttitudeInterpolation>(state.range(0)));
+    std::vector<Rotation3D> rot(npulse);
+    for (auto _ : state)
+    {
+        spline.evaluate(att.tp.data(), rot.data(), npulse, true);
+        benchmark::DoNotOptimize(rot.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * npulse));
+}
+BENCHMARK(BM_AttitudeSpline3D)->Arg(static_cast<int>(AttitudeInterpolation::slerp))
+                              ->Arg(static_cast<int>(AttitudeInterpolation::squad))
+                              ->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,112 @@
+// ===== BENCHMARK batched ray / Earth ellipsoid intersection =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using namespace Osl::Geometry;
+using namespace Osl::Geometry::Shape3D;
+
+// Reference per-ray intersection built on Maths::Roots::quadratic_roots
+bool legacy_intersect(const Line3D &ray,
+                      const double &a, const double &b, const double &c,
+                      double &t)
+{
+    Vector3D o = ray.getPoint(), d = ray.getDirection();
+    double ox, oy, oz, dx, dy, dz;
+    o.getCoordinates(ox, oy, oz);
+    d.getCoordinates(dx, dy, dz);
+    double a2 = dx * dx / (a * a) + dy * dy / (b * b) + dz * dz / (c * c),
+           a1 = 2.0 * (ox * dx / (a * a) + oy * dy / (b * b) + oz * dz / (c * c)),
+           a0 = ox * ox / (a * a) + oy * oy / (b * b) + oz * oz / (c * c) - 1.0;
+    complex t1, t2;
+    Maths::Roots::quadratic_roots(a2, a1, a0, t1, t2);
+    if (t1.imag() != 0.0)
+        return false;
+    double tn = std::min(t1.real(), t2.real()), tf = std::max(t1.real(), t2.real());
+    t = (tn >= 0.0) ? tn : tf;
+    return t >= 0.0;
+}
+
+const std::size_t n = 65536; // Number of rays per iteration
+const double a = 6378137.0, c = 6356752.314245;
+
+// Lines of sight from a 700 km orbit, pointing around the nadir
+struct LinesOfSight
+{
+    std::vector<Line3D> rays;
+    vector ox, oy, oz, dx, dy, dz;
+
+    LinesOfSight() : rays(n), ox(n), oy(n), oz(n), dx(n), dy(n), dz(n)
+    {
+        std::mt19937_64 gen(42);
+        std::uniform_real_distribution<double> ulon(-Constants::m_pi, Constants::m_pi),
+                                               ulat(-1.5, 1.5),
+                                               uoff(-0.15, 0.15);
+        for (std::size_t i = 0 ; i < n ; ++i)
+        {
+            double lon = ulon(gen), lat = ulat(gen), r = a + 700e3;
+            ox[i] = r * std::cos(lat) * std::cos(lon);
+            oy[i] = r * std::cos(lat) * std::sin(lon);
+            oz[i] = r * std::sin(lat);
+            dx[i] = -std::cos(lat) * std::cos(lon) + uoff(gen);
+            dy[i] = -std::cos(lat) * std::sin(lon) + uoff(gen);
+            dz[i] = -std::sin(lat) + uoff(gen);
+            rays[i] = Line3D(Vector3D(ox[i], oy[i], oz[i]), Vector3D(dx[i], dy[i], dz[i]));
+        }
+    }
+};
+
+// Per-ray scalar code on quadratic_roots
+void BM_EllipsoidIntersectLegacy(benchmark::State &state)
+{
+    LinesOfSight los;
+    vector t(n);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < n ; ++i)
+            legacy_intersect(los.rays[i], a, a, c, t[i]);
+        benchmark::DoNotOptimize(t.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_EllipsoidIntersectLegacy);
+
+// Batched kernel from an array of Line3D
+void BM_EllipsoidIntersectLine3D(benchmark::State &state)
+{
+    LinesOfSight los;
+    Ellipsoid3D earth(NULL_VEC, a, a, c);
+    vector t(n), px(n), py(n), pz(n);
+    for (auto _ : state)
+    {
+        earth.intersect(los.rays.data(), n, t.data(), px.data(), py.data(), pz.data());
+        benchmark::DoNotOptimize(t.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_EllipsoidIntersectLine3D)->UseRealTime();
+
+// Batched kernel in SoA layout
+void BM_EllipsoidIntersectSoA(benchmark::State &state)
+{
+    LinesOfSight los;
+    Ellipsoid3D earth(NULL_VEC, a, a, c);
+    vector t(n), px(n), py(n), pz(n);
+    for (auto _ : state)
+    {
+        earth.intersect(los.ox.data(), los.oy.data(), los.oz.data(),
+                        los.dx.data(), los.dy.data(), los.dz.data(), n,
+                        t.data(), px.data(), py.data(), pz.data());
+        benchmark::DoNotOptimize(t.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_EllipsoidIntersectSoA)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,111 @@
+// ===== BENCHMARK Quaternion composition and batch rotations =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using namespace Osl::Geometry;
+
+const std::size_t nr = 4096;  // Number of rotations per iteration
+const std::size_t nv = 65536; // Number of vectors per batch
+
+// Same composition as BM_Rotation3DCompose
+void BM_QuaternionCompose(benchmark::State &state)
+{
+    Quaternion step("zyx", 1e-3, 2e-3, -1e-3), acc;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nr ; ++i)
+            acc *= step;
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nr));
+}
+BENCHMARK(BM_QuaternionCompose);
+
+struct Vectors
+{
+    vector x, y, z, rx, ry, rz;
+    vector3d vecs, rvecs;
+
+    Vectors() : x(nv), y(nv), z(nv), rx(nv), ry(nv), rz(nv), vecs(nv), rvecs(nv)
+    {
+        std::mt19937_64 gen(1);
+        std::uniform_real_distribution<double> u(-1.0, 1.0);
+        for (std::size_t i = 0 ; i < nv ; ++i)
+        {
+            x[i] = u(gen); y[i] = u(gen); z[i] = u(gen);
+            vecs[i] = Vector3D(x[i], y[i], z[i]);
+        }
+    }
+};
+
+// Reference: one rotation matrix applied to each Vector3D
+void BM_Rotation3DRotateVectors(benchmark::State &state)
+{
+    Vectors v;
+    Rotation3D rot("zyx", 30.0, 20.0, -10.0);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nv ; ++i)
+            v.rvecs[i] = rot * v.vecs[i];
+        benchmark::DoNotOptimize(v.rvecs.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nv));
+}
+BENCHMARK(BM_Rotation3DRotateVectors);
+
+void BM_QuaternionRotateSoA(benchmark::State &state)
+{
+    Vectors v;
+    Quaternion q("zyx", 30.0, 20.0, -10.0);
+    for (auto _ : state)
+    {
+        q.rotate(v.x.data(), v.y.data(), v.z.data(), nv, v.rx.data(), v.ry.data(), v.rz.data());
+        benchmark::DoNotOptimize(v.rx.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nv));
+}
+BENCHMARK(BM_QuaternionRotateSoA);
+
+// Reference: one rotation matrix per vector, built from the attitude angles
+void BM_Rotation3DRotatePerElement(benchmark::State &state)
+{
+    Vectors v;
+    std::vector<Rotation3D> rots(nv);
+    for (std::size_t i = 0 ; i < nv ; ++i)
+        rots[i] = Rotation3D("zyx", 1e-3 * i, 20.0, -10.0);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nv ; ++i)
+            v.rvecs[i] = rots[i] * v.vecs[i];
+        benchmark::DoNotOptimize(v.rvecs.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nv));
+}
+BENCHMARK(BM_Rotation3DRotatePerElement);
+
+void BM_QuaternionRotatePerElementSoA(benchmark::State &state)
+{
+    Vectors v;
+    vector qw(nv), qx(nv), qy(nv), qz(nv);
+    for (std::size_t i = 0 ; i < nv ; ++i)
+        Quaternion("zyx", 1e-3 * i, 20.0, -10.0).getCoefficients(qw[i], qx[i], qy[i], qz[i]);
+    for (auto _ : state)
+    {
+        Quaternion::rotate(qw.data(), qx.data(), qy.data(), qz.data(),
+                           v.x.data(), v.y.data(), v.z.data(), nv,
+                           v.rx.data(), v.ry.data(), v.rz.data());
+        benchmark::DoNotOptimize(v.rx.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nv));
+}
+BENCHMARK(BM_QuaternionRotatePerElementSoA);
+
+} // namespace
@@ -0,0 +1,155 @@
+// ===== BENCHMARK Rotation3D composition and application =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+
+namespace {
+
+using namespace Osl;
+using namespace Osl::Geometry;
+
+const std::size_t nr = 4096; // Number of rotations per iteration
+
+// Reference product with the former heap allocated storage (Osl::matrix)
+matrix legacy_product(const matrix &a, const matrix &b)
+{
+    matrix rot{{0.0, 0.0, 0.0},
+               {0.0, 0.0, 0.0},
+               {0.0, 0.0, 0.0}};
+    for (std::size_t row = 0 ; row < 3 ; ++row)
+        for (std::size_t col = 0 ; col < 3 ; ++col)
+            for (std::size_t k = 0 ; k < 3 ; ++k)
+                rot[row][col] += a[row][k] * b[k][col];
+    return rot;
+}
+
+void BM_Rotation3DComposeLegacy(benchmark::State &state)
+{
+    matrix step = Rotation3D("zyx", 1e-3, 2e-3, -1e-3).getMatrix(),
+           acc = Identity.getMatrix();
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nr ; ++i)
+            acc = legacy_product(acc, step);
+        benchmark::DoNotOptimize(acc.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nr));
+}
+BENCHMARK(BM_Rotation3DComposeLegacy);
+
+void BM_Rotation3DCompose(benchmark::State &state)
+{
+    Rotation3D step("zyx", 1e-3, 2e-3, -1e-3), acc;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nr ; ++i)
+            acc *= step;
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nr));
+}
+BENCHMARK(BM_Rotation3DCompose);
+
+void BM_Rotation3DApply(benchmark::State &state)
+{
+    Rotation3D step("zyx", 1e-3, 2e-3, -1e-3);
+    Vector3D vec(1.0, 0.0, 0.0);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nr ; ++i)
+            vec = step * vec;
+        benchmark::DoNotOptimize(vec);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nr));
+}
+BENCHMARK(BM_Rotation3DApply);
+
+// Construction from an Euler angles convention
+void BM_Rotation3DFromEuler(benchmark::State &state)
+{
+    double a = 0.0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nr ; ++i)
+        {
+            a += 1e-3;
+            Rotation3D rot("zyx", a, 2e-3, -1e-3);
+            benchmark::DoNotOptimize(rot);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nr));
+}
+BENCHMARK(BM_Rotation3DFromEuler);
+
+// Same with the convention known at compile time
+void BM_Rotation3DFromEulerTemplate(benchmark::State &state)
+{
+    double a = 0.0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nr ; ++i)
+        {
+            a += 1e-3;
+            Rotation3D rot = Rotation3D::fromEuler<EulerConvention::zyx>(a, 2e-3, -1e-3);
+            benchmark::DoNotOptimize(rot);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nr));
+}
+BENCHMARK(BM_Rotation3DFromEulerTemplate);
+
+// Batch conversion of navigation samples (heading, pitch, roll)
+void BM_Rotation3DFromEulerBatch(benchmark::State &state)
+{
+    vector a1(nr), a2(nr), a3(nr);
+    for (std::size_t i = 0 ; i < nr ; ++i)
+    {
+        a1[i] = 1e-3 * static_cast<double>(i);
+        a2[i] = 2e-3;
+        a3[i] = -1e-3;
+    }
+    std::vector<Rotation3D> rot(nr);
+    for (auto _ : state)
+    {
+        Rotation3D::fromEuler<EulerConvention::zyx>(a1.data(), a2.data(), a3.data(), nr, rot.data());
+        benchmark::DoNotOptimize(rot.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nr));
+}
+BENCHMARK(BM_Rotation3DFromEulerBatch);
+
+// Extraction of Euler angles
+void BM_Rotation3DEulerAngles(benchmark::State &state)
+{
+    Rotation3D rot("zyx", 30.0, 20.0, 10.0);
+    double a1, a2, a3;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nr ; ++i)
+        {
+            benchmark::DoNotOptimize(rot);
+            rot.eulerAngles("zyx", a1, a2, a3);
+            benchmark::DoNotOptimize(a1);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nr));
+}
+BENCHMARK(BM_Rotation3DEulerAngles);
+
+void BM_Rotation3DEulerAnglesTemplate(benchmark::State &state)
+{
+    Rotation3D rot("zyx", 30.0, 20.0, 10.0);
+    double a1, a2, a3;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nr ; ++i)
+        {
+            benchmark::DoNotOptimize(rot);
+            rot.eulerAngles<EulerConvention::zyx>(a1, a2, a3);
+            benchmark::DoNotOptimize(a1);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nr));
+}
+BENCHMARK(BM_Rotation3DEulerAnglesTemplate);
+
+} // namespace
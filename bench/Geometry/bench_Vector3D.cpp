@@ -0,0 +1,108 @@
+// ===== BENCHMARK Vector3D arithmetic over arrays of vectors =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using namespace Osl::Geometry;
+
+const std::size_t nv = 4096; // Number of vectors per iteration
+
+vector3d make_vectors(std::uint64_t seed)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> u(-1.0, 1.0);
+    vector3d v(nv);
+    for (std::size_t i = 0 ; i < nv ; ++i)
+        v[i] = Vector3D(u(gen), u(gen), u(gen));
+    return v;
+}
+
+// r = a + b * s - c
+void BM_Vector3DAxpy(benchmark::State &state)
+{
+    vector3d a = make_vectors(1), b = make_vectors(2), c = make_vectors(3), r(nv);
+    const double s = 0.01;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nv ; ++i)
+            r[i] = a[i] + b[i] * s - c[i];
+        benchmark::DoNotOptimize(r.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nv));
+}
+BENCHMARK(BM_Vector3DAxpy);
+
+void BM_Vector3DDotProduct(benchmark::State &state)
+{
+    vector3d a = make_vectors(1), b = make_vectors(2);
+    for (auto _ : state)
+    {
+        double acc = 0.0;
+        for (std::size_t i = 0 ; i < nv ; ++i)
+            acc += a[i].dotProduct(b[i]);
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nv));
+}
+BENCHMARK(BM_Vector3DDotProduct);
+
+void BM_Vector3DCrossProduct(benchmark::State &state)
+{
+    vector3d a = make_vectors(1), b = make_vectors(2), r(nv);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nv ; ++i)
+            r[i] = a[i].crossProduct(b[i]);
+        benchmark::DoNotOptimize(r.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nv));
+}
+BENCHMARK(BM_Vector3DCrossProduct);
+
+void BM_Vector3DNormalized(benchmark::State &state)
+{
+    vector3d a = make_vectors(1), r(nv);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nv ; ++i)
+            r[i] = a[i].normalized();
+        benchmark::DoNotOptimize(r.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nv));
+}
+BENCHMARK(BM_Vector3DNormalized);
+
+// Keplerian trajectories of satellites (second order time step)
+void BM_Vector3DTrajectory(benchmark::State &state)
+{
+    const double mu = 3.986004418e14, dt = 1.0; // [m^3/s^2], [s]
+    vector3d p = make_vectors(1), v = make_vectors(2);
+    for (std::size_t i = 0 ; i < nv ; ++i)
+    {
+        p[i] = 7.0e6 * p[i].normalized();
+        v[i] = 7.5e3 * p[i].crossProduct(v[i]).crossProduct(p[i]).normalized();
+    }
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nv ; ++i)
+        {
+            const double r2 = p[i].norm2();
+            const Vector3D acc = p[i] * (-mu / (r2 * std::sqrt(r2)));
+            p[i] += v[i] * dt + acc * (0.5 * dt * dt);
+            v[i] += acc * dt;
+        }
+        benchmark::DoNotOptimize(p.data());
+        benchmark::DoNotOptimize(v.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nv));
+}
+BENCHMARK(BM_Vector3DTrajectory);
+
+} // namespace
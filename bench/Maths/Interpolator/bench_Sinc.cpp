@@ -0,0 +1,88 @@
+// ===== BENCHMARK full and windowed sinc interpolators =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using namespace Osl::Maths;
+
+const std::size_t nq = 1024; // Number of evaluated points per iteration
+
+// Band-limited signal on m evenly spaced points and random query points
+void make_signal(std::size_t m, vector &x, vector &y, vector &xq)
+{
+    x.resize(m);
+    y.resize(m);
+    for (std::size_t i = 0 ; i < m ; ++i)
+    {
+        x[i] = static_cast<double>(i) * 0.1;
+        y[i] = std::cos(2.0 * x[i]);
+    }
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> ux(x.front(), x.back());
+    xq.resize(nq);
+    for (std::size_t i = 0 ; i < nq ; ++i)
+        xq[i] = ux(gen);
+}
+
+// Full sinc interpolation, O(m) per point
+void BM_Sinc(benchmark::State &state)
+{
+    vector x, y, xq, yq(nq);
+    make_signal(static_cast<std::size_t>(state.range(0)), x, y, xq);
+    Interpolator::Sinc f(x, y);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nq ; ++i)
+            f(xq[i], yq[i]);
+        benchmark::DoNotOptimize(yq.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nq));
+}
+BENCHMARK(BM_Sinc)->Arg(256)->Arg(4096)->ArgName("size");
+
+// Windowed sinc interpolation, O(halfWidth) per point
+void BM_WindowedSinc(benchmark::State &state)
+{
+    vector x, y, xq, yq(nq);
+    make_signal(65536, x, y, xq);
+    Interpolator::WindowedSinc f(x, y, static_cast<std::size_t>(state.range(0)),
+                                 static_cast<Interpolator::SincWindow>(state.range(1)));
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nq ; ++i)
+            f(xq[i], yq[i]);
+        benchmark::DoNotOptimize(yq.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nq));
+}
+BENCHMARK(BM_WindowedSinc)
+    ->ArgsProduct({{4, 8, 16},
+                   {static_cast<int64_t>(Interpolator::SincWindow::lanczos),
+                    static_cast<int64_t>(Interpolator::SincWindow::kaiser)}})
+    ->ArgNames({"halfWidth", "window"});
+
+void BM_ComplexWindowedSinc(benchmark::State &state)
+{
+    vector x, y, xq;
+    make_signal(65536, x, y, xq);
+    cvector yc(x.size()), yq(nq);
+    for (std::size_t i = 0 ; i < x.size() ; ++i)
+        yc[i] = std::polar(1.0, 2.0 * x[i]);
+    Interpolator::ComplexWindowedSinc f(x, yc, static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nq ; ++i)
+            f(xq[i], yq[i]);
+        benchmark::DoNotOptimize(yq.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nq));
+}
+BENCHMARK(BM_ComplexWindowedSinc)->Arg(8)->ArgName("halfWidth");
+
+} // namespace
@@ -0,0 +1,160 @@
+// ===== BENCHMARK 1D and 3D spline interpolators per type and table size =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <algorithm>
+
+namespace {
+
+using namespace Osl;
+using namespace Osl::Maths;
+
+const std::size_t nq = 4096; // Number of evaluated points per iteration
+
+// Samples of the interpolated function (real or complex)
+template<class T> T sample(const double &x);
+template<> double sample<double>(const double &x) { return std::sin(x); }
+template<> complex sample<complex>(const double &x) { return std::polar(1.0, x); }
+
+// Table of m points, evenly spaced or jittered, and nq random query points
+template<class T>
+void make_table(std::size_t m, bool uniform, vector &x, std::vector<T> &y, vector &xq)
+{
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> jitter(-0.25, 0.25);
+    x.resize(m);
+    y.resize(m);
+    for (std::size_t i = 0 ; i < m ; ++i)
+    {
+        x[i] = static_cast<double>(i) + ((uniform || (i == 0) || (i == m - 1)) ? 0.0 : jitter(gen));
+        x[i] *= 0.01;
+        y[i] = sample<T>(x[i]);
+    }
+    std::uniform_real_distribution<double> ux(x.front(), x.back());
+    xq.resize(nq);
+    for (std::size_t i = 0 ; i < nq ; ++i)
+        xq[i] = ux(gen);
+}
+
+// Scalar evaluation through operator(), on an evenly spaced (O(1) index
+// lookup) or irregular (binary search) axis
+template<class Spline, class T>
+void BM_SplineScalar(benchmark::State &state)
+{
+    vector x, xq;
+    std::vector<T> y, yq(nq);
+    make_table(static_cast<std::size_t>(state.range(0)), state.range(1) != 0, x, y, xq);
+    Spline f(x, y);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nq ; ++i)
+            f(xq[i], yq[i]);
+        benchmark::DoNotOptimize(yq.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nq));
+}
+
+// Batch evaluation on an irregular axis, with random or sorted queries
+template<class Spline, class T>
+void BM_SplineBatch(benchmark::State &state)
+{
+    vector x, xq;
+    std::vector<T> y, yq(nq);
+    make_table(static_cast<std::size_t>(state.range(0)), false, x, y, xq);
+    bool sorted = state.range(1) != 0;
+    if (sorted)
+        std::sort(xq.begin(), xq.end());
+    Spline f(x, y);
+    for (auto _ : state)
+    {
+        f.evaluate(xq.data(), yq.data(), nq, sorted);
+        benchmark::DoNotOptimize(yq.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nq));
+}
+
+const std::vector<int64_t> sizes{64, 4096, 262144, 4194304};
+
+#define OSL_BENCH_SPLINE(Spline, T)                                       \
+    BENCHMARK_TEMPLATE(BM_SplineScalar, Interpolator::Spline, T)          \
+        ->ArgsProduct({sizes, {0, 1}})->ArgNames({"size", "uniform"});    \
+    BENCHMARK_TEMPLATE(BM_SplineBatch, Interpolator::Spline, T)           \
+        ->ArgsProduct({sizes, {0, 1}})->ArgNames({"size", "sorted"})
+
+OSL_BENCH_SPLINE(LinearSpline, double);
+OSL_BENCH_SPLINE(QuadraticSpline, double);
+OSL_BENCH_SPLINE(CubicSpline, double);
+OSL_BENCH_SPLINE(ComplexLinearSpline, complex);
+OSL_BENCH_SPLINE(ComplexQuadraticSpline, complex);
+OSL_BENCH_SPLINE(ComplexCubicSpline, complex);
+
+// Sample by sample appending to the streaming interpolator
+void BM_StreamingCubicSplineAppend(benchmark::State &state)
+{
+    Interpolator::StreamingCubicSpline f(static_cast<std::size_t>(state.range(0)));
+    double x = 0.0;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nq ; ++i)
+        {
+            x += 0.01;
+            f.append(x, std::sin(x));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nq));
+}
+BENCHMARK(BM_StreamingCubicSplineAppend)->Arg(1024)->ArgName("capacity");
+
+// Position interpolators along a trajectory
+template<class Spline3D>
+Spline3D make_spline3d(const vector &t, const Geometry::vector3d &pos, const Geometry::vector3d &vel);
+template<>
+Geometry::Interpolator3D::LinearSpline3D make_spline3d(const vector &t, const Geometry::vector3d &pos,
+                                                       const Geometry::vector3d &)
+{
+    return Geometry::Interpolator3D::LinearSpline3D(t, pos);
+}
+template<>
+Geometry::Interpolator3D::CubicSpline3D make_spline3d(const vector &t, const Geometry::vector3d &pos,
+                                                      const Geometry::vector3d &vel)
+{
+    return Geometry::Interpolator3D::CubicSpline3D(t, pos, vel);
+}
+
+template<class Spline3D>
+void BM_Spline3D(benchmark::State &state)
+{
+    std::size_t m = static_cast<std::size_t>(state.range(0));
+    vector t(m), tq(nq);
+    Geometry::vector3d pos(m), vel(m);
+    for (std::size_t i = 0 ; i < m ; ++i)
+    {
+        t[i] = static_cast<double>(i) * 0.01;
+        pos[i] = Geometry::Vector3D(7e6 * std::cos(1e-3 * t[i]), 7e6 * std::sin(1e-3 * t[i]), 0.0);
+        vel[i] = Geometry::Vector3D(-7e3 * std::sin(1e-3 * t[i]), 7e3 * std::cos(1e-3 * t[i]), 0.0);
+    }
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> ut(t.front(), t.back());
+    for (std::size_t i = 0 ; i < nq ; ++i)
+        tq[i] = ut(gen);
+    Spline3D f = make_spline3d<Spline3D>(t, pos, vel);
+    Geometry::Vector3D p;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nq ; ++i)
+        {
+            f(tq[i], p);
+            benchmark::DoNotOptimize(p);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nq));
+}
+BENCHMARK_TEMPLATE(BM_Spline3D, Geometry::Interpolator3D::LinearSpline3D)
+    ->Arg(4096)->Arg(262144)->ArgName("size");
+BENCHMARK_TEMPLATE(BM_Spline3D, Geometry::Interpolator3D::CubicSpline3D)
+    ->Arg(4096)->Arg(262144)->ArgName("size");
+
+} // namespace
@@ -0,0 +1,211 @@
+// ===== BENCHMARK CubicSpline coefficient layout from L1 to DRAM table sizes =====
+// The CubicSpline layout (32 bytes segments, and the axis in a separate
+// array when it is not evenly spaced) is compared to a structure-of-arrays
+// layout and, for uneven axes, to 64 bytes segments packing the node with
+// the coefficients. All layouts use the same index search as CubicSpline.
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+
+namespace {
+
+// Index search of CubicSpline: O(1) on an evenly spaced axis, binary
+// search of the nodes given by node(i) otherwise
+template <class Node>
+std::size_t search_index(const double &xe, bool uniform, double xmin, double xmax,
+                         double inv_dx, std::size_t n, Node node)
+{
+    if (xe >= xmax)
+        return n - 1;
+    if (!(xe > xmin))
+        return 0;
+    if (uniform)
+        return static_cast<std::size_t>(std::min((xe - xmin) * inv_dx, static_cast<double>(n - 1)));
+    std::size_t left = 0, right = n, mid;
+    while (right - left > 1)
+    {
+        mid = (left + right) / 2;
+        if (xe >= node(mid))
+            left = mid;
+        else
+            right = mid;
+    }
+    return left;
+}
+
+// Reference structure-of-arrays layout (one vector per coefficient, the
+// axis being stored only when it is not evenly spaced)
+struct CubicSplineSoA
+{
+    Osl::vector x, a, b, c, d;
+    bool uniform;
+    double xmin, xmax, dx, inv_dx;
+    std::size_t n;
+
+    explicit CubicSplineSoA(Osl::Maths::Interpolator::CubicSpline &f)
+    {
+        f.getCoeffs(a, b, c, d);
+        n = a.size();
+        uniform = f.isUniform();
+        xmin = f.getXmin();
+        xmax = f.getXmax();
+        dx = (xmax - xmin) / static_cast<double>(n);
+        inv_dx = 1.0 / dx;
+        if (!uniform)
+            x = f.getX();
+    }
+
+    double operator()(const double &xe) const
+    {
+        std::size_t i = search_index(xe, uniform, xmin, xmax, inv_dx, n,
+                                     [this](std::size_t k) { return x[k]; });
+        double dxe = xe - (uniform ? xmin + static_cast<double>(i) * dx : x[i]);
+        return ((a[i] * dxe + b[i]) * dxe + c[i]) * dxe + d[i];
+    }
+
+    std::size_t bytes() const { return (4 * n + x.size()) * sizeof(double); }
+};
+
+// Node and coefficients packed in a 64 bytes segment, for uneven axes
+struct CubicSplinePacked
+{
+    struct alignas(64) Segment
+    {
+        double x, a, b, c, d;
+    };
+    std::vector<Segment> seg;
+    double xmin, xmax;
+    std::size_t n;
+
+    explicit CubicSplinePacked(Osl::Maths::Interpolator::CubicSpline &f)
+    {
+        Osl::vector x = f.getX(), a, b, c, d;
+        f.getCoeffs(a, b, c, d);
+        n = a.size();
+        xmin = f.getXmin();
+        xmax = f.getXmax();
+        seg.resize(n);
+        for (std::size_t i = 0 ; i < n ; ++i)
+            seg[i] = {x[i], a[i], b[i], c[i], d[i]};
+    }
+
+    double operator()(const double &xe) const
+    {
+        const Segment &s = seg[search_index(xe, false, xmin, xmax, 0.0, n,
+                                            [this](std::size_t k) { return seg[k].x; })];
+        double dxe = xe - s.x;
+        return ((s.a * dxe + s.b) * dxe + s.c) * dxe + s.d;
+    }
+
+    std::size_t bytes() const { return n * sizeof(Segment); }
+};
+
+const std::size_t nq = 65536; // Number of random queries per iteration
+
+// Spline over m segments of an evenly spaced or uneven axis, and random
+// query points spanning the whole table
+void make_layout_table(std::size_t m, bool uneven, Osl::vector &x, Osl::vector &y, Osl::vector &xq)
+{
+    x.resize(m + 1);
+    y.resize(m + 1);
+    for (std::size_t i = 0 ; i <= m ; ++i)
+    {
+        double t = static_cast<double>(i);
+        x[i] = uneven ? t + 0.3 * std::sin(1.7 * t) : t;
+        y[i] = std::sin(0.001 * x[i]);
+    }
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> ux(x.front(), x.back());
+    xq.resize(nq);
+    for (std::size_t i = 0 ; i < nq ; ++i)
+        xq[i] = ux(gen);
+}
+
+// Bytes of the tables read by the CubicSpline evaluation
+double spline_KiB(const Osl::Maths::Interpolator::CubicSpline &f, std::size_t m)
+{
+    return static_cast<double>(32 * m + (f.isUniform() ? 0 : 8 * (m + 1))) / 1024.0;
+}
+
+// Structure-of-arrays reference
+void BM_CubicSplineLayoutSoA(benchmark::State &state)
+{
+    Osl::vector x, y, xq, yq(nq);
+    make_layout_table(static_cast<std::size_t>(state.range(0)), state.range(1) != 0, x, y, xq);
+    Osl::Maths::Interpolator::CubicSpline f(x, y);
+    CubicSplineSoA fsoa(f);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nq ; ++i)
+            yq[i] = fsoa(xq[i]);
+        benchmark::DoNotOptimize(yq.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nq));
+    state.counters["table_KiB"] = static_cast<double>(fsoa.bytes()) / 1024.0;
+}
+
+// 64 bytes segments packing the node, uneven axes only
+void BM_CubicSplineLayoutPacked64(benchmark::State &state)
+{
+    Osl::vector x, y, xq, yq(nq);
+    make_layout_table(static_cast<std::size_t>(state.range(0)), true, x, y, xq);
+    Osl::Maths::Interpolator::CubicSpline f(x, y);
+    CubicSplinePacked fp(f);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nq ; ++i)
+            yq[i] = fp(xq[i]);
+        benchmark::DoNotOptimize(yq.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nq));
+    state.counters["table_KiB"] = static_cast<double>(fp.bytes()) / 1024.0;
+}
+
+// CubicSpline segments, scalar evaluation
+void BM_CubicSplineLayoutAoS(benchmark::State &state)
+{
+    Osl::vector x, y, xq, yq(nq);
+    std::size_t m = static_cast<std::size_t>(state.range(0));
+    make_layout_table(m, state.range(1) != 0, x, y, xq);
+    Osl::Maths::Interpolator::CubicSpline f(x, y);
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < nq ; ++i)
+            f(xq[i], yq[i]);
+        benchmark::DoNotOptimize(yq.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nq));
+    state.counters["table_KiB"] = spline_KiB(f, m);
+}
+
+// CubicSpline segments, batch evaluation
+void BM_CubicSplineLayoutAoSBatch(benchmark::State &state)
+{
+    Osl::vector x, y, xq, yq(nq);
+    std::size_t m = static_cast<std::size_t>(state.range(0));
+    make_layout_table(m, state.range(1) != 0, x, y, xq);
+    Osl::Maths::Interpolator::CubicSpline f(x, y);
+    for (auto _ : state)
+    {
+        f.evaluate(xq.data(), yq.data(), nq);
+        benchmark::DoNotOptimize(yq.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * nq));
+    state.counters["table_KiB"] = spline_KiB(f, m);
+}
+
+// From L1 to DRAM table sizes, on evenly spaced (0) and uneven (1) axes
+BENCHMARK(BM_CubicSplineLayoutSoA)->ArgsProduct({benchmark::CreateRange(256, 1 << 24, 16), {0, 1}})
+                                  ->ArgNames({"segments", "uneven"});
+BENCHMARK(BM_CubicSplineLayoutAoS)->ArgsProduct({benchmark::CreateRange(256, 1 << 24, 16), {0, 1}})
+                                  ->ArgNames({"segments", "uneven"});
+BENCHMARK(BM_CubicSplineLayoutAoSBatch)->ArgsProduct({benchmark::CreateRange(256, 1 << 24, 16), {0, 1}})
+                                       ->ArgNames({"segments", "uneven"});
+BENCHMARK(BM_CubicSplineLayoutPacked64)->RangeMultiplier(16)->Range(256, 1 << 24)->ArgName("segments");
+
+} // namespace
@@ -0,0 +1,186 @@
+// ===== BENCHMARK analytical polynomial root solvers =====
+#include "Osl.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace {
+
+using namespace Osl;
+using namespace Osl::Maths;
+
+const std::size_t np = 4096; // Number of polynomials per iteration
+
+// Random real coefficients, leading coefficient kept away from zero
+vector make_coeffs(std::size_t ncoeffs)
+{
+    std::mt19937_64 gen(42);
+    std::uniform_real_distribution<double> u(-10.0, 10.0), ua(0.5, 10.0);
+    vector c(np * ncoeffs);
+    for (std::size_t i = 0 ; i < np ; ++i)
+    {
+        c[i * ncoeffs] = ua(gen);
+        for (std::size_t k = 1 ; k < ncoeffs ; ++k)
+            c[i * ncoeffs + k] = u(gen);
+    }
+    return c;
+}
+
+void BM_QuadraticRoots(benchmark::State &state)
+{
+    vector c = make_coeffs(3);
+    complex x1, x2;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < np ; ++i)
+        {
+            const double *p = c.data() + 3 * i;
+            Roots::quadratic_roots(p[0], p[1], p[2], x1, x2);
+            benchmark::DoNotOptimize(x1);
+            benchmark::DoNotOptimize(x2);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * np));
+}
+BENCHMARK(BM_QuadraticRoots);
+
+void BM_CubicRoots(benchmark::State &state)
+{
+    vector c = make_coeffs(4);
+    complex x1, x2, x3;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < np ; ++i)
+        {
+            const double *p = c.data() + 4 * i;
+            Roots::cubic_roots(p[0], p[1], p[2], p[3], x1, x2, x3);
+            benchmark::DoNotOptimize(x1);
+            benchmark::DoNotOptimize(x3);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * np));
+}
+BENCHMARK(BM_CubicRoots);
+
+void BM_QuarticRoots(benchmark::State &state)
+{
+    vector c = make_coeffs(5);
+    complex x1, x2, x3, x4;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < np ; ++i)
+        {
+            const double *p = c.data() + 5 * i;
+            Roots::quartic_roots(p[0], p[1], p[2], p[3], p[4], x1, x2, x3, x4);
+            benchmark::DoNotOptimize(x1);
+            benchmark::DoNotOptimize(x4);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * np));
+}
+BENCHMARK(BM_QuarticRoots);
+
+// Real arithmetic paths, point by point
+void BM_CubicRealRoots(benchmark::State &state)
+{
+    vector c = make_coeffs(4);
+    double x1, x2, x3;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < np ; ++i)
+        {
+            const double *p = c.data() + 4 * i;
+            std::size_t nr = Roots::cubic_roots(p[0], p[1], p[2], p[3], x1, x2, x3);
+            benchmark::DoNotOptimize(nr);
+            benchmark::DoNotOptimize(x1);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * np));
+}
+BENCHMARK(BM_CubicRealRoots);
+
+void BM_QuarticRealRoots(benchmark::State &state)
+{
+    vector c = make_coeffs(5);
+    double x1, x2, x3, x4;
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0 ; i < np ; ++i)
+        {
+            const double *p = c.data() + 5 * i;
+            std::size_t nr = Roots::quartic_roots(p[0], p[1], p[2], p[3], p[4], x1, x2, x3, x4);
+            benchmark::DoNotOptimize(nr);
+            benchmark::DoNotOptimize(x1);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * np));
+}
+BENCHMARK(BM_QuarticRealRoots);
+
+// Real arithmetic paths over SoA arrays of coefficients
+struct SoACoeffs
+{
+    vector a, b, c, d, e;
+
+    SoACoeffs() : a(np), b(np), c(np), d(np), e(np)
+    {
+        vector cf = make_coeffs(5);
+        for (std::size_t i = 0 ; i < np ; ++i)
+        {
+            a[i] = cf[5 * i];
+            b[i] = cf[5 * i + 1];
+            c[i] = cf[5 * i + 2];
+            d[i] = cf[5 * i + 3];
+            e[i] = cf[5 * i + 4];
+        }
+    }
+};
+
+void BM_QuadraticRealRootsBatch(benchmark::State &state)
+{
+    SoACoeffs p;
+    vector x1(np), x2(np);
+    std::vector<std::size_t> nr(np);
+    for (auto _ : state)
+    {
+        Roots::quadratic_roots(p.a.data(), p.b.data(), p.c.data(), np,
+                               x1.data(), x2.data(), nr.data());
+        benchmark::DoNotOptimize(x1.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * np));
+}
+BENCHMARK(BM_QuadraticRealRootsBatch);
+
+void BM_CubicRealRootsBatch(benchmark::State &state)
+{
+    SoACoeffs p;
+    vector x1(np), x2(np), x3(np);
+    std::vector<std::size_t> nr(np);
+    for (auto _ : state)
+    {
+        Roots::cubic_roots(p.a.data(), p.b.data(), p.c.data(), p.d.data(), np,
+                           x1.data(), x2.data(), x3.data(), nr.data());
+        benchmark::DoNotOptimize(x1.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * np));
+}
+BENCHMARK(BM_CubicRealRootsBatch);
+
+void BM_QuarticRealRootsBatch(benchmark::State &state)
+{
+    SoACoeffs p;
+    vector x1(np), x2(np), x3(np), x4(np);
+    std::vector<std::size_t> nr(np);
+    for (auto _ : state)
+    {
+        Roots::quartic_roots(p.a.data(), p.b.data(), p.c.data(), p.d.data(), p.e.data(), np,
+                             x1.data(), x2.data(), x3.data(), x4.data(), nr.data());
+        benchmark::DoNotOptimize(x1.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * np));
+}
+BENCHMARK(BM_QuarticRealRootsBatch);
+
+} // namespace
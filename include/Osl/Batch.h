@@ -0,0 +1,44 @@
+/*! ********************************************************************
+ * \file Batch.h
+ * \brief Header file for the internal block driver of the batch
+ *        (structure-of-arrays) kernels.
+ *********************************************************************/
+
+#ifndef OSL_BATCH_H
+#define OSL_BATCH_H
+
+#include <algorithm>
+#include <cstddef>
+
+namespace Osl { // Osl namespace
+
+namespace detail { // Osl::detail namespace
+
+//! Number of points per block of the batch kernels
+inline constexpr std::size_t batch_size = 256;
+
+/*! ********************************************************************
+ * \brief Calls a kernel on the consecutive blocks of \f$n\f$ points.
+ *
+ * The points \f$[0;n[\f$ are split in blocks \f$[k_0;k_0+n_b[\f$ of
+ * batch_size points (the last one being possibly shorter), shared among
+ * threads with a static schedule. The kernel is expected to vectorize its
+ * loop over the points of a block, and to hold its temporaries in arrays
+ * of batch_size values.
+ *
+ * \param [in] n the number of points.
+ * \param [in] f the kernel, called as f(k0, nb) for each block.
+ *********************************************************************/
+template <typename F>
+inline void for_each_block(std::size_t n, F &&f)
+{
+    #pragma omp parallel for schedule(static)
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += batch_size)
+        f(k0, std::min(batch_size, n - k0));
+}
+
+} // namespace Osl::detail
+
+} // namespace Osl
+
+#endif // OSL_BATCH_H
@@ -0,0 +1,388 @@
+/*! ********************************************************************
+ * \file DEMTileCache.cpp
+ * \brief Source file of Osl::Geography::DEMTileCache class.
+ *********************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include "DEMTileCache.h"
+#include "Osl/Batch.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+namespace { // Local functions
+
+// Path of the SRTM tile of south-west corner (ilon, ilat), e.g. N45E006.hgt
+std::string srtmFilename(const std::string &directory, int ilon, int ilat)
+{
+    char name[32]; // Large enough for the whole int range
+    std::snprintf(name, sizeof(name), "%c%02d%c%03d.hgt",
+                  ilat < 0 ? 'S' : 'N', std::abs(ilat),
+                  ilon < 0 ? 'W' : 'E', std::abs(ilon));
+    if (directory.empty() || (directory.back() == '/'))
+        return directory + name;
+    return directory + "/" + name;
+}
+
+// Decodes the n x n samples of a mapped tile to heights, voids being NaN
+template <typename T>
+void decodeTile(const unsigned char *data, bool swap, const double &noData,
+                std::vector<float> &tile)
+{
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    for (std::size_t k = 0 ; k < tile.size() ; ++k)
+    {
+        double v = readRasterSample<T>(data + k * sizeof(T), swap);
+        tile[k] = (v == noData) ? nan : static_cast<float>(v);
+    }
+}
+
+} // namespace
+
+// ============== CONSTRUCTOR ==============
+DEMTileCache::DEMTileCache()
+    : m_n(0), m_size(1.0), m_type(RasterType::int16), m_swap(false),
+      m_noData(-32768.0), m_missingHeight(0.0), m_budget(0), m_prefetchRadius(0) {}
+
+DEMTileCache::DEMTileCache(const std::string &directory, std::size_t samplesPerSide,
+                           std::size_t memoryBudget)
+    : DEMTileCache([directory](int ilon, int ilat) { return srtmFilename(directory, ilon, ilat); },
+                   samplesPerSide, 1.0, RasterType::int16, Endian::Endianness::big,
+                   memoryBudget) {}
+
+DEMTileCache::DEMTileCache(const TileFilename &filename, std::size_t samplesPerSide,
+                           const double &tileSize, enum RasterType type,
+                           Endian::Endianness endianness, std::size_t memoryBudget,
+                           const double &noData, const double &missingHeight)
+    : m_filename(filename), m_n(samplesPerSide), m_size(tileSize), m_type(type),
+      m_swap(endianness != Endian::Endianness::native),
+      m_noData(noData), m_missingHeight(missingHeight),
+      m_budget(memoryBudget), m_prefetchRadius(0)
+{
+    if (!filename)
+        throw std::invalid_argument("DEMTileCache constructor:\n"
+                                    "\t'filename' must be a valid function.");
+    if (samplesPerSide < 2)
+        throw std::invalid_argument("DEMTileCache constructor:\n"
+                                    "\t'samplesPerSide' must be at least 2.");
+    if ((tileSize <= 0.0) || (tileSize > 180.0))
+        throw std::invalid_argument("DEMTileCache constructor:\n"
+                                    "\t'tileSize' must be in ]0, 180].");
+}
+
+// ============== DESTRUCTOR ==============
+DEMTileCache::~DEMTileCache() {} // Tiles in use elsewhere are released with their last owner
+
+// ============== CLASS METHODS ==============
+// ********** SETTER **********
+void DEMTileCache::setMemoryBudget(std::size_t memoryBudget)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_budget = memoryBudget;
+    this->evict();
+}
+
+void DEMTileCache::setPrefetchRadius(int radius)
+{
+    if (radius < 0)
+        throw std::invalid_argument("DEMTileCache.setPrefetchRadius():\n"
+                                    "\t'radius' must be positive.");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_prefetchRadius = radius;
+}
+
+void DEMTileCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tiles.clear();
+    m_lru.clear();
+    m_stats.tiles = 0;
+    m_stats.memoryUsage = 0;
+}
+
+void DEMTileCache::resetStats()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.hits = 0;
+    m_stats.misses = 0;
+    m_stats.prefetches = 0;
+    m_stats.evictions = 0;
+    m_stats.missingTiles = 0;
+}
+
+// ********** GETTER **********
+std::size_t DEMTileCache::getMemoryBudget() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_budget;
+}
+
+int DEMTileCache::getPrefetchRadius() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_prefetchRadius;
+}
+
+double DEMTileCache::getTileSize(bool degrees) const { return degrees ? m_size : m_size * Constants::m_degtorad; }
+std::size_t DEMTileCache::getSamplesPerSide() const { return m_n; }
+
+DEMCacheStats DEMTileCache::getStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+// ============== HEIGHTS ==============
+double DEMTileCache::height(const double &lon, const double &lat, bool degrees)
+{
+    double h;
+    this->height_block(&lon, &lat, &h, 1, degrees);
+    return h;
+}
+
+void DEMTileCache::height(const double *lon, const double *lat, double *h, std::size_t n,
+                          bool degrees)
+{
+    // The first error is rethrown once out of the parallel region
+    std::exception_ptr error;
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        try
+        {
+            this->height_block(lon + k0, lat + k0, h + k0, nb, degrees);
+        }
+        catch (...)
+        {
+            #pragma omp critical
+            if (!error)
+                error = std::current_exception();
+        }
+    });
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void DEMTileCache::height(const vector &lon, const vector &lat, vector &h, bool degrees)
+{
+    std::size_t n = lon.size();
+    if (lat.size() != n)
+        throw std::invalid_argument("DEMTileCache.height():\n"
+                                    "\t'lon' and 'lat' must have same size.");
+    h.resize(n);
+    this->height(lon.data(), lat.data(), h.data(), n, degrees);
+}
+
+void DEMTileCache::height(const GeoPointArray &points, vector &h)
+{
+    const vector &lon = points.getLonRad(),
+                 &lat = points.getLatRad();
+    h.resize(lon.size());
+    this->height(lon.data(), lat.data(), h.data(), lon.size(), false);
+}
+
+void DEMTileCache::prefetch(const double &lon, const double &lat, int radius, bool degrees)
+{
+    if (!m_filename)
+        throw std::invalid_argument("DEMTileCache.prefetch():\n"
+                                    "\tthe cache is not initialized.");
+    if (std::isnan(lat) || !std::isfinite(lon))
+        throw std::invalid_argument("DEMTileCache.prefetch():\n"
+                                    "\t'lon' and 'lat' must be finite.");
+    const double k = degrees ? 1.0 : Constants::m_radtodeg;
+    const int ilatMax = static_cast<int>(std::ceil(90.0 / m_size)) - 1;
+    double lond = lon * k,
+           latd = std::min(std::max(lat * k, -90.0), 90.0);
+    lond -= 360.0 * std::floor((lond + 180.0) / 360.0);
+    int ilon = static_cast<int>(std::floor(lond / m_size)),
+        ilat = std::min(static_cast<int>(std::floor(latd / m_size)), ilatMax);
+    this->prefetchTiles(ilon, ilat, radius, true);
+}
+
+// ============== PRIVATE CLASS METHODS ==============
+DEMTileCache::TileKey DEMTileCache::key(int ilon, int ilat)
+{
+    // Built from unsigned values (no shift of negative indices)
+    return (static_cast<TileKey>(static_cast<std::uint32_t>(ilon)) << 32) |
+           static_cast<std::uint32_t>(ilat);
+}
+
+// Loads the tiles within radius of the tile (ilon, ilat), this one included
+// or not
+void DEMTileCache::prefetchTiles(int ilon, int ilat, int radius, bool center)
+{
+    const int nlon = static_cast<int>(std::ceil(360.0 / m_size)),
+              ilatMax = static_cast<int>(std::ceil(90.0 / m_size)) - 1;
+    for (int di = -radius ; di <= radius ; ++di)
+    {
+        int jlat = ilat + di;
+        if ((jlat < -ilatMax - 1) || (jlat > ilatMax))
+            continue;
+        for (int dj = -radius ; dj <= radius ; ++dj)
+        {
+            if (!center && (di == 0) && (dj == 0))
+                continue;
+            // Tiles are wrapped in longitude, from -180° to 180°
+            int jlon = ilon + dj + nlon / 2;
+            jlon = ((jlon % nlon) + nlon) % nlon - nlon / 2;
+            TileKey kt = key(jlon, jlat);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_tiles.count(kt) != 0)
+                    continue;
+            }
+            this->insertTile(kt, this->loadTile(jlon, jlat), true);
+        }
+    }
+}
+
+std::size_t DEMTileCache::tileBytes(const TilePtr &tile) const
+{
+    return tile ? tile->size() * sizeof(float) : 0;
+}
+
+DEMTileCache::TilePtr DEMTileCache::getTile(int ilon, int ilat)
+{
+    TileKey k = key(ilon, ilat);
+    int radius;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tiles.find(k);
+        if (it != m_tiles.end())
+        {
+            ++m_stats.hits;
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lru); // Most recently used
+            return it->second.tile;
+        }
+        ++m_stats.misses;
+        radius = m_prefetchRadius;
+    }
+    // The file is read out of the lock, the neighbours (not the tile
+    // itself, already loaded) being prefetched before the tile is inserted
+    // so that they never evict it
+    TilePtr tile = this->loadTile(ilon, ilat);
+    if (radius > 0)
+        this->prefetchTiles(ilon, ilat, radius, false);
+    this->insertTile(k, tile, false);
+    return tile;
+}
+
+DEMTileCache::TilePtr DEMTileCache::loadTile(int ilon, int ilat) const
+{
+    std::string filename = m_filename(ilon, ilat);
+    if (!std::ifstream(filename))
+        return TilePtr(); // Missing tile
+    std::shared_ptr<const unsigned char> data =
+        mapRasterFile(filename, 0, m_n * m_n * rasterSampleSize(m_type), "DEMTileCache.height()");
+    std::shared_ptr<std::vector<float>> tile = std::make_shared<std::vector<float>>(m_n * m_n);
+    switch (m_type)
+    {
+        case RasterType::int16:   decodeTile<std::int16_t>(data.get(), m_swap, m_noData, *tile); break;
+        case RasterType::float32: decodeTile<float>(data.get(), m_swap, m_noData, *tile); break;
+        case RasterType::float64: decodeTile<double>(data.get(), m_swap, m_noData, *tile); break;
+    }
+    return tile; // The mapping is released here, only the decoded heights are cached
+}
+
+bool DEMTileCache::insertTile(TileKey k, const TilePtr &tile, bool prefetched)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_tiles.count(k) != 0) // Already loaded by another thread
+        return false;
+    m_lru.push_front(k);
+    m_tiles[k] = CacheEntry{tile, m_lru.begin()};
+    m_stats.memoryUsage += this->tileBytes(tile);
+    m_stats.tiles = m_tiles.size();
+    if (prefetched)
+        ++m_stats.prefetches;
+    if (!tile)
+        ++m_stats.missingTiles;
+    this->evict();
+    return true;
+}
+
+// Evicts the least recently used tiles until the budget is met, keeping
+// at least the most recent one (the lock must be held)
+void DEMTileCache::evict()
+{
+    while ((m_stats.memoryUsage > m_budget) && (m_lru.size() > 1))
+    {
+        auto it = m_tiles.find(m_lru.back());
+        m_stats.memoryUsage -= this->tileBytes(it->second.tile);
+        m_tiles.erase(it);
+        m_lru.pop_back();
+        ++m_stats.evictions;
+    }
+    m_stats.tiles = m_tiles.size();
+}
+
+void DEMTileCache::height_block(const double *lon, const double *lat, double *h, std::size_t n,
+                                bool degrees)
+{
+    if (!m_filename)
+        throw std::invalid_argument("DEMTileCache.height():\n"
+                                    "\tthe cache is not initialized.");
+    // Local copies of the tiling parameters (no aliasing with outputs)
+    const double k = degrees ? 1.0 : Constants::m_radtodeg,
+                 size = m_size,
+                 scale = static_cast<double>(m_n - 1) / m_size, // Samples per degree
+                 missing = m_missingHeight;
+    const std::ptrdiff_t ns = static_cast<std::ptrdiff_t>(m_n);
+    const int ilatMax = static_cast<int>(std::ceil(90.0 / size)) - 1;
+    // Last tiles used by the block, the cache being looked up (under its
+    // lock) only for the other tiles
+    const std::size_t nrecent = 4;
+    TileKey recentKeys[nrecent];
+    TilePtr recentTiles[nrecent];
+    std::size_t nused = 0, next = 0;
+    for (std::size_t p = 0 ; p < n ; ++p)
+    {
+        if (std::isnan(lat[p]) || !std::isfinite(lon[p]))
+        {
+            h[p] = std::numeric_limits<double>::quiet_NaN(); // No tile index
+            continue;
+        }
+        double lond = lon[p] * k,
+               latd = std::min(std::max(lat[p] * k, -90.0), 90.0);
+        lond -= 360.0 * std::floor((lond + 180.0) / 360.0); // [-180, 180[
+        int ilon = static_cast<int>(std::floor(lond / size)),
+            ilat = std::min(static_cast<int>(std::floor(latd / size)), ilatMax);
+        TileKey kp = key(ilon, ilat);
+        std::size_t r = 0;
+        while ((r < nused) && (recentKeys[r] != kp))
+            ++r;
+        if (r == nused)
+        {
+            r = (nused < nrecent) ? nused++ : (next++ % nrecent);
+            recentKeys[r] = kp;
+            recentTiles[r] = this->getTile(ilon, ilat);
+        }
+        const TilePtr &tile = recentTiles[r];
+        if (!tile)
+        {
+            h[p] = missing;
+            continue;
+        }
+        // Fractional position in the tile, rows going from north to south
+        double fx = std::min(std::max((lond - ilon * size) * scale, 0.0), double(ns - 1)),
+               fy = std::min(std::max(((ilat + 1) * size - latd) * scale, 0.0), double(ns - 1));
+        std::ptrdiff_t j = std::min(static_cast<std::ptrdiff_t>(fx), ns - 2),
+                       i = std::min(static_cast<std::ptrdiff_t>(fy), ns - 2);
+        double tx = fx - j,
+               ty = fy - i;
+        const float *z = tile->data() + i * ns + j;
+        double v0 = z[0] + tx * (z[1] - z[0]),
+               v1 = z[ns] + tx * (z[ns + 1] - z[ns]);
+        h[p] = v0 + ty * (v1 - v0);
+    }
+}
+
+} // namespace Osl::Geography
+
+} // namespace Osl
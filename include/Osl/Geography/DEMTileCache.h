@@ -0,0 +1,211 @@
+/*! ********************************************************************
+ * \file DEMTileCache.h
+ * \brief Header file of Osl::Geography::DEMTileCache class.
+ *********************************************************************/
+
+#ifndef OSL_GEOGRAPHY_DEMTILECACHE_H
+#define OSL_GEOGRAPHY_DEMTILECACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include "Osl/Globals.h"
+#include "Osl/Constants.h"
+#include "RasterFile.h"
+#include "GeoPointArray.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+/*! ********************************************************************
+ * \struct DEMCacheStats
+ * \brief Statistics of a DEMTileCache.
+ *
+ * A lookup is a search of a tile in the cache. The points of a batch
+ * block lying in one of its last used tiles share one lookup.
+ *********************************************************************/
+struct DEMCacheStats
+{
+    std::uint64_t hits = 0;        //!< Lookups of a tile already in cache
+    std::uint64_t misses = 0;      //!< Lookups that loaded a tile
+    std::uint64_t prefetches = 0;  //!< Tiles loaded by prefetching
+    std::uint64_t evictions = 0;   //!< Tiles evicted to respect the memory budget
+    std::uint64_t missingTiles = 0;//!< Loaded tiles without file
+    std::size_t tiles = 0;         //!< Tiles currently in cache
+    std::size_t memoryUsage = 0;   //!< Memory of the decoded tiles in cache [bytes]
+};
+
+/*! ********************************************************************
+ * \brief Class to manage the elevations of a Digital Elevation Model
+ * split into tiles of files.
+ *
+ * The tile \f$(i,j)\f$ covers the geodetic cell
+ * \f$[i\delta, (i+1)\delta]\times[j\delta, (j+1)\delta]\f$ of longitudes
+ * and latitudes, with \f$\delta\f$ the tile size. Its file is a raster of
+ * \f$n\times n\f$ samples, rows going from north to south, the samples of
+ * the borders being shared with the neighbouring tiles (SRTM layout, the
+ * sample spacing being \f$\delta/(n-1)\f$).
+ *
+ * The files are memory-mapped and decoded, on their first access, to
+ * native single precision heights kept in a least recently used (LRU)
+ * cache whose memory never exceeds the given budget (except for a single
+ * tile larger than the budget). Missing files (e.g. ocean tiles) are
+ * cached as tiles of constant height, and no-data samples are decoded to
+ * NaN.
+ *
+ * Heights are bilinearly interpolated from geodetic coordinates on the
+ * Ellipsoid. The batch versions share blocks of points among the OpenMP
+ * threads. Each block keeps references to its last used tiles, so that
+ * the cache is only looked up (under a lock) when a point falls in
+ * another tile, and a tile evicted while in use stays valid until
+ * released. Neighbouring tiles can be prefetched, explicitly or on each
+ * miss (see DEMTileCache::setPrefetchRadius).
+ *
+ * \note The class is not copyable.
+ *********************************************************************/
+class DEMTileCache
+{
+public:
+    //! Function returning the file path of the tile (ilon, ilat).
+    typedef std::function<std::string(int ilon, int ilat)> TileFilename;
+
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor.
+    DEMTileCache();
+
+    /*! ********************************************************************
+     * \brief DEMTileCache constructor for SRTM tiles.
+     *
+     * The tiles are the 1° big-endian \em int16 files named as
+     * \em N45E006.hgt, voids (-32768) being decoded to NaN and missing
+     * files to a height of 0 m.
+     *
+     * \param [in] directory The directory of the \em .hgt files.
+     * \param [in] samplesPerSide 3601 for SRTM1, 1201 for SRTM3.
+     * \param [in] memoryBudget The maximum memory of the decoded tiles [bytes].
+     *********************************************************************/
+    DEMTileCache(const std::string &directory, std::size_t samplesPerSide=3601,
+                 std::size_t memoryBudget=std::size_t(512) << 20);
+
+    /*! ********************************************************************
+     * \brief DEMTileCache constructor.
+     * \param [in] filename The function returning the path of a tile file.
+     * \param [in] samplesPerSide The number of samples of a tile side.
+     * \param [in] tileSize The size of the tiles [deg].
+     * \param [in] type The type of the stored samples.
+     * \param [in] endianness The byte order of the stored samples.
+     * \param [in] memoryBudget The maximum memory of the decoded tiles [bytes].
+     * \param [in] noData The value of the void samples.
+     * \param [in] missingHeight The height of the tiles without file [m].
+     *********************************************************************/
+    DEMTileCache(const TileFilename &filename, std::size_t samplesPerSide,
+                 const double &tileSize, enum RasterType type,
+                 Endian::Endianness endianness, std::size_t memoryBudget,
+                 const double &noData=-32768.0, const double &missingHeight=0.0);
+
+    DEMTileCache(const DEMTileCache &other) = delete;
+
+    // ============== DESTRUCTOR ==============
+    //! Default destructor
+    ~DEMTileCache();
+
+    // ============== CLASS METHODS ==============
+    // ********** SETTER **********
+    //! Sets the memory budget, evicting the least recently used tiles if needed.
+    void setMemoryBudget(std::size_t memoryBudget);
+    //! Sets the radius (in tiles) of the neighbours loaded on each miss (0 to disable).
+    void setPrefetchRadius(int radius);
+    //! Removes all the tiles from the cache.
+    void clear();
+    //! Resets the lookup statistics.
+    void resetStats();
+
+    // ********** GETTER **********
+    std::size_t getMemoryBudget() const;
+    int getPrefetchRadius() const;
+    double getTileSize(bool degrees=true) const;
+    std::size_t getSamplesPerSide() const;
+    DEMCacheStats getStats() const;
+
+    // ============== OPERATORS ==============
+    DEMTileCache &operator=(const DEMTileCache &other) = delete;
+
+    // ============== HEIGHTS ==============
+    /*! ********************************************************************
+     * \brief Height of the DEM at a point.
+     * \param [in] lon, lat The geodetic coordinates of the point.
+     * \param [in] degrees The unit of the given coordinates.
+     * \return The bilinearly interpolated height [m] (NaN for a NaN
+     *         latitude or a non finite longitude).
+     *********************************************************************/
+    double height(const double &lon, const double &lat, bool degrees=true);
+
+    /*! ********************************************************************
+     * \brief Heights of the DEM at arrays of points.
+     *
+     * Batch version of DEMTileCache::height working on structure-of-arrays
+     * data. The vector overloads resize the output. Points sorted by tile
+     * minimize the lookups of the cache.
+     *
+     * \param [in] lon, lat Pointers to the \em n geodetic coordinates.
+     * \param [out] h Pointer to the \em n heights [m].
+     * \param [in] n The number of points.
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    void height(const double *lon, const double *lat, double *h, std::size_t n,
+                bool degrees=true);
+    void height(const vector &lon, const vector &lat, vector &h, bool degrees=true);
+    void height(const GeoPointArray &points, vector &h);
+
+    /*! ********************************************************************
+     * \brief Loads the tiles around a point.
+     * \param [in] lon, lat The geodetic coordinates of the point.
+     * \param [in] radius The radius of the loaded tiles around the tile of
+     *             the point (1 loads the 3x3 surrounding tiles).
+     * \param [in] degrees The unit of the given coordinates.
+     * \throws std::invalid_argument if \em lon or \em lat is not finite.
+     *********************************************************************/
+    void prefetch(const double &lon, const double &lat, int radius=1, bool degrees=true);
+
+private:
+    // ============== PRIVATE CLASS MEMBERS ==============
+    typedef std::shared_ptr<const std::vector<float>> TilePtr;
+    typedef std::uint64_t TileKey;
+    struct CacheEntry
+    {
+        TilePtr tile;
+        std::list<TileKey>::iterator lru; // Position in the LRU list
+    };
+    TileFilename m_filename;
+    std::size_t m_n;          // Samples per tile side
+    double m_size;            // Tile size [deg]
+    enum RasterType m_type;
+    bool m_swap;              // Byte order of the samples differs from the native one
+    double m_noData,          // Value of the void samples
+           m_missingHeight;   // Height of the tiles without file [m]
+    std::size_t m_budget;     // Memory budget [bytes]
+    int m_prefetchRadius;
+    mutable std::mutex m_mutex;                         // Lock of the cache and statistics
+    std::list<TileKey> m_lru;                           // Keys from the most to the least recently used
+    std::unordered_map<TileKey, CacheEntry> m_tiles;
+    DEMCacheStats m_stats;
+    // ============== PRIVATE CLASS METHODS ==============
+    static TileKey key(int ilon, int ilat);
+    TilePtr getTile(int ilon, int ilat);
+    void prefetchTiles(int ilon, int ilat, int radius, bool center);
+    TilePtr loadTile(int ilon, int ilat) const;
+    bool insertTile(TileKey k, const TilePtr &tile, bool prefetched);
+    void evict();
+    std::size_t tileBytes(const TilePtr &tile) const;
+    void height_block(const double *lon, const double *lat, double *h, std::size_t n,
+                      bool degrees);
+};
+
+} // namespace Osl::Geography
+
+} // namespace Osl
+
+#endif // OSL_GEOGRAPHY_DEMTILECACHE_H
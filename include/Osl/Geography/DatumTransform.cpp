@@ -0,0 +1,294 @@
+/*! ********************************************************************
+ * \file DatumTransform.cpp
+ * \brief Source file of Osl::Geography::DatumTransform class.
+ *********************************************************************/
+
+#include <algorithm>
+#include "DatumTransform.h"
+#include "Osl/Batch.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+// ============== CONSTRUCTOR ==============
+DatumTransform::DatumTransform() {}
+
+DatumTransform::DatumTransform(Ellipsoid* elps1, Ellipsoid* elps2,
+                               const double &T12x, const double &T12y, const double &T12z,
+                               const double &R12x, const double &R12y, const double &R12z,
+                               const double &S12, bool degrees)
+    : m_elps1(elps1), m_elps2(elps2)
+{
+    const double k = degrees ? Constants::m_degtorad : 1.0,
+                 rx = R12x * k,
+                 ry = R12y * k,
+                 rz = R12z * k,
+                 scale = 1.0 + S12;
+    m_t[0] = T12x;
+    m_t[1] = T12y;
+    m_t[2] = T12z;
+    // Small angles rotation matrix :
+    // rot = |1.0, -rz, ry |
+    //       |rz,  1.0, -rx|
+    //       |-ry, rx,  1.0|
+    m_m[0] = scale;       m_m[1] = -scale * rz; m_m[2] = scale * ry;
+    m_m[3] = scale * rz;  m_m[4] = scale;       m_m[5] = -scale * rx;
+    m_m[6] = -scale * ry; m_m[7] = scale * rx;  m_m[8] = scale;
+}
+
+// Copy constructor
+DatumTransform::DatumTransform(const DatumTransform &other)
+    : m_elps1(other.m_elps1), m_elps2(other.m_elps2)
+{
+    std::copy(other.m_t, other.m_t + 3, m_t);
+    std::copy(other.m_m, other.m_m + 9, m_m);
+}
+
+// ============== DESTRUCTOR ==============
+DatumTransform::~DatumTransform() {}
+
+// ============== CLASS METHODS ==============
+// ********** GETTER **********
+Ellipsoid* DatumTransform::getSourceEllipsoidPtr() const { return m_elps1; }
+Ellipsoid* DatumTransform::getTargetEllipsoidPtr() const { return m_elps2; }
+
+void DatumTransform::getTranslation(double &tx, double &ty, double &tz) const
+{
+    tx = m_t[0];
+    ty = m_t[1];
+    tz = m_t[2];
+}
+
+double DatumTransform::getCoeff(std::size_t row, std::size_t col) const
+{
+    if ((row > 2) || (col > 2))
+        throw std::invalid_argument("DatumTransform.getCoeff():\n"
+                                    "\t'row' and 'col' must be in [0, 2].");
+    return m_m[3 * row + col];
+}
+
+// ============== OPERATORS ==============
+// Assignement from another DatumTransform
+DatumTransform DatumTransform::operator=(const DatumTransform &other)
+{
+    m_elps1 = other.m_elps1;                      // Source ellipsoid
+    m_elps2 = other.m_elps2;                      // Target ellipsoid
+    std::copy(other.m_t, other.m_t + 3, m_t);     // Translation [m]
+    std::copy(other.m_m, other.m_m + 9, m_m);     // Scaled rotation matrix
+    return *this;
+}
+
+// ============== COMPOSITION ==============
+DatumTransform DatumTransform::then(const DatumTransform &next) const
+{
+    if (*next.m_elps1 != *m_elps2)
+        throw std::invalid_argument("DatumTransform.then():\n"
+                                    "\tthe source ellipsoid of 'next' must be the target ellipsoid.");
+    DatumTransform res(*this);
+    res.m_elps2 = next.m_elps2;
+    // M = M_next * M, T = M_next * T + T_next
+    const double *a = next.m_m,
+                 *b = m_m;
+    for (std::size_t r = 0 ; r < 3 ; ++r)
+    {
+        for (std::size_t c = 0 ; c < 3 ; ++c)
+            res.m_m[3 * r + c] = a[3 * r] * b[c] + a[3 * r + 1] * b[3 + c] + a[3 * r + 2] * b[6 + c];
+        res.m_t[r] = a[3 * r] * m_t[0] + a[3 * r + 1] * m_t[1] + a[3 * r + 2] * m_t[2] + next.m_t[r];
+    }
+    return res;
+}
+
+DatumTransform DatumTransform::inverse() const
+{
+    DatumTransform res(*this);
+    res.m_elps1 = m_elps2;
+    res.m_elps2 = m_elps1;
+    // M^-1 from the cofactors of M
+    const double *m = m_m;
+    double *inv = res.m_m;
+    inv[0] = m[4] * m[8] - m[5] * m[7];
+    inv[1] = m[2] * m[7] - m[1] * m[8];
+    inv[2] = m[1] * m[5] - m[2] * m[4];
+    inv[3] = m[5] * m[6] - m[3] * m[8];
+    inv[4] = m[0] * m[8] - m[2] * m[6];
+    inv[5] = m[2] * m[3] - m[0] * m[5];
+    inv[6] = m[3] * m[7] - m[4] * m[6];
+    inv[7] = m[1] * m[6] - m[0] * m[7];
+    inv[8] = m[0] * m[4] - m[1] * m[3];
+    const double idet = 1.0 / (m[0] * inv[0] + m[1] * inv[3] + m[2] * inv[6]);
+    for (std::size_t i = 0 ; i < 9 ; ++i)
+        inv[i] *= idet;
+    // T^-1 = -M^-1 * T
+    for (std::size_t r = 0 ; r < 3 ; ++r)
+        res.m_t[r] = -(inv[3 * r] * m_t[0] + inv[3 * r + 1] * m_t[1] + inv[3 * r + 2] * m_t[2]);
+    return res;
+}
+
+// ============== TRANSFORMS ==============
+void DatumTransform::transformGeocentric(const double &x1, const double &y1, const double &z1,
+                                         double &x2, double &y2, double &z2) const
+{
+    this->transformGeocentric_block(&x1, &y1, &z1, &x2, &y2, &z2, 1);
+}
+
+void DatumTransform::transformGeodetic(const double &lon1, const double &lat1, const double &alt1,
+                                       double &lon2, double &lat2, double &alt2, bool degrees) const
+{
+    this->transformGeodetic_block(&lon1, &lat1, &alt1, &lon2, &lat2, &alt2, 1, degrees);
+}
+
+void DatumTransform::geodeticToGeocentric(const double &lon1, const double &lat1, const double &alt1,
+                                          double &x2, double &y2, double &z2, bool degrees) const
+{
+    this->geodeticToGeocentric_block(&lon1, &lat1, &alt1, &x2, &y2, &z2, 1, degrees);
+}
+
+void DatumTransform::transformGeocentric(const double *x1, const double *y1, const double *z1,
+                                         double *x2, double *y2, double *z2, std::size_t n) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        this->transformGeocentric_block(x1 + k0, y1 + k0, z1 + k0,
+                                        x2 + k0, y2 + k0, z2 + k0, nb);
+    });
+}
+
+void DatumTransform::transformGeocentric(const vector &x1, const vector &y1, const vector &z1,
+                                         vector &x2, vector &y2, vector &z2) const
+{
+    std::size_t n = x1.size();
+    if ((y1.size() != n) || (z1.size() != n))
+        throw std::invalid_argument("DatumTransform.transformGeocentric():\n"
+                                    "\t'x1', 'y1' and 'z1' must have same size.");
+    x2.resize(n);
+    y2.resize(n);
+    z2.resize(n);
+    this->transformGeocentric(x1.data(), y1.data(), z1.data(),
+                              x2.data(), y2.data(), z2.data(), n);
+}
+
+void DatumTransform::transformGeodetic(const double *lon1, const double *lat1, const double *alt1,
+                                       double *lon2, double *lat2, double *alt2,
+                                       std::size_t n, bool degrees) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        this->transformGeodetic_block(lon1 + k0, lat1 + k0, alt1 + k0,
+                                      lon2 + k0, lat2 + k0, alt2 + k0, nb, degrees);
+    });
+}
+
+void DatumTransform::transformGeodetic(const vector &lon1, const vector &lat1, const vector &alt1,
+                                       vector &lon2, vector &lat2, vector &alt2, bool degrees) const
+{
+    std::size_t n = lon1.size();
+    if ((lat1.size() != n) || (alt1.size() != n))
+        throw std::invalid_argument("DatumTransform.transformGeodetic():\n"
+                                    "\t'lon1', 'lat1' and 'alt1' must have same size.");
+    lon2.resize(n);
+    lat2.resize(n);
+    alt2.resize(n);
+    this->transformGeodetic(lon1.data(), lat1.data(), alt1.data(),
+                            lon2.data(), lat2.data(), alt2.data(), n, degrees);
+}
+
+void DatumTransform::geodeticToGeocentric(const double *lon1, const double *lat1, const double *alt1,
+                                          double *x2, double *y2, double *z2,
+                                          std::size_t n, bool degrees) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        this->geodeticToGeocentric_block(lon1 + k0, lat1 + k0, alt1 + k0,
+                                         x2 + k0, y2 + k0, z2 + k0, nb, degrees);
+    });
+}
+
+void DatumTransform::geodeticToGeocentric(const vector &lon1, const vector &lat1, const vector &alt1,
+                                          vector &x2, vector &y2, vector &z2, bool degrees) const
+{
+    std::size_t n = lon1.size();
+    if ((lat1.size() != n) || (alt1.size() != n))
+        throw std::invalid_argument("DatumTransform.geodeticToGeocentric():\n"
+                                    "\t'lon1', 'lat1' and 'alt1' must have same size.");
+    x2.resize(n);
+    y2.resize(n);
+    z2.resize(n);
+    this->geodeticToGeocentric(lon1.data(), lat1.data(), alt1.data(),
+                               x2.data(), y2.data(), z2.data(), n, degrees);
+}
+
+GeoPoint DatumTransform::transform(const GeoPoint &point) const
+{
+    if (*point.getEllipsoidPtr() != *m_elps1)
+        throw std::invalid_argument("DatumTransform.transform():\n"
+                                    "\tthe ellipsoid of 'point' must be the source ellipsoid.");
+    double x2, y2, z2;
+    this->transformGeocentric(point.getX(), point.getY(), point.getZ(), x2, y2, z2);
+    return GeoPoint(m_elps2, x2, y2, z2, GeoPointInit::fromGeocentric);
+}
+
+GeoPointArray DatumTransform::transform(const GeoPointArray &points) const
+{
+    if (*points.getEllipsoidPtr() != *m_elps1)
+        throw std::invalid_argument("DatumTransform.transform():\n"
+                                    "\tthe ellipsoid of 'points' must be the source ellipsoid.");
+    std::size_t n = points.size();
+    vector x2(n), y2(n), z2(n);
+    this->transformGeocentric(points.getX().data(), points.getY().data(), points.getZ().data(),
+                              x2.data(), y2.data(), z2.data(), n);
+    GeoPointArray res(m_elps2);
+    res.setGeocentricCoords(x2, y2, z2);
+    return res;
+}
+
+// ============== PRIVATE CLASS METHODS ==============
+void DatumTransform::transformGeocentric_block(const double *x1, const double *y1, const double *z1,
+                                               double *x2, double *y2, double *z2, std::size_t n) const
+{
+    // Local copies of the transform parameters (no aliasing with outputs)
+    const double m00 = m_m[0], m01 = m_m[1], m02 = m_m[2],
+                 m10 = m_m[3], m11 = m_m[4], m12 = m_m[5],
+                 m20 = m_m[6], m21 = m_m[7], m22 = m_m[8],
+                 tx = m_t[0], ty = m_t[1], tz = m_t[2];
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double x = x1[i], y = y1[i], z = z1[i];
+        x2[i] = tx + m00 * x + m01 * y + m02 * z;
+        y2[i] = ty + m10 * x + m11 * y + m12 * z;
+        z2[i] = tz + m20 * x + m21 * y + m22 * z;
+    }
+}
+
+void DatumTransform::transformGeodetic_block(const double *lon1, const double *lat1, const double *alt1,
+                                             double *lon2, double *lat2, double *alt2,
+                                             std::size_t n, bool degrees) const
+{
+    // Geocentric coordinates of the block, kept in cache
+    double x[detail::batch_size], y[detail::batch_size], z[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        this->geodeticToGeocentric_block(lon1 + k0, lat1 + k0, alt1 + k0, x, y, z, nb, degrees);
+        m_elps2->geocentricToGeodetic(x, y, z, lon2 + k0, lat2 + k0, alt2 + k0, nb, degrees);
+    }
+}
+
+void DatumTransform::geodeticToGeocentric_block(const double *lon1, const double *lat1, const double *alt1,
+                                                double *x2, double *y2, double *z2,
+                                                std::size_t n, bool degrees) const
+{
+    // Geocentric coordinates on the source ellipsoid, kept in cache
+    double x[detail::batch_size], y[detail::batch_size], z[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        m_elps1->geodeticToGeocentric(lon1 + k0, lat1 + k0, alt1 + k0, x, y, z, nb, degrees);
+        this->transformGeocentric_block(x, y, z, x2 + k0, y2 + k0, z2 + k0, nb);
+    }
+}
+
+} // namespace Osl::Geography
+
+} // namespace Osl
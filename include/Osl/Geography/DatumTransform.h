@@ -0,0 +1,205 @@
+/*! ********************************************************************
+ * \file DatumTransform.h
+ * \brief Header file of Osl::Geography::DatumTransform class.
+ *********************************************************************/
+
+#ifndef OSL_GEOGRAPHY_DATUMTRANSFORM_H
+#define OSL_GEOGRAPHY_DATUMTRANSFORM_H
+
+#include "GeoPoint.h"
+#include "GeoPointArray.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+/*! ********************************************************************
+ * \brief Class to manage a Helmert datum transformation between two
+ * ellipsoids.
+ *
+ * The geocentric coordinates of a point of the source ellipsoid are
+ * transformed to the target ellipsoid by the affine map
+ *
+ * \f[
+ *     \begin{pmatrix}X_2 \\ Y_2 \\ Z_2\end{pmatrix} =
+ *     \begin{pmatrix}T_x \\ T_y \\ T_z\end{pmatrix} +
+ *     \mathbf{M}\begin{pmatrix}X_1 \\ Y_1 \\ Z_1\end{pmatrix},
+ *     \quad
+ *     \mathbf{M}=(1+s)\begin{pmatrix}
+ *         1  & -\theta_z  &  \theta_y \\
+ *         \theta_z &  1    & -\theta_x \\
+ *         -\theta_y &  \theta_x  &  1  \\
+ *     \end{pmatrix}
+ * \f]
+ *
+ * i.e. the small angles 7-parameters similitude of
+ * GeoPoint::toEllipsoid. The matrix \f$\mathbf{M}\f$ is computed once at
+ * construction, so that chained transforms (e.g. Clk80IGN to WGS84 to
+ * GRS80) are composed into a single affine map by DatumTransform::then,
+ * and a transform is reversed exactly by DatumTransform::inverse.
+ *
+ * The batch versions share blocks of points among the OpenMP threads,
+ * each block being vectorized by the compiler (through \em omp \em simd).
+ * When only the geocentric coordinates on the target ellipsoid are needed,
+ * transformGeocentric and geodeticToGeocentric skip the iterative
+ * geocentric to geodetic transform.
+ *
+ * \note The ellipsoids given at construction must outlive the transform.
+ * \sa GeoPoint::toEllipsoid
+ *********************************************************************/
+class DatumTransform
+{
+public:
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor.
+    DatumTransform();
+
+    /*! ********************************************************************
+     * \brief DatumTransform constructor.
+     * \param [in] elps1 The source ellipsoid.
+     * \param [in] elps2 The target ellipsoid.
+     * \param [in] T12x, T12y, T12z The translation from elps1 to elps2 [m].
+     * \param [in] R12x, R12y, R12z The small rotation angles from elps1 to
+     *             elps2 about the x, y and z axes.
+     * \param [in] S12 The scale factor offset (e.g. 1e-6 for 1 ppm).
+     * \param [in] degrees The unit of the given angles.
+     *********************************************************************/
+    DatumTransform(Ellipsoid* elps1, Ellipsoid* elps2,
+                   const double &T12x, const double &T12y, const double &T12z,
+                   const double &R12x=0.0, const double &R12y=0.0, const double &R12z=0.0,
+                   const double &S12=0.0, bool degrees=false);
+
+    //! Copy constructor
+    DatumTransform(const DatumTransform &other);
+
+    // ============== DESTRUCTOR ==============
+    //! Default destructor
+    ~DatumTransform();
+
+    // ============== CLASS METHODS ==============
+    // ********** GETTER **********
+    Ellipsoid* getSourceEllipsoidPtr() const;
+    Ellipsoid* getTargetEllipsoidPtr() const;
+    void getTranslation(double &tx, double &ty, double &tz) const;
+    //! Coefficient (\em row, \em col) of the matrix \f$\mathbf{M}\f$.
+    double getCoeff(std::size_t row, std::size_t col) const;
+
+    // ============== OPERATORS ==============
+    DatumTransform operator=(const DatumTransform &other); // Assignement from another DatumTransform
+
+    // ============== COMPOSITION ==============
+    /*! ********************************************************************
+     * \brief Composition with a following transform.
+     * \param [in] next The transform applied after this one. Its source
+     *             ellipsoid must be the target ellipsoid of this one.
+     * \return The transform from the source ellipsoid of this transform to
+     *         the target ellipsoid of \em next.
+     *********************************************************************/
+    DatumTransform then(const DatumTransform &next) const;
+
+    //! The exact inverse transform, from the target to the source ellipsoid.
+    DatumTransform inverse() const;
+
+    // ============== TRANSFORMS ==============
+    /*! ********************************************************************
+     * \brief Transform of geocentric coordinates.
+     * \param [in] x1, y1, z1 The geocentric coordinates on the source
+     *             ellipsoid [m].
+     * \param [out] x2, y2, z2 The geocentric coordinates on the target
+     *              ellipsoid [m].
+     *********************************************************************/
+    void transformGeocentric(const double &x1, const double &y1, const double &z1,
+                             double &x2, double &y2, double &z2) const;
+
+    /*! ********************************************************************
+     * \brief Transform of geodetic coordinates.
+     * \param [in] lon1, lat1, alt1 The geodetic coordinates on the source
+     *             ellipsoid.
+     * \param [out] lon2, lat2, alt2 The geodetic coordinates on the target
+     *              ellipsoid.
+     * \param [in] degrees The unit of the given and returned coordinates.
+     *********************************************************************/
+    void transformGeodetic(const double &lon1, const double &lat1, const double &alt1,
+                           double &lon2, double &lat2, double &alt2, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Transform of geodetic coordinates to geocentric coordinates on
+     * the target ellipsoid.
+     * \param [in] lon1, lat1, alt1 The geodetic coordinates on the source
+     *             ellipsoid.
+     * \param [out] x2, y2, z2 The geocentric coordinates on the target
+     *              ellipsoid [m].
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    void geodeticToGeocentric(const double &lon1, const double &lat1, const double &alt1,
+                              double &x2, double &y2, double &z2, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Batch transforms of arrays of points.
+     *
+     * Batch versions of the above transforms working on structure-of-arrays
+     * data. The vector overloads resize the outputs.
+     *
+     * \param [in] x1, y1, z1 (lon1, lat1, alt1) Pointers to the \em n
+     *             coordinates on the source ellipsoid.
+     * \param [out] x2, y2, z2 (lon2, lat2, alt2) Pointers to the \em n
+     *              coordinates on the target ellipsoid.
+     * \param [in] n The number of points.
+     * \param [in] degrees The unit of the geodetic coordinates.
+     * \note Input and output arrays must not overlap.
+     *********************************************************************/
+    void transformGeocentric(const double *x1, const double *y1, const double *z1,
+                             double *x2, double *y2, double *z2, std::size_t n) const;
+    void transformGeocentric(const vector &x1, const vector &y1, const vector &z1,
+                             vector &x2, vector &y2, vector &z2) const;
+    void transformGeodetic(const double *lon1, const double *lat1, const double *alt1,
+                           double *lon2, double *lat2, double *alt2,
+                           std::size_t n, bool degrees=true) const;
+    void transformGeodetic(const vector &lon1, const vector &lat1, const vector &alt1,
+                           vector &lon2, vector &lat2, vector &alt2, bool degrees=true) const;
+    void geodeticToGeocentric(const double *lon1, const double *lat1, const double *alt1,
+                              double *x2, double *y2, double *z2,
+                              std::size_t n, bool degrees=true) const;
+    void geodeticToGeocentric(const vector &lon1, const vector &lat1, const vector &alt1,
+                              vector &x2, vector &y2, vector &z2, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Transform of a GeoPoint of the source ellipsoid.
+     * \throw std::invalid_argument if \em point is not on the source
+     *        ellipsoid.
+     *********************************************************************/
+    GeoPoint transform(const GeoPoint &point) const;
+
+    /*! ********************************************************************
+     * \brief Transform of a GeoPointArray of the source ellipsoid.
+     *
+     * Only the geocentric coordinates of the returned array are computed,
+     * its geodetic coordinates being computed on their first access.
+     *
+     * \throw std::invalid_argument if \em points are not on the source
+     *        ellipsoid.
+     *********************************************************************/
+    GeoPointArray transform(const GeoPointArray &points) const;
+
+private:
+    // ============== PRIVATE CLASS MEMBERS ==============
+    Ellipsoid* m_elps1;  // Source ellipsoid
+    Ellipsoid* m_elps2;  // Target ellipsoid
+    double m_t[3];       // Translation [m]
+    double m_m[9];       // Scaled rotation matrix (row-major)
+    // ============== PRIVATE CLASS METHODS ==============
+    void transformGeocentric_block(const double *x1, const double *y1, const double *z1,
+                                   double *x2, double *y2, double *z2, std::size_t n) const;
+    void transformGeodetic_block(const double *lon1, const double *lat1, const double *alt1,
+                                 double *lon2, double *lat2, double *alt2,
+                                 std::size_t n, bool degrees) const;
+    void geodeticToGeocentric_block(const double *lon1, const double *lat1, const double *alt1,
+                                    double *x2, double *y2, double *z2,
+                                    std::size_t n, bool degrees) const;
+};
+
+} // namespace Osl::Geography
+
+} // namespace Osl
+
+#endif // OSL_GEOGRAPHY_DATUMTRANSFORM_H
@@ -3,12 +3,34 @@
  * \brief Source file of Osl::Geography::Ellipsoid class.
  *********************************************************************/
 
+#include <algorithm>
 #include "Ellipsoid.h"
 
 namespace Osl { // namespace Osl
 
 namespace Geography { // namespace Osl::Geography
 
+namespace { // Local functions
+
+// Clenshaw summation of the series sum_{k=1}^{n} c[k-1] * sin(2kx) from
+// sin(x) and cos(x) only, through the recurrence on cos(2x).
+inline double clenshawSin2(const double *c, std::size_t n,
+                           const double &sx, const double &cx)
+{
+    double ar = 2.0 * (cx - sx) * (cx + sx), // 2 * cos(2x)
+           b1 = 0.0,
+           b2 = 0.0;
+    for (std::size_t k = n ; k > 0 ; --k)
+    {
+        double b0 = ar * b1 - b2 + c[k - 1];
+        b2 = b1;
+        b1 = b0;
+    }
+    return 2.0 * sx * cx * b1; // sin(2x) * b1
+}
+
+} // namespace
+
 // ============== CONSTRUCTOR ==============
 Ellipsoid::Ellipsoid() {}
 
@@ -44,7 +66,8 @@ Ellipsoid::Ellipsoid(const double &a, const double &f,
     m_1_e2 = 1.0 - m_e2;                   // 1 - m_e2
     m_a_1_e2 = m_a * m_1_e2;               // m_a * (1 - m_e2)
     m_1_f = 1.0 - m_f;                     // 1 - m_f
-    // Initialization of series expansion of inverse latitude functions
+    // Initialization of series expansion of meridian distance and inverse latitude functions
+    this->initMeridianDistanceCoeffs();
     this->initInverseLattitudeCoeffs();
 }
 
@@ -53,8 +76,8 @@ Ellipsoid::Ellipsoid(const Ellipsoid &other)
     :  m_a(other.m_a), m_f(other.m_f), m_b(other.m_b),
        m_f2(other.m_f2), m_n(other.m_n), m_e2(other.m_e2),
        m_e(other.m_e), m_ep2(other.m_ep2), m_mp(other.m_mp),
-       m_1_e2(other.m_1_e2), m_a_1_e2(other.m_a_1_e2),
-       m_1_f(other.m_1_f), m_phimu(other.m_phimu),
+       m_A(other.m_A), m_1_e2(other.m_1_e2), m_a_1_e2(other.m_a_1_e2),
+       m_1_f(other.m_1_f), m_muphi(other.m_muphi), m_phimu(other.m_phimu),
        m_phixi(other.m_phixi), m_phichi(other.m_phichi) {}
 
 // ============== DESTRUCTOR ==============
@@ -86,9 +109,11 @@ Ellipsoid Ellipsoid::operator=(const Ellipsoid &other)
     m_e = other.m_e;    // the ellipsoïd excentricity
     m_ep2 = other.m_ep2;  // the second excentricity squared
     m_mp = other.m_mp;   // Length of a quarter meridian
+    m_A = other.m_A;    // Meridian distance by radian of rectifying latitude
     m_1_e2 = other.m_1_e2;    // 1 - m_e2
     m_a_1_e2 = other.m_a_1_e2;  // m_a * (1 - m_e2)
     m_1_f = other.m_1_f;     // 1 - m_f
+    m_muphi = other.m_muphi;  // Coefficients of the rectifying latitude
     m_phimu = other.m_phimu,  // Coefficients of the inverse rectifying latitude
     m_phixi = other.m_phixi,  // Coefficients of the inverse authalic latitude
     m_phichi = other.m_phichi; // Coefficients of the inverse conformal latitude
@@ -109,10 +134,43 @@ bool Ellipsoid::operator!=(const Ellipsoid &other) const
 
 // ============== ELLIPSOID FUNCTIONS ==============
 // ********** CURVATURE RADIUS AND DISTANCE **********
-double Ellipsoid::meridianDistance(const double &lat, bool degrees)
+double Ellipsoid::meridianDistance(const double &lat, bool degrees,
+                                   MeridianDistanceMethod method)
 {
     double lat_rad = degrees ? lat * Constants::m_degtorad : lat;
-    return m_a_1_e2 * std::ellint_3(m_e, m_e2, lat_rad);
+    switch (method)
+    {
+    case MeridianDistanceMethod::fromSeries:
+        return m_A * (lat_rad + clenshawSin2(m_muphi.data(), m_size_meridian_coeffs,
+                                             std::sin(lat_rad), std::cos(lat_rad)));
+    case MeridianDistanceMethod::fromEllipticIntegral:
+        return m_a_1_e2 * std::ellint_3(m_e, m_e2, lat_rad);
+    default:
+        throw std::invalid_argument("Ellipsoid.meridianDistance():\n"
+                                    "\t'method' is not a valid meridian distance method.");
+    }
+}
+
+void Ellipsoid::meridianDistance(const double *lat, double *m,
+                                 std::size_t n, bool degrees) const
+{
+    // Local copies of the coefficients (no aliasing with outputs)
+    double c[m_size_meridian_coeffs];
+    std::copy(m_muphi.begin(), m_muphi.end(), c);
+    const double A = m_A,
+                 k = degrees ? Constants::m_degtorad : 1.0;
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double x = lat[i] * k;
+        m[i] = A * (x + clenshawSin2(c, m_size_meridian_coeffs, std::sin(x), std::cos(x)));
+    }
+}
+
+void Ellipsoid::meridianDistance(const vector &lat, vector &m, bool degrees) const
+{
+    m.resize(lat.size());
+    this->meridianDistance(lat.data(), m.data(), lat.size(), degrees);
 }
 
 double Ellipsoid::meridianCurvatureRadius(const double &lat, bool degrees)
@@ -167,18 +225,17 @@ double Ellipsoid::inverseParametricLatitude(const double &beta, bool degrees)
 
 double Ellipsoid::rectifyingLatitude(const double &lat, bool degrees)
 {
-    double mu = Constants::m_pi_2 * this->meridianDistance(lat, degrees) / m_mp;
+    double lat_rad = degrees ? lat * Constants::m_degtorad : lat,
+           mu = lat_rad + clenshawSin2(m_muphi.data(), m_size_meridian_coeffs,
+                                       std::sin(lat_rad), std::cos(lat_rad));
     return degrees ? mu * Constants::m_radtodeg : mu;
 }
 
 double Ellipsoid::inverseRectifyingLatitude(const double &mu, bool degrees)
 {
     double mu_rad = degrees ? mu * Constants::m_degtorad : mu,
-           phi = mu_rad;
-    for (std::size_t i = 0 ; i < m_size_coeffs ; ++i)
-    {
-        phi += m_phimu[i] * std::sin(2.0 * (i + 1) * mu_rad);
-    }
+           phi = mu_rad + clenshawSin2(m_phimu.data(), m_size_coeffs,
+                                          std::sin(mu_rad), std::cos(mu_rad));
     return degrees ? phi * Constants::m_radtodeg : phi;
 }
 
@@ -195,11 +252,8 @@ double Ellipsoid::authalicLatitude(const double &lat, bool degrees)
 double Ellipsoid::inverseAuthalicLatitude(const double &xi, bool degrees)
 {
     double xi_rad = degrees ? xi * Constants::m_degtorad : xi,
-           phi = xi_rad;
-    for (std::size_t i = 0 ; i < m_size_coeffs ; ++i)
-    {
-        phi += m_phixi[i] * std::sin(2.0 * (i + 1) * xi_rad);
-    }
+           phi = xi_rad + clenshawSin2(m_phixi.data(), m_size_coeffs,
+                                          std::sin(xi_rad), std::cos(xi_rad));
     return degrees ? phi * Constants::m_radtodeg : phi;
 }
 
@@ -213,11 +267,8 @@ double Ellipsoid::conformalLatitude(const double &lat, bool degrees)
 double Ellipsoid::inverseConformalLatitude(const double &chi, bool degrees)
 {
     double chi_rad = degrees ? chi * Constants::m_degtorad : chi,
-           phi = chi_rad;
-    for (std::size_t i = 0 ; i < m_size_coeffs ; ++i)
-    {
-        phi += m_phichi[i] * std::sin(2.0 * (i + 1) * chi_rad);
-    }
+           phi = chi_rad + clenshawSin2(m_phichi.data(), m_size_coeffs,
+                                          std::sin(chi_rad), std::cos(chi_rad));
     return degrees ? phi * Constants::m_radtodeg : phi;
 }
 
@@ -230,11 +281,127 @@ double Ellipsoid::isometricLatitude(const double &lat, bool degrees)
 
 double Ellipsoid::inverseIsometricLatitude(const double &psi, bool degrees)
 {
-    double chi = std::asin(std::tanh(degrees ? psi * Constants::m_degtorad : psi)),
-           phi = this->inverseConformalLatitude(chi, false);
+    // Conformal latitude: sin(chi) = tanh(psi), cos(chi) = 1 / cosh(psi)
+    double psi_rad = degrees ? psi * Constants::m_degtorad : psi,
+           schi = std::tanh(psi_rad),
+           cchi = 1.0 / std::cosh(psi_rad),
+           phi = std::atan2(schi, cchi) + clenshawSin2(m_phichi.data(), m_size_coeffs, schi, cchi);
     return degrees ? phi * Constants::m_radtodeg : phi;
 }
 
+// ********** LATITUDES (BATCH) **********
+void Ellipsoid::rectifyingLatitude(const double *lat, double *mu,
+                                   std::size_t n, bool degrees) const
+{
+    this->latitudeSeries(m_muphi, lat, mu, n, degrees);
+}
+
+void Ellipsoid::rectifyingLatitude(const vector &lat, vector &mu, bool degrees) const
+{
+    mu.resize(lat.size());
+    this->latitudeSeries(m_muphi, lat.data(), mu.data(), lat.size(), degrees);
+}
+
+void Ellipsoid::inverseRectifyingLatitude(const double *mu, double *lat,
+                                          std::size_t n, bool degrees) const
+{
+    this->latitudeSeries(m_phimu, mu, lat, n, degrees);
+}
+
+void Ellipsoid::inverseRectifyingLatitude(const vector &mu, vector &lat, bool degrees) const
+{
+    lat.resize(mu.size());
+    this->latitudeSeries(m_phimu, mu.data(), lat.data(), mu.size(), degrees);
+}
+
+void Ellipsoid::inverseAuthalicLatitude(const double *xi, double *lat,
+                                        std::size_t n, bool degrees) const
+{
+    this->latitudeSeries(m_phixi, xi, lat, n, degrees);
+}
+
+void Ellipsoid::inverseAuthalicLatitude(const vector &xi, vector &lat, bool degrees) const
+{
+    lat.resize(xi.size());
+    this->latitudeSeries(m_phixi, xi.data(), lat.data(), xi.size(), degrees);
+}
+
+void Ellipsoid::conformalLatitude(const double *lat, double *chi,
+                                  std::size_t n, bool degrees) const
+{
+    const double e = m_e,
+                 k = degrees ? Constants::m_degtorad : 1.0,
+                 invk = degrees ? Constants::m_radtodeg : 1.0;
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double slat = std::sin(lat[i] * k);
+        chi[i] = std::asin(std::tanh(std::atanh(slat) - e * std::atanh(e * slat))) * invk;
+    }
+}
+
+void Ellipsoid::conformalLatitude(const vector &lat, vector &chi, bool degrees) const
+{
+    chi.resize(lat.size());
+    this->conformalLatitude(lat.data(), chi.data(), lat.size(), degrees);
+}
+
+void Ellipsoid::inverseConformalLatitude(const double *chi, double *lat,
+                                         std::size_t n, bool degrees) const
+{
+    this->latitudeSeries(m_phichi, chi, lat, n, degrees);
+}
+
+void Ellipsoid::inverseConformalLatitude(const vector &chi, vector &lat, bool degrees) const
+{
+    lat.resize(chi.size());
+    this->latitudeSeries(m_phichi, chi.data(), lat.data(), chi.size(), degrees);
+}
+
+void Ellipsoid::isometricLatitude(const double *lat, double *psi,
+                                  std::size_t n, bool degrees) const
+{
+    const double e = m_e,
+                 k = degrees ? Constants::m_degtorad : 1.0,
+                 invk = degrees ? Constants::m_radtodeg : 1.0;
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double slat = std::sin(lat[i] * k);
+        psi[i] = (std::atanh(slat) - e * std::atanh(e * slat)) * invk;
+    }
+}
+
+void Ellipsoid::isometricLatitude(const vector &lat, vector &psi, bool degrees) const
+{
+    psi.resize(lat.size());
+    this->isometricLatitude(lat.data(), psi.data(), lat.size(), degrees);
+}
+
+void Ellipsoid::inverseIsometricLatitude(const double *psi, double *lat,
+                                         std::size_t n, bool degrees) const
+{
+    // Local copies of the coefficients (no aliasing with outputs)
+    double c[m_size_coeffs];
+    std::copy(m_phichi.begin(), m_phichi.end(), c);
+    const double k = degrees ? Constants::m_degtorad : 1.0,
+                 invk = degrees ? Constants::m_radtodeg : 1.0;
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double psi_rad = psi[i] * k,
+               schi = std::tanh(psi_rad),
+               cchi = 1.0 / std::cosh(psi_rad);
+        lat[i] = (std::atan2(schi, cchi) + clenshawSin2(c, m_size_coeffs, schi, cchi)) * invk;
+    }
+}
+
+void Ellipsoid::inverseIsometricLatitude(const vector &psi, vector &lat, bool degrees) const
+{
+    lat.resize(psi.size());
+    this->inverseIsometricLatitude(psi.data(), lat.data(), psi.size(), degrees);
+}
+
 // ********** Coordinates transform **********
 void Ellipsoid::geodeticToGeocentric(const double &lon, const double &lat, const double &alt,
                                      double &x, double &y, double &z, bool degrees)
@@ -289,14 +456,127 @@ void Ellipsoid::geocentricToGeodetic(const double &x, const double &y, const dou
     }
 }
 
+void Ellipsoid::geodeticToGeocentric(const double *lon, const double *lat, const double *alt,
+                                     double *x, double *y, double *z,
+                                     std::size_t n, bool degrees) const
+{
+    // Local copies of the ellipsoid parameters (no aliasing with outputs)
+    const double a = m_a,
+                 e2 = m_e2,
+                 one_e2 = m_1_e2,
+                 k = degrees ? Constants::m_degtorad : 1.0;
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double lon_rad = lon[i] * k,
+               lat_rad = lat[i] * k,
+               h = alt[i];
+        double slat = std::sin(lat_rad),
+               nu = a / std::sqrt(1.0 - e2 * slat * slat), // Prime vertical curvature radius
+               nuhcosphi = (nu + h) * std::cos(lat_rad);
+        x[i] = nuhcosphi * std::cos(lon_rad);
+        y[i] = nuhcosphi * std::sin(lon_rad);
+        z[i] = (one_e2 * nu + h) * slat;
+    }
+}
+
+void Ellipsoid::geodeticToGeocentric(const vector &lon, const vector &lat, const vector &alt,
+                                     vector &x, vector &y, vector &z, bool degrees) const
+{
+    std::size_t n = lon.size();
+    if ((lat.size() != n) || (alt.size() != n))
+        throw std::invalid_argument("Ellipsoid.geodeticToGeocentric():\n"
+                                    "\t'lon', 'lat' and 'alt' must have same size.");
+    x.resize(n);
+    y.resize(n);
+    z.resize(n);
+    this->geodeticToGeocentric(lon.data(), lat.data(), alt.data(),
+                               x.data(), y.data(), z.data(), n, degrees);
+}
+
+void Ellipsoid::geocentricToGeodetic(const double *x, const double *y, const double *z,
+                                     double *lon, double *lat, double *alt,
+                                     std::size_t n, bool degrees) const
+{
+    // Local copies of the ellipsoid parameters (no aliasing with outputs)
+    const double a = m_a,
+                 b = m_b,
+                 e2 = m_e2,
+                 ae2 = m_a * m_e2,    // a * e^2
+                 bep2 = m_b * m_ep2,  // b * e'^2
+                 k = degrees ? Constants::m_radtodeg : 1.0;
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double xi = x[i], yi = y[i], zi = z[i];
+        double p = std::sqrt(xi * xi + yi * yi); // Distance from the Ellipsoid center in the equatorial plane
+        // Initial parametric latitude: tan(u0) = a * Z / (b * p)
+        double su = a * zi,
+               cu = b * p,
+               inv = 1.0 / std::sqrt(su * su + cu * cu);
+        su *= inv;
+        cu *= inv;
+        // First Bowring iteration: tan(phi) = num / den
+        double num = zi + bep2 * su * su * su,
+               den = p - ae2 * cu * cu * cu;
+        // Parametric latitude update: tan(u1) = (1 - f) * tan(phi) = b * num / (a * den)
+        su = b * num;
+        cu = a * den;
+        inv = 1.0 / std::sqrt(su * su + cu * cu);
+        su *= inv;
+        cu *= inv;
+        // Second Bowring iteration
+        num = zi + bep2 * su * su * su;
+        den = p - ae2 * cu * cu * cu;
+        // Sine and cosine of the geodetic latitude
+        inv = 1.0 / std::sqrt(num * num + den * den);
+        double slat = num * inv,
+               clat = den * inv;
+        lon[i] = std::atan2(yi, xi) * k;
+        lat[i] = std::atan2(num, den) * k;
+        // Computing altitude [Bowring formula, 1985]
+        alt[i] = p * clat + zi * slat - a * std::sqrt(1.0 - e2 * slat * slat);
+    }
+}
+
+void Ellipsoid::geocentricToGeodetic(const vector &x, const vector &y, const vector &z,
+                                     vector &lon, vector &lat, vector &alt, bool degrees) const
+{
+    std::size_t n = x.size();
+    if ((y.size() != n) || (z.size() != n))
+        throw std::invalid_argument("Ellipsoid.geocentricToGeodetic():\n"
+                                    "\t'x', 'y' and 'z' must have same size.");
+    lon.resize(n);
+    lat.resize(n);
+    alt.resize(n);
+    this->geocentricToGeodetic(x.data(), y.data(), z.data(),
+                               lon.data(), lat.data(), alt.data(), n, degrees);
+}
+
 // ============== PRIVATE CLASS METHODS ==============
+void Ellipsoid::initMeridianDistanceCoeffs()
+{
+    // Power of third flattening factor
+    double n2 = m_n * m_n, n3 = m_n * n2, n4 = n2 * n2, n5 = n2 * n3, n6 = n3 * n3;
+    // Meridian distance by radian of rectifying latitude
+    m_A = m_a / (1.0 + m_n) * (1.0 + n2/4.0 + n4/64.0 + n6/256.0);
+    // Coefficients of the rectifying latitude
+    m_muphi.resize(m_size_meridian_coeffs);
+    m_muphi[0] = -3.0*m_n/2.0 + 9.0*n3/16.0 - 3.0*n5/32.0;         // beta2
+    m_muphi[1] = 15.0*n2/16.0 - 15.0*n4/32.0 + 135.0*n6/2048.0;    // beta4
+    m_muphi[2] = -35.0*n3/48.0 + 105.0*n5/256.0;                   // beta6
+    m_muphi[3] = 315.0*n4/512.0 - 189.0*n6/512.0;                  // beta8
+    m_muphi[4] = -693.0*n5/1280.0;                                 // beta10
+    m_muphi[5] = 1001.0*n6/2048.0;                                 // beta12
+}
+
 void Ellipsoid::initInverseLattitudeCoeffs()
 {
     // Power of third flattening factor
     double n2 = m_n * m_n, n3 = m_n * n2, n4 = n2 * n2, n5 = n2 * n3, n6 = n3 * n3,
            n7 = n2 * n5, n8 = n4 * n4, n9 = n4 * n5, n10 = n5 * n5;
     // Coefficients of the inverse rectifying latitude
-    m_phimu.reserve(m_size_coeffs);
+    m_phimu.resize(m_size_coeffs);
     m_phimu[0] = 3.0*m_n/2.0 - 27.0*n3/32.0 + 269.0*n5/512.0 - 6607.0*n7/24576.0 + 4094.0*n9/327680.0;              // b2
     m_phimu[1] = 21.0*n2/16.0 - 55.0*n4/32.0 + 6759.0*n6/4096.0 - 155113.0*n8/122880.0 + 39591143.0*n10/47185920.0; // b4
     m_phimu[2] = 151.0*n3/96.0 - 417.0*n5/128.0 + 87963.0*n7/20480.0 - 572057.0*n9/131072.0;                        // b6
@@ -308,7 +588,7 @@ void Ellipsoid::initInverseLattitudeCoeffs()
     m_phimu[8] = 116391263.0*n9/5898240.0;                                                                          // b18
     m_phimu[9] = 32385167569.0*n10/990904320.0;                                                                     // b20
     // Coefficients of the inverse
-    m_phixi.reserve(m_size_coeffs);
+    m_phixi.resize(m_size_coeffs);
     m_phixi[0] = 4.0*m_n/3.0 + 4.0*n2/45.0 - 16.0*n3/35.0 - 2582.0*n4/14175.0 + 60136.0*n5/467775.0  // c2
                  + 28112932.0*n6/212837625.0 + 22947844.0*n7/1915538625.0
                  - 1683291094.0*n8/37574026875.0 - 338504669588.0*n9/12993098493375.0
@@ -342,7 +622,7 @@ void Ellipsoid::initInverseLattitudeCoeffs()
                  + 31664196627408368.0*n10/6431583754220625.0;
     m_phixi[9] = 68217869975393752.0*n10/7656647326453125.0;                                         // c20
     // Coefficients of the inverse conformal latitude
-    m_phichi.reserve(m_size_coeffs);
+    m_phichi.resize(m_size_coeffs);
     m_phichi[0] = 2.0*m_n - 2.0*n2/3.0 - 2.0*n3 + 116.0*n4/45.0 + 26.0*n5/45.0 - 2854.0*n6/675.0    // d2
                   + 16822.0*n7/4725.0 + 189416.0*n8/99225.0 - 1113026.0*n9/165375.0
                   + 22150106.0*n10/4465125.0;
@@ -368,6 +648,24 @@ void Ellipsoid::initInverseLattitudeCoeffs()
     m_phichi[9] = 175201343549.0*n10/297604125.0;                                                   // d20
 }
 
+void Ellipsoid::latitudeSeries(const vector &coeffs, const double *in, double *out,
+                               std::size_t n, bool degrees) const
+{
+    // Local copies of the coefficients (no aliasing with outputs), the
+    // series having coeffs.size() <= m_size_coeffs terms
+    const std::size_t nc = std::min(coeffs.size(), m_size_coeffs);
+    double c[m_size_coeffs];
+    std::copy(coeffs.begin(), coeffs.begin() + nc, c);
+    const double k = degrees ? Constants::m_degtorad : 1.0,
+                 invk = degrees ? Constants::m_radtodeg : 1.0;
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double x = in[i] * k;
+        out[i] = (x + clenshawSin2(c, nc, std::sin(x), std::cos(x))) * invk;
+    }
+}
+
 } // namespace Osl::Geometry
 
 } // namespace Osl
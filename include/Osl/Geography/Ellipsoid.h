@@ -25,6 +25,19 @@ enum class EllipsoidInit
     fromRadiusAndRadius
 };
 
+/*! ********************************************************************
+ * \enum MeridianDistanceMethod
+ * \brief Enumeration of the evaluation methods of the meridian distance.
+ *********************************************************************/
+enum class MeridianDistanceMethod
+{
+    /*! Series expansion in the third flattening (default).*/
+    fromSeries,
+    /*! Legendre's incomplete elliptic integral of the third kind
+     * (reference).*/
+    fromEllipticIntegral
+};
+
 /*! ********************************************************************
  * \brief Class to manage Ellipsoid of revolution for geographic
  * applications.
@@ -217,9 +230,26 @@ public:
      *         {(1-\alpha^2\sin^2(t))\sqrt{1-k^2\sin^2(t)}}
      * \f]
      *
+     * By default, the meridian distance is evaluated from its series
+     * expansion in the third flattening \f$n\f$ (Helmert's expansion, as
+     * extended by Krüger):
+     *
+     * \f[
+     *     m(\phi)=A\left(\phi+\sum_{k=1}^{6}\beta_{2k}\sin(2k\phi)\right),
+     *     \quad A=\dfrac{a}{1+n}\left(1+\dfrac{n^2}{4}+\dfrac{n^4}{64}
+     *         +\dfrac{n^6}{256}\right)
+     * \f]
+     *
+     * whose coefficients are computed once at construction of the
+     * ellipsoid. The series, summed by Clenshaw's method, is truncated
+     * at \f$n^6\f$, far below the micrometer for terrestrial ellipsoids.
+     * The elliptic integral is kept as reference.
+     *
      * \param [in] lat The geodetic latitude.
      * \param [in] degrees The unit of the given latitude. If true (default)
      *        the latitude is provided in degrees, if false it is
+     * \param [in] method The evaluation method, series (default) or
+     *        elliptic integral.
      * \return The meridian distance from equator to the given latitude
      *         in meters.
      * \sa rectifyingLatitude, meridianDistance
@@ -227,7 +257,28 @@ public:
      *               Latitude#Length_of_a_degree_of_latitude"
      *         target="_blank">[Wikipedia]</a>
      * ********************************************************************/
-    double meridianDistance(const double &lat, bool degrees=true);
+    double meridianDistance(const double &lat, bool degrees=true,
+                            MeridianDistanceMethod method=MeridianDistanceMethod::fromSeries);
+
+    /*! ********************************************************************
+     * \brief Compute the meridian distance of arrays of latitudes.
+     *
+     * Batch version of Ellipsoid::meridianDistance from the series
+     * expansion, written to be vectorized by the compiler (through
+     * \em omp \em simd when OpenMP is enabled). The vector overload
+     * resizes the output to the size of the input.
+     *
+     * \param [in] lat Pointer to the \em n geodetic latitudes.
+     * \param [out] m Pointer to the \em n resulting meridian distances in
+     *              meters.
+     * \param [in] n The number of latitudes.
+     * \param [in] degrees The unit of the given latitudes.
+     * \note Input and output arrays must not overlap.
+     * \sa meridianDistance
+     *********************************************************************/
+    void meridianDistance(const double *lat, double *m,
+                          std::size_t n, bool degrees=true) const;
+    void meridianDistance(const vector &lat, vector &m, bool degrees=true) const;
 
     //! Meridian curvature radius
     /*! Compute the meridian curvature radius at a given latitude \f$\phi\f$:
@@ -357,6 +408,10 @@ public:
     * where \f$m(\phi)\f$ is the meridian distance from equator to latitude
     * \f$\phi\f$ and \f$m_p\f$ is the quarter meridian distance
     * (\f$m_p=m(\pi/2)\f$.
+    *
+    * The rectifying latitude is directly given by the series expansion of
+    * the meridian distance (\f$\mu=m(\phi)/A\f$).
+    *
     * \brief rectifyingLatitude
     * \param [in] lat
     * \param [in] degrees
@@ -367,7 +422,16 @@ public:
     double rectifyingLatitude(const double &lat, bool degrees=true);
 
     //! Inverse rectifying latitude
-    /*! TO DO...
+    /*! Compute the geodetic latitude \f$\phi\f$ as function of the
+    * rectifying latitude \f$\mu\f$ from its series expansion in the third
+    * flattening \f$n\f$ (up to \f$n^{10}\f$):
+    *
+    * \f[
+    *     \phi(\mu)=\mu+\sum_{k=1}^{10}b_{2k}\sin(2k\mu)
+    * \f]
+    *
+    * The series is evaluated by Clenshaw summation, so that only one
+    * sine and one cosine of \f$\mu\f$ are needed.
     * \brief inverseRectifyingLatitude
     * \param [in] mu
     * \param [in] degrees
@@ -397,7 +461,16 @@ public:
     double authalicLatitude(const double &lat, bool degrees=true);
 
     //! Inverse authalic latitude
-    /*! TO DO...
+    /*! Compute the geodetic latitude \f$\phi\f$ as function of the
+    * authalic latitude \f$\xi\f$ from its series expansion in the third
+    * flattening \f$n\f$ (up to \f$n^{10}\f$):
+    *
+    * \f[
+    *     \phi(\xi)=\xi+\sum_{k=1}^{10}c_{2k}\sin(2k\xi)
+    * \f]
+    *
+    * The series is evaluated by Clenshaw summation, so that only one
+    * sine and one cosine of \f$\xi\f$ are needed.
     * \brief inverseAuthalicLatitude
     * \param [in] xi
     * \param [in] degrees
@@ -422,7 +495,16 @@ public:
     double conformalLatitude(const double &lat, bool degrees=true);
 
     //! Inverse conformal latitude
-    /*! TO DO...
+    /*! Compute the geodetic latitude \f$\phi\f$ as function of the
+    * conformal latitude \f$\chi\f$ from its series expansion in the third
+    * flattening \f$n\f$ (up to \f$n^{10}\f$):
+    *
+    * \f[
+    *     \phi(\chi)=\chi+\sum_{k=1}^{10}d_{2k}\sin(2k\chi)
+    * \f]
+    *
+    * The series is evaluated by Clenshaw summation, so that only one
+    * sine and one cosine of \f$\chi\f$ are needed.
     * \brief inverseConformalLatitude
     * \param [in] chi
     * \param [in] degrees
@@ -456,6 +538,9 @@ public:
     *     \phi(\psi)=\chi^{-1}\big[\arcsin\big(\tanh(\psi)\big)\big]
     * \f]
     *
+    * where \f$\sin\chi=\tanh\psi\f$ and \f$\cos\chi=1/\cosh\psi\f$
+    * are directly used in the Clenshaw summation of the series.
+    *
     * \brief inverseIsometricLatitude
     * \param [in] psi
     * \param [in] degrees
@@ -463,6 +548,44 @@ public:
     */
     double inverseIsometricLatitude(const double &psi, bool degrees=true);
 
+    /*! ********************************************************************
+     * \brief Batch versions of the auxiliary latitude functions.
+     *
+     * Each function transforms the \em n values of the input array and
+     * writes them in the output array, the vector overloads resizing the
+     * output to the size of the input. They give the same results as the
+     * corresponding single value functions, with loops written to be
+     * vectorized by the compiler (through \em omp \em simd when OpenMP is
+     * enabled): the series of the inverse functions, summed by Clenshaw's
+     * method, have a fixed number of terms and no data-dependent branch.
+     *
+     * \note Input and output arrays must not overlap.
+     * \sa rectifyingLatitude, inverseRectifyingLatitude, inverseAuthalicLatitude,
+     *     conformalLatitude, inverseConformalLatitude, isometricLatitude,
+     *     inverseIsometricLatitude
+     *********************************************************************/
+    void rectifyingLatitude(const double *lat, double *mu,
+                            std::size_t n, bool degrees=true) const;
+    void rectifyingLatitude(const vector &lat, vector &mu, bool degrees=true) const;
+    void inverseRectifyingLatitude(const double *mu, double *lat,
+                                   std::size_t n, bool degrees=true) const;
+    void inverseRectifyingLatitude(const vector &mu, vector &lat, bool degrees=true) const;
+    void inverseAuthalicLatitude(const double *xi, double *lat,
+                                 std::size_t n, bool degrees=true) const;
+    void inverseAuthalicLatitude(const vector &xi, vector &lat, bool degrees=true) const;
+    void conformalLatitude(const double *lat, double *chi,
+                           std::size_t n, bool degrees=true) const;
+    void conformalLatitude(const vector &lat, vector &chi, bool degrees=true) const;
+    void inverseConformalLatitude(const double *chi, double *lat,
+                                  std::size_t n, bool degrees=true) const;
+    void inverseConformalLatitude(const vector &chi, vector &lat, bool degrees=true) const;
+    void isometricLatitude(const double *lat, double *psi,
+                           std::size_t n, bool degrees=true) const;
+    void isometricLatitude(const vector &lat, vector &psi, bool degrees=true) const;
+    void inverseIsometricLatitude(const double *psi, double *lat,
+                                  std::size_t n, bool degrees=true) const;
+    void inverseIsometricLatitude(const vector &psi, vector &lat, bool degrees=true) const;
+
     /*! ********************************************************************
      * \brief Transform geodetic coordinates to geocentric (ECEF) coordinates.
      *
@@ -561,6 +684,103 @@ public:
                               double &lon, double &lat, double &alt,
                               bool degrees=true, std::size_t maxiter=10);
 
+    /*! ********************************************************************
+     * \brief Transform arrays of geodetic coordinates to geocentric (ECEF)
+     *        coordinates.
+     *
+     * Batch version of Ellipsoid::geodeticToGeocentric working on
+     * structure-of-arrays data: the \f$i\f$-th point is given by
+     * \f$(\lambda_i,\phi_i,H_i)\f$=(lon[i], lat[i], alt[i]) and its
+     * geocentric coordinates are written in (x[i], y[i], z[i]).
+     *
+     * The loop has no data-dependent branch and is written to be
+     * vectorized by the compiler (through \em omp \em simd when OpenMP is
+     * enabled).
+     *
+     * \param [in] lon, lat, alt Pointers to the \em n geodetic coordinates.
+     * \param [out] x, y, z Pointers to the \em n resulting geocentric
+     *              coordinates in meters.
+     * \param [in] n The number of points to transform.
+     * \param [in] degrees The unit of the given longitudes and latitudes.
+     * \note Input and output arrays must not overlap.
+     * \sa geodeticToGeocentric
+     *********************************************************************/
+    void geodeticToGeocentric(const double *lon, const double *lat, const double *alt,
+                              double *x, double *y, double *z,
+                              std::size_t n, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Transform vectors of geodetic coordinates to geocentric (ECEF)
+     *        coordinates.
+     *
+     * Output vectors are resized to the size of the input vectors.
+     *
+     * \sa geodeticToGeocentric(const double*, const double*, const double*,
+     *     double*, double*, double*, std::size_t, bool) const
+     *********************************************************************/
+    void geodeticToGeocentric(const vector &lon, const vector &lat, const vector &alt,
+                              vector &x, vector &y, vector &z, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Transform arrays of geocentric (ECEF) coordinates to geodetic
+     *        coordinates.
+     *
+     * Batch version of Ellipsoid::geocentricToGeodetic working on
+     * structure-of-arrays data. Contrary to the single point version, the
+     * latitude is not computed through a fixed-point iteration stopped on
+     * a convergence criterion but through a fixed number of Bowring's
+     * iterations \cite Bowring_85 on the parametric latitude \f$u\f$,
+     * written with algebraic operations only:
+     *
+     * \f[
+     *     \left\{\begin{array}{rcl}
+     *         (\cos u_0,\sin u_0) & \propto & (bp, aZ) \\
+     *         \tan\phi_{k} & = & \dfrac{Z+e'^2b\sin^3u_k}
+     *                                  {p-e^2a\cos^3u_k} \\
+     *         \tan u_{k+1} & = & (1-f)\tan\phi_{k}
+     *     \end{array}\right.
+     * \f]
+     *
+     * with \f$p=\sqrt{X^2+Y^2}\f$ and \f$e'^2\f$ the second eccentricity
+     * squared. Two iterations are made, providing an accuracy far below
+     * the micrometer for terrestrial points. Only two arc-tangents (for
+     * \f$\lambda\f$ and \f$\phi\f$) and square roots are needed per point,
+     * so that the loop has no data-dependent branch and can be vectorized
+     * by the compiler (through \em omp \em simd when OpenMP is enabled).
+     * The results are not bit-for-bit those of the scalar method (the
+     * algorithm differs, and vector math functions may round differently):
+     * on random terrestrial points they agree within \f$10^{-13}\f$° in
+     * latitude and \f$10^{-8}\f$ m in altitude.
+     *
+     * Altitude is then computed from the modified Bowring's expression
+     * (see Ellipsoid::geocentricToGeodetic).
+     *
+     * \param [in] x, y, z Pointers to the \em n geocentric coordinates in
+     *             meters.
+     * \param [out] lon, lat, alt Pointers to the \em n resulting geodetic
+     *              coordinates.
+     * \param [in] n The number of points to transform.
+     * \param [in] degrees The unit of the returned longitudes and latitudes.
+     * \note Input and output arrays must not overlap. The center of the
+     *       ellipsoid (\f$X=Y=Z=0\f$) is not a valid input.
+     * \sa geocentricToGeodetic
+     *********************************************************************/
+    void geocentricToGeodetic(const double *x, const double *y, const double *z,
+                              double *lon, double *lat, double *alt,
+                              std::size_t n, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Transform vectors of geocentric (ECEF) coordinates to geodetic
+     *        coordinates.
+     *
+     * Output vectors are resized to the size of the input vectors.
+     *
+     * \sa geocentricToGeodetic(const double*, const double*, const double*,
+     *     double*, double*, double*, std::size_t, bool) const
+     *********************************************************************/
+    void geocentricToGeodetic(const vector &x, const vector &y, const vector &z,
+                              vector &lon, vector &lat, vector &alt, bool degrees=true) const;
+
 
 private:
     // ============== PRIVATE CLASS MEMBERS ==============
@@ -573,16 +793,24 @@ private:
            m_e,    // the ellipsoïd excentricity
            m_ep2,  // the second excentricity squared
            m_mp,   // Length of a quarter meridian
+           m_A,    // Meridian distance by radian of rectifying latitude
            // Convenient value used multiple times
            m_1_e2,    // 1 - m_e2
            m_a_1_e2,  // m_a * (1 - m_e2)
            m_1_f;     // 1 - m_f
-    vector m_phimu,  // Coefficients of the inverse rectifying latitude
+    vector m_muphi,  // Coefficients of the rectifying latitude
+           m_phimu,  // Coefficients of the inverse rectifying latitude
            m_phixi,  // Coefficients of the inverse authalic latitude
            m_phichi; // Coefficients of the inverse conformal latitude
-    const std::size_t m_size_coeffs = 10;
+    static constexpr std::size_t m_size_coeffs = 10,
+                                 m_size_meridian_coeffs = 6;
     // ============== PRIVATE CLASS METHODS ==============
+    void initMeridianDistanceCoeffs();
     void initInverseLattitudeCoeffs();
+    // Batch sum of x + sum_k coeffs[k-1]*sin(2kx), for the forward and
+    // inverse auxiliary latitude series
+    void latitudeSeries(const vector &coeffs, const double *in, double *out,
+                        std::size_t n, bool degrees) const;
 };
 
 // Definition of classical Ellipsoïds
@@ -189,8 +189,9 @@ GeoPoint GeoPoint::toEllipsoid(Ellipsoid* elps2,
 
 void GeoPoint::toEllipsoidInplace(Ellipsoid* elps2,
                                   const double &Tx, const double &Ty, const double &Tz,
-                                  const double &Rx=0.0, const double &Ry=0.0, const double &Rz=0.0,
-                                  const double &scale=0.0)
+                                  const double &Rx, const double &Ry, const double &Rz,
+                                  const double &scale)
+{
     m_elps = elps2;
     double sscale = 1.0 + scale;
     // Small angles rotation matrix :
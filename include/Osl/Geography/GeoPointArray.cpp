@@ -0,0 +1,303 @@
+/*! ********************************************************************
+ * \file GeoPointArray.cpp
+ * \brief Source file of Osl::Geography::GeoPointArray class.
+ *********************************************************************/
+
+#include <algorithm>
+#include "GeoPointArray.h"
+#include "Osl/Batch.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+// ============== CONSTRUCTOR ==============
+GeoPointArray::GeoPointArray()
+    : m_elps(nullptr), m_size(0),
+      m_xyz_lo(0), m_xyz_hi(0), m_lla_lo(0), m_lla_hi(0) {}
+
+GeoPointArray::GeoPointArray(Ellipsoid* elps)
+    : m_elps(elps), m_size(0),
+      m_xyz_lo(0), m_xyz_hi(0), m_lla_lo(0), m_lla_hi(0) {}
+
+GeoPointArray::GeoPointArray(Ellipsoid* elps,
+                             const vector &X, const vector &Y, const vector &Z,
+                             enum GeoPointInit init, bool degrees)
+    : m_elps(elps), m_size(0),
+      m_xyz_lo(0), m_xyz_hi(0), m_lla_lo(0), m_lla_hi(0)
+{
+    if (init == GeoPointInit::fromGeodetic)
+        this->setGeodeticCoords(X, Y, Z, degrees);
+    else if (init == GeoPointInit::fromGeocentric)
+        this->setGeocentricCoords(X, Y, Z);
+}
+
+// Copy constructor
+GeoPointArray::GeoPointArray(const GeoPointArray &other)
+    : m_elps(other.m_elps), m_size(other.m_size),
+      m_x(other.m_x), m_y(other.m_y), m_z(other.m_z),
+      m_lon(other.m_lon), m_lat(other.m_lat), m_alt(other.m_alt),
+      m_xyz_lo(other.m_xyz_lo), m_xyz_hi(other.m_xyz_hi),
+      m_lla_lo(other.m_lla_lo), m_lla_hi(other.m_lla_hi) {}
+
+// ============== DESTRUCTOR ==============
+GeoPointArray::~GeoPointArray() {}
+
+// ============== CLASS METHODS ==============
+// ********** SETTER **********
+void GeoPointArray::setGeocentricCoords(const double *x, const double *y, const double *z,
+                                        std::size_t n)
+{
+    m_size = n;
+    m_x.assign(x, x + n);
+    m_y.assign(y, y + n);
+    m_z.assign(z, z + n);
+    // All the geodetic coordinates are stale
+    m_xyz_lo = m_xyz_hi = 0;
+    m_lla_lo = 0;
+    m_lla_hi = n;
+}
+
+void GeoPointArray::setGeocentricCoords(const vector &x, const vector &y, const vector &z)
+{
+    std::size_t n = x.size();
+    if ((y.size() != n) || (z.size() != n))
+        throw std::invalid_argument("GeoPointArray.setGeocentricCoords():\n"
+                                    "\t'x', 'y' and 'z' must have same size.");
+    this->setGeocentricCoords(x.data(), y.data(), z.data(), n);
+}
+
+void GeoPointArray::setGeodeticCoords(const double *lon, const double *lat, const double *alt,
+                                      std::size_t n, bool degrees)
+{
+    m_size = n;
+    m_lon.resize(n);
+    m_lat.resize(n);
+    m_alt.assign(alt, alt + n);
+    const double k = degrees ? Constants::m_degtorad : 1.0;
+    double *plon = m_lon.data(),
+           *plat = m_lat.data();
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        plon[i] = lon[i] * k;
+        plat[i] = lat[i] * k;
+    }
+    // All the geocentric coordinates are stale
+    m_lla_lo = m_lla_hi = 0;
+    m_xyz_lo = 0;
+    m_xyz_hi = n;
+}
+
+void GeoPointArray::setGeodeticCoords(const vector &lon, const vector &lat, const vector &alt,
+                                      bool degrees)
+{
+    std::size_t n = lon.size();
+    if ((lat.size() != n) || (alt.size() != n))
+        throw std::invalid_argument("GeoPointArray.setGeodeticCoords():\n"
+                                    "\t'lon', 'lat' and 'alt' must have same size.");
+    this->setGeodeticCoords(lon.data(), lat.data(), alt.data(), n, degrees);
+}
+
+void GeoPointArray::setGeocentricPoint(std::size_t i, const double &x, const double &y, const double &z)
+{
+    this->checkIndex(i, "GeoPointArray.setGeocentricPoint():\n"
+                        "\t'i' is out of range.");
+    // The other geocentric points must be valid before the geodetic ones get stale
+    this->updateGeocentric();
+    m_x[i] = x;
+    m_y[i] = y;
+    m_z[i] = z;
+    if (m_lla_lo < m_lla_hi)
+    {
+        m_lla_lo = std::min(m_lla_lo, i);
+        m_lla_hi = std::max(m_lla_hi, i + 1);
+    }
+    else
+    {
+        m_lla_lo = i;
+        m_lla_hi = i + 1;
+    }
+}
+
+void GeoPointArray::setGeodeticPoint(std::size_t i, const double &lon, const double &lat,
+                                     const double &alt, bool degrees)
+{
+    this->checkIndex(i, "GeoPointArray.setGeodeticPoint():\n"
+                        "\t'i' is out of range.");
+    // The other geodetic points must be valid before the geocentric ones get stale
+    this->updateGeodetic();
+    m_lon[i] = degrees ? lon * Constants::m_degtorad : lon;
+    m_lat[i] = degrees ? lat * Constants::m_degtorad : lat;
+    m_alt[i] = alt;
+    if (m_xyz_lo < m_xyz_hi)
+    {
+        m_xyz_lo = std::min(m_xyz_lo, i);
+        m_xyz_hi = std::max(m_xyz_hi, i + 1);
+    }
+    else
+    {
+        m_xyz_lo = i;
+        m_xyz_hi = i + 1;
+    }
+}
+
+void GeoPointArray::update() const
+{
+    this->updateGeocentric();
+    this->updateGeodetic();
+}
+
+void GeoPointArray::clear()
+{
+    m_size = 0;
+    vector().swap(m_x);
+    vector().swap(m_y);
+    vector().swap(m_z);
+    vector().swap(m_lon);
+    vector().swap(m_lat);
+    vector().swap(m_alt);
+    m_xyz_lo = m_xyz_hi = m_lla_lo = m_lla_hi = 0;
+}
+
+// ********** GETTER **********
+std::size_t GeoPointArray::size() const { return m_size; }
+bool GeoPointArray::empty() const { return m_size == 0; }
+Ellipsoid* GeoPointArray::getEllipsoidPtr() const { return m_elps; }
+bool GeoPointArray::isGeocentricUpToDate() const { return m_xyz_lo >= m_xyz_hi; }
+bool GeoPointArray::isGeodeticUpToDate() const { return m_lla_lo >= m_lla_hi; }
+
+const vector &GeoPointArray::getX() const { this->updateGeocentric(); return m_x; }
+const vector &GeoPointArray::getY() const { this->updateGeocentric(); return m_y; }
+const vector &GeoPointArray::getZ() const { this->updateGeocentric(); return m_z; }
+const vector &GeoPointArray::getLonRad() const { this->updateGeodetic(); return m_lon; }
+const vector &GeoPointArray::getLatRad() const { this->updateGeodetic(); return m_lat; }
+const vector &GeoPointArray::getAlt() const { this->updateGeodetic(); return m_alt; }
+
+void GeoPointArray::getGeocentricCoords(vector &x, vector &y, vector &z) const
+{
+    this->updateGeocentric();
+    x = m_x;
+    y = m_y;
+    z = m_z;
+}
+
+void GeoPointArray::getGeodeticCoords(vector &lon, vector &lat, vector &alt, bool degrees) const
+{
+    this->updateGeodetic();
+    lon.resize(m_size);
+    lat.resize(m_size);
+    alt = m_alt;
+    const double k = degrees ? Constants::m_radtodeg : 1.0;
+    const double *plon = m_lon.data(),
+                 *plat = m_lat.data();
+    double *olon = lon.data(),
+           *olat = lat.data();
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < m_size ; ++i)
+    {
+        olon[i] = plon[i] * k;
+        olat[i] = plat[i] * k;
+    }
+}
+
+void GeoPointArray::getGeocentricPoint(std::size_t i, double &x, double &y, double &z) const
+{
+    this->checkIndex(i, "GeoPointArray.getGeocentricPoint():\n"
+                        "\t'i' is out of range.");
+    this->updateGeocentric();
+    x = m_x[i];
+    y = m_y[i];
+    z = m_z[i];
+}
+
+void GeoPointArray::getGeodeticPoint(std::size_t i, double &lon, double &lat, double &alt,
+                                     bool degrees) const
+{
+    this->checkIndex(i, "GeoPointArray.getGeodeticPoint():\n"
+                        "\t'i' is out of range.");
+    this->updateGeodetic();
+    const double k = degrees ? Constants::m_radtodeg : 1.0;
+    lon = m_lon[i] * k;
+    lat = m_lat[i] * k;
+    alt = m_alt[i];
+}
+
+GeoPoint GeoPointArray::getGeoPoint(std::size_t i) const
+{
+    this->checkIndex(i, "GeoPointArray.getGeoPoint():\n"
+                        "\t'i' is out of range.");
+    // A geocentric initialization would need the iterative inverse transform
+    this->updateGeodetic();
+    return GeoPoint(m_elps, m_lon[i], m_lat[i], m_alt[i], GeoPointInit::fromGeodetic, false);
+}
+
+// ============== OPERATORS ==============
+// Assignement from another GeoPointArray
+GeoPointArray GeoPointArray::operator=(const GeoPointArray &other)
+{
+    m_elps = other.m_elps;
+    m_size = other.m_size;
+    m_x = other.m_x;           // Geocentric coordinates [m]
+    m_y = other.m_y;
+    m_z = other.m_z;
+    m_lon = other.m_lon;       // Geodetic coordinates [rad, rad, m]
+    m_lat = other.m_lat;
+    m_alt = other.m_alt;
+    m_xyz_lo = other.m_xyz_lo; // Stale ranges
+    m_xyz_hi = other.m_xyz_hi;
+    m_lla_lo = other.m_lla_lo;
+    m_lla_hi = other.m_lla_hi;
+    return *this;
+}
+
+// ============== PRIVATE CLASS METHODS ==============
+void GeoPointArray::updateGeocentric() const
+{
+    if (m_xyz_lo >= m_xyz_hi)
+        return;
+    // The columns are only allocated on the first access
+    m_x.resize(m_size);
+    m_y.resize(m_size);
+    m_z.resize(m_size);
+    // Blocks of the stale range of points
+    const std::size_t lo = m_xyz_lo;
+    detail::for_each_block(m_xyz_hi - lo, [&](std::size_t k0, std::size_t nb)
+    {
+        const std::size_t k = lo + k0;
+        m_elps->geodeticToGeocentric(m_lon.data() + k, m_lat.data() + k, m_alt.data() + k,
+                                     m_x.data() + k, m_y.data() + k, m_z.data() + k,
+                                     nb, false);
+    });
+    m_xyz_lo = m_xyz_hi = 0;
+}
+
+void GeoPointArray::updateGeodetic() const
+{
+    if (m_lla_lo >= m_lla_hi)
+        return;
+    // The columns are only allocated on the first access
+    m_lon.resize(m_size);
+    m_lat.resize(m_size);
+    m_alt.resize(m_size);
+    // Blocks of the stale range of points
+    const std::size_t lo = m_lla_lo;
+    detail::for_each_block(m_lla_hi - lo, [&](std::size_t k0, std::size_t nb)
+    {
+        const std::size_t k = lo + k0;
+        m_elps->geocentricToGeodetic(m_x.data() + k, m_y.data() + k, m_z.data() + k,
+                                     m_lon.data() + k, m_lat.data() + k, m_alt.data() + k,
+                                     nb, false);
+    });
+    m_lla_lo = m_lla_hi = 0;
+}
+
+void GeoPointArray::checkIndex(std::size_t i, const char *msg) const
+{
+    if (i >= m_size)
+        throw std::out_of_range(msg);
+}
+
+} // namespace Osl::Geography
+
+} // namespace Osl
@@ -0,0 +1,165 @@
+/*! ********************************************************************
+ * \file GeoPointArray.h
+ * \brief Header file of Osl::Geography::GeoPointArray class.
+ *********************************************************************/
+
+#ifndef OSL_GEOGRAPHY_GEOPOINTARRAY_H
+#define OSL_GEOGRAPHY_GEOPOINTARRAY_H
+
+#include "GeoPoint.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+/*! ********************************************************************
+ * \brief Class to manage a set of points of one Ellipsoid stored as
+ * columns (structure-of-arrays).
+ *
+ * Contrary to GeoPoint, which computes both its geocentric and geodetic
+ * coordinates as soon as one of them is set, a GeoPointArray only stores
+ * the representation it is given. The other one is computed lazily, in
+ * bulk through the batch methods of the Ellipsoid, the first time it is
+ * accessed. Its columns are not even allocated before that.
+ *
+ * Each representation tracks the range of its points that are stale
+ * (dirty), so that modifying a few points only recomputes that range on
+ * the next access of the other representation. Longitudes and latitudes
+ * are stored in radians, as in GeoPoint.
+ *
+ * \warning The column getters are const but may update the stale
+ *          representation: a GeoPointArray must not be accessed from
+ *          several threads without synchronization unless both
+ *          representations are up to date (see GeoPointArray::update).
+ * \note The ellipsoid given at construction must outlive the array.
+ * \sa GeoPoint
+ *********************************************************************/
+class GeoPointArray
+{
+public:
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor.
+    GeoPointArray();
+
+    //! Empty GeoPointArray of the given ellipsoid.
+    GeoPointArray(Ellipsoid* elps);
+
+    /*! ********************************************************************
+     * \brief GeoPointArray constructor.
+     * \param [in] elps The reference ellipsoid of the points.
+     * \param [in] X (lon) The geocentric (geodetic) coordinates of the points.
+     * \param [in] Y (lat)
+     * \param [in] Z (alt)
+     * \param [in] init The type of the given coordinates.
+     * \param [in] degrees (It has no effect if init==GeoPointInit::fromGeocentric)
+     *********************************************************************/
+    GeoPointArray(Ellipsoid* elps,
+                  const vector &X, const vector &Y, const vector &Z,
+                  enum GeoPointInit init=GeoPointInit::fromGeodetic,
+                  bool degrees=true);
+
+    //! Copy constructor
+    GeoPointArray(const GeoPointArray &other);
+
+    // ============== DESTRUCTOR ==============
+    //! Default destructor
+    ~GeoPointArray();
+
+    // ============== CLASS METHODS ==============
+    // ********** SETTER **********
+    /*! ********************************************************************
+     * \brief Sets all the points from geocentric coordinates.
+     *
+     * The geodetic coordinates are only computed on their next access.
+     *
+     * \param [in] x, y, z Pointers to the \em n geocentric coordinates [m].
+     * \param [in] n The number of points.
+     *********************************************************************/
+    void setGeocentricCoords(const double *x, const double *y, const double *z, std::size_t n);
+    void setGeocentricCoords(const vector &x, const vector &y, const vector &z);
+
+    /*! ********************************************************************
+     * \brief Sets all the points from geodetic coordinates.
+     *
+     * The geocentric coordinates are only computed on their next access.
+     *
+     * \param [in] lon, lat Pointers to the \em n geodetic coordinates.
+     * \param [in] alt Pointer to the \em n heights above the ellipsoid [m].
+     * \param [in] n The number of points.
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    void setGeodeticCoords(const double *lon, const double *lat, const double *alt,
+                           std::size_t n, bool degrees=true);
+    void setGeodeticCoords(const vector &lon, const vector &lat, const vector &alt,
+                           bool degrees=true);
+
+    //! Sets the geocentric coordinates of the point \em i.
+    void setGeocentricPoint(std::size_t i, const double &x, const double &y, const double &z);
+    //! Sets the geodetic coordinates of the point \em i.
+    void setGeodeticPoint(std::size_t i, const double &lon, const double &lat, const double &alt,
+                          bool degrees=true);
+
+    /*! ********************************************************************
+     * \brief Computes the stale coordinates of both representations.
+     *
+     * After this call, and until the next modification, the array can be
+     * read concurrently.
+     *********************************************************************/
+    void update() const;
+
+    //! Removes all the points and releases the memory.
+    void clear();
+
+    // ********** GETTER **********
+    std::size_t size() const;
+    bool empty() const;
+    Ellipsoid* getEllipsoidPtr() const;
+    //! True if the geocentric coordinates of all the points are up to date.
+    bool isGeocentricUpToDate() const;
+    //! True if the geodetic coordinates of all the points are up to date.
+    bool isGeodeticUpToDate() const;
+
+    // Columns of the geocentric coordinates [m]
+    const vector &getX() const;
+    const vector &getY() const;
+    const vector &getZ() const;
+    // Columns of the geodetic coordinates [rad, rad, m]
+    const vector &getLonRad() const;
+    const vector &getLatRad() const;
+    const vector &getAlt() const;
+
+    //! Copy of the geocentric coordinates of all the points.
+    void getGeocentricCoords(vector &x, vector &y, vector &z) const;
+    //! Copy of the geodetic coordinates of all the points.
+    void getGeodeticCoords(vector &lon, vector &lat, vector &alt, bool degrees=true) const;
+
+    //! Geocentric coordinates of the point \em i.
+    void getGeocentricPoint(std::size_t i, double &x, double &y, double &z) const;
+    //! Geodetic coordinates of the point \em i.
+    void getGeodeticPoint(std::size_t i, double &lon, double &lat, double &alt,
+                          bool degrees=true) const;
+    //! The point \em i as a GeoPoint.
+    GeoPoint getGeoPoint(std::size_t i) const;
+
+    // ============== OPERATORS ==============
+    GeoPointArray operator=(const GeoPointArray &other); // Assignement from another GeoPointArray
+
+private:
+    // ============== PRIVATE CLASS MEMBERS ==============
+    Ellipsoid* m_elps;
+    std::size_t m_size;
+    mutable vector m_x, m_y, m_z;             // Geocentric coordinates [m]
+    mutable vector m_lon, m_lat, m_alt;       // Geodetic coordinates [rad, rad, m]
+    mutable std::size_t m_xyz_lo, m_xyz_hi,   // Stale range [lo, hi) of the geocentric coordinates
+                        m_lla_lo, m_lla_hi;   // Stale range [lo, hi) of the geodetic coordinates
+    // ============== PRIVATE CLASS METHODS ==============
+    void updateGeocentric() const;
+    void updateGeodetic() const;
+    void checkIndex(std::size_t i, const char *msg) const;
+};
+
+} // namespace Osl::Geography
+
+} // namespace Osl
+
+#endif // OSL_GEOGRAPHY_GEOPOINTARRAY_H
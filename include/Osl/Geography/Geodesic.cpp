@@ -0,0 +1,820 @@
+/*! ********************************************************************
+ * \file Geodesic.cpp
+ * \brief Source file of Osl::Geography::Geodesic class.
+ *********************************************************************/
+
+#include <algorithm>
+#include "Geodesic.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+namespace { // Local functions
+
+constexpr std::size_t nC = 6; // Order of the series expansions
+
+// Tolerances of the inverse problem
+const double tiny = std::sqrt(std::numeric_limits<double>::min()),
+             tol0 = Constants::n_machine_eps,
+             tol1 = 200.0 * tol0,
+             tol2 = std::sqrt(tol0),
+             tolb = tol0 * tol2,
+             xthresh = 1000.0 * tol2;
+// Maximum number of Newton's iterations and of bisections
+constexpr unsigned maxit1 = 20,
+                   maxit2 = maxit1 + std::numeric_limits<double>::digits + 10;
+
+inline void norm2(double &s, double &c)
+{
+    double r = std::hypot(s, c);
+    s /= r;
+    c /= r;
+}
+
+// Round very small angles (in degrees) so that sums with them are exact
+inline double angRound(const double &x)
+{
+    const double z = 1.0 / 16.0;
+    double y = std::abs(x);
+    y = y < z ? z - (z - y) : y;
+    return std::copysign(y, x);
+}
+
+// Difference of longitudes y - x reduced to ]-180, 180]
+inline double angDiff(const double &x, const double &y)
+{
+    double d = std::remainder(std::remainder(y, 360.0) - std::remainder(x, 360.0), 360.0);
+    return (d == -180.0) ? 180.0 : d;
+}
+
+inline double angNormalize(const double &x)
+{
+    double y = std::remainder(x, 360.0);
+    return (std::abs(y) == 180.0) ? std::copysign(180.0, x) : y;
+}
+
+inline double latFix(const double &x)
+{
+    return std::abs(x) > 90.0 ? std::numeric_limits<double>::quiet_NaN() : x;
+}
+
+// Sine and cosine of an angle in degrees, exact for multiples of 90°
+inline void sincosd(const double &x, double &sinx, double &cosx)
+{
+    int q = 0;
+    double r = std::remquo(x, 90.0, &q) * Constants::m_degtorad,
+           s = std::sin(r),
+           c = std::cos(r);
+    switch (static_cast<unsigned>(q) & 3U)
+    {
+    case 0U:  sinx =  s; cosx =  c; break;
+    case 1U:  sinx =  c; cosx = -s; break;
+    case 2U:  sinx = -s; cosx = -c; break;
+    default:  sinx = -c; cosx =  s; break;
+    }
+    cosx += 0.0; // -0 -> 0
+}
+
+// atan2 in degrees, exact for multiples of 90°
+inline double atan2d(double y, double x)
+{
+    int q = 0;
+    if (std::abs(y) > std::abs(x))
+    {
+        std::swap(x, y);
+        q = 2;
+    }
+    if (std::signbit(x))
+    {
+        x = -x;
+        ++q;
+    }
+    double ang = std::atan2(y, x) * Constants::m_radtodeg;
+    switch (q)
+    {
+    case 1: ang = std::copysign(180.0, y) - ang; break;
+    case 2: ang = 90.0 - ang; break;
+    case 3: ang = -90.0 + ang; break;
+    default: break;
+    }
+    return ang;
+}
+
+// Clenshaw summation of sum_{l=1}^{n} c[l] * sin(2l sigma) from sin(sigma)
+// and cos(sigma) (c[0] is unused)
+inline double sinSeries(const double *c, std::size_t n,
+                        const double &ssig, const double &csig)
+{
+    double ar = 2.0 * (csig - ssig) * (csig + ssig), // 2 * cos(2 sigma)
+           b1 = 0.0,
+           b2 = 0.0;
+    for (std::size_t l = n ; l > 0 ; --l)
+    {
+        double b0 = ar * b1 - b2 + c[l];
+        b2 = b1;
+        b1 = b0;
+    }
+    return 2.0 * ssig * csig * b1; // sin(2 sigma) * b1
+}
+
+// (1 - eps) * A1 - 1
+inline double A1m1f(const double &eps)
+{
+    double eps2 = eps * eps,
+           t = eps2 * (eps2 * (eps2 + 4.0) + 64.0) / 256.0;
+    return (t + eps) / (1.0 - eps);
+}
+
+// Coefficients C1[l] of the distance series
+inline void C1f(const double &eps, double *c)
+{
+    double eps2 = eps * eps, d = eps;
+    c[1] = d * (eps2 * (6.0 - eps2) - 16.0) / 32.0;
+    d *= eps;
+    c[2] = d * (eps2 * (64.0 - 9.0 * eps2) - 128.0) / 2048.0;
+    d *= eps;
+    c[3] = d * (9.0 * eps2 - 16.0) / 768.0;
+    d *= eps;
+    c[4] = d * (3.0 * eps2 - 5.0) / 512.0;
+    d *= eps;
+    c[5] = -7.0 * d / 1280.0;
+    d *= eps;
+    c[6] = -7.0 * d / 2048.0;
+}
+
+// Coefficients C1'[l] of the reverted distance series
+inline void C1pf(const double &eps, double *c)
+{
+    double eps2 = eps * eps, d = eps;
+    c[1] = d * (eps2 * (205.0 * eps2 - 432.0) + 768.0) / 1536.0;
+    d *= eps;
+    c[2] = d * (eps2 * (4005.0 * eps2 - 4736.0) + 3840.0) / 12288.0;
+    d *= eps;
+    c[3] = d * (116.0 - 225.0 * eps2) / 384.0;
+    d *= eps;
+    c[4] = d * (2695.0 - 7173.0 * eps2) / 7680.0;
+    d *= eps;
+    c[5] = 3467.0 * d / 7680.0;
+    d *= eps;
+    c[6] = 38081.0 * d / 61440.0;
+}
+
+// (1 + eps) * A2 - 1
+inline double A2m1f(const double &eps)
+{
+    double eps2 = eps * eps,
+           t = eps2 * (eps2 * (-11.0 * eps2 - 28.0) - 192.0) / 256.0;
+    return (t - eps) / (1.0 + eps);
+}
+
+// Coefficients C2[l] of the reduced length series
+inline void C2f(const double &eps, double *c)
+{
+    double eps2 = eps * eps, d = eps;
+    c[1] = d * (eps2 * (eps2 + 2.0) + 16.0) / 32.0;
+    d *= eps;
+    c[2] = d * (eps2 * (35.0 * eps2 + 64.0) + 384.0) / 2048.0;
+    d *= eps;
+    c[3] = d * (15.0 * eps2 + 80.0) / 768.0;
+    d *= eps;
+    c[4] = d * (7.0 * eps2 + 35.0) / 512.0;
+    d *= eps;
+    c[5] = 63.0 * d / 1280.0;
+    d *= eps;
+    c[6] = 77.0 * d / 2048.0;
+}
+
+// Distance s12 / b and reduced length m12 / b along the geodesic, with
+// m0 = A1 - A2
+inline void lengths(const double &eps, const double &sig12,
+                    const double &ssig1, const double &csig1, const double &dn1,
+                    const double &ssig2, const double &csig2, const double &dn2,
+                    double &s12b, double &m12b, double &m0)
+{
+    double Ca[nC + 1], Cb[nC + 1];
+    double A1 = A1m1f(eps);
+    C1f(eps, Ca);
+    double A2 = A2m1f(eps);
+    C2f(eps, Cb);
+    m0 = A1 - A2;
+    A1 += 1.0;
+    A2 += 1.0;
+    double B1 = sinSeries(Ca, nC, ssig2, csig2) - sinSeries(Ca, nC, ssig1, csig1),
+           B2 = sinSeries(Cb, nC, ssig2, csig2) - sinSeries(Cb, nC, ssig1, csig1),
+           J12 = m0 * sig12 + (A1 * B1 - A2 * B2);
+    s12b = A1 * (sig12 + B1);
+    m12b = dn2 * (csig1 * ssig2) - dn1 * (ssig1 * csig2) - csig1 * csig2 * J12;
+}
+
+// Solution of k^4 + 2k^3 - (x^2 + y^2 - 1)k^2 - 2y^2k - y^2 = 0 for the
+// positive root k
+inline double astroid(const double &x, const double &y)
+{
+    double p = x * x,
+           q = y * y,
+           r = (p + q - 1.0) / 6.0;
+    if (q == 0.0 && r <= 0.0)
+        return 0.0;
+    double S = p * q / 4.0,
+           r2 = r * r,
+           r3 = r * r2,
+           disc = S * (S + 2.0 * r3),
+           u = r;
+    if (disc >= 0.0)
+    {
+        double T3 = S + r3;
+        T3 += T3 < 0.0 ? -std::sqrt(disc) : std::sqrt(disc);
+        double T = std::cbrt(T3);
+        u += T + (T != 0.0 ? r2 / T : 0.0);
+    }
+    else
+    {
+        double ang = std::atan2(std::sqrt(-disc), -(S + r3));
+        u += 2.0 * r * std::cos(ang / 3.0);
+    }
+    double v = std::sqrt(u * u + q),
+           uv = u < 0.0 ? q / (v - u) : u + v,
+           w = (uv - q) / (2.0 * v);
+    return uv / (std::sqrt(uv + w * w) + w);
+}
+
+} // namespace
+
+// ============== CONSTRUCTOR ==============
+Geodesic::Geodesic() {}
+
+Geodesic::Geodesic(const Ellipsoid* elps)
+    : m_a(elps->getEquatorialRadius()),   // Equatorial radius [m]
+      m_f(elps->getFirstFlattening()),    // first flattening parameter
+      m_f1(1.0 - m_f),                    // 1 - m_f
+      m_b(elps->getPolarRadius()),        // Polar radius [m]
+      m_n(elps->getThirdFlattening())     // third flattening parameter
+{
+    if (!(std::abs(m_f) < 0.02))
+        throw std::invalid_argument("Geodesic constructor:\n"
+                                    "\t'elps' flattening must be in ]-1/50, 1/50[.");
+    m_ep2 = elps->getEccentricitySquared() / (m_f1 * m_f1);
+    m_etol2 = 0.1 * tol2 / std::sqrt(std::max(0.001, std::abs(m_f)) *
+                                     std::min(1.0, 1.0 - m_f / 2.0) / 2.0);
+    // Initialization of the series coefficients depending on the ellipsoid
+    this->initSeriesCoeffs();
+}
+
+// Copy constructor
+Geodesic::Geodesic(const Geodesic &other)
+    : m_a(other.m_a), m_f(other.m_f), m_f1(other.m_f1),
+      m_b(other.m_b), m_n(other.m_n), m_ep2(other.m_ep2),
+      m_etol2(other.m_etol2)
+{
+    std::copy(other.m_A3x, other.m_A3x + m_order, m_A3x);
+    std::copy(&other.m_C3x[0][0], &other.m_C3x[0][0] + m_order * m_order, &m_C3x[0][0]);
+}
+
+// ============== DESTRUCTOR ==============
+Geodesic::~Geodesic() {}
+
+// ============== OPERATORS ==============
+// Assignement from another Geodesic
+Geodesic Geodesic::operator=(const Geodesic &other)
+{
+    m_a = other.m_a;          // Equatorial radius [m]
+    m_f = other.m_f;          // first flattening parameter
+    m_f1 = other.m_f1;        // 1 - m_f
+    m_b = other.m_b;          // Polar radius [m]
+    m_n = other.m_n;          // third flattening parameter
+    m_ep2 = other.m_ep2;      // the second excentricity squared
+    m_etol2 = other.m_etol2;  // Tolerance for the short lines
+    std::copy(other.m_A3x, other.m_A3x + m_order, m_A3x);
+    std::copy(&other.m_C3x[0][0], &other.m_C3x[0][0] + m_order * m_order, &m_C3x[0][0]);
+    return *this;
+}
+
+// ============== GEODESIC PROBLEMS ==============
+void Geodesic::direct(const double &lon1, const double &lat1, const double &azi1,
+                      const double &s12,
+                      double &lon2, double &lat2, double &azi2, bool degrees) const
+{
+    const double k = degrees ? 1.0 : Constants::m_radtodeg;
+    double lon1_deg = lon1 * k,
+           lat1_deg = latFix(lat1 * k),
+           azi1_deg = angNormalize(azi1 * k);
+    // Auxiliary sphere at the first point
+    double salp1, calp1, sbet1, cbet1;
+    sincosd(angRound(azi1_deg), salp1, calp1);
+    sincosd(angRound(lat1_deg), sbet1, cbet1);
+    sbet1 *= m_f1;
+    norm2(sbet1, cbet1);
+    cbet1 = std::max(tiny, cbet1); // Ensure cbet1 = +epsilon at poles
+    // Azimuth at the equator crossing: sin(alp0) = sin(alp1) * cos(bet1)
+    double salp0 = salp1 * cbet1,
+           calp0 = std::hypot(calp1, salp1 * sbet1);
+    // Arc lengths from the equator crossing: tan(bet1) = tan(sig1) * cos(alp1)
+    // and tan(omg1) = sin(alp0) * tan(sig1)
+    double ssig1 = sbet1,
+           somg1 = salp0 * sbet1,
+           csig1 = (sbet1 != 0.0 || calp1 != 0.0) ? cbet1 * calp1 : 1.0,
+           comg1 = csig1;
+    norm2(ssig1, csig1);
+    double k2 = calp0 * calp0 * m_ep2,
+           eps = k2 / (2.0 * (1.0 + std::sqrt(1.0 + k2)) + k2);
+    double C1a[nC + 1], C1pa[nC + 1], C3a[nC];
+    double A1m1 = A1m1f(eps);
+    C1f(eps, C1a);
+    C1pf(eps, C1pa);
+    this->C3f(eps, C3a);
+    double B11 = sinSeries(C1a, nC, ssig1, csig1),
+           s = std::sin(B11),
+           c = std::cos(B11),
+           stau1 = ssig1 * c + csig1 * s,  // tau1 = sig1 + B11
+           ctau1 = csig1 * c - ssig1 * s,
+           A3c = -m_f * salp0 * this->A3f(eps),
+           B31 = sinSeries(C3a, nC - 1, ssig1, csig1);
+    // Arc length on the auxiliary sphere from the reverted distance series
+    double tau12 = s12 / (m_b * (1.0 + A1m1));
+    s = std::sin(tau12);
+    c = std::cos(tau12);
+    double B12 = -sinSeries(C1pa, nC, stau1 * c + ctau1 * s, ctau1 * c - stau1 * s),
+           sig12 = tau12 - (B12 - B11),
+           ssig12 = std::sin(sig12),
+           csig12 = std::cos(sig12);
+    // sig2 = sig1 + sig12
+    double ssig2 = ssig1 * csig12 + csig1 * ssig12,
+           csig2 = csig1 * csig12 - ssig1 * ssig12;
+    // sin(bet2) = cos(alp0) * sin(sig2)
+    double sbet2 = calp0 * ssig2,
+           cbet2 = std::hypot(salp0, calp0 * csig2);
+    if (cbet2 == 0.0) // salp0 = 0 and csig2 = 0: break the degeneracy
+        cbet2 = csig2 = tiny;
+    // tan(alp0) = cos(sig2) * tan(alp2)
+    double salp2 = salp0,
+           calp2 = calp0 * csig2;
+    // tan(omg2) = sin(alp0) * tan(sig2) and omg12 = omg2 - omg1
+    double somg2 = salp0 * ssig2,
+           comg2 = csig2,
+           omg12 = std::atan2(somg2 * comg1 - comg2 * somg1,
+                              comg2 * comg1 + somg2 * somg1),
+           lam12 = omg12 + A3c * (sig12 + (sinSeries(C3a, nC - 1, ssig2, csig2) - B31));
+    lon2 = angNormalize(angNormalize(lon1_deg) + angNormalize(lam12 * Constants::m_radtodeg)) / k;
+    lat2 = atan2d(sbet2, m_f1 * cbet2) / k;
+    azi2 = atan2d(salp2, calp2) / k;
+}
+
+double Geodesic::inverse(const double &lon1, const double &lat1,
+                         const double &lon2, const double &lat2,
+                         double &azi1, double &azi2, bool degrees) const
+{
+    const double k = degrees ? 1.0 : Constants::m_radtodeg;
+    double lat1_deg = angRound(latFix(lat1 * k)),
+           lat2_deg = angRound(latFix(lat2 * k)),
+           sbet1, cbet1, dn1, sbet2, cbet2, dn2;
+    this->reducedLatitude(lat1_deg, sbet1, cbet1, dn1);
+    this->reducedLatitude(lat2_deg, sbet2, cbet2, dn2);
+    double salp1, calp1, salp2, calp2,
+           s12 = this->inverseReduced(lon1 * k, lat1_deg, sbet1, cbet1, dn1,
+                                      lon2 * k, lat2_deg, sbet2, cbet2, dn2,
+                                      salp1, calp1, salp2, calp2);
+    azi1 = atan2d(salp1, calp1) / k;
+    azi2 = atan2d(salp2, calp2) / k;
+    return s12;
+}
+
+double Geodesic::distance(const double &lon1, const double &lat1,
+                          const double &lon2, const double &lat2, bool degrees) const
+{
+    double azi1, azi2;
+    return this->inverse(lon1, lat1, lon2, lat2, azi1, azi2, degrees);
+}
+
+void Geodesic::distance(const double *lon1, const double *lat1,
+                        const double *lon2, const double *lat2,
+                        double *s12, std::size_t n, bool degrees) const
+{
+    // Note: the number of iterations of the inverse problem depends on the
+    //       points, so that pairs are distributed dynamically among threads
+    #pragma omp parallel for schedule(dynamic, 64)
+    for (std::size_t i = 0 ; i < n ; ++i)
+        s12[i] = this->distance(lon1[i], lat1[i], lon2[i], lat2[i], degrees);
+}
+
+void Geodesic::distanceMatrix(const double *lon1, const double *lat1, std::size_t n1,
+                              const double *lon2, const double *lat2, std::size_t n2,
+                              double *s12, bool degrees) const
+{
+    const double k = degrees ? 1.0 : Constants::m_radtodeg;
+    // Quantities depending on a single point of the second set, computed once
+    vector lon2_deg(n2), lat2_deg(n2), sbet2(n2), cbet2(n2), dn2(n2);
+    for (std::size_t j = 0 ; j < n2 ; ++j)
+    {
+        lon2_deg[j] = lon2[j] * k;
+        lat2_deg[j] = angRound(latFix(lat2[j] * k));
+        this->reducedLatitude(lat2_deg[j], sbet2[j], cbet2[j], dn2[j]);
+    }
+    #pragma omp parallel for schedule(dynamic)
+    for (std::size_t i = 0 ; i < n1 ; ++i)
+    {
+        double lon1_deg = lon1[i] * k,
+               lat1_deg = angRound(latFix(lat1[i] * k)),
+               sbet1, cbet1, dn1,
+               salp1, calp1, salp2, calp2;
+        this->reducedLatitude(lat1_deg, sbet1, cbet1, dn1);
+        double *row = s12 + i * n2;
+        for (std::size_t j = 0 ; j < n2 ; ++j)
+            row[j] = this->inverseReduced(lon1_deg, lat1_deg, sbet1, cbet1, dn1,
+                                          lon2_deg[j], lat2_deg[j], sbet2[j], cbet2[j], dn2[j],
+                                          salp1, calp1, salp2, calp2);
+    }
+}
+
+void Geodesic::distanceMatrix(const vector &lon1, const vector &lat1,
+                              const vector &lon2, const vector &lat2,
+                              vector &s12, bool degrees) const
+{
+    std::size_t n1 = lon1.size(),
+                n2 = lon2.size();
+    if ((lat1.size() != n1) || (lat2.size() != n2))
+        throw std::invalid_argument("Geodesic.distanceMatrix():\n"
+                                    "\t'lon1' and 'lat1', 'lon2' and 'lat2' must have same size.");
+    s12.resize(n1 * n2);
+    this->distanceMatrix(lon1.data(), lat1.data(), n1,
+                         lon2.data(), lat2.data(), n2, s12.data(), degrees);
+}
+
+// ============== PRIVATE CLASS METHODS ==============
+void Geodesic::initSeriesCoeffs()
+{
+    double n2 = m_n * m_n;
+    // Coefficients of A3, in increasing powers of epsilon
+    m_A3x[0] = 1.0;
+    m_A3x[1] = -(1.0 - m_n) / 2.0;
+    m_A3x[2] = -(2.0 + m_n - 3.0*n2) / 8.0;
+    m_A3x[3] = -(1.0 + 3.0*m_n + n2) / 16.0;
+    m_A3x[4] = -(3.0 + 2.0*m_n) / 64.0;
+    m_A3x[5] = -3.0 / 128.0;
+    // Coefficients of C3[l] (1 <= l < 6), m_C3x[l][j] being the
+    // coefficient of epsilon^j
+    std::fill(&m_C3x[0][0], &m_C3x[0][0] + m_order * m_order, 0.0);
+    m_C3x[1][1] = (1.0 - m_n) / 4.0;
+    m_C3x[1][2] = (1.0 - n2) / 8.0;
+    m_C3x[1][3] = (3.0 + 3.0*m_n - n2) / 64.0;
+    m_C3x[1][4] = (5.0 + 2.0*m_n) / 128.0;
+    m_C3x[1][5] = 3.0 / 128.0;
+    m_C3x[2][2] = (2.0 - 3.0*m_n + n2) / 32.0;
+    m_C3x[2][3] = (3.0 - 2.0*m_n - 3.0*n2) / 64.0;
+    m_C3x[2][4] = (3.0 + m_n) / 128.0;
+    m_C3x[2][5] = 5.0 / 256.0;
+    m_C3x[3][3] = (5.0 - 9.0*m_n + 5.0*n2) / 192.0;
+    m_C3x[3][4] = (9.0 - 10.0*m_n) / 384.0;
+    m_C3x[3][5] = 7.0 / 512.0;
+    m_C3x[4][4] = (7.0 - 14.0*m_n) / 512.0;
+    m_C3x[4][5] = 7.0 / 512.0;
+    m_C3x[5][5] = 21.0 / 2560.0;
+}
+
+double Geodesic::A3f(const double &eps) const
+{
+    double A3 = 0.0;
+    for (std::size_t j = m_order ; j > 0 ; --j)
+        A3 = A3 * eps + m_A3x[j - 1];
+    return A3;
+}
+
+void Geodesic::C3f(const double &eps, double *c) const
+{
+    for (std::size_t l = 1 ; l < m_order ; ++l)
+    {
+        double cl = 0.0;
+        for (std::size_t j = m_order - 1 ; j > 0 ; --j)
+            cl = (cl + m_C3x[l][j]) * eps;
+        c[l] = cl;
+    }
+}
+
+void Geodesic::reducedLatitude(const double &lat, double &sbet, double &cbet, double &dn) const
+{
+    sincosd(lat, sbet, cbet);
+    sbet *= m_f1;
+    norm2(sbet, cbet);
+    cbet = std::max(tiny, cbet); // Ensure cbet = +epsilon at poles
+    dn = std::sqrt(1.0 + m_ep2 * sbet * sbet);
+}
+
+double Geodesic::inverseStart(const double &sbet1, const double &cbet1, const double &dn1,
+                              const double &sbet2, const double &cbet2, const double &dn2,
+                              const double &lam12, const double &slam12, const double &clam12,
+                              double &salp1, double &calp1, double &salp2, double &calp2,
+                              double &dnm) const
+{
+    double sig12 = -1.0, // Negative value means that the line is not short
+           sbet12 = sbet2 * cbet1 - cbet2 * sbet1,
+           cbet12 = cbet2 * cbet1 + sbet2 * sbet1,
+           sbet12a = sbet2 * cbet1 + cbet2 * sbet1;
+    bool shortline = cbet12 >= 0.0 && sbet12 < 0.5 && cbet2 * lam12 < 0.5;
+    double somg12, comg12;
+    if (shortline)
+    {
+        double sbetm2 = (sbet1 + sbet2) * (sbet1 + sbet2);
+        sbetm2 /= sbetm2 + (cbet1 + cbet2) * (cbet1 + cbet2);
+        dnm = std::sqrt(1.0 + m_ep2 * sbetm2);
+        double omg12 = lam12 / (m_f1 * dnm);
+        somg12 = std::sin(omg12);
+        comg12 = std::cos(omg12);
+    }
+    else
+    {
+        somg12 = slam12;
+        comg12 = clam12;
+    }
+    salp1 = cbet2 * somg12;
+    calp1 = comg12 >= 0.0 ?
+            sbet12 + cbet2 * sbet1 * somg12 * somg12 / (1.0 + comg12) :
+            sbet12a - cbet2 * sbet1 * somg12 * somg12 / (1.0 - comg12);
+    double ssig12 = std::hypot(salp1, calp1),
+           csig12 = sbet1 * sbet2 + cbet1 * cbet2 * comg12;
+    if (shortline && ssig12 < m_etol2)
+    {
+        // Really short lines
+        salp2 = cbet1 * somg12;
+        calp2 = sbet12 - cbet1 * sbet2 *
+                (comg12 >= 0.0 ? somg12 * somg12 / (1.0 + comg12) : 1.0 - comg12);
+        norm2(salp2, calp2);
+        sig12 = std::atan2(ssig12, csig12);
+    }
+    else if (std::abs(m_n) > 0.1 || csig12 >= 0.0 ||
+             ssig12 >= 6.0 * std::abs(m_n) * Constants::m_pi * cbet1 * cbet1)
+    {
+        // Nothing to do, zeroth order spherical approximation is OK
+    }
+    else
+    {
+        // Nearly antipodal points: solution of the astroid problem
+        double x, y, lamscale, betscale,
+               lam12x = std::atan2(-slam12, -clam12); // lam12 - pi
+        if (m_f >= 0.0)
+        {
+            double k2 = sbet1 * sbet1 * m_ep2,
+                   eps = k2 / (2.0 * (1.0 + std::sqrt(1.0 + k2)) + k2);
+            lamscale = m_f * cbet1 * this->A3f(eps) * Constants::m_pi;
+            betscale = lamscale * cbet1;
+            x = lam12x / lamscale;
+            y = sbet12a / betscale;
+        }
+        else
+        {
+            double cbet12a = cbet2 * cbet1 - sbet2 * sbet1,
+                   bet12a = std::atan2(sbet12a, cbet12a),
+                   s12b, m12b, m0;
+            lengths(m_n, Constants::m_pi + bet12a,
+                    sbet1, -cbet1, dn1, sbet2, cbet2, dn2, s12b, m12b, m0);
+            x = -1.0 + m12b / (cbet1 * cbet2 * m0 * Constants::m_pi);
+            betscale = x < -0.01 ? sbet12a / x : -m_f * cbet1 * cbet1 * Constants::m_pi;
+            lamscale = betscale / cbet1;
+            y = lam12x / lamscale;
+        }
+        if (y > -tol1 && x > -1.0 - xthresh)
+        {
+            if (m_f >= 0.0)
+            {
+                salp1 = std::min(1.0, -x);
+                calp1 = -std::sqrt(1.0 - salp1 * salp1);
+            }
+            else
+            {
+                calp1 = std::max(x > -tol1 ? 0.0 : -1.0, x);
+                salp1 = std::sqrt(1.0 - calp1 * calp1);
+            }
+        }
+        else
+        {
+            double k = astroid(x, y),
+                   omg12a = lamscale * (m_f >= 0.0 ? -x * k / (1.0 + k) : -y * (1.0 + k) / k);
+            somg12 = std::sin(omg12a);
+            comg12 = -std::cos(omg12a);
+            salp1 = cbet2 * somg12;
+            calp1 = sbet12a - cbet2 * sbet1 * somg12 * somg12 / (1.0 - comg12);
+        }
+    }
+    if (!(salp1 <= 0.0))
+        norm2(salp1, calp1);
+    else
+    {
+        salp1 = 1.0;
+        calp1 = 0.0;
+    }
+    return sig12;
+}
+
+double Geodesic::lambda12(const double &sbet1, const double &cbet1, const double &dn1,
+                          const double &sbet2, const double &cbet2, const double &dn2,
+                          double salp1, double calp1,
+                          const double &slam12, const double &clam12,
+                          double &salp2, double &calp2, double &sig12,
+                          double &ssig1, double &csig1, double &ssig2, double &csig2,
+                          double &eps, bool diffp, double &dlam12) const
+{
+    if (sbet1 == 0.0 && calp1 == 0.0)
+        calp1 = -tiny; // Break degeneracy of equatorial line
+    // sin(alp1) * cos(bet1) = sin(alp0)
+    double salp0 = salp1 * cbet1,
+           calp0 = std::hypot(calp1, salp1 * sbet1); // calp0 > 0
+    // tan(bet1) = tan(sig1) * cos(alp1) and tan(omg1) = sin(alp0) * tan(sig1)
+    ssig1 = sbet1;
+    csig1 = calp1 * cbet1;
+    double somg1 = salp0 * sbet1,
+           comg1 = calp1 * cbet1;
+    norm2(ssig1, csig1);
+    // Enforce symmetries in the case abs(bet2) = -bet1
+    salp2 = cbet2 != cbet1 ? salp0 / cbet2 : salp1;
+    calp2 = (cbet2 != cbet1 || std::abs(sbet2) != -sbet1) ?
+            std::sqrt(calp1 * cbet1 * calp1 * cbet1 +
+                      (cbet1 < -sbet1 ?
+                       (cbet2 - cbet1) * (cbet1 + cbet2) :
+                       (sbet1 - sbet2) * (sbet1 + sbet2))) / cbet2 :
+            std::abs(calp1);
+    // tan(bet2) = tan(sig2) * cos(alp2) and tan(omg2) = sin(alp0) * tan(sig2)
+    ssig2 = sbet2;
+    csig2 = calp2 * cbet2;
+    double somg2 = salp0 * sbet2,
+           comg2 = calp2 * cbet2;
+    norm2(ssig2, csig2);
+    // sig12 = sig2 - sig1, limited to [0, pi]
+    sig12 = std::atan2(std::max(0.0, csig1 * ssig2 - ssig1 * csig2) + 0.0,
+                       csig1 * csig2 + ssig1 * ssig2);
+    // omg12 = omg2 - omg1, limited to [0, pi]
+    double somg12 = std::max(0.0, comg1 * somg2 - somg1 * comg2) + 0.0,
+           comg12 = comg1 * comg2 + somg1 * somg2;
+    // eta = omg12 - lam12
+    double eta = std::atan2(somg12 * clam12 - comg12 * slam12,
+                            comg12 * clam12 + somg12 * slam12);
+    double k2 = calp0 * calp0 * m_ep2;
+    eps = k2 / (2.0 * (1.0 + std::sqrt(1.0 + k2)) + k2);
+    double C3a[nC];
+    this->C3f(eps, C3a);
+    double B312 = sinSeries(C3a, nC - 1, ssig2, csig2) - sinSeries(C3a, nC - 1, ssig1, csig1),
+           domg12 = -m_f * this->A3f(eps) * salp0 * (sig12 + B312);
+    if (diffp)
+    {
+        if (calp2 == 0.0)
+            dlam12 = -2.0 * m_f1 * dn1 / sbet1;
+        else
+        {
+            double s12b, m12b, m0;
+            lengths(eps, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2, s12b, m12b, m0);
+            dlam12 = m12b * m_f1 / (calp2 * cbet2);
+        }
+    }
+    return eta + domg12;
+}
+
+double Geodesic::inverseReduced(const double &lon1, double lat1, double sbet1, double cbet1, double dn1,
+                                const double &lon2, double lat2, double sbet2, double cbet2, double dn2,
+                                double &salp1, double &calp1, double &salp2, double &calp2) const
+{
+    // Longitude difference, made positive
+    double lon12 = angDiff(lon1, lon2),
+           lonsign = std::signbit(lon12) ? -1.0 : 1.0;
+    lon12 *= lonsign;
+    double lam12 = lon12 * Constants::m_degtorad,
+           slam12, clam12;
+    sincosd(lon12, slam12, clam12);
+    // Swap points so that the point with higher (abs) latitude is point 1
+    double swapp = (std::abs(lat1) < std::abs(lat2) || lat2 != lat2) ? -1.0 : 1.0;
+    if (swapp < 0.0)
+    {
+        lonsign *= -1.0;
+        std::swap(lat1, lat2);
+        std::swap(sbet1, sbet2);
+        std::swap(cbet1, cbet2);
+        std::swap(dn1, dn2);
+    }
+    // Make lat1 <= -0
+    double latsign = std::signbit(lat1) ? 1.0 : -1.0;
+    lat1 *= latsign;
+    sbet1 *= latsign;
+    sbet2 *= latsign;
+    // Now 0 <= lon12 <= 180, -90 <= lat1 <= -0 and lat1 <= lat2 <= -lat1.
+    // Force bet2 = +/- bet1 exactly when their difference vanishes
+    if (cbet1 < -sbet1)
+    {
+        if (cbet2 == cbet1)
+            sbet2 = std::copysign(sbet1, sbet2);
+    }
+    else if (std::abs(sbet2) == -sbet1)
+        cbet2 = cbet1;
+
+    double s12x = 0.0, m12x = 0.0, sig12 = 0.0;
+    bool meridian = lat1 == -90.0 || slam12 == 0.0;
+    if (meridian)
+    {
+        // Endpoints on a single full meridian: the geodesic might lie on it
+        calp1 = clam12; salp1 = slam12; // Head to the target longitude
+        calp2 = 1.0; salp2 = 0.0;       // At the target we're heading north
+        // tan(bet) = tan(sig) * cos(alp)
+        double ssig1 = sbet1, csig1 = calp1 * cbet1,
+               ssig2 = sbet2, csig2 = calp2 * cbet2, m0;
+        sig12 = std::atan2(std::max(0.0, csig1 * ssig2 - ssig1 * csig2) + 0.0,
+                           csig1 * csig2 + ssig1 * ssig2);
+        lengths(m_n, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2, s12x, m12x, m0);
+        // sig12 > pi/2 with m12 < 0 is not a shortest path
+        if (sig12 < 1.0 || m12x >= 0.0)
+        {
+            if (sig12 < 3.0 * tiny || (sig12 < tol0 && (s12x < 0.0 || m12x < 0.0)))
+                sig12 = m12x = s12x = 0.0;
+            s12x *= m_b;
+        }
+        else
+            meridian = false;
+    }
+    if (!meridian && sbet1 == 0.0 && (m_f <= 0.0 || 180.0 - lon12 >= m_f * 180.0))
+    {
+        // Geodesic along the equator
+        calp1 = calp2 = 0.0;
+        salp1 = salp2 = 1.0;
+        s12x = m_a * lam12;
+    }
+    else if (!meridian)
+    {
+        // Starting point for Newton's method
+        double dnm = 0.0;
+        sig12 = this->inverseStart(sbet1, cbet1, dn1, sbet2, cbet2, dn2,
+                                   lam12, slam12, clam12,
+                                   salp1, calp1, salp2, calp2, dnm);
+        if (sig12 >= 0.0) // Short lines
+            s12x = sig12 * m_b * dnm;
+        else
+        {
+            // Newton's method on lambda12(alp1) - lam12 = 0, the root being
+            // bracketed in (alp1a, alp1b); bisection is used when the Newton
+            // step falls outside of this range.
+            double ssig1 = 0.0, csig1 = 0.0, ssig2 = 0.0, csig2 = 0.0, eps = 0.0;
+            double salp1a = tiny, calp1a = 1.0, salp1b = tiny, calp1b = -1.0;
+            bool tripn = false,
+                 tripb = false;
+            for (unsigned numit = 0 ;; ++numit)
+            {
+                double dv = 0.0,
+                       v = this->lambda12(sbet1, cbet1, dn1, sbet2, cbet2, dn2,
+                                          salp1, calp1, slam12, clam12,
+                                          salp2, calp2, sig12, ssig1, csig1, ssig2, csig2,
+                                          eps, numit < maxit1, dv);
+                // Reversed test to allow escape with NaNs
+                if (tripb || !(std::abs(v) >= (tripn ? 8.0 : 1.0) * tol0) || numit == maxit2)
+                    break;
+                // Update bracketing values
+                if (v > 0.0 && (numit > maxit1 || calp1 / salp1 > calp1b / salp1b))
+                {
+                    salp1b = salp1;
+                    calp1b = calp1;
+                }
+                else if (v < 0.0 && (numit > maxit1 || calp1 / salp1 < calp1a / salp1a))
+                {
+                    salp1a = salp1;
+                    calp1a = calp1;
+                }
+                if (numit < maxit1 && dv > 0.0)
+                {
+                    double dalp1 = -v / dv;
+                    if (std::abs(dalp1) < Constants::m_pi)
+                    {
+                        double sdalp1 = std::sin(dalp1),
+                               cdalp1 = std::cos(dalp1),
+                               nsalp1 = salp1 * cdalp1 + calp1 * sdalp1;
+                        if (nsalp1 > 0.0)
+                        {
+                            calp1 = calp1 * cdalp1 - salp1 * sdalp1;
+                            salp1 = nsalp1;
+                            norm2(salp1, calp1);
+                            // Convergence conditions based on epsilon when
+                            // the slope vanishes
+                            tripn = std::abs(v) <= 16.0 * tol0;
+                            continue;
+                        }
+                    }
+                }
+                // Bisection
+                salp1 = (salp1a + salp1b) / 2.0;
+                calp1 = (calp1a + calp1b) / 2.0;
+                norm2(salp1, calp1);
+                tripn = false;
+                tripb = (std::abs(salp1a - salp1) + (calp1a - calp1) < tolb ||
+                         std::abs(salp1 - salp1b) + (calp1 - calp1b) < tolb);
+            }
+            double m0;
+            lengths(eps, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2, s12x, m12x, m0);
+            s12x *= m_b;
+        }
+    }
+    // Azimuths of the original problem from the canonical one
+    if (swapp < 0.0)
+    {
+        std::swap(salp1, salp2);
+        std::swap(calp1, calp2);
+    }
+    salp1 *= swapp * lonsign; calp1 *= swapp * latsign;
+    salp2 *= swapp * lonsign; calp2 *= swapp * latsign;
+    return 0.0 + s12x; // Convert -0 to 0
+}
+
+} // namespace Osl::Geography
+
+} // namespace Osl
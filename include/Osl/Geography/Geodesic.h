@@ -0,0 +1,202 @@
+/*! ********************************************************************
+ * \file Geodesic.h
+ * \brief Header file of Osl::Geography::Geodesic class.
+ *********************************************************************/
+
+#ifndef OSL_GEOGRAPHY_GEODESIC_H
+#define OSL_GEOGRAPHY_GEODESIC_H
+
+#include "Ellipsoid.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+/*! ********************************************************************
+ * \brief Class to solve the direct and inverse geodesic problems on an
+ * Ellipsoid of revolution.
+ *
+ * The geodesic problems are solved with the algorithms of Karney
+ * \cite Karney_13: the distance and the longitude along the geodesic are
+ * given by series expansions in the small parameter
+ * \f$\epsilon=\dfrac{\sqrt{1+e'^2\cos^2\alpha_0}-1}
+ * {\sqrt{1+e'^2\cos^2\alpha_0}+1}\f$ (truncated at \f$\epsilon^6\f$),
+ * summed by Clenshaw's method, and the inverse problem is solved by
+ * Newton's iterations on the azimuth at the first point, started from an
+ * approximate solution of the astroid problem for nearly antipodal
+ * points. The results are accurate to about 15 nanometers for the
+ * terrestrial ellipsoids.
+ *
+ * The coefficients of the series depending only on the ellipsoid are
+ * computed once at construction, so that a Geodesic object should be
+ * built once and reused for all the computations on a given ellipsoid.
+ *
+ * \note As for GeoPoint, points are given in the (longitude, latitude)
+ *       order. Azimuths are measured clockwise from the north.
+ * \see <a href="https://arxiv.org/abs/1109.4448" target="_blank">
+ *      [Karney, Algorithms for geodesics]</a>
+ *********************************************************************/
+class Geodesic
+{
+public:
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor.
+    Geodesic();
+
+    /*! ********************************************************************
+     * \brief Geodesic constructor.
+     * \param [in] elps The ellipsoid on which the geodesics are computed.
+     *             Its flattening must be in \f$]-1/50,1/50[\f$.
+     *********************************************************************/
+    Geodesic(const Ellipsoid* elps);
+
+    //! Copy constructor
+    Geodesic(const Geodesic &other);
+
+    //! Default destructor
+    ~Geodesic();
+
+    // ============== OPERATORS ==============
+    Geodesic operator=(const Geodesic &other); // Assignement from another Geodesic
+
+    // ============== GEODESIC PROBLEMS ==============
+    /*! ********************************************************************
+     * \brief Solve the direct geodesic problem.
+     *
+     * Compute the position and the azimuth at the end of the geodesic of
+     * length \f$s_{12}\f$ leaving the point \f$(\lambda_1,\phi_1)\f$ with
+     * the azimuth \f$\alpha_1\f$.
+     *
+     * \param [in] lon1, lat1 The geodetic coordinates of the first point.
+     * \param [in] azi1 The azimuth at the first point.
+     * \param [in] s12 The length of the geodesic in meters (it may be
+     *             negative).
+     * \param [out] lon2, lat2 The geodetic coordinates of the second point,
+     *              longitude being reduced to \f$[-180°,180°]\f$.
+     * \param [out] azi2 The (forward) azimuth at the second point.
+     * \param [in] degrees The unit of the angles.
+     *********************************************************************/
+    void direct(const double &lon1, const double &lat1, const double &azi1,
+                const double &s12,
+                double &lon2, double &lat2, double &azi2, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Solve the inverse geodesic problem.
+     *
+     * Compute the length of the shortest geodesic between the points
+     * \f$(\lambda_1,\phi_1)\f$ and \f$(\lambda_2,\phi_2)\f$ and its
+     * azimuths at both ends.
+     *
+     * \param [in] lon1, lat1 The geodetic coordinates of the first point.
+     * \param [in] lon2, lat2 The geodetic coordinates of the second point.
+     * \param [out] azi1 The azimuth at the first point.
+     * \param [out] azi2 The (forward) azimuth at the second point.
+     * \param [in] degrees The unit of the angles.
+     * \return The length of the geodesic in meters.
+     *********************************************************************/
+    double inverse(const double &lon1, const double &lat1,
+                   const double &lon2, const double &lat2,
+                   double &azi1, double &azi2, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Length of the shortest geodesic between two points.
+     * \sa inverse
+     *********************************************************************/
+    double distance(const double &lon1, const double &lat1,
+                    const double &lon2, const double &lat2, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Lengths of the shortest geodesics between pairs of points.
+     *
+     * Batch version of Geodesic::distance: s12[i] is the distance between
+     * the points (lon1[i], lat1[i]) and (lon2[i], lat2[i]). The pairs are
+     * shared among the OpenMP threads when OpenMP is enabled.
+     *
+     * \param [in] lon1, lat1 Pointers to the \em n first points.
+     * \param [in] lon2, lat2 Pointers to the \em n second points.
+     * \param [out] s12 Pointer to the \em n resulting distances in meters.
+     * \param [in] n The number of pairs of points.
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    void distance(const double *lon1, const double *lat1,
+                  const double *lon2, const double *lat2,
+                  double *s12, std::size_t n, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Matrix of the lengths of the shortest geodesics between two
+     *        sets of points.
+     *
+     * Compute the \f$n_1\times n_2\f$ distances between each point of the
+     * first set and each point of the second set, stored in row-major
+     * order: s12[i*n2+j] is the distance between the points
+     * (lon1[i], lat1[i]) and (lon2[j], lat2[j]).
+     *
+     * The quantities depending on a single point (reduced latitude and
+     * its sine and cosine) are computed once per point instead of once
+     * per pair, and the rows are shared among the OpenMP threads when
+     * OpenMP is enabled.
+     *
+     * \param [in] lon1, lat1 Pointers to the \em n1 points of the first set.
+     * \param [in] n1 The number of points of the first set.
+     * \param [in] lon2, lat2 Pointers to the \em n2 points of the second set.
+     * \param [in] n2 The number of points of the second set.
+     * \param [out] s12 Pointer to the \em n1*n2 resulting distances in
+     *              meters.
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    void distanceMatrix(const double *lon1, const double *lat1, std::size_t n1,
+                        const double *lon2, const double *lat2, std::size_t n2,
+                        double *s12, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Matrix of the lengths of the shortest geodesics between two
+     *        sets of points given as vectors.
+     *
+     * The output vector is resized to lon1.size()*lon2.size().
+     *
+     * \sa distanceMatrix(const double*, const double*, std::size_t,
+     *     const double*, const double*, std::size_t, double*, bool) const
+     *********************************************************************/
+    void distanceMatrix(const vector &lon1, const vector &lat1,
+                        const vector &lon2, const vector &lat2,
+                        vector &s12, bool degrees=true) const;
+
+private:
+    // ============== PRIVATE CLASS MEMBERS ==============
+    static constexpr std::size_t m_order = 6; // Order of the series expansions
+    double m_a,     // Equatorial radius [m]
+           m_f,     // first flattening parameter
+           m_f1,    // 1 - m_f
+           m_b,     // Polar radius [m]
+           m_n,     // third flattening parameter
+           m_ep2,   // the second excentricity squared
+           m_etol2; // Tolerance for the short lines
+    double m_A3x[m_order],              // Coefficients of A3 in powers of epsilon
+           m_C3x[m_order][m_order];     // Coefficients of C3[l] in powers of epsilon
+    // ============== PRIVATE CLASS METHODS ==============
+    void initSeriesCoeffs();
+    double A3f(const double &eps) const;
+    void C3f(const double &eps, double *c) const;
+    void reducedLatitude(const double &lat, double &sbet, double &cbet, double &dn) const;
+    double inverseStart(const double &sbet1, const double &cbet1, const double &dn1,
+                        const double &sbet2, const double &cbet2, const double &dn2,
+                        const double &lam12, const double &slam12, const double &clam12,
+                        double &salp1, double &calp1, double &salp2, double &calp2,
+                        double &dnm) const;
+    double lambda12(const double &sbet1, const double &cbet1, const double &dn1,
+                    const double &sbet2, const double &cbet2, const double &dn2,
+                    double salp1, double calp1,
+                    const double &slam12, const double &clam12,
+                    double &salp2, double &calp2, double &sig12,
+                    double &ssig1, double &csig1, double &ssig2, double &csig2,
+                    double &eps, bool diffp, double &dlam12) const;
+    double inverseReduced(const double &lon1, double lat1, double sbet1, double cbet1, double dn1,
+                          const double &lon2, double lat2, double sbet2, double cbet2, double dn2,
+                          double &salp1, double &calp1, double &salp2, double &calp2) const;
+};
+
+} // namespace Osl::Geography
+
+} // namespace Osl
+
+#endif // OSL_GEOGRAPHY_GEODESIC_H
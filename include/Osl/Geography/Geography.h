@@ -10,6 +10,15 @@
 
 #include "Ellipsoid.h"
 #include "GeoPoint.h"
+#include "GeoPointArray.h"
+#include "DatumTransform.h"
+#include "GeoidGrid.h"
+#include "DEMTileCache.h"
+#include "TerrainIntersector.h"
+#include "LocalCartesian.h"
+#include "Geodesic.h"
+#include "TransverseMercator.h"
+#include "UTM.h"
 #include "dms_to_dd.h"
 #include "dd_to_dms.h"
 
@@ -0,0 +1,281 @@
+/*! ********************************************************************
+ * \file GeoidGrid.cpp
+ * \brief Source file of Osl::Geography::GeoidGrid class.
+ *********************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "GeoidGrid.h"
+#include "Osl/Batch.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+namespace { // Local functions
+
+// Catmull-Rom weights of the nodes -1, 0, 1 and 2 at the abscissa t in [0, 1]
+inline void cubicWeights(const double &t, double *w)
+{
+    w[0] = 0.5 * t * ((2.0 - t) * t - 1.0);
+    w[1] = 0.5 * (t * t * (3.0 * t - 5.0) + 2.0);
+    w[2] = 0.5 * t * ((4.0 - 3.0 * t) * t + 1.0);
+    w[3] = 0.5 * (t - 1.0) * t * t;
+}
+
+} // namespace
+
+// ============== CONSTRUCTOR ==============
+GeoidGrid::GeoidGrid()
+    : m_nlon(0), m_nlat(0) {}
+
+GeoidGrid::GeoidGrid(const std::string &filename,
+                     std::size_t nlon, std::size_t nlat,
+                     const double &lon0, const double &lat0,
+                     const double &dlon, const double &dlat,
+                     GeoidGridType type, Endian::Endianness endianness,
+                     const double &scale, const double &offset,
+                     std::size_t headerSize)
+    : m_nlon(nlon), m_nlat(nlat),
+      m_lon0(lon0), m_lat0(lat0),
+      m_dlon(dlon), m_dlat(dlat),
+      m_scale(scale), m_offset(offset),
+      m_type(type),
+      m_swap(endianness != Endian::Endianness::native)
+{
+    if ((nlon < 2) || (nlat < 2))
+        throw std::invalid_argument("GeoidGrid constructor:\n"
+                                    "\t'nlon' and 'nlat' must be at least 2.");
+    if ((dlon == 0.0) || (dlat == 0.0))
+        throw std::invalid_argument("GeoidGrid constructor:\n"
+                                    "\t'dlon' and 'dlat' must be non zero.");
+    // The grid is periodic if its columns cover 360° (up to the half of a column)
+    m_global = std::fabs(std::fabs(nlon * dlon) - 360.0) < 0.5 * std::fabs(dlon);
+    m_data = mapRasterFile(filename, headerSize, nlon * nlat * rasterSampleSize(type),
+                           "GeoidGrid constructor");
+}
+
+// Copy constructor (the mapping is shared)
+GeoidGrid::GeoidGrid(const GeoidGrid &other)
+    : m_data(other.m_data),
+      m_nlon(other.m_nlon), m_nlat(other.m_nlat),
+      m_lon0(other.m_lon0), m_lat0(other.m_lat0),
+      m_dlon(other.m_dlon), m_dlat(other.m_dlat),
+      m_scale(other.m_scale), m_offset(other.m_offset),
+      m_type(other.m_type), m_swap(other.m_swap), m_global(other.m_global) {}
+
+// ============== DESTRUCTOR ==============
+GeoidGrid::~GeoidGrid() {} // The mapping is released with its last owner
+
+// ============== CLASS METHODS ==============
+// ********** GETTER **********
+std::size_t GeoidGrid::getNLon() const { return m_nlon; }
+std::size_t GeoidGrid::getNLat() const { return m_nlat; }
+double GeoidGrid::getLon0(bool degrees) const { return degrees ? m_lon0 : m_lon0 * Constants::m_degtorad; }
+double GeoidGrid::getLat0(bool degrees) const { return degrees ? m_lat0 : m_lat0 * Constants::m_degtorad; }
+double GeoidGrid::getLonSpacing(bool degrees) const { return degrees ? m_dlon : m_dlon * Constants::m_degtorad; }
+double GeoidGrid::getLatSpacing(bool degrees) const { return degrees ? m_dlat : m_dlat * Constants::m_degtorad; }
+bool GeoidGrid::isGlobal() const { return m_global; }
+
+double GeoidGrid::getNode(std::size_t ilat, std::size_t ilon) const
+{
+    if ((ilat >= m_nlat) || (ilon >= m_nlon))
+        throw std::out_of_range("GeoidGrid.getNode():\n"
+                                "\t'ilat' or 'ilon' is out of range.");
+    const unsigned char *p = m_data.get() + (ilat * m_nlon + ilon) * rasterSampleSize(m_type);
+    double v = 0.0;
+    switch (m_type)
+    {
+        case GeoidGridType::int16:   v = readRasterSample<std::int16_t>(p, m_swap); break;
+        case GeoidGridType::float32: v = readRasterSample<float>(p, m_swap); break;
+        case GeoidGridType::float64: v = readRasterSample<double>(p, m_swap); break;
+    }
+    return m_scale * v + m_offset;
+}
+
+// ============== OPERATORS ==============
+// Assignement from another GeoidGrid
+GeoidGrid GeoidGrid::operator=(const GeoidGrid &other)
+{
+    m_data = other.m_data;      // Shared mapping
+    m_nlon = other.m_nlon;
+    m_nlat = other.m_nlat;
+    m_lon0 = other.m_lon0;      // Coordinates of the first node [deg]
+    m_lat0 = other.m_lat0;
+    m_dlon = other.m_dlon;      // Spacings of the columns and rows [deg]
+    m_dlat = other.m_dlat;
+    m_scale = other.m_scale;    // Undulation = m_scale * sample + m_offset
+    m_offset = other.m_offset;
+    m_type = other.m_type;
+    m_swap = other.m_swap;
+    m_global = other.m_global;
+    return *this;
+}
+
+// ============== UNDULATION ==============
+double GeoidGrid::undulation(const double &lon, const double &lat, bool degrees,
+                             enum GeoidInterpolation method) const
+{
+    double N;
+    this->undulation_dispatch(&lon, &lat, &N, 1, degrees, method);
+    return N;
+}
+
+void GeoidGrid::undulation(const double *lon, const double *lat, double *N, std::size_t n,
+                           bool degrees, enum GeoidInterpolation method) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        this->undulation_dispatch(lon + k0, lat + k0, N + k0, nb, degrees, method);
+    });
+}
+
+void GeoidGrid::undulation(const vector &lon, const vector &lat, vector &N,
+                           bool degrees, enum GeoidInterpolation method) const
+{
+    std::size_t n = lon.size();
+    if (lat.size() != n)
+        throw std::invalid_argument("GeoidGrid.undulation():\n"
+                                    "\t'lon' and 'lat' must have same size.");
+    N.resize(n);
+    this->undulation(lon.data(), lat.data(), N.data(), n, degrees, method);
+}
+
+void GeoidGrid::orthometricHeight(const double *lon, const double *lat, const double *h,
+                                  double *H, std::size_t n, bool degrees,
+                                  enum GeoidInterpolation method) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        double N[detail::batch_size];
+        this->undulation_dispatch(lon + k0, lat + k0, N, nb, degrees, method);
+        #pragma omp simd
+        for (std::size_t i = 0 ; i < nb ; ++i)
+            H[k0 + i] = h[k0 + i] - N[i];
+    });
+}
+
+void GeoidGrid::ellipsoidalHeight(const double *lon, const double *lat, const double *H,
+                                  double *h, std::size_t n, bool degrees,
+                                  enum GeoidInterpolation method) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        double N[detail::batch_size];
+        this->undulation_dispatch(lon + k0, lat + k0, N, nb, degrees, method);
+        #pragma omp simd
+        for (std::size_t i = 0 ; i < nb ; ++i)
+            h[k0 + i] = H[k0 + i] + N[i];
+    });
+}
+
+// ============== PRIVATE CLASS METHODS ==============
+void GeoidGrid::undulation_dispatch(const double *lon, const double *lat, double *N, std::size_t n,
+                                    bool degrees, enum GeoidInterpolation method) const
+{
+    if (!m_data)
+        throw std::invalid_argument("GeoidGrid.undulation():\n"
+                                    "\tthe grid is not initialized.");
+    switch (m_type)
+    {
+        case GeoidGridType::int16:
+            this->undulation_block<std::int16_t>(lon, lat, N, n, degrees, method);
+            break;
+        case GeoidGridType::float32:
+            this->undulation_block<float>(lon, lat, N, n, degrees, method);
+            break;
+        case GeoidGridType::float64:
+            this->undulation_block<double>(lon, lat, N, n, degrees, method);
+            break;
+    }
+}
+
+template <typename T>
+void GeoidGrid::undulation_block(const double *lon, const double *lat, double *N, std::size_t n,
+                                 bool degrees, enum GeoidInterpolation method) const
+{
+    // Local copies of the grid parameters (no aliasing with outputs)
+    const unsigned char *data = m_data.get();
+    const bool swap = m_swap,
+               global = m_global;
+    const std::ptrdiff_t nlon = static_cast<std::ptrdiff_t>(m_nlon),
+                         nlat = static_cast<std::ptrdiff_t>(m_nlat);
+    const double k = degrees ? 1.0 : Constants::m_radtodeg,
+                 lon0 = m_lon0,
+                 lat0 = m_lat0,
+                 idlon = 1.0 / m_dlon,
+                 idlat = 1.0 / m_dlat,
+                 scale = m_scale,
+                 offset = m_offset,
+                 xmax = static_cast<double>(nlon - 1),
+                 ymax = static_cast<double>(nlat - 1),
+                 period = static_cast<double>(nlon);
+    // Index of a column, wrapped or clamped
+    auto col = [global, nlon](std::ptrdiff_t j) -> std::ptrdiff_t
+    {
+        if (global)
+            return ((j % nlon) + nlon) % nlon;
+        return std::min(std::max(j, std::ptrdiff_t(0)), nlon - 1);
+    };
+    // Index of a row, clamped
+    auto row = [nlat](std::ptrdiff_t i) -> std::ptrdiff_t
+    {
+        return std::min(std::max(i, std::ptrdiff_t(0)), nlat - 1);
+    };
+    auto node = [data, swap, nlon](std::ptrdiff_t i, std::ptrdiff_t j) -> double
+    {
+        return readRasterSample<T>(data + static_cast<std::size_t>(i * nlon + j) * sizeof(T), swap);
+    };
+    for (std::size_t p = 0 ; p < n ; ++p)
+    {
+        // Fractional position of the point in the grid
+        double fx = (lon[p] * k - lon0) * idlon,
+               fy = (lat[p] * k - lat0) * idlat;
+        // Undefined position: no undulation (and no conversion of NaN)
+        if (!std::isfinite(fx) || std::isnan(fy))
+        {
+            N[p] = std::numeric_limits<double>::quiet_NaN();
+            continue;
+        }
+        fy = std::min(std::max(fy, 0.0), ymax);
+        if (global)
+            fx -= period * std::floor(fx / period);
+        else
+            fx = std::min(std::max(fx, 0.0), xmax);
+        double jf = std::floor(fx),
+               if_ = std::floor(fy),
+               tx = fx - jf,
+               ty = fy - if_;
+        std::ptrdiff_t j = col(static_cast<std::ptrdiff_t>(jf)),
+                       i = row(static_cast<std::ptrdiff_t>(if_));
+        double v;
+        if (method == GeoidInterpolation::bicubic)
+        {
+            double wx[4], wy[4];
+            cubicWeights(tx, wx);
+            cubicWeights(ty, wy);
+            std::ptrdiff_t cj[4] = {col(j - 1), col(j), col(j + 1), col(j + 2)};
+            v = 0.0;
+            for (std::ptrdiff_t r = 0 ; r < 4 ; ++r)
+            {
+                std::ptrdiff_t ir = row(i + r - 1);
+                v += wy[r] * (wx[0] * node(ir, cj[0]) + wx[1] * node(ir, cj[1]) +
+                              wx[2] * node(ir, cj[2]) + wx[3] * node(ir, cj[3]));
+            }
+        }
+        else
+        {
+            std::ptrdiff_t j1 = col(j + 1),
+                           i1 = row(i + 1);
+            double v0 = node(i, j) + tx * (node(i, j1) - node(i, j)),
+                   v1 = node(i1, j) + tx * (node(i1, j1) - node(i1, j));
+            v = v0 + ty * (v1 - v0);
+        }
+        N[p] = scale * v + offset;
+    }
+}
+
+} // namespace Osl::Geography
+
+} // namespace Osl
@@ -0,0 +1,193 @@
+/*! ********************************************************************
+ * \file GeoidGrid.h
+ * \brief Header file of Osl::Geography::GeoidGrid class.
+ *********************************************************************/
+
+#ifndef OSL_GEOGRAPHY_GEOIDGRID_H
+#define OSL_GEOGRAPHY_GEOIDGRID_H
+
+#include "Osl/Globals.h"
+#include "Osl/Constants.h"
+#include "RasterFile.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+/*! ********************************************************************
+ * \brief Sample types of a GeoidGrid file (e.g. RasterType::int16 for the
+ * EGM96 15' grid in centimeters).
+ *********************************************************************/
+using GeoidGridType = RasterType;
+
+/*! ********************************************************************
+ * \enum GeoidInterpolation
+ * \brief Enumeration of the interpolation methods of a GeoidGrid.
+ *********************************************************************/
+enum class GeoidInterpolation
+{
+    /*! Bilinear interpolation of the 2x2 surrounding nodes.*/
+    bilinear,
+    /*! Bicubic (Catmull-Rom) interpolation of the 4x4 surrounding nodes.*/
+    bicubic
+};
+
+/*! ********************************************************************
+ * \brief Class to manage a geoid undulation grid stored in a binary file.
+ *
+ * The file is a raster of \em nlat rows of \em nlon samples, possibly
+ * preceded by a header of \em headerSize bytes. The node \f$(i,j)\f$, at
+ * row \f$i\f$ and column \f$j\f$, has the coordinates
+ * \f$(\lambda_0+j\Delta\lambda,\ \phi_0+i\Delta\phi)\f$ and the undulation
+ * \f$N_{ij}=s\,v_{ij}+o\f$, with \f$v_{ij}\f$ the stored sample, \f$s\f$
+ * the scale and \f$o\f$ the offset. For instance the EGM96 15' grid
+ * (WW15MGH.DAC) is made of 721 rows of 1440 big-endian \em int16 samples
+ * in centimeters, from \f$\phi_0=90°\f$ with \f$\Delta\phi=-0.25°\f$ and
+ * from \f$\lambda_0=0°\f$ with \f$\Delta\lambda=0.25°\f$.
+ *
+ * The file is memory-mapped and read in place, the byte order being
+ * swapped on the fly through the Endian module when it differs from the
+ * native one. The node of a point is found in O(1) from its coordinates.
+ * The grid is periodic in longitude when its columns cover 360°, and
+ * clamped to its borders otherwise.
+ *
+ * The grid is never modified after construction, so that concurrent
+ * reads from several threads are safe. Copies share the same mapping.
+ * The batch versions share blocks of points among the OpenMP threads.
+ *
+ * \note On platforms without \em mmap the file is read in memory
+ *       (see mapRasterFile).
+ *********************************************************************/
+class GeoidGrid
+{
+public:
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor.
+    GeoidGrid();
+
+    /*! ********************************************************************
+     * \brief GeoidGrid constructor.
+     * \param [in] filename The path of the grid file.
+     * \param [in] nlon, nlat The number of columns and rows of the grid.
+     * \param [in] lon0, lat0 The coordinates of the first node [deg].
+     * \param [in] dlon, dlat The (signed) spacings of the columns and rows
+     *             [deg].
+     * \param [in] type The type of the stored samples.
+     * \param [in] endianness The byte order of the stored samples.
+     * \param [in] scale, offset The undulation of a node is
+     *             scale * sample + offset [m].
+     * \param [in] headerSize The number of bytes before the first sample.
+     *********************************************************************/
+    GeoidGrid(const std::string &filename,
+              std::size_t nlon, std::size_t nlat,
+              const double &lon0, const double &lat0,
+              const double &dlon, const double &dlat,
+              GeoidGridType type=GeoidGridType::float32,
+              Endian::Endianness endianness=Endian::Endianness::little,
+              const double &scale=1.0, const double &offset=0.0,
+              std::size_t headerSize=0);
+
+    //! Copy constructor (the mapping is shared)
+    GeoidGrid(const GeoidGrid &other);
+
+    // ============== DESTRUCTOR ==============
+    //! Default destructor
+    ~GeoidGrid();
+
+    // ============== CLASS METHODS ==============
+    // ********** GETTER **********
+    std::size_t getNLon() const;
+    std::size_t getNLat() const;
+    double getLon0(bool degrees=true) const;
+    double getLat0(bool degrees=true) const;
+    double getLonSpacing(bool degrees=true) const;
+    double getLatSpacing(bool degrees=true) const;
+    bool isGlobal() const;
+    //! Undulation of the node at row \em ilat and column \em ilon [m].
+    double getNode(std::size_t ilat, std::size_t ilon) const;
+
+    // ============== OPERATORS ==============
+    GeoidGrid operator=(const GeoidGrid &other); // Assignement from another GeoidGrid
+
+    // ============== UNDULATION ==============
+    /*! ********************************************************************
+     * \brief Geoid undulation at a point.
+     * \param [in] lon, lat The geodetic coordinates of the point.
+     * \param [in] degrees The unit of the given coordinates.
+     * \param [in] method The interpolation method.
+     * \return The height of the geoid above the ellipsoid [m], NaN for a
+     *         NaN or infinite longitude or a NaN latitude.
+     *********************************************************************/
+    double undulation(const double &lon, const double &lat, bool degrees=true,
+                      enum GeoidInterpolation method=GeoidInterpolation::bilinear) const;
+
+    /*! ********************************************************************
+     * \brief Geoid undulations of arrays of points.
+     *
+     * Batch version of GeoidGrid::undulation working on structure-of-arrays
+     * data. The vector overload resizes the output.
+     *
+     * \param [in] lon, lat Pointers to the \em n geodetic coordinates.
+     * \param [out] N Pointer to the \em n undulations [m].
+     * \param [in] n The number of points.
+     * \param [in] degrees The unit of the given coordinates.
+     * \param [in] method The interpolation method.
+     *********************************************************************/
+    void undulation(const double *lon, const double *lat, double *N, std::size_t n,
+                    bool degrees=true,
+                    enum GeoidInterpolation method=GeoidInterpolation::bilinear) const;
+    void undulation(const vector &lon, const vector &lat, vector &N,
+                    bool degrees=true,
+                    enum GeoidInterpolation method=GeoidInterpolation::bilinear) const;
+
+    /*! ********************************************************************
+     * \brief Orthometric heights \f$H=h-N\f$ of arrays of points.
+     * \param [in] lon, lat Pointers to the \em n geodetic coordinates.
+     * \param [in] h Pointer to the \em n ellipsoidal heights [m].
+     * \param [out] H Pointer to the \em n orthometric heights [m] (it may
+     *              be \em h for an in-place correction).
+     * \param [in] n The number of points.
+     * \param [in] degrees The unit of the given coordinates.
+     * \param [in] method The interpolation method.
+     *********************************************************************/
+    void orthometricHeight(const double *lon, const double *lat, const double *h,
+                           double *H, std::size_t n, bool degrees=true,
+                           enum GeoidInterpolation method=GeoidInterpolation::bilinear) const;
+
+    /*! ********************************************************************
+     * \brief Ellipsoidal heights \f$h=H+N\f$ of arrays of points.
+     * \param [in] lon, lat Pointers to the \em n geodetic coordinates.
+     * \param [in] H Pointer to the \em n orthometric heights [m].
+     * \param [out] h Pointer to the \em n ellipsoidal heights [m] (it may
+     *              be \em H for an in-place correction).
+     * \param [in] n The number of points.
+     * \param [in] degrees The unit of the given coordinates.
+     * \param [in] method The interpolation method.
+     *********************************************************************/
+    void ellipsoidalHeight(const double *lon, const double *lat, const double *H,
+                           double *h, std::size_t n, bool degrees=true,
+                           enum GeoidInterpolation method=GeoidInterpolation::bilinear) const;
+
+private:
+    // ============== PRIVATE CLASS MEMBERS ==============
+    std::shared_ptr<const unsigned char> m_data; // First sample of the mapped grid
+    std::size_t m_nlon, m_nlat;
+    double m_lon0, m_lat0,    // Coordinates of the first node [deg]
+           m_dlon, m_dlat,    // Spacings of the columns and rows [deg]
+           m_scale, m_offset; // Undulation = m_scale * sample + m_offset
+    GeoidGridType m_type;
+    bool m_swap;   // Byte order of the samples differs from the native one
+    bool m_global; // The columns cover 360° of longitude
+    // ============== PRIVATE CLASS METHODS ==============
+    template <typename T>
+    void undulation_block(const double *lon, const double *lat, double *N, std::size_t n,
+                          bool degrees, enum GeoidInterpolation method) const;
+    void undulation_dispatch(const double *lon, const double *lat, double *N, std::size_t n,
+                             bool degrees, enum GeoidInterpolation method) const;
+};
+
+} // namespace Osl::Geography
+
+} // namespace Osl
+
+#endif // OSL_GEOGRAPHY_GEOIDGRID_H
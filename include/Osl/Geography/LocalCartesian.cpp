@@ -1,9 +1,12 @@
 /*! ********************************************************************
- * \file LocalENU.cpp
- * \brief Source file of Osl::Geography::LocalENU class.
+ * \file LocalCartesian.cpp
+ * \brief Source file of Osl::Geography::LocalENU, Osl::Geography::LocalNED
+ * and Osl::Geography::LocalFramePipeline
  *********************************************************************/
 
+#include <algorithm>
 #include "LocalCartesian.h"
+#include "Osl/Batch.h"
 
 namespace Osl { // namespace Osl
 
@@ -11,27 +14,748 @@ namespace Geography { // namespace Osl::Geography
 
 namespace LocalCartesian { // namespace Osl::Geography::LocalCartesian
 
+namespace { // Local functions
+
+// Local coordinates of a block: (u, v, w) = R * ((x, y, z) - O)
+inline void toLocal_block(const double *r, const double *o,
+                          const double *x, const double *y, const double *z,
+                          double *u, double *v, double *w, std::size_t n)
+{
+    // Local copies of the frame parameters (no aliasing with outputs)
+    const double r00 = r[0], r01 = r[1], r02 = r[2],
+                 r10 = r[3], r11 = r[4], r12 = r[5],
+                 r20 = r[6], r21 = r[7], r22 = r[8],
+                 x0 = o[0], y0 = o[1], z0 = o[2];
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double dx = x[i] - x0,
+               dy = y[i] - y0,
+               dz = z[i] - z0;
+        u[i] = r00 * dx + r01 * dy + r02 * dz;
+        v[i] = r10 * dx + r11 * dy + r12 * dz;
+        w[i] = r20 * dx + r21 * dy + r22 * dz;
+    }
+}
+
+// Geocentric coordinates of a block: (x, y, z) = R^T * (u, v, w) + O
+inline void fromLocal_block(const double *r, const double *o,
+                            const double *u, const double *v, const double *w,
+                            double *x, double *y, double *z, std::size_t n)
+{
+    // Local copies of the frame parameters (no aliasing with outputs)
+    const double r00 = r[0], r01 = r[1], r02 = r[2],
+                 r10 = r[3], r11 = r[4], r12 = r[5],
+                 r20 = r[6], r21 = r[7], r22 = r[8],
+                 x0 = o[0], y0 = o[1], z0 = o[2];
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        // The point is read before being written (in-place transforms)
+        double ui = u[i],
+               vi = v[i],
+               wi = w[i];
+        x[i] = r00 * ui + r10 * vi + r20 * wi + x0;
+        y[i] = r01 * ui + r11 * vi + r21 * wi + y0;
+        z[i] = r02 * ui + r12 * vi + r22 * wi + z0;
+    }
+}
+
+// Local coordinates of a block of geodetic points, the geocentric coordinates
+// being kept in registers: (u, v, w) = R * (P(lon, lat, alt) - O)
+inline void geodeticToLocal_block(const double &a, const double &e2,
+                                  const double *r, const double *o,
+                                  const double *lon, const double *lat, const double *alt,
+                                  double *u, double *v, double *w,
+                                  std::size_t n, bool degrees)
+{
+    // Local copies of the frame parameters (no aliasing with outputs)
+    const double r00 = r[0], r01 = r[1], r02 = r[2],
+                 r10 = r[3], r11 = r[4], r12 = r[5],
+                 r20 = r[6], r21 = r[7], r22 = r[8],
+                 x0 = o[0], y0 = o[1], z0 = o[2],
+                 one_e2 = 1.0 - e2,
+                 k = degrees ? Constants::m_degtorad : 1.0;
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double lon_rad = lon[i] * k,
+               lat_rad = lat[i] * k,
+               h = alt[i];
+        double slat = std::sin(lat_rad),
+               nu = a / std::sqrt(1.0 - e2 * slat * slat), // Prime vertical curvature radius
+               nuhcosphi = (nu + h) * std::cos(lat_rad);
+        double dx = nuhcosphi * std::cos(lon_rad) - x0,
+               dy = nuhcosphi * std::sin(lon_rad) - y0,
+               dz = (one_e2 * nu + h) * slat - z0;
+        u[i] = r00 * dx + r01 * dy + r02 * dz;
+        v[i] = r10 * dx + r11 * dy + r12 * dz;
+        w[i] = r20 * dx + r21 * dy + r22 * dz;
+    }
+}
+
+void toLocal(const double *r, const double *o,
+             const double *x, const double *y, const double *z,
+             double *u, double *v, double *w, std::size_t n)
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        toLocal_block(r, o, x + k0, y + k0, z + k0, u + k0, v + k0, w + k0, nb);
+    });
+}
+
+void fromLocal(const double *r, const double *o,
+               const double *u, const double *v, const double *w,
+               double *x, double *y, double *z, std::size_t n)
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        fromLocal_block(r, o, u + k0, v + k0, w + k0, x + k0, y + k0, z + k0, nb);
+    });
+}
+
+void geodeticToLocal(const double &a, const double &e2,
+                     const double *r, const double *o,
+                     const double *lon, const double *lat, const double *alt,
+                     double *u, double *v, double *w, std::size_t n, bool degrees)
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        geodeticToLocal_block(a, e2, r, o, lon + k0, lat + k0, alt + k0,
+                              u + k0, v + k0, w + k0, nb, degrees);
+    });
+}
+
+// Checks the sizes of the inputs and resizes the outputs
+void resizeOutputs(const char *msg, const vector &x, const vector &y, const vector &z,
+                   vector &u, vector &v, vector &w)
+{
+    std::size_t n = x.size();
+    if ((y.size() != n) || (z.size() != n))
+        throw std::invalid_argument(msg);
+    u.resize(n);
+    v.resize(n);
+    w.resize(n);
+}
+
+const double zero[3] = {0.0, 0.0, 0.0}; // Origin of the vector transforms
+
+} // namespace
+
 // ====================
 // ===== LocalENU =====
 // ====================
+// ============== CONSTRUCTOR ==============
 LocalENU::LocalENU()
 {
+    this->setFromGeodetic(WGS84, 0.0, 0.0, 0.0);
+}
+
+LocalENU::LocalENU(Ellipsoid* elps,
+                   const double &X0, const double &Y0, const double &Z0,
+                   enum GeoPointInit init, bool degrees)
+{
+    if (init == GeoPointInit::fromGeodetic)
+        this->setFromGeodetic(elps, X0, Y0, Z0, degrees);
+    else if (init == GeoPointInit::fromGeocentric)
+        this->setFromGeocentric(elps, X0, Y0, Z0);
+}
+
+LocalENU::LocalENU(const GeoPoint &origin)
+    : m_elps(origin.getEllipsoidPtr()),
+      m_x0(origin.getX()), m_y0(origin.getY()), m_z0(origin.getZ())
+{
+    this->initRotation(origin.getLon(false), origin.getLat(false));
+}
+
+// Copy constructor
+LocalENU::LocalENU(const LocalENU &other)
+    : m_elps(other.m_elps),
+      m_x0(other.m_x0), m_y0(other.m_y0), m_z0(other.m_z0),
+      m_r00(other.m_r00), m_r01(other.m_r01), m_r02(other.m_r02),
+      m_r10(other.m_r10), m_r11(other.m_r11), m_r12(other.m_r12),
+      m_r20(other.m_r20), m_r21(other.m_r21), m_r22(other.m_r22) {}
+
+// ============== DESTRUCTOR ==============
+LocalENU::~LocalENU() {}
+
+// ============== CLASS METHODS ==============
+// ********** SETTER **********
+void LocalENU::setFromGeocentric(Ellipsoid* elps, const double &x, const double &y, const double &z)
+{
+    m_elps = elps;
+    double lon, lat, alt;
+    elps->geocentricToGeodetic(x, y, z, lon, lat, alt, false);
+    m_x0 = x;
+    m_y0 = y;
+    m_z0 = z;
+    this->initRotation(lon, lat);
+}
+
+void LocalENU::setFromGeodetic(Ellipsoid* elps, const double &lon, const double &lat,
+                               const double &alt, bool degrees)
+{
+    m_elps = elps;
+    double lon_rad = degrees ? lon * Constants::m_degtorad : lon,
+           lat_rad = degrees ? lat * Constants::m_degtorad : lat;
+    elps->geodeticToGeocentric(lon_rad, lat_rad, alt, m_x0, m_y0, m_z0, false);
+    this->initRotation(lon_rad, lat_rad);
+}
+
+// ********** GETTER **********
+Geometry::Vector3D LocalENU::getOriginAsVector3D() const
+{
+    return Geometry::Vector3D(m_x0, m_y0, m_z0);
+}
+
+void LocalENU::getOriginCoordinates(double &x0, double &y0, double &z0) const
+{
+    x0 = m_x0;
+    y0 = m_y0;
+    z0 = m_z0;
+}
+
+Geometry::Rotation3D LocalENU::getGeocentricToENURotation() const
+{
+    return Geometry::Rotation3D(m_r00, m_r01, m_r02,
+                                m_r10, m_r11, m_r12,
+                                m_r20, m_r21, m_r22);
+}
+
+Geometry::Rotation3D LocalENU::getENUtoGeocentricRotation() const
+{
+    return Geometry::Rotation3D(m_r00, m_r10, m_r20,
+                                m_r01, m_r11, m_r21,
+                                m_r02, m_r12, m_r22);
+}
+
+Ellipsoid* LocalENU::getEllipsoidPtr() const { return m_elps; }
+
+// ============== OPERATORS ==============
+// Assignement from another LocalENU
+LocalENU LocalENU::operator=(const LocalENU &other)
+{
+    m_elps = other.m_elps;
+    m_x0 = other.m_x0; // Origin
+    m_y0 = other.m_y0;
+    m_z0 = other.m_z0;
+    m_r00 = other.m_r00; m_r01 = other.m_r01; m_r02 = other.m_r02; // Rotation matrix ECEF -> ENU
+    m_r10 = other.m_r10; m_r11 = other.m_r11; m_r12 = other.m_r12;
+    m_r20 = other.m_r20; m_r21 = other.m_r21; m_r22 = other.m_r22;
+    return *this;
+}
+
+// ============== TRANSFORMS ==============
+void LocalENU::geocentricPointToENUPoint(const double &xgeo, const double &ygeo, const double &zgeo,
+                                         double &xenu, double &yenu, double &zenu) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    toLocal_block(r, o, &xgeo, &ygeo, &zgeo, &xenu, &yenu, &zenu, 1);
+}
+
+void LocalENU::geocentricVectorToENUVector(const double &xgeo, const double &ygeo, const double &zgeo,
+                                           double &xenu, double &yenu, double &zenu) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22};
+    toLocal_block(r, zero, &xgeo, &ygeo, &zgeo, &xenu, &yenu, &zenu, 1);
+}
+
+void LocalENU::ENUPointToGeocentricPoint(const double &xenu, const double &yenu, const double &zenu,
+                                         double &xgeo, double &ygeo, double &zgeo) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    fromLocal_block(r, o, &xenu, &yenu, &zenu, &xgeo, &ygeo, &zgeo, 1);
+}
+
+void LocalENU::ENUVectorToGeocentricVector(const double &xenu, const double &yenu, const double &zenu,
+                                           double &xgeo, double &ygeo, double &zgeo) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22};
+    fromLocal_block(r, zero, &xenu, &yenu, &zenu, &xgeo, &ygeo, &zgeo, 1);
+}
+
+void LocalENU::geodeticPointToENUPoint(const double &lon, const double &lat, const double &alt,
+                                       double &xenu, double &yenu, double &zenu, bool degrees) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    geodeticToLocal_block(m_elps->getEquatorialRadius(), m_elps->getEccentricitySquared(),
+                          r, o, &lon, &lat, &alt, &xenu, &yenu, &zenu, 1, degrees);
+}
+
+void LocalENU::geocentricPointToENUPoint(const double *xgeo, const double *ygeo, const double *zgeo,
+                                         double *xenu, double *yenu, double *zenu, std::size_t n) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    toLocal(r, o, xgeo, ygeo, zgeo, xenu, yenu, zenu, n);
+}
+
+void LocalENU::geocentricPointToENUPoint(const vector &xgeo, const vector &ygeo, const vector &zgeo,
+                                         vector &xenu, vector &yenu, vector &zenu) const
+{
+    resizeOutputs("LocalENU.geocentricPointToENUPoint():\n"
+                  "\t'xgeo', 'ygeo' and 'zgeo' must have same size.",
+                  xgeo, ygeo, zgeo, xenu, yenu, zenu);
+    this->geocentricPointToENUPoint(xgeo.data(), ygeo.data(), zgeo.data(),
+                                    xenu.data(), yenu.data(), zenu.data(), xgeo.size());
+}
+
+void LocalENU::geocentricVectorToENUVector(const double *xgeo, const double *ygeo, const double *zgeo,
+                                           double *xenu, double *yenu, double *zenu, std::size_t n) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22};
+    toLocal(r, zero, xgeo, ygeo, zgeo, xenu, yenu, zenu, n);
+}
+
+void LocalENU::geocentricVectorToENUVector(const vector &xgeo, const vector &ygeo, const vector &zgeo,
+                                           vector &xenu, vector &yenu, vector &zenu) const
+{
+    resizeOutputs("LocalENU.geocentricVectorToENUVector():\n"
+                  "\t'xgeo', 'ygeo' and 'zgeo' must have same size.",
+                  xgeo, ygeo, zgeo, xenu, yenu, zenu);
+    this->geocentricVectorToENUVector(xgeo.data(), ygeo.data(), zgeo.data(),
+                                      xenu.data(), yenu.data(), zenu.data(), xgeo.size());
+}
+
+void LocalENU::ENUPointToGeocentricPoint(const double *xenu, const double *yenu, const double *zenu,
+                                         double *xgeo, double *ygeo, double *zgeo, std::size_t n) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    fromLocal(r, o, xenu, yenu, zenu, xgeo, ygeo, zgeo, n);
+}
+
+void LocalENU::ENUPointToGeocentricPoint(const vector &xenu, const vector &yenu, const vector &zenu,
+                                         vector &xgeo, vector &ygeo, vector &zgeo) const
+{
+    resizeOutputs("LocalENU.ENUPointToGeocentricPoint():\n"
+                  "\t'xenu', 'yenu' and 'zenu' must have same size.",
+                  xenu, yenu, zenu, xgeo, ygeo, zgeo);
+    this->ENUPointToGeocentricPoint(xenu.data(), yenu.data(), zenu.data(),
+                                    xgeo.data(), ygeo.data(), zgeo.data(), xenu.size());
+}
 
+void LocalENU::ENUVectorToGeocentricVector(const double *xenu, const double *yenu, const double *zenu,
+                                           double *xgeo, double *ygeo, double *zgeo, std::size_t n) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22};
+    fromLocal(r, zero, xenu, yenu, zenu, xgeo, ygeo, zgeo, n);
+}
+
+void LocalENU::ENUVectorToGeocentricVector(const vector &xenu, const vector &yenu, const vector &zenu,
+                                           vector &xgeo, vector &ygeo, vector &zgeo) const
+{
+    resizeOutputs("LocalENU.ENUVectorToGeocentricVector():\n"
+                  "\t'xenu', 'yenu' and 'zenu' must have same size.",
+                  xenu, yenu, zenu, xgeo, ygeo, zgeo);
+    this->ENUVectorToGeocentricVector(xenu.data(), yenu.data(), zenu.data(),
+                                      xgeo.data(), ygeo.data(), zgeo.data(), xenu.size());
+}
+
+void LocalENU::geodeticPointToENUPoint(const double *lon, const double *lat, const double *alt,
+                                       double *xenu, double *yenu, double *zenu, std::size_t n,
+                                       bool degrees) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    geodeticToLocal(m_elps->getEquatorialRadius(), m_elps->getEccentricitySquared(),
+                    r, o, lon, lat, alt, xenu, yenu, zenu, n, degrees);
+}
+
+void LocalENU::geodeticPointToENUPoint(const vector &lon, const vector &lat, const vector &alt,
+                                       vector &xenu, vector &yenu, vector &zenu, bool degrees) const
+{
+    resizeOutputs("LocalENU.geodeticPointToENUPoint():\n"
+                  "\t'lon', 'lat' and 'alt' must have same size.",
+                  lon, lat, alt, xenu, yenu, zenu);
+    this->geodeticPointToENUPoint(lon.data(), lat.data(), alt.data(),
+                                  xenu.data(), yenu.data(), zenu.data(), lon.size(), degrees);
+}
+
+// ============== PRIVATE CLASS METHODS ==============
+void LocalENU::initRotation(const double &lon_rad, const double &lat_rad)
+{
+    double slon = std::sin(lon_rad), clon = std::cos(lon_rad),
+           slat = std::sin(lat_rad), clat = std::cos(lat_rad);
+    // East
+    m_r00 = -slon;
+    m_r01 = clon;
+    m_r02 = 0.0;
+    // North
+    m_r10 = -slat * clon;
+    m_r11 = -slat * slon;
+    m_r12 = clat;
+    // Up
+    m_r20 = clat * clon;
+    m_r21 = clat * slon;
+    m_r22 = slat;
 }
 
 // ====================
 // ===== LocalNED =====
 // ====================
-LocalNED::LocalNED(){}
+// ============== CONSTRUCTOR ==============
+LocalNED::LocalNED()
+{
+    this->setFromGeodetic(WGS84, 0.0, 0.0, 0.0);
+}
+
+LocalNED::LocalNED(Ellipsoid* elps,
+                   const double &X0, const double &Y0, const double &Z0,
+                   enum GeoPointInit init, bool degrees)
+{
+    if (init == GeoPointInit::fromGeodetic)
+        this->setFromGeodetic(elps, X0, Y0, Z0, degrees);
+    else if (init == GeoPointInit::fromGeocentric)
+        this->setFromGeocentric(elps, X0, Y0, Z0);
+}
+
+LocalNED::LocalNED(const GeoPoint &origin)
+    : m_elps(origin.getEllipsoidPtr()),
+      m_x0(origin.getX()), m_y0(origin.getY()), m_z0(origin.getZ())
+{
+    this->initRotation(origin.getLon(false), origin.getLat(false));
+}
+
+// Copy constructor
+LocalNED::LocalNED(const LocalNED &other)
+    : m_elps(other.m_elps),
+      m_x0(other.m_x0), m_y0(other.m_y0), m_z0(other.m_z0),
+      m_r00(other.m_r00), m_r01(other.m_r01), m_r02(other.m_r02),
+      m_r10(other.m_r10), m_r11(other.m_r11), m_r12(other.m_r12),
+      m_r20(other.m_r20), m_r21(other.m_r21), m_r22(other.m_r22) {}
+
+// ============== DESTRUCTOR ==============
+LocalNED::~LocalNED() {}
+
+// ============== CLASS METHODS ==============
+// ********** SETTER **********
+void LocalNED::setFromGeocentric(Ellipsoid* elps, const double &x, const double &y, const double &z)
+{
+    m_elps = elps;
+    double lon, lat, alt;
+    elps->geocentricToGeodetic(x, y, z, lon, lat, alt, false);
+    m_x0 = x;
+    m_y0 = y;
+    m_z0 = z;
+    this->initRotation(lon, lat);
+}
+
+void LocalNED::setFromGeodetic(Ellipsoid* elps, const double &lon, const double &lat,
+                               const double &alt, bool degrees)
+{
+    m_elps = elps;
+    double lon_rad = degrees ? lon * Constants::m_degtorad : lon,
+           lat_rad = degrees ? lat * Constants::m_degtorad : lat;
+    elps->geodeticToGeocentric(lon_rad, lat_rad, alt, m_x0, m_y0, m_z0, false);
+    this->initRotation(lon_rad, lat_rad);
+}
+
+// ********** GETTER **********
+Geometry::Vector3D LocalNED::getOriginAsVector3D() const
+{
+    return Geometry::Vector3D(m_x0, m_y0, m_z0);
+}
+
+void LocalNED::getOriginCoordinates(double &x0, double &y0, double &z0) const
+{
+    x0 = m_x0;
+    y0 = m_y0;
+    z0 = m_z0;
+}
+
+Geometry::Rotation3D LocalNED::getGeocentricToNEDRotation() const
+{
+    return Geometry::Rotation3D(m_r00, m_r01, m_r02,
+                                m_r10, m_r11, m_r12,
+                                m_r20, m_r21, m_r22);
+}
+
+Geometry::Rotation3D LocalNED::getNEDtoGeocentricRotation() const
+{
+    return Geometry::Rotation3D(m_r00, m_r10, m_r20,
+                                m_r01, m_r11, m_r21,
+                                m_r02, m_r12, m_r22);
+}
+
+Ellipsoid* LocalNED::getEllipsoidPtr() const { return m_elps; }
+
+// ============== OPERATORS ==============
+// Assignement from another LocalNED
+LocalNED LocalNED::operator=(const LocalNED &other)
+{
+    m_elps = other.m_elps;
+    m_x0 = other.m_x0; // Origin
+    m_y0 = other.m_y0;
+    m_z0 = other.m_z0;
+    m_r00 = other.m_r00; m_r01 = other.m_r01; m_r02 = other.m_r02; // Rotation matrix ECEF -> NED
+    m_r10 = other.m_r10; m_r11 = other.m_r11; m_r12 = other.m_r12;
+    m_r20 = other.m_r20; m_r21 = other.m_r21; m_r22 = other.m_r22;
+    return *this;
+}
+
+// ============== TRANSFORMS ==============
+void LocalNED::geocentricPointToNEDPoint(const double &xgeo, const double &ygeo, const double &zgeo,
+                                         double &xned, double &yned, double &zned) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    toLocal_block(r, o, &xgeo, &ygeo, &zgeo, &xned, &yned, &zned, 1);
+}
+
+void LocalNED::geocentricVectorToNEDVector(const double &xgeo, const double &ygeo, const double &zgeo,
+                                           double &xned, double &yned, double &zned) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22};
+    toLocal_block(r, zero, &xgeo, &ygeo, &zgeo, &xned, &yned, &zned, 1);
+}
+
+void LocalNED::NEDPointToGeocentricPoint(const double &xned, const double &yned, const double &zned,
+                                         double &xgeo, double &ygeo, double &zgeo) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    fromLocal_block(r, o, &xned, &yned, &zned, &xgeo, &ygeo, &zgeo, 1);
+}
+
+void LocalNED::NEDVectorToGeocentricVector(const double &xned, const double &yned, const double &zned,
+                                           double &xgeo, double &ygeo, double &zgeo) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22};
+    fromLocal_block(r, zero, &xned, &yned, &zned, &xgeo, &ygeo, &zgeo, 1);
+}
+
+void LocalNED::geodeticPointToNEDPoint(const double &lon, const double &lat, const double &alt,
+                                       double &xned, double &yned, double &zned, bool degrees) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    geodeticToLocal_block(m_elps->getEquatorialRadius(), m_elps->getEccentricitySquared(),
+                          r, o, &lon, &lat, &alt, &xned, &yned, &zned, 1, degrees);
+}
+
+void LocalNED::geocentricPointToNEDPoint(const double *xgeo, const double *ygeo, const double *zgeo,
+                                         double *xned, double *yned, double *zned, std::size_t n) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    toLocal(r, o, xgeo, ygeo, zgeo, xned, yned, zned, n);
+}
+
+void LocalNED::geocentricPointToNEDPoint(const vector &xgeo, const vector &ygeo, const vector &zgeo,
+                                         vector &xned, vector &yned, vector &zned) const
+{
+    resizeOutputs("LocalNED.geocentricPointToNEDPoint():\n"
+                  "\t'xgeo', 'ygeo' and 'zgeo' must have same size.",
+                  xgeo, ygeo, zgeo, xned, yned, zned);
+    this->geocentricPointToNEDPoint(xgeo.data(), ygeo.data(), zgeo.data(),
+                                    xned.data(), yned.data(), zned.data(), xgeo.size());
+}
+
+void LocalNED::geocentricVectorToNEDVector(const double *xgeo, const double *ygeo, const double *zgeo,
+                                           double *xned, double *yned, double *zned, std::size_t n) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22};
+    toLocal(r, zero, xgeo, ygeo, zgeo, xned, yned, zned, n);
+}
+
+void LocalNED::geocentricVectorToNEDVector(const vector &xgeo, const vector &ygeo, const vector &zgeo,
+                                           vector &xned, vector &yned, vector &zned) const
+{
+    resizeOutputs("LocalNED.geocentricVectorToNEDVector():\n"
+                  "\t'xgeo', 'ygeo' and 'zgeo' must have same size.",
+                  xgeo, ygeo, zgeo, xned, yned, zned);
+    this->geocentricVectorToNEDVector(xgeo.data(), ygeo.data(), zgeo.data(),
+                                      xned.data(), yned.data(), zned.data(), xgeo.size());
+}
+
+void LocalNED::NEDPointToGeocentricPoint(const double *xned, const double *yned, const double *zned,
+                                         double *xgeo, double *ygeo, double *zgeo, std::size_t n) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    fromLocal(r, o, xned, yned, zned, xgeo, ygeo, zgeo, n);
+}
+
+void LocalNED::NEDPointToGeocentricPoint(const vector &xned, const vector &yned, const vector &zned,
+                                         vector &xgeo, vector &ygeo, vector &zgeo) const
+{
+    resizeOutputs("LocalNED.NEDPointToGeocentricPoint():\n"
+                  "\t'xned', 'yned' and 'zned' must have same size.",
+                  xned, yned, zned, xgeo, ygeo, zgeo);
+    this->NEDPointToGeocentricPoint(xned.data(), yned.data(), zned.data(),
+                                    xgeo.data(), ygeo.data(), zgeo.data(), xned.size());
+}
+
+void LocalNED::NEDVectorToGeocentricVector(const double *xned, const double *yned, const double *zned,
+                                           double *xgeo, double *ygeo, double *zgeo, std::size_t n) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22};
+    fromLocal(r, zero, xned, yned, zned, xgeo, ygeo, zgeo, n);
+}
+
+void LocalNED::NEDVectorToGeocentricVector(const vector &xned, const vector &yned, const vector &zned,
+                                           vector &xgeo, vector &ygeo, vector &zgeo) const
+{
+    resizeOutputs("LocalNED.NEDVectorToGeocentricVector():\n"
+                  "\t'xned', 'yned' and 'zned' must have same size.",
+                  xned, yned, zned, xgeo, ygeo, zgeo);
+    this->NEDVectorToGeocentricVector(xned.data(), yned.data(), zned.data(),
+                                      xgeo.data(), ygeo.data(), zgeo.data(), xned.size());
+}
+
+void LocalNED::geodeticPointToNEDPoint(const double *lon, const double *lat, const double *alt,
+                                       double *xned, double *yned, double *zned, std::size_t n,
+                                       bool degrees) const
+{
+    const double r[9] = {m_r00, m_r01, m_r02, m_r10, m_r11, m_r12, m_r20, m_r21, m_r22},
+                 o[3] = {m_x0, m_y0, m_z0};
+    geodeticToLocal(m_elps->getEquatorialRadius(), m_elps->getEccentricitySquared(),
+                    r, o, lon, lat, alt, xned, yned, zned, n, degrees);
+}
+
+void LocalNED::geodeticPointToNEDPoint(const vector &lon, const vector &lat, const vector &alt,
+                                       vector &xned, vector &yned, vector &zned, bool degrees) const
+{
+    resizeOutputs("LocalNED.geodeticPointToNEDPoint():\n"
+                  "\t'lon', 'lat' and 'alt' must have same size.",
+                  lon, lat, alt, xned, yned, zned);
+    this->geodeticPointToNEDPoint(lon.data(), lat.data(), alt.data(),
+                                  xned.data(), yned.data(), zned.data(), lon.size(), degrees);
+}
+
+// ============== PRIVATE CLASS METHODS ==============
+void LocalNED::initRotation(const double &lon_rad, const double &lat_rad)
+{
+    double slon = std::sin(lon_rad), clon = std::cos(lon_rad),
+           slat = std::sin(lat_rad), clat = std::cos(lat_rad);
+    // North
+    m_r00 = -slat * clon;
+    m_r01 = -slat * slon;
+    m_r02 = clat;
+    // East
+    m_r10 = -slon;
+    m_r11 = clon;
+    m_r12 = 0.0;
+    // Down
+    m_r20 = -clat * clon;
+    m_r21 = -clat * slon;
+    m_r22 = -slat;
+}
+
+// ==============================
+// ===== LocalFramePipeline =====
+// ==============================
+// ============== CONSTRUCTOR ==============
+LocalFramePipeline::LocalFramePipeline()
+    : LocalFramePipeline(LocalENU()) {}
+
+LocalFramePipeline::LocalFramePipeline(const LocalENU &frame)
+    : m_elps(frame.getEllipsoidPtr()),
+      m_rot(frame.getGeocentricToENURotation())
+{
+    frame.getOriginCoordinates(m_x0, m_y0, m_z0);
+}
+
+LocalFramePipeline::LocalFramePipeline(const LocalNED &frame)
+    : m_elps(frame.getEllipsoidPtr()),
+      m_rot(frame.getGeocentricToNEDRotation())
+{
+    frame.getOriginCoordinates(m_x0, m_y0, m_z0);
+}
+
+// Copy constructor
+LocalFramePipeline::LocalFramePipeline(const LocalFramePipeline &other)
+    : m_elps(other.m_elps),
+      m_x0(other.m_x0), m_y0(other.m_y0), m_z0(other.m_z0),
+      m_rot(other.m_rot) {}
 
-LocalNED::LocalNED(const LocalNED &other):
-    m_x0(other.m_x0), m_y0(other.m_y0), m_z0(other.m_z0),
-    m_r00(other.m_r00), m_r01(other.m_r01), m_r02(other.m_r02),
-    m_r10(other.m_r10), m_r11(other.m_r11), m_r12(other.m_r12),
-    m_r20(other.m_r20), m_r21(other.m_r21), m_r22(other.m_r22){}
+// ============== DESTRUCTOR ==============
+LocalFramePipeline::~LocalFramePipeline() {}
 
-//LocalNED::LocalNED(const double &lon0, const double &lat0, const double &alt0,
-//                   bool degrees)
+// ============== CLASS METHODS ==============
+// ********** SETTER **********
+LocalFramePipeline &LocalFramePipeline::append(const Geometry::Rotation3D &rot)
+{
+    m_rot = rot * m_rot;
+    return *this;
+}
+
+// ********** GETTER **********
+Geometry::Vector3D LocalFramePipeline::getOriginAsVector3D() const
+{
+    return Geometry::Vector3D(m_x0, m_y0, m_z0);
+}
+
+Geometry::Rotation3D LocalFramePipeline::getGeocentricToOutputRotation() const { return m_rot; }
+Ellipsoid* LocalFramePipeline::getEllipsoidPtr() const { return m_elps; }
+
+// ============== OPERATORS ==============
+// Assignement from another LocalFramePipeline
+LocalFramePipeline LocalFramePipeline::operator=(const LocalFramePipeline &other)
+{
+    m_elps = other.m_elps;
+    m_x0 = other.m_x0; // Origin of the local frame
+    m_y0 = other.m_y0;
+    m_z0 = other.m_z0;
+    m_rot = other.m_rot; // Rotation ECEF -> output frame
+    return *this;
+}
+
+// ============== TRANSFORMS ==============
+void LocalFramePipeline::geodeticToOutput(const double &lon, const double &lat, const double &alt,
+                                          double &x, double &y, double &z, bool degrees) const
+{
+    const double o[3] = {m_x0, m_y0, m_z0};
+    geodeticToLocal_block(m_elps->getEquatorialRadius(), m_elps->getEccentricitySquared(),
+                          m_rot.data(), o, &lon, &lat, &alt, &x, &y, &z, 1, degrees);
+}
+
+void LocalFramePipeline::geocentricToOutput(const double &xgeo, const double &ygeo, const double &zgeo,
+                                            double &x, double &y, double &z) const
+{
+    const double o[3] = {m_x0, m_y0, m_z0};
+    toLocal_block(m_rot.data(), o, &xgeo, &ygeo, &zgeo, &x, &y, &z, 1);
+}
+
+void LocalFramePipeline::geodeticToOutput(const double *lon, const double *lat, const double *alt,
+                                          double *x, double *y, double *z, std::size_t n,
+                                          bool degrees) const
+{
+    const double o[3] = {m_x0, m_y0, m_z0};
+    geodeticToLocal(m_elps->getEquatorialRadius(), m_elps->getEccentricitySquared(),
+                    m_rot.data(), o, lon, lat, alt, x, y, z, n, degrees);
+}
+
+void LocalFramePipeline::geodeticToOutput(const vector &lon, const vector &lat, const vector &alt,
+                                          vector &x, vector &y, vector &z, bool degrees) const
+{
+    resizeOutputs("LocalFramePipeline.geodeticToOutput():\n"
+                  "\t'lon', 'lat' and 'alt' must have same size.",
+                  lon, lat, alt, x, y, z);
+    this->geodeticToOutput(lon.data(), lat.data(), alt.data(),
+                           x.data(), y.data(), z.data(), lon.size(), degrees);
+}
+
+void LocalFramePipeline::geocentricToOutput(const double *xgeo, const double *ygeo, const double *zgeo,
+                                            double *x, double *y, double *z, std::size_t n) const
+{
+    const double o[3] = {m_x0, m_y0, m_z0};
+    toLocal(m_rot.data(), o, xgeo, ygeo, zgeo, x, y, z, n);
+}
+
+void LocalFramePipeline::geocentricToOutput(const vector &xgeo, const vector &ygeo, const vector &zgeo,
+                                            vector &x, vector &y, vector &z) const
+{
+    resizeOutputs("LocalFramePipeline.geocentricToOutput():\n"
+                  "\t'xgeo', 'ygeo' and 'zgeo' must have same size.",
+                  xgeo, ygeo, zgeo, x, y, z);
+    this->geocentricToOutput(xgeo.data(), ygeo.data(), zgeo.data(),
+                             x.data(), y.data(), z.data(), xgeo.size());
+}
 
 } // namespace Osl::Geography::LocalCartesian
 
@@ -1,12 +1,14 @@
 /*! ********************************************************************
  * \file LocalCartesian.h
- * \brief Header file of Osl::Geography::LocalENU and Osl::Geography::LocalNED
+ * \brief Header file of Osl::Geography::LocalENU, Osl::Geography::LocalNED
+ * and Osl::Geography::LocalFramePipeline
  *********************************************************************/
 
 #ifndef OSL_GEOGRAPHY_LOCALENU_H
 #define OSL_GEOGRAPHY_LOCALENU_H
 
 #include "Ellipsoid.h"
+#include "GeoPoint.h"
 #include "Osl/Geometry/Vector3D.h"
 #include "Osl/Geometry/Rotation3D.h"
 
@@ -16,12 +18,56 @@ namespace Geography { // namespace Osl::Geography
 
 namespace LocalCartesian { // namespace Osl::Geography::LocalCartesian
 
+/*! ********************************************************************
+ * \brief Class to manage a local East-North-Up cartesian frame.
+ *
+ * The frame is tangent to the Ellipsoid at the origin
+ * \f$(\lambda_0,\phi_0,h_0)\f$ of geocentric coordinates
+ * \f$\overrightarrow{O}=(X_0,Y_0,Z_0)\f$. A geocentric point
+ * \f$\overrightarrow{P}\f$ is transformed to the local point
+ * \f$\overrightarrow{p}=\mathbf{R}(\overrightarrow{P}-\overrightarrow{O})\f$,
+ * and a geocentric vector \f$\overrightarrow{V}\f$ to
+ * \f$\overrightarrow{v}=\mathbf{R}\overrightarrow{V}\f$, with:
+ *
+ * \f[
+ *     \mathbf{R}=\begin{pmatrix}
+ *         -\sin\lambda_0 & \cos\lambda_0 & 0 \\
+ *         -\sin\phi_0\cos\lambda_0 & -\sin\phi_0\sin\lambda_0 & \cos\phi_0 \\
+ *         \cos\phi_0\cos\lambda_0 & \cos\phi_0\sin\lambda_0 & \sin\phi_0
+ *     \end{pmatrix}
+ * \f]
+ *
+ * The inverse transforms use \f$\mathbf{R}^T\f$. The matrix is computed
+ * once when the origin is set. The batch versions share blocks of points
+ * among the OpenMP threads, each block being vectorized by the compiler
+ * (through \em omp \em simd).
+ *
+ * \sa LocalNED
+ *********************************************************************/
 class LocalENU
 {
 public:
-    //! Default Constructor.
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor (ENU frame at lon = lat = alt = 0 on WGS84).
     LocalENU();
 
+    /*! ********************************************************************
+     * \brief LocalENU constructor.
+     * \param [in] elps The reference ellipsoid of the origin.
+     * \param [in] X0 (lon0) The geocentric (geodetic) coordinates of the origin.
+     * \param [in] Y0 (lat0)
+     * \param [in] Z0 (alt0)
+     * \param [in] init The type of the given coordinates.
+     * \param [in] degrees (It has no effect if init==GeoPointInit::fromGeocentric)
+     *********************************************************************/
+    LocalENU(Ellipsoid* elps,
+             const double &X0, const double &Y0, const double &Z0,
+             enum GeoPointInit init=GeoPointInit::fromGeodetic,
+             bool degrees=true);
+
+    //! LocalENU constructor at a GeoPoint origin.
+    LocalENU(const GeoPoint &origin);
+
     //! Copy constructor
     LocalENU(const LocalENU &other);
 
@@ -32,57 +78,166 @@ public:
     // ============== CLASS METHODS ==============
     // ********** SETTER **********
     /*! ********************************************************************
-     * \brief LocalENU
-     * \param [in] elps
-     * \param [in] X0 (lon0)
-     * \param [in] Y0 (lat0)
-     * \param [in] Z0 (alt0)
-     * \param [in] init
+     * \brief Sets the origin of the frame from geocentric coordinates.
+     * \param [in] elps The reference ellipsoid of the origin.
+     * \param [in] x, y, z The geocentric coordinates of the origin [m].
      *********************************************************************/
-//    void setFromGeocentric(Ellipsoid* elps, const double &x, const double &y, const double &z);
+    void setFromGeocentric(Ellipsoid* elps, const double &x, const double &y, const double &z);
 
     /*! ********************************************************************
-     * \brief LocalENU
-     * \param [in] elps
-     * \param [in] X0 (lon0)
-     * \param [in] Y0 (lat0)
-     * \param [in] Z0 (alt0)
-     * \param [in] init
+     * \brief Sets the origin of the frame from geodetic coordinates.
+     * \param [in] elps The reference ellipsoid of the origin.
+     * \param [in] lon, lat The geodetic coordinates of the origin.
+     * \param [in] alt The height of the origin above the ellipsoid [m].
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    void setFromGeodetic(Ellipsoid* elps, const double &lon, const double &lat,
+                         const double &alt=0.0, bool degrees=true);
+
+    // ********** GETTER **********
+    Geometry::Vector3D getOriginAsVector3D() const;
+    void getOriginCoordinates(double &x0, double &y0, double &z0) const;
+    Geometry::Rotation3D getGeocentricToENURotation() const;
+    Geometry::Rotation3D getENUtoGeocentricRotation() const;
+    Ellipsoid* getEllipsoidPtr() const;
+
+    // ============== OPERATORS ==============
+    LocalENU operator=(const LocalENU &other); // Assignement from another LocalENU
+
+    // ============== TRANSFORMS ==============
+    void geocentricPointToENUPoint(const double &xgeo, const double &ygeo, const double &zgeo,
+                                   double &xenu, double &yenu, double &zenu) const;
+    void geocentricVectorToENUVector(const double &xgeo, const double &ygeo, const double &zgeo,
+                                     double &xenu, double &yenu, double &zenu) const;
+    void ENUPointToGeocentricPoint(const double &xenu, const double &yenu, const double &zenu,
+                                   double &xgeo, double &ygeo, double &zgeo) const;
+    void ENUVectorToGeocentricVector(const double &xenu, const double &yenu, const double &zenu,
+                                     double &xgeo, double &ygeo, double &zgeo) const;
+
+    /*! ********************************************************************
+     * \brief Fused transform of a geodetic point to the local frame.
+     *
+     * Same as Ellipsoid::geodeticToGeocentric followed by
+     * geocentricPointToENUPoint, the geocentric coordinates being kept in
+     * registers.
+     *
+     * \param [in] lon, lat The geodetic coordinates of the point.
+     * \param [in] alt The height of the point above the ellipsoid [m].
+     * \param [out] xenu, yenu, zenu The local coordinates of the point [m].
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    void geodeticPointToENUPoint(const double &lon, const double &lat, const double &alt,
+                                 double &xenu, double &yenu, double &zenu, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Batch transforms of arrays of points or vectors.
+     *
+     * Batch versions of the above transforms working on structure-of-arrays
+     * data. The vector overloads resize the outputs.
+     *
+     * \param [in] xgeo, ygeo, zgeo (xenu, yenu, zenu) Pointers to the \em n
+     *             input geocentric (local) coordinates [m].
+     * \param [out] xenu, yenu, zenu (xgeo, ygeo, zgeo) Pointers to the \em n
+     *              transformed local (geocentric) coordinates [m].
+     * \param [in] n The number of points or vectors.
+     * \note An output array may be one of the input arrays (in-place
+     *       transform, each point being read before it is written), but
+     *       input and output arrays must not partially overlap.
      *********************************************************************/
-//    void setFromGeodetic(Ellipsoid* elps, double lon, double lat, double alt=0);
+    void geocentricPointToENUPoint(const double *xgeo, const double *ygeo, const double *zgeo,
+                                   double *xenu, double *yenu, double *zenu, std::size_t n) const;
+    void geocentricPointToENUPoint(const vector &xgeo, const vector &ygeo, const vector &zgeo,
+                                   vector &xenu, vector &yenu, vector &zenu) const;
+    void geocentricVectorToENUVector(const double *xgeo, const double *ygeo, const double *zgeo,
+                                     double *xenu, double *yenu, double *zenu, std::size_t n) const;
+    void geocentricVectorToENUVector(const vector &xgeo, const vector &ygeo, const vector &zgeo,
+                                     vector &xenu, vector &yenu, vector &zenu) const;
+    void ENUPointToGeocentricPoint(const double *xenu, const double *yenu, const double *zenu,
+                                   double *xgeo, double *ygeo, double *zgeo, std::size_t n) const;
+    void ENUPointToGeocentricPoint(const vector &xenu, const vector &yenu, const vector &zenu,
+                                   vector &xgeo, vector &ygeo, vector &zgeo) const;
+    void ENUVectorToGeocentricVector(const double *xenu, const double *yenu, const double *zenu,
+                                     double *xgeo, double *ygeo, double *zgeo, std::size_t n) const;
+    void ENUVectorToGeocentricVector(const vector &xenu, const vector &yenu, const vector &zenu,
+                                     vector &xgeo, vector &ygeo, vector &zgeo) const;
 
+    /*! ********************************************************************
+     * \brief Fused transform of arrays of geodetic points to the local frame.
+     *
+     * Batch version of geodeticPointToENUPoint: the points are read and
+     * written in a single pass, without intermediate geocentric arrays.
+     * The vector overload resizes the outputs.
+     *
+     * \param [in] lon, lat Pointers to the \em n geodetic coordinates.
+     * \param [in] alt Pointer to the \em n heights above the ellipsoid [m].
+     * \param [out] xenu, yenu, zenu Pointers to the \em n local
+     *              coordinates [m].
+     * \param [in] n The number of points.
+     * \param [in] degrees The unit of the given coordinates.
+     * \note An output array may be one of the input arrays (in-place
+     *       transform, each point being read before it is written), but
+     *       input and output arrays must not partially overlap.
+     *********************************************************************/
+    void geodeticPointToENUPoint(const double *lon, const double *lat, const double *alt,
+                                 double *xenu, double *yenu, double *zenu, std::size_t n,
+                                 bool degrees=true) const;
+    void geodeticPointToENUPoint(const vector &lon, const vector &lat, const vector &alt,
+                                 vector &xenu, vector &yenu, vector &zenu, bool degrees=true) const;
+
+private:
+    // ============== PRIVATE CLASS MEMBERS ==============
+    Ellipsoid* m_elps;
+    double m_x0, m_y0, m_z0;
+    double m_r00, m_r01, m_r02, // Rotation matrix ECEF -> ENU
+           m_r10, m_r11, m_r12, // note: rotation ENU -> ECEF = transpose(R_ECEF->ENU)
+           m_r20, m_r21, m_r22;
+    // ============== PRIVATE CLASS METHODS ==============
+    void initRotation(const double &lon_rad, const double &lat_rad);
 };
 
 
+/*! ********************************************************************
+ * \brief Class to manage a local North-East-Down cartesian frame.
+ *
+ * Same as LocalENU with the rows of the rotation matrix ordered as
+ * North, East and Down:
+ *
+ * \f[
+ *     \mathbf{R}=\begin{pmatrix}
+ *         -\sin\phi_0\cos\lambda_0 & -\sin\phi_0\sin\lambda_0 & \cos\phi_0 \\
+ *         -\sin\lambda_0 & \cos\lambda_0 & 0 \\
+ *         -\cos\phi_0\cos\lambda_0 & -\cos\phi_0\sin\lambda_0 & -\sin\phi_0
+ *     \end{pmatrix}
+ * \f]
+ *
+ * \sa LocalENU
+ *********************************************************************/
 class LocalNED
 {
 public:
-    //! Default Constructor.
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor (NED frame at lon = lat = alt = 0 on WGS84).
     LocalNED();
 
-    //! Copy constructor
-    LocalNED(const LocalNED &other);
-
     /*! ********************************************************************
-     * \brief LocalNED
-     * \param [in] elps
-     * \param [in] lon0
-     * \param [in] lat0
-     * \param [in] alt0
-     * \param [in] init
-     *********************************************************************/
-//    LocalNED(const double &lon0, const double &lat0, const double &alt0,
-//             Ellipsoid &elps=WGS84, bool degrees=true);
-
-    /*! ********************************************************************
-     * \brief LocalNED
-     * \param [in] X0 (lon0)
+     * \brief LocalNED constructor.
+     * \param [in] elps The reference ellipsoid of the origin.
+     * \param [in] X0 (lon0) The geocentric (geodetic) coordinates of the origin.
      * \param [in] Y0 (lat0)
      * \param [in] Z0 (alt0)
-     * \param [in] elps
+     * \param [in] init The type of the given coordinates.
+     * \param [in] degrees (It has no effect if init==GeoPointInit::fromGeocentric)
      *********************************************************************/
-//    LocalNED(const double &x0, const double &y0, const double &z0,
-//             Ellipsoid &elps=WGS84);
+    LocalNED(Ellipsoid* elps,
+             const double &X0, const double &Y0, const double &Z0,
+             enum GeoPointInit init=GeoPointInit::fromGeodetic,
+             bool degrees=true);
+
+    //! LocalNED constructor at a GeoPoint origin.
+    LocalNED(const GeoPoint &origin);
+
+    //! Copy constructor
+    LocalNED(const LocalNED &other);
 
     // ============== DESTRUCTOR ==============
     //! Default destructor
@@ -90,30 +245,233 @@ public:
 
     // ============== CLASS METHODS ==============
     // ********** SETTER **********
+    /*! ********************************************************************
+     * \brief Sets the origin of the frame from geocentric coordinates.
+     * \param [in] elps The reference ellipsoid of the origin.
+     * \param [in] x, y, z The geocentric coordinates of the origin [m].
+     *********************************************************************/
+    void setFromGeocentric(Ellipsoid* elps, const double &x, const double &y, const double &z);
+
+    /*! ********************************************************************
+     * \brief Sets the origin of the frame from geodetic coordinates.
+     * \param [in] elps The reference ellipsoid of the origin.
+     * \param [in] lon, lat The geodetic coordinates of the origin.
+     * \param [in] alt The height of the origin above the ellipsoid [m].
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    void setFromGeodetic(Ellipsoid* elps, const double &lon, const double &lat,
+                         const double &alt=0.0, bool degrees=true);
 
     // ********** GETTER **********
-    Geometry::Vector3D getOriginAsVector3D();
-    void getOriginCoordinates(double &x0, double &y0, double &z0);
-    Geometry::Rotation3D getGeocentricToNEDRotation();
-    Geometry::Rotation3D getNEDtoGeocentricRotation();
+    Geometry::Vector3D getOriginAsVector3D() const;
+    void getOriginCoordinates(double &x0, double &y0, double &z0) const;
+    Geometry::Rotation3D getGeocentricToNEDRotation() const;
+    Geometry::Rotation3D getNEDtoGeocentricRotation() const;
+    Ellipsoid* getEllipsoidPtr() const;
 
     // ============== OPERATORS ==============
+    LocalNED operator=(const LocalNED &other); // Assignement from another LocalNED
 
-    //
+    // ============== TRANSFORMS ==============
     void geocentricPointToNEDPoint(const double &xgeo, const double &ygeo, const double &zgeo,
-                                   double &xned, double &yned, double &zned);
+                                   double &xned, double &yned, double &zned) const;
     void geocentricVectorToNEDVector(const double &xgeo, const double &ygeo, const double &zgeo,
-                                     double &xned, double &yned, double &zned);
+                                     double &xned, double &yned, double &zned) const;
     void NEDPointToGeocentricPoint(const double &xned, const double &yned, const double &zned,
-                                   double &xgeo, double &ygeo, double &zgeo);
+                                   double &xgeo, double &ygeo, double &zgeo) const;
     void NEDVectorToGeocentricVector(const double &xned, const double &yned, const double &zned,
-                                     double &xgeo, double &ygeo, double &zgeo);
+                                     double &xgeo, double &ygeo, double &zgeo) const;
+
+    /*! ********************************************************************
+     * \brief Fused transform of a geodetic point to the local frame.
+     *
+     * Same as Ellipsoid::geodeticToGeocentric followed by
+     * geocentricPointToNEDPoint, the geocentric coordinates being kept in
+     * registers.
+     *
+     * \param [in] lon, lat The geodetic coordinates of the point.
+     * \param [in] alt The height of the point above the ellipsoid [m].
+     * \param [out] xned, yned, zned The local coordinates of the point [m].
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    void geodeticPointToNEDPoint(const double &lon, const double &lat, const double &alt,
+                                 double &xned, double &yned, double &zned, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Batch transforms of arrays of points or vectors.
+     *
+     * Batch versions of the above transforms working on structure-of-arrays
+     * data. The vector overloads resize the outputs.
+     *
+     * \param [in] xgeo, ygeo, zgeo (xned, yned, zned) Pointers to the \em n
+     *             input geocentric (local) coordinates [m].
+     * \param [out] xned, yned, zned (xgeo, ygeo, zgeo) Pointers to the \em n
+     *              transformed local (geocentric) coordinates [m].
+     * \param [in] n The number of points or vectors.
+     * \note An output array may be one of the input arrays (in-place
+     *       transform, each point being read before it is written), but
+     *       input and output arrays must not partially overlap.
+     *********************************************************************/
+    void geocentricPointToNEDPoint(const double *xgeo, const double *ygeo, const double *zgeo,
+                                   double *xned, double *yned, double *zned, std::size_t n) const;
+    void geocentricPointToNEDPoint(const vector &xgeo, const vector &ygeo, const vector &zgeo,
+                                   vector &xned, vector &yned, vector &zned) const;
+    void geocentricVectorToNEDVector(const double *xgeo, const double *ygeo, const double *zgeo,
+                                     double *xned, double *yned, double *zned, std::size_t n) const;
+    void geocentricVectorToNEDVector(const vector &xgeo, const vector &ygeo, const vector &zgeo,
+                                     vector &xned, vector &yned, vector &zned) const;
+    void NEDPointToGeocentricPoint(const double *xned, const double *yned, const double *zned,
+                                   double *xgeo, double *ygeo, double *zgeo, std::size_t n) const;
+    void NEDPointToGeocentricPoint(const vector &xned, const vector &yned, const vector &zned,
+                                   vector &xgeo, vector &ygeo, vector &zgeo) const;
+    void NEDVectorToGeocentricVector(const double *xned, const double *yned, const double *zned,
+                                     double *xgeo, double *ygeo, double *zgeo, std::size_t n) const;
+    void NEDVectorToGeocentricVector(const vector &xned, const vector &yned, const vector &zned,
+                                     vector &xgeo, vector &ygeo, vector &zgeo) const;
+
+    /*! ********************************************************************
+     * \brief Fused transform of arrays of geodetic points to the local frame.
+     *
+     * Batch version of geodeticPointToNEDPoint: the points are read and
+     * written in a single pass, without intermediate geocentric arrays.
+     * The vector overload resizes the outputs.
+     *
+     * \param [in] lon, lat Pointers to the \em n geodetic coordinates.
+     * \param [in] alt Pointer to the \em n heights above the ellipsoid [m].
+     * \param [out] xned, yned, zned Pointers to the \em n local
+     *              coordinates [m].
+     * \param [in] n The number of points.
+     * \param [in] degrees The unit of the given coordinates.
+     * \note An output array may be one of the input arrays (in-place
+     *       transform, each point being read before it is written), but
+     *       input and output arrays must not partially overlap.
+     *********************************************************************/
+    void geodeticPointToNEDPoint(const double *lon, const double *lat, const double *alt,
+                                 double *xned, double *yned, double *zned, std::size_t n,
+                                 bool degrees=true) const;
+    void geodeticPointToNEDPoint(const vector &lon, const vector &lat, const vector &alt,
+                                 vector &xned, vector &yned, vector &zned, bool degrees=true) const;
 
 private:
+    // ============== PRIVATE CLASS MEMBERS ==============
+    Ellipsoid* m_elps;
     double m_x0, m_y0, m_z0;
     double m_r00, m_r01, m_r02, // Rotation matrix ECEF -> NED
            m_r10, m_r11, m_r12, // note: rotation NED -> ECEF = transpose(R_ECEF->NED)
            m_r20, m_r21, m_r22;
+    // ============== PRIVATE CLASS METHODS ==============
+    void initRotation(const double &lon_rad, const double &lat_rad);
+};
+
+
+/*! ********************************************************************
+ * \brief Class to chain the transforms from geodetic coordinates to a
+ * local cartesian frame and, optionally, to body frames.
+ *
+ * The pipeline is built from a LocalENU or LocalNED frame and appended
+ * rotations \f$\mathbf{B}_1,\dots,\mathbf{B}_k\f$ (e.g. the attitude of a
+ * platform) are folded at once into a single matrix
+ * \f$\mathbf{M}=\mathbf{B}_k\cdots\mathbf{B}_1\mathbf{R}\f$, so that a
+ * geodetic point is transformed to
+ *
+ * \f[
+ *     \overrightarrow{p}=\mathbf{M}\big(\overrightarrow{P}(\lambda,\phi,h)
+ *         -\overrightarrow{O}\big)
+ * \f]
+ *
+ * in a single pass over the data, the geocentric coordinates
+ * \f$\overrightarrow{P}\f$ being kept in registers. The batch versions
+ * share blocks of points among the OpenMP threads, each block being
+ * vectorized by the compiler (through \em omp \em simd).
+ *
+ * \note The ellipsoid of the frame must outlive the pipeline.
+ * \sa LocalENU, LocalNED
+ *********************************************************************/
+class LocalFramePipeline
+{
+public:
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor (ENU frame at lon = lat = alt = 0 on WGS84).
+    LocalFramePipeline();
+
+    //! LocalFramePipeline constructor from a local ENU frame.
+    LocalFramePipeline(const LocalENU &frame);
+
+    //! LocalFramePipeline constructor from a local NED frame.
+    LocalFramePipeline(const LocalNED &frame);
+
+    //! Copy constructor
+    LocalFramePipeline(const LocalFramePipeline &other);
+
+    // ============== DESTRUCTOR ==============
+    //! Default destructor
+    ~LocalFramePipeline();
+
+    // ============== CLASS METHODS ==============
+    // ********** SETTER **********
+    /*! ********************************************************************
+     * \brief Appends a rotation at the end of the pipeline.
+     * \param [in] rot The rotation from the current output frame to the
+     *             new one (e.g. local frame to body frame).
+     * \return A reference to the pipeline, so that calls can be chained.
+     *********************************************************************/
+    LocalFramePipeline &append(const Geometry::Rotation3D &rot);
+
+    // ********** GETTER **********
+    Geometry::Vector3D getOriginAsVector3D() const;
+    Geometry::Rotation3D getGeocentricToOutputRotation() const;
+    Ellipsoid* getEllipsoidPtr() const;
+
+    // ============== OPERATORS ==============
+    LocalFramePipeline operator=(const LocalFramePipeline &other); // Assignement from another LocalFramePipeline
+
+    // ============== TRANSFORMS ==============
+    /*! ********************************************************************
+     * \brief Transform of a geodetic point to the output frame.
+     * \param [in] lon, lat The geodetic coordinates of the point.
+     * \param [in] alt The height of the point above the ellipsoid [m].
+     * \param [out] x, y, z The coordinates of the point in the output frame [m].
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    void geodeticToOutput(const double &lon, const double &lat, const double &alt,
+                          double &x, double &y, double &z, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Transform of a geocentric point to the output frame.
+     * \param [in] xgeo, ygeo, zgeo The geocentric coordinates of the point [m].
+     * \param [out] x, y, z The coordinates of the point in the output frame [m].
+     *********************************************************************/
+    void geocentricToOutput(const double &xgeo, const double &ygeo, const double &zgeo,
+                            double &x, double &y, double &z) const;
+
+    /*! ********************************************************************
+     * \brief Batch transforms of arrays of points to the output frame.
+     *
+     * Batch versions of the above transforms working on structure-of-arrays
+     * data. The vector overloads resize the outputs.
+     *
+     * \param [in] lon, lat, alt (xgeo, ygeo, zgeo) Pointers to the \em n
+     *             geodetic (geocentric) coordinates.
+     * \param [out] x, y, z Pointers to the \em n coordinates in the output
+     *              frame [m].
+     * \param [in] n The number of points.
+     * \param [in] degrees The unit of the given geodetic coordinates.
+     * \note Input and output arrays must not overlap.
+     *********************************************************************/
+    void geodeticToOutput(const double *lon, const double *lat, const double *alt,
+                          double *x, double *y, double *z, std::size_t n, bool degrees=true) const;
+    void geodeticToOutput(const vector &lon, const vector &lat, const vector &alt,
+                          vector &x, vector &y, vector &z, bool degrees=true) const;
+    void geocentricToOutput(const double *xgeo, const double *ygeo, const double *zgeo,
+                            double *x, double *y, double *z, std::size_t n) const;
+    void geocentricToOutput(const vector &xgeo, const vector &ygeo, const vector &zgeo,
+                            vector &x, vector &y, vector &z) const;
+
+private:
+    // ============== PRIVATE CLASS MEMBERS ==============
+    Ellipsoid* m_elps;
+    double m_x0, m_y0, m_z0;      // Origin of the local frame
+    Geometry::Rotation3D m_rot;   // Rotation ECEF -> output frame
 };
 
 } // namespace Osl::Geography::LocalCartesian
@@ -0,0 +1,81 @@
+/*! ********************************************************************
+ * \file RasterFile.cpp
+ * \brief Source file of the binary raster file utilities of
+ * Osl::Geography (GeoidGrid, DEMTileCache).
+ *********************************************************************/
+
+#include <stdexcept>
+#include "RasterFile.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define OSL_RASTERFILE_MMAP
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#else
+    #include <fstream>
+#endif
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+std::size_t rasterSampleSize(enum RasterType type)
+{
+    switch (type)
+    {
+        case RasterType::int16:   return sizeof(std::int16_t);
+        case RasterType::float32: return sizeof(float);
+        case RasterType::float64: return sizeof(double);
+    }
+    return 0;
+}
+
+std::shared_ptr<const unsigned char> mapRasterFile(const std::string &filename,
+                                                   std::size_t headerSize, std::size_t dataSize,
+                                                   const std::string &caller)
+{
+#ifdef OSL_RASTERFILE_MMAP
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::invalid_argument(caller + ":\n"
+                                    "\tcannot open '" + filename + "'.");
+    struct stat st;
+    if ((::fstat(fd, &st) != 0) ||
+        (static_cast<std::size_t>(st.st_size) < headerSize + dataSize))
+    {
+        ::close(fd);
+        throw std::invalid_argument(caller + ":\n"
+                                    "\t'" + filename + "' is smaller than the given raster.");
+    }
+    std::size_t size = static_cast<std::size_t>(st.st_size);
+    void *base = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd); // The mapping stays valid after closing the file
+    if (base == MAP_FAILED)
+        throw std::invalid_argument(caller + ":\n"
+                                    "\tcannot map '" + filename + "'.");
+    return std::shared_ptr<const unsigned char>(
+                static_cast<const unsigned char*>(base) + headerSize,
+                [base, size](const unsigned char*) { ::munmap(base, size); });
+#else
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+        throw std::invalid_argument(caller + ":\n"
+                                    "\tcannot open '" + filename + "'.");
+    unsigned char *buffer = new unsigned char[dataSize];
+    file.seekg(static_cast<std::streamoff>(headerSize));
+    file.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(dataSize));
+    if (!file)
+    {
+        delete[] buffer;
+        throw std::invalid_argument(caller + ":\n"
+                                    "\t'" + filename + "' is smaller than the given raster.");
+    }
+    return std::shared_ptr<const unsigned char>(buffer, std::default_delete<unsigned char[]>());
+#endif
+}
+
+} // namespace Osl::Geography
+
+} // namespace Osl
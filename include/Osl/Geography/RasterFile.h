@@ -0,0 +1,77 @@
+/*! ********************************************************************
+ * \file RasterFile.h
+ * \brief Header file of the binary raster file utilities of
+ * Osl::Geography (GeoidGrid, DEMTileCache).
+ *********************************************************************/
+
+#ifndef OSL_GEOGRAPHY_RASTERFILE_H
+#define OSL_GEOGRAPHY_RASTERFILE_H
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include "Osl/Endian/Endian.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+/*! ********************************************************************
+ * \enum RasterType
+ * \brief Enumeration of the sample types of a binary raster file.
+ *********************************************************************/
+enum class RasterType
+{
+    /*! 16 bits signed integers (e.g. EGM96 15' grid in centimeters, SRTM tiles).*/
+    int16,
+    /*! 32 bits floating points.*/
+    float32,
+    /*! 64 bits floating points.*/
+    float64
+};
+
+//! Size in bytes of a sample of the given type.
+std::size_t rasterSampleSize(enum RasterType type);
+
+/*! ********************************************************************
+ * \brief Reads a sample of a raster file.
+ * \param [in] p The address of the sample.
+ * \param [in] swap True if the byte order of the sample differs from the
+ *             native one.
+ * \return The value of the sample.
+ *********************************************************************/
+template <typename T>
+inline double readRasterSample(const unsigned char *p, bool swap)
+{
+    T v;
+    std::memcpy(&v, p, sizeof(T));
+    if (swap)
+        Endian::swapEndianInplace(v);
+    return static_cast<double>(v);
+}
+
+/*! ********************************************************************
+ * \brief Maps a binary raster file in memory (read only).
+ *
+ * The file is memory-mapped, or read in memory on platforms without
+ * \em mmap. The mapping is released with the last copy of the returned
+ * pointer.
+ *
+ * \param [in] filename The path of the file.
+ * \param [in] headerSize The number of bytes before the first sample.
+ * \param [in] dataSize The number of bytes of the samples.
+ * \param [in] caller The caller name used in the error messages.
+ * \return A pointer to the first sample.
+ * \throw std::invalid_argument if the file cannot be opened or mapped, or
+ *        is smaller than \em headerSize + \em dataSize.
+ *********************************************************************/
+std::shared_ptr<const unsigned char> mapRasterFile(const std::string &filename,
+                                                   std::size_t headerSize, std::size_t dataSize,
+                                                   const std::string &caller);
+
+} // namespace Osl::Geography
+
+} // namespace Osl
+
+#endif // OSL_GEOGRAPHY_RASTERFILE_H
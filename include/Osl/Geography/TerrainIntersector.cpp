@@ -0,0 +1,450 @@
+/*! ********************************************************************
+ * \file TerrainIntersector.cpp
+ * \brief Source file of Osl::Geography::TerrainIntersector class.
+ *********************************************************************/
+
+#include <algorithm>
+#include <limits>
+#include "TerrainIntersector.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+namespace { // Local functions
+
+// Maximum over the 3x3 neighbourhood of each cell of a rows x cols level
+void dilateMax(std::vector<float> &h, std::size_t rows, std::size_t cols)
+{
+    std::vector<float> tmp(h.size());
+    for (std::size_t i = 0 ; i < rows ; ++i) // Along the rows
+        for (std::size_t j = 0 ; j < cols ; ++j)
+        {
+            float m = h[i * cols + j];
+            if (j > 0)
+                m = std::max(m, h[i * cols + j - 1]);
+            if (j + 1 < cols)
+                m = std::max(m, h[i * cols + j + 1]);
+            tmp[i * cols + j] = m;
+        }
+    for (std::size_t i = 0 ; i < rows ; ++i) // Along the columns
+        for (std::size_t j = 0 ; j < cols ; ++j)
+        {
+            float m = tmp[i * cols + j];
+            if (i > 0)
+                m = std::max(m, tmp[(i - 1) * cols + j]);
+            if (i + 1 < rows)
+                m = std::max(m, tmp[(i + 1) * cols + j]);
+            h[i * cols + j] = m;
+        }
+}
+
+} // namespace
+
+// ============== CONSTRUCTOR ==============
+TerrainIntersector::TerrainIntersector()
+    : m_elps(nullptr), m_nlon(0), m_nlat(0),
+      m_lon0(0.0), m_lat0(0.0), m_dlon(0.0), m_dlat(0.0),
+      m_hmin(0.0), m_hmax(0.0), m_cellWidth(0.0), m_lonScale(0.0), m_latScale(0.0),
+      m_tolerance(0.01) {}
+
+TerrainIntersector::TerrainIntersector(Ellipsoid* elps, const vector &heights,
+                                       std::size_t nlon, std::size_t nlat,
+                                       const double &lon0, const double &lat0,
+                                       const double &dlon, const double &dlat, bool degrees)
+    : m_tolerance(0.01)
+{
+    this->init(elps, heights, nlon, nlat, lon0, lat0, dlon, dlat, degrees);
+}
+
+TerrainIntersector::TerrainIntersector(Ellipsoid* elps, DEMTileCache &dem,
+                                       const double &lonmin, const double &latmin,
+                                       const double &lonmax, const double &latmax,
+                                       std::size_t nlon, std::size_t nlat, bool degrees)
+    : m_tolerance(0.01)
+{
+    if ((nlon < 2) || (nlat < 2))
+        throw std::invalid_argument("TerrainIntersector constructor:\n"
+                                    "\t'nlon' and 'nlat' must be at least 2.");
+    double dlon = (lonmax - lonmin) / static_cast<double>(nlon - 1),
+           dlat = (latmax - latmin) / static_cast<double>(nlat - 1);
+    // Nodes of the grid, rows from south to north
+    vector lon(nlon * nlat), lat(nlon * nlat), h;
+    for (std::size_t i = 0 ; i < nlat ; ++i)
+        for (std::size_t j = 0 ; j < nlon ; ++j)
+        {
+            lon[i * nlon + j] = lonmin + static_cast<double>(j) * dlon;
+            lat[i * nlon + j] = latmin + static_cast<double>(i) * dlat;
+        }
+    dem.height(lon, lat, h, degrees);
+    this->init(elps, h, nlon, nlat, lonmin, latmin, dlon, dlat, degrees);
+}
+
+// Copy constructor
+TerrainIntersector::TerrainIntersector(const TerrainIntersector &other)
+    : m_elps(other.m_elps), m_h(other.m_h),
+      m_nlon(other.m_nlon), m_nlat(other.m_nlat),
+      m_lon0(other.m_lon0), m_lat0(other.m_lat0),
+      m_dlon(other.m_dlon), m_dlat(other.m_dlat),
+      m_hmin(other.m_hmin), m_hmax(other.m_hmax),
+      m_cellWidth(other.m_cellWidth),
+      m_lonScale(other.m_lonScale), m_latScale(other.m_latScale),
+      m_tolerance(other.m_tolerance),
+      m_levels(other.m_levels) {}
+
+// ============== DESTRUCTOR ==============
+TerrainIntersector::~TerrainIntersector() {}
+
+// ============== CLASS METHODS ==============
+// ********** SETTER **********
+void TerrainIntersector::setTolerance(const double &tolerance)
+{
+    if (tolerance <= 0.0)
+        throw std::invalid_argument("TerrainIntersector.setTolerance():\n"
+                                    "\t'tolerance' must be strictly positive.");
+    m_tolerance = tolerance;
+}
+
+// ********** GETTER **********
+Ellipsoid* TerrainIntersector::getEllipsoidPtr() const { return m_elps; }
+std::size_t TerrainIntersector::getNLon() const { return m_nlon; }
+std::size_t TerrainIntersector::getNLat() const { return m_nlat; }
+std::size_t TerrainIntersector::getLevels() const { return m_levels.size(); }
+double TerrainIntersector::getMinHeight() const { return m_hmin; }
+double TerrainIntersector::getMaxHeight() const { return m_hmax; }
+double TerrainIntersector::getTolerance() const { return m_tolerance; }
+
+// ============== OPERATORS ==============
+// Assignement from another TerrainIntersector
+TerrainIntersector TerrainIntersector::operator=(const TerrainIntersector &other)
+{
+    m_elps = other.m_elps;
+    m_h = other.m_h;                 // Heights, rows from south to north
+    m_nlon = other.m_nlon;
+    m_nlat = other.m_nlat;
+    m_lon0 = other.m_lon0;           // Coordinates of the south-west node [rad]
+    m_lat0 = other.m_lat0;
+    m_dlon = other.m_dlon;           // Positive spacings [rad]
+    m_dlat = other.m_dlat;
+    m_hmin = other.m_hmin;           // Height bounds of the terrain [m]
+    m_hmax = other.m_hmax;
+    m_cellWidth = other.m_cellWidth; // Ground scales [m]
+    m_lonScale = other.m_lonScale;
+    m_latScale = other.m_latScale;
+    m_tolerance = other.m_tolerance;
+    m_levels = other.m_levels;       // Min/max pyramid
+    return *this;
+}
+
+// ============== TERRAIN ==============
+double TerrainIntersector::height(const double &lon, const double &lat, bool degrees) const
+{
+    const double k = degrees ? Constants::m_degtorad : 1.0;
+    double x, y;
+    if (m_h.empty() || !this->gridPosition(lon * k, lat * k, x, y))
+        return std::numeric_limits<double>::quiet_NaN();
+    return this->gridHeight(x, y);
+}
+
+// ============== RAY INTERSECTION ==============
+bool TerrainIntersector::intersect(const Geometry::Shape3D::Line3D &ray, double &t,
+                                   Geometry::Vector3D &point) const
+{
+    if (m_levels.empty())
+        throw std::invalid_argument("TerrainIntersector.intersect():\n"
+                                    "\tthe terrain is not initialized.");
+    double ox, oy, oz, dx, dy, dz, px, py, pz;
+    Geometry::Vector3D o = ray.getPoint(), d = ray.getDirection();
+    o.getCoordinates(ox, oy, oz);
+    d.getCoordinates(dx, dy, dz);
+    this->intersect_block(&ox, &oy, &oz, &dx, &dy, &dz, 1, &t, &px, &py, &pz);
+    point.setCoordinates(px, py, pz);
+    return !std::isnan(t);
+}
+
+void TerrainIntersector::intersect(const double *ox, const double *oy, const double *oz,
+                                   const double *dx, const double *dy, const double *dz,
+                                   std::size_t n,
+                                   double *t, double *px, double *py, double *pz) const
+{
+    if (m_levels.empty())
+        throw std::invalid_argument("TerrainIntersector.intersect():\n"
+                                    "\tthe terrain is not initialized.");
+    // Tiles of rays are shared dynamically among threads, the cost of a
+    // ray depending on the terrain it crosses
+    #pragma omp parallel for schedule(dynamic)
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += m_batch)
+    {
+        std::size_t nb = std::min(m_batch, n - k0);
+        this->intersect_block(ox + k0, oy + k0, oz + k0,
+                              dx + k0, dy + k0, dz + k0, nb,
+                              t + k0, px + k0, py + k0, pz + k0);
+    }
+}
+
+void TerrainIntersector::intersect(const Geometry::Shape3D::Line3D *rays, std::size_t n,
+                                   double *t, double *px, double *py, double *pz) const
+{
+    if (m_levels.empty())
+        throw std::invalid_argument("TerrainIntersector.intersect():\n"
+                                    "\tthe terrain is not initialized.");
+    #pragma omp parallel for schedule(dynamic)
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += m_batch)
+    {
+        std::size_t nb = std::min(m_batch, n - k0);
+        // Unpack the tile of rays in SoA layout
+        double ox[m_batch], oy[m_batch], oz[m_batch],
+               dx[m_batch], dy[m_batch], dz[m_batch];
+        Geometry::Shape3D::Line3D::unpack(rays + k0, nb, ox, oy, oz, dx, dy, dz);
+        this->intersect_block(ox, oy, oz, dx, dy, dz, nb,
+                              t + k0, px + k0, py + k0, pz + k0);
+    }
+}
+
+// ============== PRIVATE CLASS METHODS ==============
+void TerrainIntersector::init(Ellipsoid* elps, const vector &heights,
+                              std::size_t nlon, std::size_t nlat,
+                              const double &lon0, const double &lat0,
+                              const double &dlon, const double &dlat, bool degrees)
+{
+    if (elps == nullptr)
+        throw std::invalid_argument("TerrainIntersector constructor:\n"
+                                    "\t'elps' must be a valid ellipsoid.");
+    if ((nlon < 2) || (nlat < 2))
+        throw std::invalid_argument("TerrainIntersector constructor:\n"
+                                    "\t'nlon' and 'nlat' must be at least 2.");
+    if (heights.size() != nlon * nlat)
+        throw std::invalid_argument("TerrainIntersector constructor:\n"
+                                    "\t'heights' must have nlon * nlat elements.");
+    if ((dlon <= 0.0) || (dlat == 0.0))
+        throw std::invalid_argument("TerrainIntersector constructor:\n"
+                                    "\t'dlon' must be strictly positive and 'dlat' non zero.");
+    const double k = degrees ? Constants::m_degtorad : 1.0;
+    m_elps = elps;
+    m_nlon = nlon;
+    m_nlat = nlat;
+    m_lon0 = lon0 * k;
+    m_dlon = dlon * k;
+    // Rows are stored from south to north
+    bool flip = dlat < 0.0;
+    m_lat0 = (flip ? lat0 + static_cast<double>(nlat - 1) * dlat : lat0) * k;
+    m_dlat = std::fabs(dlat) * k;
+    m_h.resize(nlon * nlat);
+    for (std::size_t i = 0 ; i < nlat ; ++i)
+    {
+        const double *row = heights.data() + (flip ? nlat - 1 - i : i) * nlon;
+        for (std::size_t j = 0 ; j < nlon ; ++j)
+            m_h[i * nlon + j] = std::isnan(row[j]) ? 0.0f : static_cast<float>(row[j]);
+    }
+    auto bounds = std::minmax_element(m_h.begin(), m_h.end());
+    m_hmin = *bounds.first;
+    m_hmax = *bounds.second;
+    // Minimum ground lengths of a radian over the grid: the meridian radius
+    // at the equator, and the parallel radius at the most poleward row
+    const double a = elps->getEquatorialRadius(),
+                 e2 = elps->getEccentricitySquared(),
+                 latmax = std::min(std::max(std::fabs(m_lat0),
+                                            std::fabs(m_lat0 + static_cast<double>(nlat - 1) * m_dlat)),
+                                   Constants::m_pi_2),
+                 slat = std::sin(latmax);
+    m_latScale = a * (1.0 - e2);
+    m_lonScale = a * std::cos(latmax) / std::sqrt(1.0 - e2 * slat * slat);
+    m_cellWidth = std::min(m_dlon * m_lonScale, m_dlat * m_latScale);
+    this->buildPyramid();
+}
+
+void TerrainIntersector::buildPyramid()
+{
+    m_levels.clear();
+    // Level 0: bounds of the bilinear surface of each cell, i.e. of its 4 nodes
+    Level level;
+    level.rows = m_nlat - 1;
+    level.cols = m_nlon - 1;
+    level.hmax.resize(level.rows * level.cols);
+    level.hmin.resize(level.rows * level.cols);
+    for (std::size_t i = 0 ; i < level.rows ; ++i)
+        for (std::size_t j = 0 ; j < level.cols ; ++j)
+        {
+            const float *z = m_h.data() + i * m_nlon + j;
+            std::size_t c = i * level.cols + j;
+            level.hmax[c] = std::max(std::max(z[0], z[1]), std::max(z[m_nlon], z[m_nlon + 1]));
+            level.hmin[c] = std::min(std::min(z[0], z[1]), std::min(z[m_nlon], z[m_nlon + 1]));
+        }
+    m_levels.push_back(std::move(level));
+    // Coarser levels: bounds of the (up to) 2x2 children cells
+    while ((m_levels.back().rows > 1) || (m_levels.back().cols > 1))
+    {
+        const Level &fine = m_levels.back();
+        Level coarse;
+        coarse.rows = (fine.rows + 1) / 2;
+        coarse.cols = (fine.cols + 1) / 2;
+        coarse.hmax.assign(coarse.rows * coarse.cols, -std::numeric_limits<float>::infinity());
+        coarse.hmin.assign(coarse.rows * coarse.cols, std::numeric_limits<float>::infinity());
+        for (std::size_t i = 0 ; i < fine.rows ; ++i)
+            for (std::size_t j = 0 ; j < fine.cols ; ++j)
+            {
+                std::size_t c = (i / 2) * coarse.cols + j / 2,
+                            f = i * fine.cols + j;
+                coarse.hmax[c] = std::max(coarse.hmax[c], fine.hmax[f]);
+                coarse.hmin[c] = std::min(coarse.hmin[c], fine.hmin[f]);
+            }
+        m_levels.push_back(std::move(coarse));
+    }
+    // Maximum heights are then extended to the neighbouring cells, so that
+    // they bound the terrain at less than a cell width of each cell
+    for (Level &l : m_levels)
+        dilateMax(l.hmax, l.rows, l.cols);
+}
+
+// Fractional position (column x, row y) of a point in the grid, false if
+// the point is outside of it. Longitudes are wrapped around the grid center
+bool TerrainIntersector::gridPosition(double lon, const double &lat, double &x, double &y) const
+{
+    const double span = static_cast<double>(m_nlon - 1) * m_dlon;
+    lon -= m_lon0 + 0.5 * span;
+    lon -= 2.0 * Constants::m_pi * std::floor(0.5 * (lon + Constants::m_pi) / Constants::m_pi);
+    x = (lon + 0.5 * span) / m_dlon;
+    y = (lat - m_lat0) / m_dlat;
+    return (x >= 0.0) && (x <= static_cast<double>(m_nlon - 1)) &&
+           (y >= 0.0) && (y <= static_cast<double>(m_nlat - 1));
+}
+
+double TerrainIntersector::gridHeight(const double &x, const double &y) const
+{
+    std::size_t j = std::min(static_cast<std::size_t>(x), m_nlon - 2),
+                i = std::min(static_cast<std::size_t>(y), m_nlat - 2);
+    double tx = x - static_cast<double>(j),
+           ty = y - static_cast<double>(i);
+    const float *z = m_h.data() + i * m_nlon + j;
+    double v0 = z[0] + tx * (z[1] - z[0]),
+           v1 = z[m_nlon] + tx * (z[m_nlon + 1] - z[m_nlon]);
+    return v0 + ty * (v1 - v0);
+}
+
+// Largest distance a point at height h above the grid position (x, y) may
+// move without going below the terrain
+double TerrainIntersector::safeStep(const double &x, const double &y, const double &h) const
+{
+    std::size_t j0 = std::min(static_cast<std::size_t>(x), m_nlon - 2),
+                i0 = std::min(static_cast<std::size_t>(y), m_nlat - 2);
+    double best = 0.0;
+    for (std::size_t L = m_levels.size() ; L-- > 0 ; )
+    {
+        const Level &level = m_levels[L];
+        double gap = h - level.hmax[(i0 >> L) * level.cols + (j0 >> L)];
+        if ((level.rows == 1) && (level.cols == 1) && (gap > 0.0))
+            return gap; // Above the whole terrain
+        double width = std::ldexp(m_cellWidth, static_cast<int>(L));
+        if (gap >= width)
+            return std::max(best, width); // Finer levels have narrower cells
+        best = std::max(best, gap);
+    }
+    return best;
+}
+
+// Lower bound of the ground distance from a point outside of the grid to the grid
+double TerrainIntersector::outsideDistance(const double &lon, const double &lat) const
+{
+    double x, y;
+    this->gridPosition(lon, lat, x, y);
+    const double xmax = static_cast<double>(m_nlon - 1),
+                 ymax = static_cast<double>(m_nlat - 1),
+                 dx = std::max(std::max(-x, x - xmax), 0.0) * m_dlon,
+                 dy = std::max(std::max(-y, y - ymax), 0.0) * m_dlat,
+                 lonScale = std::min(m_lonScale, m_latScale * std::cos(lat));
+    return std::max(dx * std::max(lonScale, 0.0), dy * m_latScale);
+}
+
+double TerrainIntersector::intersect_ray(const double &ox, const double &oy, const double &oz,
+                                         const double &dx, const double &dy, const double &dz) const
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN(),
+                 dn = std::sqrt(dx * dx + dy * dy + dz * dz);
+    if (dn == 0.0)
+        return nan;
+    // Entry and exit of the sphere bounding the terrain
+    const double R = m_elps->getEquatorialRadius() + std::max(m_hmax, 0.0) + 1.0,
+                 a2 = dn * dn,
+                 a1 = ox * dx + oy * dy + oz * dz,
+                 a0 = ox * ox + oy * oy + oz * oz - R * R,
+                 disc = a1 * a1 - a2 * a0;
+    if (disc < 0.0)
+        return nan;
+    const double sq = std::sqrt(disc),
+                 tfar = (-a1 + sq) / a2;
+    if (tfar < 0.0)
+        return nan;
+    // Steps close to the terrain: half a cell, at least a quarter of a row
+    const double fine = std::max(0.5 * m_cellWidth, 0.25 * m_dlat * m_latScale);
+    const Level &level0 = m_levels.front();
+    // Position of the point t of the ray, true if it is below the terrain
+    auto below = [&](const double &t, double &lon, double &lat, double &h,
+                     double &x, double &y, bool &inside) -> bool
+    {
+        double px = ox + t * dx, py = oy + t * dy, pz = oz + t * dz;
+        m_elps->geocentricToGeodetic(&px, &py, &pz, &lon, &lat, &h, 1, false);
+        inside = this->gridPosition(lon, lat, x, y);
+        if (!inside)
+            return false;
+        std::size_t c = std::min(static_cast<std::size_t>(y), m_nlat - 2) * level0.cols +
+                        std::min(static_cast<std::size_t>(x), m_nlon - 2);
+        if (h < level0.hmin[c]) // Below the whole cell
+            return true;
+        if (h > level0.hmax[c]) // Above the whole cell
+            return false;
+        return h < this->gridHeight(x, y);
+    };
+    double t = std::max(0.0, (-a1 - sq) / a2),
+           tprev = nan,
+           lon, lat, h, x, y;
+    bool inside;
+    for ( ; ; )
+    {
+        if (below(t, lon, lat, h, x, y, inside))
+        {
+            if (std::isnan(tprev)) // The ray starts below the terrain
+                return t;
+            // Bisection between the last point above and the first point below
+            double ta = tprev, tb = t;
+            while ((tb - ta) * dn > m_tolerance)
+            {
+                double tm = 0.5 * (ta + tb);
+                if (below(tm, lon, lat, h, x, y, inside))
+                    tb = tm;
+                else
+                    ta = tm;
+            }
+            return 0.5 * (ta + tb);
+        }
+        if (t >= tfar)
+            return nan;
+        // Above all the terrain and going up: the height along a line being
+        // convex outside of the ellipsoid, the ray never comes back
+        double clat = std::cos(lat);
+        if ((h > m_hmax) &&
+            (dx * clat * std::cos(lon) + dy * clat * std::sin(lon) + dz * std::sin(lat) > 0.0))
+            return nan;
+        double step = inside ? this->safeStep(x, y, h) : this->outsideDistance(lon, lat);
+        tprev = t;
+        t = std::min(t + std::max(0.99 * step, fine) / dn, tfar);
+    }
+}
+
+void TerrainIntersector::intersect_block(const double *ox, const double *oy, const double *oz,
+                                         const double *dx, const double *dy, const double *dz,
+                                         std::size_t n,
+                                         double *t, double *px, double *py, double *pz) const
+{
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        double tk = this->intersect_ray(ox[k], oy[k], oz[k], dx[k], dy[k], dz[k]);
+        t[k] = tk;
+        px[k] = ox[k] + tk * dx[k];
+        py[k] = oy[k] + tk * dy[k];
+        pz[k] = oz[k] + tk * dz[k];
+    }
+}
+
+} // namespace Osl::Geography
+
+} // namespace Osl
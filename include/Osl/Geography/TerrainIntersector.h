@@ -0,0 +1,190 @@
+/*! ********************************************************************
+ * \file TerrainIntersector.h
+ * \brief Header file of Osl::Geography::TerrainIntersector class.
+ *********************************************************************/
+
+#ifndef OSL_GEOGRAPHY_TERRAININTERSECTOR_H
+#define OSL_GEOGRAPHY_TERRAININTERSECTOR_H
+
+#include "Ellipsoid.h"
+#include "DEMTileCache.h"
+#include "Osl/Geometry/Vector3D.h"
+#include "Osl/Geometry/Shape3D/Line3D.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+/*! ********************************************************************
+ * \brief Class to intersect rays with a terrain given as a raster of
+ * heights above an Ellipsoid.
+ *
+ * The terrain is the bilinear surface of a regular geodetic grid of
+ * \em nlat rows of \em nlon heights, the node \f$(i,j)\f$ having the
+ * coordinates \f$(\lambda_0+j\Delta\lambda,\ \phi_0+i\Delta\phi)\f$.
+ * Outside of the grid, there is no terrain.
+ *
+ * At construction a min/max pyramid of the grid cells is built: the cell
+ * \f$(i,j)\f$ of level \f$L\f$ covers \f$2^L\times 2^L\f$ cells of the
+ * grid, and stores the maximum height over itself and its 8 neighbours,
+ * and its minimum height. The rays (Line3D in geocentric coordinates) are
+ * marched from their entry in the sphere bounding the terrain. Since
+ * the geodetic height is 1-Lipschitz with respect to the Euclidean
+ * distance, a point at height \f$h\f$ above a cell of level \f$L\f$ of
+ * (dilated) maximum height \f$H_L\f$ may safely move along the ray by
+ * \f$\min(h-H_L, w_L)\f$, with \f$w_L\f$ the ground width of a cell of
+ * that level. The largest step over the levels is taken, so that the
+ * empty space above the terrain is skipped hierarchically, the march
+ * only falling back to steps of half a grid cell close to the terrain.
+ * Once the ray is found below the terrain (or below the minimum of a
+ * cell), the intersection is refined by bisection up to the tolerance.
+ *
+ * The batch versions share tiles of rays among the OpenMP threads
+ * (dynamically, the cost of a ray depending on the terrain it crosses).
+ *
+ * \note Heights are stored in single precision. NaN heights (DEM voids)
+ *       are taken at 0 m. The ellipsoid given at construction must
+ *       outlive the intersector.
+ *********************************************************************/
+class TerrainIntersector
+{
+public:
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor.
+    TerrainIntersector();
+
+    /*! ********************************************************************
+     * \brief TerrainIntersector constructor from a raster of heights.
+     * \param [in] elps The ellipsoid of the heights.
+     * \param [in] heights The \em nlat rows of \em nlon heights [m].
+     * \param [in] nlon, nlat The number of columns and rows of the grid.
+     * \param [in] lon0, lat0 The coordinates of the first node.
+     * \param [in] dlon, dlat The spacings of the columns and rows (\em dlat
+     *             may be negative for rows going from north to south).
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    TerrainIntersector(Ellipsoid* elps, const vector &heights,
+                       std::size_t nlon, std::size_t nlat,
+                       const double &lon0, const double &lat0,
+                       const double &dlon, const double &dlat, bool degrees=true);
+
+    /*! ********************************************************************
+     * \brief TerrainIntersector constructor from a DEMTileCache.
+     *
+     * The DEM is sampled on a regular grid of the given area.
+     *
+     * \param [in] elps The ellipsoid of the heights.
+     * \param [in] dem The DEM to sample.
+     * \param [in] lonmin, latmin The coordinates of the south-west corner.
+     * \param [in] lonmax, latmax The coordinates of the north-east corner.
+     * \param [in] nlon, nlat The number of columns and rows of the grid.
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    TerrainIntersector(Ellipsoid* elps, DEMTileCache &dem,
+                       const double &lonmin, const double &latmin,
+                       const double &lonmax, const double &latmax,
+                       std::size_t nlon, std::size_t nlat, bool degrees=true);
+
+    //! Copy constructor
+    TerrainIntersector(const TerrainIntersector &other);
+
+    // ============== DESTRUCTOR ==============
+    //! Default destructor
+    ~TerrainIntersector();
+
+    // ============== CLASS METHODS ==============
+    // ********** SETTER **********
+    //! Sets the accuracy of the intersections along the rays [m] (default 1 cm).
+    void setTolerance(const double &tolerance);
+
+    // ********** GETTER **********
+    Ellipsoid* getEllipsoidPtr() const;
+    std::size_t getNLon() const;
+    std::size_t getNLat() const;
+    //! Number of levels of the min/max pyramid.
+    std::size_t getLevels() const;
+    double getMinHeight() const;
+    double getMaxHeight() const;
+    double getTolerance() const;
+
+    // ============== OPERATORS ==============
+    TerrainIntersector operator=(const TerrainIntersector &other); // Assignement from another TerrainIntersector
+
+    // ============== TERRAIN ==============
+    /*! ********************************************************************
+     * \brief Height of the terrain at a point.
+     * \param [in] lon, lat The geodetic coordinates of the point.
+     * \param [in] degrees The unit of the given coordinates.
+     * \return The bilinearly interpolated height [m], NaN outside the grid.
+     *********************************************************************/
+    double height(const double &lon, const double &lat, bool degrees=true) const;
+
+    // ============== RAY INTERSECTION ==============
+    /*! ********************************************************************
+     * \brief Nearest intersection (t >= 0) of a ray with the terrain.
+     * \param [in] ray The ray in geocentric coordinates [m].
+     * \param [out] t The distance along the ray (in direction units).
+     * \param [out] point The geocentric coordinates of the intersection.
+     * \return False if the ray misses the terrain, \em t and \em point
+     *         being then set to NaN.
+     *********************************************************************/
+    bool intersect(const Geometry::Shape3D::Line3D &ray, double &t, Geometry::Vector3D &point) const;
+
+    /*! ********************************************************************
+     * \brief Batched intersections of rays with the terrain.
+     * \param [in] ox, oy, oz Pointers to the \em n origins of the rays [m].
+     * \param [in] dx, dy, dz Pointers to the \em n directions of the rays.
+     * \param [in] n The number of rays.
+     * \param [out] t Pointer to the \em n distances along the rays.
+     * \param [out] px, py, pz Pointers to the \em n intersections, set to
+     *              NaN for missed rays.
+     *********************************************************************/
+    void intersect(const double *ox, const double *oy, const double *oz,
+                   const double *dx, const double *dy, const double *dz,
+                   std::size_t n,
+                   double *t, double *px, double *py, double *pz) const;
+    void intersect(const Geometry::Shape3D::Line3D *rays, std::size_t n,
+                   double *t, double *px, double *py, double *pz) const;
+
+private:
+    // ============== PRIVATE CLASS MEMBERS ==============
+    struct Level
+    {
+        std::size_t rows, cols;
+        std::vector<float> hmax, // Maximum heights of the cells and their neighbours
+                           hmin; // Minimum heights of the cells
+    };
+    static constexpr std::size_t m_batch = 64; // Rays per tile
+    Ellipsoid* m_elps;
+    std::vector<float> m_h;       // Heights, rows from south to north
+    std::size_t m_nlon, m_nlat;
+    double m_lon0, m_lat0,        // Coordinates of the south-west node [rad]
+           m_dlon, m_dlat,        // Positive spacings [rad]
+           m_hmin, m_hmax,        // Height bounds of the terrain [m]
+           m_cellWidth,           // Minimum ground width of a grid cell [m]
+           m_lonScale,            // Minimum ground length of a radian of longitude [m]
+           m_latScale,            // Minimum ground length of a radian of latitude [m]
+           m_tolerance;
+    std::vector<Level> m_levels;
+    // ============== PRIVATE CLASS METHODS ==============
+    void init(Ellipsoid* elps, const vector &heights, std::size_t nlon, std::size_t nlat,
+              const double &lon0, const double &lat0, const double &dlon, const double &dlat,
+              bool degrees);
+    void buildPyramid();
+    bool gridPosition(double lon, const double &lat, double &x, double &y) const;
+    double gridHeight(const double &x, const double &y) const;
+    double safeStep(const double &x, const double &y, const double &h) const;
+    double outsideDistance(const double &lon, const double &lat) const;
+    double intersect_ray(const double &ox, const double &oy, const double &oz,
+                         const double &dx, const double &dy, const double &dz) const;
+    void intersect_block(const double *ox, const double *oy, const double *oz,
+                         const double *dx, const double *dy, const double *dz,
+                         std::size_t n,
+                         double *t, double *px, double *py, double *pz) const;
+};
+
+} // namespace Osl::Geography
+
+} // namespace Osl
+
+#endif // OSL_GEOGRAPHY_TERRAININTERSECTOR_H
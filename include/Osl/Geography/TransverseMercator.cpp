@@ -0,0 +1,260 @@
+/*! ********************************************************************
+ * \file TransverseMercator.cpp
+ * \brief Source file of Osl::Geography::TransverseMercator class.
+ *********************************************************************/
+
+#include <algorithm>
+#include "TransverseMercator.h"
+#include "Osl/Batch.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+namespace { // Local functions
+
+// Clenshaw summation of the complex series sum_{j=1}^{n} c[j-1] * sin(2j zeta)
+// with zeta = xi + i*eta, written in real arithmetic:
+//     re = sum c[j-1] * sin(2j xi) * cosh(2j eta)
+//     im = sum c[j-1] * cos(2j xi) * sinh(2j eta)
+inline void clenshawSin2(const double *c, std::size_t n,
+                         const double &xi, const double &eta,
+                         double &re, double &im)
+{
+    double s2 = std::sin(2.0 * xi),
+           c2 = std::cos(2.0 * xi),
+           sh2 = std::sinh(2.0 * eta),
+           ch2 = std::cosh(2.0 * eta);
+    // 2 * cos(2 zeta)
+    double ar = 2.0 * c2 * ch2,
+           ai = -2.0 * s2 * sh2;
+    double b1r = 0.0, b1i = 0.0,
+           b2r = 0.0, b2i = 0.0;
+    for (std::size_t j = n ; j > 0 ; --j)
+    {
+        double b0r = ar * b1r - ai * b1i - b2r + c[j - 1],
+               b0i = ar * b1i + ai * b1r - b2i;
+        b2r = b1r; b2i = b1i;
+        b1r = b0r; b1i = b0i;
+    }
+    // sin(2 zeta) * b1
+    double sr = s2 * ch2,
+           si = c2 * sh2;
+    re = sr * b1r - si * b1i;
+    im = sr * b1i + si * b1r;
+}
+
+} // namespace
+
+// ============== CONSTRUCTOR ==============
+TransverseMercator::TransverseMercator() {}
+
+TransverseMercator::TransverseMercator(const Ellipsoid* elps, const double &lon0, const double &k0,
+                                       const double &falseEasting, const double &falseNorthing,
+                                       bool degrees)
+    : m_elps(elps),
+      m_lon0(degrees ? lon0 * Constants::m_degtorad : lon0),  // Longitude of the central meridian [rad]
+      m_k0(k0),                                               // Scale factor on the central meridian
+      m_fe(falseEasting),                                     // False easting [m]
+      m_fn(falseNorthing)                                     // False northing [m]
+{
+    if (!(k0 > 0.0))
+        throw std::invalid_argument("TransverseMercator constructor:\n"
+                                    "\t'k0' must be strictly positive.");
+    m_e = m_elps->getEccentricity();
+    // Initialization of Krüger's series coefficients
+    this->initSeriesCoeffs();
+}
+
+// Copy constructor
+TransverseMercator::TransverseMercator(const TransverseMercator &other)
+    : m_elps(other.m_elps), m_lon0(other.m_lon0), m_k0(other.m_k0),
+      m_fe(other.m_fe), m_fn(other.m_fn), m_e(other.m_e), m_k0A(other.m_k0A)
+{
+    std::copy(other.m_alp, other.m_alp + m_order, m_alp);
+    std::copy(other.m_bet, other.m_bet + m_order, m_bet);
+}
+
+// ============== DESTRUCTOR ==============
+TransverseMercator::~TransverseMercator() {}
+
+// ============== CLASS METHODS ==============
+// ********** GETTER **********
+double TransverseMercator::getCentralMeridian(bool degrees) const
+{
+    return degrees ? m_lon0 * Constants::m_radtodeg : m_lon0;
+}
+double TransverseMercator::getScaleFactor() const { return m_k0; }
+double TransverseMercator::getFalseEasting() const { return m_fe; }
+double TransverseMercator::getFalseNorthing() const { return m_fn; }
+const Ellipsoid* TransverseMercator::getEllipsoidPtr() const { return m_elps; }
+
+// ============== OPERATORS ==============
+// Assignement from another TransverseMercator
+TransverseMercator TransverseMercator::operator=(const TransverseMercator &other)
+{
+    m_elps = other.m_elps;
+    m_lon0 = other.m_lon0;  // Longitude of the central meridian [rad]
+    m_k0 = other.m_k0;      // Scale factor on the central meridian
+    m_fe = other.m_fe;      // False easting [m]
+    m_fn = other.m_fn;      // False northing [m]
+    m_e = other.m_e;        // the ellipsoïd excentricity
+    m_k0A = other.m_k0A;    // m_k0 * rectifying radius [m]
+    std::copy(other.m_alp, other.m_alp + m_order, m_alp);
+    std::copy(other.m_bet, other.m_bet + m_order, m_bet);
+    return *this;
+}
+
+// ============== PROJECTION ==============
+void TransverseMercator::forward(const double &lon, const double &lat,
+                                 double &x, double &y, bool degrees) const
+{
+    this->forward_block(&lon, &lat, &x, &y, 1, degrees);
+}
+
+void TransverseMercator::inverse(const double &x, const double &y,
+                                 double &lon, double &lat, bool degrees) const
+{
+    this->inverse_block(&x, &y, &lon, &lat, 1, degrees);
+}
+
+void TransverseMercator::forward(const double *lon, const double *lat,
+                                 double *x, double *y, std::size_t n, bool degrees) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        this->forward_block(lon + k0, lat + k0, x + k0, y + k0, nb, degrees);
+    });
+}
+
+void TransverseMercator::forward(const vector &lon, const vector &lat,
+                                 vector &x, vector &y, bool degrees) const
+{
+    std::size_t n = lon.size();
+    if (lat.size() != n)
+        throw std::invalid_argument("TransverseMercator.forward():\n"
+                                    "\t'lon' and 'lat' must have same size.");
+    x.resize(n);
+    y.resize(n);
+    this->forward(lon.data(), lat.data(), x.data(), y.data(), n, degrees);
+}
+
+void TransverseMercator::inverse(const double *x, const double *y,
+                                 double *lon, double *lat, std::size_t n, bool degrees) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        this->inverse_block(x + k0, y + k0, lon + k0, lat + k0, nb, degrees);
+    });
+}
+
+void TransverseMercator::inverse(const vector &x, const vector &y,
+                                 vector &lon, vector &lat, bool degrees) const
+{
+    std::size_t n = x.size();
+    if (y.size() != n)
+        throw std::invalid_argument("TransverseMercator.inverse():\n"
+                                    "\t'x' and 'y' must have same size.");
+    lon.resize(n);
+    lat.resize(n);
+    this->inverse(x.data(), y.data(), lon.data(), lat.data(), n, degrees);
+}
+
+// ============== PRIVATE CLASS METHODS ==============
+void TransverseMercator::initSeriesCoeffs()
+{
+    // Power of third flattening factor
+    double n = m_elps->getThirdFlattening(),
+           n2 = n * n, n3 = n * n2, n4 = n2 * n2, n5 = n2 * n3, n6 = n3 * n3;
+    // Scaled rectifying radius
+    m_k0A = m_k0 * m_elps->getEquatorialRadius() / (1.0 + n) * (1.0 + n2/4.0 + n4/64.0 + n6/256.0);
+    // Coefficients of the forward series
+    m_alp[0] = n/2.0 - 2.0*n2/3.0 + 5.0*n3/16.0 + 41.0*n4/180.0 - 127.0*n5/288.0 + 7891.0*n6/37800.0;
+    m_alp[1] = 13.0*n2/48.0 - 3.0*n3/5.0 + 557.0*n4/1440.0 + 281.0*n5/630.0 - 1983433.0*n6/1935360.0;
+    m_alp[2] = 61.0*n3/240.0 - 103.0*n4/140.0 + 15061.0*n5/26880.0 + 167603.0*n6/181440.0;
+    m_alp[3] = 49561.0*n4/161280.0 - 179.0*n5/168.0 + 6601661.0*n6/7257600.0;
+    m_alp[4] = 34729.0*n5/80640.0 - 3418889.0*n6/1995840.0;
+    m_alp[5] = 212378941.0*n6/319334400.0;
+    // Coefficients of the inverse series
+    m_bet[0] = n/2.0 - 2.0*n2/3.0 + 37.0*n3/96.0 - n4/360.0 - 81.0*n5/512.0 + 96199.0*n6/604800.0;
+    m_bet[1] = n2/48.0 + n3/15.0 - 437.0*n4/1440.0 + 46.0*n5/105.0 - 1118711.0*n6/3870720.0;
+    m_bet[2] = 17.0*n3/480.0 - 37.0*n4/840.0 - 209.0*n5/4480.0 + 5569.0*n6/90720.0;
+    m_bet[3] = 4397.0*n4/161280.0 - 11.0*n5/504.0 - 830251.0*n6/7257600.0;
+    m_bet[4] = 4583.0*n5/161280.0 - 108847.0*n6/3991680.0;
+    m_bet[5] = 20648693.0*n6/638668800.0;
+}
+
+void TransverseMercator::forward_block(const double *lon, const double *lat,
+                                       double *x, double *y, std::size_t n, bool degrees) const
+{
+    // Local copies of the projection parameters (no aliasing with outputs)
+    double alp[m_order];
+    std::copy(m_alp, m_alp + m_order, alp);
+    const double lon0 = m_lon0,
+                 e = m_e,
+                 k0A = m_k0A,
+                 fe = m_fe,
+                 fn = m_fn,
+                 k = degrees ? Constants::m_degtorad : 1.0,
+                 two_pi = 2.0 * Constants::m_pi;
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double lam = std::remainder(lon[i] * k - lon0, two_pi),
+               slat = std::sin(lat[i] * k),
+               tau = std::sinh(std::atanh(slat) - e * std::atanh(e * slat)), // tan(chi)
+               clam = std::cos(lam),
+               slam = std::sin(lam);
+        // Gauss-Schreiber coordinates
+        double xip = std::atan2(tau, clam),
+               etap = std::asinh(slam / std::hypot(tau, clam)),
+               re, im;
+        clenshawSin2(alp, m_order, xip, etap, re, im);
+        x[i] = fe + k0A * (etap + im);
+        y[i] = fn + k0A * (xip + re);
+    }
+}
+
+void TransverseMercator::inverse_block(const double *x, const double *y,
+                                       double *lon, double *lat, std::size_t n, bool degrees) const
+{
+    // Local copies of the projection parameters (no aliasing with outputs)
+    double bet[m_order];
+    std::copy(m_bet, m_bet + m_order, bet);
+    const double lon0 = m_lon0,
+                 invk0A = 1.0 / m_k0A,
+                 fe = m_fe,
+                 fn = m_fn,
+                 k = degrees ? Constants::m_radtodeg : 1.0,
+                 two_pi = 2.0 * Constants::m_pi;
+    double chi[detail::batch_size]; // Conformal latitudes of the block
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        #pragma omp simd
+        for (std::size_t i = 0 ; i < nb ; ++i)
+        {
+            double xi = (y[k0 + i] - fn) * invk0A,
+                   eta = (x[k0 + i] - fe) * invk0A,
+                   re, im;
+            clenshawSin2(bet, m_order, xi, eta, re, im);
+            // Gauss-Schreiber coordinates
+            double xip = xi - re,
+                   etap = eta - im,
+                   sxip = std::sin(xip),
+                   cxip = std::cos(xip),
+                   shetap = std::sinh(etap);
+            chi[i] = std::atan2(sxip, std::hypot(shetap, cxip));
+            lon[k0 + i] = std::remainder(lon0 + std::atan2(shetap, cxip), two_pi) * k;
+        }
+        // Geodetic latitudes from the series of the inverse conformal latitude
+        m_elps->inverseConformalLatitude(chi, lat + k0, nb, false);
+        #pragma omp simd
+        for (std::size_t i = 0 ; i < nb ; ++i)
+            lat[k0 + i] *= k;
+    }
+}
+
+} // namespace Osl::Geography
+
+} // namespace Osl
@@ -0,0 +1,171 @@
+/*! ********************************************************************
+ * \file TransverseMercator.h
+ * \brief Header file of Osl::Geography::TransverseMercator class.
+ *********************************************************************/
+
+#ifndef OSL_GEOGRAPHY_TRANSVERSEMERCATOR_H
+#define OSL_GEOGRAPHY_TRANSVERSEMERCATOR_H
+
+#include "Ellipsoid.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+/*! ********************************************************************
+ * \brief Class to manage the Transverse Mercator projection of an
+ * Ellipsoid of revolution.
+ *
+ * The projection is computed from Krüger's series in the third
+ * flattening \f$n\f$, truncated at \f$n^6\f$ \cite Karney_11. The forward
+ * projection maps the conformal latitude \f$\chi\f$ and the longitude
+ * \f$\lambda\f$ from the central meridian \f$\lambda_0\f$ to the
+ * Gauss-Schreiber coordinates
+ *
+ * \f[
+ *     \xi'=\arctan\left(\dfrac{\tan\chi}{\cos(\lambda-\lambda_0)}\right),
+ *     \quad
+ *     \eta'=\mathrm{arcsinh}\left(\dfrac{\sin(\lambda-\lambda_0)}
+ *         {\sqrt{\tan^2\chi+\cos^2(\lambda-\lambda_0)}}\right)
+ * \f]
+ *
+ * and then to the easting \f$E\f$ and northing \f$N\f$:
+ *
+ * \f[
+ *     N+iE=N_0+iE_0+k_0A\left(\zeta'+\sum_{j=1}^{6}\alpha_{j}
+ *         \sin(2j\zeta')\right),\quad\zeta'=\xi'+i\eta'
+ * \f]
+ *
+ * where \f$A\f$ is the rectifying radius and \f$k_0\f$ the scale factor on
+ * the central meridian. The inverse projection uses the reverted series
+ * of coefficients \f$\beta_j\f$ and the inverse conformal latitude of the
+ * Ellipsoid. Both series are summed by Clenshaw's method in complex
+ * arithmetic written with real numbers, so that only one sine, cosine,
+ * hyperbolic sine and hyperbolic cosine are needed per point. The
+ * accuracy is better than a few nanometers within 4000 km of the central
+ * meridian.
+ *
+ * The coefficients are computed once at construction. The batch versions
+ * share blocks of points among the OpenMP threads, each block being
+ * vectorized by the compiler (through \em omp \em simd).
+ *
+ * \note The ellipsoid given at construction must outlive the projection.
+ * \sa UTM
+ *********************************************************************/
+class TransverseMercator
+{
+public:
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor.
+    TransverseMercator();
+
+    /*! ********************************************************************
+     * \brief TransverseMercator constructor.
+     * \param [in] elps The projected ellipsoid.
+     * \param [in] lon0 The longitude of the central meridian.
+     * \param [in] k0 The scale factor on the central meridian.
+     * \param [in] falseEasting The easting of the central meridian [m].
+     * \param [in] falseNorthing The northing of the equator [m].
+     * \param [in] degrees The unit of the given longitude.
+     *********************************************************************/
+    TransverseMercator(const Ellipsoid* elps, const double &lon0, const double &k0=1.0,
+                       const double &falseEasting=0.0, const double &falseNorthing=0.0,
+                       bool degrees=true);
+
+    //! Copy constructor
+    TransverseMercator(const TransverseMercator &other);
+
+    //! Default destructor
+    virtual ~TransverseMercator();
+
+    // ============== CLASS METHODS ==============
+    // ********** GETTER **********
+    double getCentralMeridian(bool degrees=true) const;
+    double getScaleFactor() const;
+    double getFalseEasting() const;
+    double getFalseNorthing() const;
+    const Ellipsoid* getEllipsoidPtr() const;
+
+    // ============== OPERATORS ==============
+    TransverseMercator operator=(const TransverseMercator &other); // Assignement from another TransverseMercator
+
+    // ============== PROJECTION ==============
+    /*! ********************************************************************
+     * \brief Forward projection of a geodetic point.
+     * \param [in] lon, lat The geodetic coordinates of the point.
+     * \param [out] x, y The easting and northing of the point [m].
+     * \param [in] degrees The unit of the given coordinates.
+     *********************************************************************/
+    void forward(const double &lon, const double &lat,
+                 double &x, double &y, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Inverse projection of a projected point.
+     * \param [in] x, y The easting and northing of the point [m].
+     * \param [out] lon, lat The geodetic coordinates of the point.
+     * \param [in] degrees The unit of the returned coordinates.
+     *********************************************************************/
+    void inverse(const double &x, const double &y,
+                 double &lon, double &lat, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Forward projection of arrays of geodetic points.
+     *
+     * Batch version of TransverseMercator::forward working on
+     * structure-of-arrays data. The vector overload resizes the outputs.
+     *
+     * \param [in] lon, lat Pointers to the \em n geodetic coordinates.
+     * \param [out] x, y Pointers to the \em n resulting eastings and
+     *              northings [m].
+     * \param [in] n The number of points.
+     * \param [in] degrees The unit of the given coordinates.
+     * \note Input and output arrays must not overlap.
+     *********************************************************************/
+    void forward(const double *lon, const double *lat,
+                 double *x, double *y, std::size_t n, bool degrees=true) const;
+    void forward(const vector &lon, const vector &lat,
+                 vector &x, vector &y, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Inverse projection of arrays of projected points.
+     *
+     * Batch version of TransverseMercator::inverse working on
+     * structure-of-arrays data. The vector overload resizes the outputs.
+     *
+     * \param [in] x, y Pointers to the \em n eastings and northings [m].
+     * \param [out] lon, lat Pointers to the \em n resulting geodetic
+     *              coordinates.
+     * \param [in] n The number of points.
+     * \param [in] degrees The unit of the returned coordinates.
+     * \note Input and output arrays must not overlap.
+     *********************************************************************/
+    void inverse(const double *x, const double *y,
+                 double *lon, double *lat, std::size_t n, bool degrees=true) const;
+    void inverse(const vector &x, const vector &y,
+                 vector &lon, vector &lat, bool degrees=true) const;
+
+private:
+    // ============== PRIVATE CLASS MEMBERS ==============
+    static constexpr std::size_t m_order = 6; // Order of Krüger's series
+    const Ellipsoid* m_elps;
+    double m_lon0,   // Longitude of the central meridian [rad]
+           m_k0,     // Scale factor on the central meridian
+           m_fe,     // False easting [m]
+           m_fn,     // False northing [m]
+           m_e,      // the ellipsoïd excentricity
+           m_k0A;    // m_k0 * rectifying radius [m]
+    double m_alp[m_order],  // Coefficients of the forward series
+           m_bet[m_order];  // Coefficients of the inverse series
+    // ============== PRIVATE CLASS METHODS ==============
+    void initSeriesCoeffs();
+    void forward_block(const double *lon, const double *lat,
+                       double *x, double *y, std::size_t n, bool degrees) const;
+    void inverse_block(const double *x, const double *y,
+                       double *lon, double *lat, std::size_t n, bool degrees) const;
+};
+
+} // namespace Osl::Geography
+
+} // namespace Osl
+
+#endif // OSL_GEOGRAPHY_TRANSVERSEMERCATOR_H
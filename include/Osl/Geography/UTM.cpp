@@ -0,0 +1,95 @@
+/*! ********************************************************************
+ * \file UTM.cpp
+ * \brief Source file of Osl::Geography::UTM class.
+ *********************************************************************/
+
+#include <algorithm>
+#include "UTM.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+namespace { // Local functions
+
+// Central meridian of a UTM zone in degrees
+double centralMeridian(int zone)
+{
+    if ((zone < 1) || (zone > 60))
+        throw std::invalid_argument("UTM constructor:\n"
+                                    "\t'zone' must be in [1, 60].");
+    return 6.0 * zone - 183.0;
+}
+
+} // namespace
+
+// ============== CONSTRUCTOR ==============
+UTM::UTM() {}
+
+UTM::UTM(const Ellipsoid* elps, int zone, bool north)
+    : TransverseMercator(elps, centralMeridian(zone), 0.9996,
+                         500000.0, north ? 0.0 : 10000000.0, true),
+      m_zone(zone),
+      m_north(north) {}
+
+// Copy constructor
+UTM::UTM(const UTM &other)
+    : TransverseMercator(other), m_zone(other.m_zone), m_north(other.m_north) {}
+
+// ============== DESTRUCTOR ==============
+UTM::~UTM() {}
+
+// ============== CLASS METHODS ==============
+// ********** GETTER **********
+int UTM::getZone() const { return m_zone; }
+bool UTM::isNorth() const { return m_north; }
+
+// ============== OPERATORS ==============
+// Assignement from another UTM
+UTM UTM::operator=(const UTM &other)
+{
+    TransverseMercator::operator=(other);
+    m_zone = other.m_zone;    // UTM zone
+    m_north = other.m_north;  // Hemisphere
+    return *this;
+}
+
+// ============== UTILITIES ==============
+int UTM::zone(const double &lon, bool degrees)
+{
+    double lon_deg = std::remainder(degrees ? lon : lon * Constants::m_radtodeg, 360.0);
+    if (std::isnan(lon_deg))
+        throw std::invalid_argument("UTM.zone():\n"
+                                    "\t'lon' must be finite.");
+    // The antimeridian starts zone 1
+    if (lon_deg >= 180.0)
+        lon_deg -= 360.0;
+    int z = static_cast<int>(std::floor((lon_deg + 180.0) / 6.0)) + 1;
+    return std::min(std::max(z, 1), 60);
+}
+
+int UTM::zone(const double &lon, const double &lat, bool degrees)
+{
+    int z = UTM::zone(lon, degrees);
+    double lon_deg = std::remainder(degrees ? lon : lon * Constants::m_radtodeg, 360.0),
+           lat_deg = degrees ? lat : lat * Constants::m_radtodeg;
+    // Norway: zone 32 widened to 3°E on band V
+    if ((lat_deg >= 56.0) && (lat_deg < 64.0) && (lon_deg >= 3.0) && (lon_deg < 12.0))
+        return 32;
+    // Svalbard: zones 31, 33, 35 and 37 widened on band X
+    if ((lat_deg >= 72.0) && (lat_deg <= 84.0) && (lon_deg >= 0.0) && (lon_deg < 42.0))
+    {
+        if (lon_deg < 9.0)
+            return 31;
+        if (lon_deg < 21.0)
+            return 33;
+        if (lon_deg < 33.0)
+            return 35;
+        return 37;
+    }
+    return z;
+}
+
+} // namespace Osl::Geography
+
+} // namespace Osl
@@ -0,0 +1,95 @@
+/*! ********************************************************************
+ * \file UTM.h
+ * \brief Header file of Osl::Geography::UTM class.
+ *********************************************************************/
+
+#ifndef OSL_GEOGRAPHY_UTM_H
+#define OSL_GEOGRAPHY_UTM_H
+
+#include "TransverseMercator.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geography { // namespace Osl::Geography
+
+/*! ********************************************************************
+ * \brief Class to manage the Universal Transverse Mercator projection.
+ *
+ * A UTM zone is the TransverseMercator projection of central meridian
+ * \f$\lambda_0=6z-183°\f$ for the zone \f$z\in[1,60]\f$, with the scale
+ * factor \f$k_0=0.9996\f$, the false easting \f$E_0=500\,000\f$ m and the
+ * false northing \f$N_0=0\f$ m in the northern hemisphere and
+ * \f$N_0=10\,000\,000\f$ m in the southern hemisphere.
+ *
+ * \sa TransverseMercator
+ *********************************************************************/
+class UTM : public TransverseMercator
+{
+public:
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor.
+    UTM();
+
+    /*! ********************************************************************
+     * \brief UTM constructor.
+     * \param [in] elps The projected ellipsoid.
+     * \param [in] zone The UTM zone in [1, 60].
+     * \param [in] north True for the northern hemisphere, false for the
+     *             southern one.
+     *********************************************************************/
+    UTM(const Ellipsoid* elps, int zone, bool north=true);
+
+    //! Copy constructor
+    UTM(const UTM &other);
+
+    //! Default destructor
+    ~UTM();
+
+    // ============== CLASS METHODS ==============
+    // ********** GETTER **********
+    int getZone() const;
+    bool isNorth() const;
+
+    // ============== OPERATORS ==============
+    UTM operator=(const UTM &other); // Assignement from another UTM
+
+    // ============== UTILITIES ==============
+    /*! ********************************************************************
+     * \brief Standard UTM zone of a longitude.
+     * \param [in] lon The longitude.
+     * \param [in] degrees The unit of the given longitude.
+     * \return The zone in [1, 60] containing the longitude. Zones are
+     *         half-open \f$[-180°+6(z-1), -180°+6z[\f$, so the
+     *         antimeridian (\f$\pm 180°\f$) belongs to zone 1.
+     * \throw std::invalid_argument if \em lon is not finite.
+     * \note The exceptions of Norway and Svalbard are not handled (see
+     *       the overload with the latitude).
+     *********************************************************************/
+    static int zone(const double &lon, bool degrees=true);
+
+    /*! ********************************************************************
+     * \brief UTM zone of a point, with the exceptions of Norway and Svalbard.
+     *
+     * Zone 32 is widened to \f$[3°,12°[\f$ for latitudes in
+     * \f$[56°,64°[\f$, and zones 31, 33, 35 and 37 cover \f$[0°,9°[\f$,
+     * \f$[9°,21°[\f$, \f$[21°,33°[\f$ and \f$[33°,42°[\f$ for latitudes
+     * in \f$[72°,84°]\f$.
+     *
+     * \param [in] lon, lat The geodetic coordinates of the point.
+     * \param [in] degrees The unit of the given coordinates.
+     * \return The zone in [1, 60] containing the point.
+     * \throw std::invalid_argument if \em lon is not finite.
+     *********************************************************************/
+    static int zone(const double &lon, const double &lat, bool degrees=true);
+
+private:
+    // ============== PRIVATE CLASS MEMBERS ==============
+    int m_zone;    // UTM zone
+    bool m_north;  // Hemisphere
+};
+
+} // namespace Osl::Geography
+
+} // namespace Osl
+
+#endif // OSL_GEOGRAPHY_UTM_H
@@ -11,6 +11,7 @@
 
 #include "Vector3D.h"
 #include "Rotation3D.h"
+#include "Quaternion.h"
 // Interpolator
 #include "Interpolator3D/Interpolator3D.h"
 // Shape
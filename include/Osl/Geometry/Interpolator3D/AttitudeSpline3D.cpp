@@ -0,0 +1,426 @@
+/*! ********************************************************************
+ * \file AttitudeSpline3D.cpp
+ * \brief Source file of Osl::Geometry::Interpolator3D::AttitudeSpline3D
+ *        class.
+ *********************************************************************/
+
+
+#include "AttitudeSpline3D.h"
+#include "Osl/Batch.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geometry { // namespace Osl::Geometry
+
+namespace Interpolator3D { // namespace Osl::Geometry::Interpolator
+
+namespace { // Local functions
+
+const double theta_min = 1e-6; // Below, SLERP is replaced by a normalized linear interpolation
+const double small_angle = 0.1; // Below, series replace the trigonometric functions
+const double nlerp_cos = 1.0 - 1e-8; // Above, the SQUAD blend is a normalized linear interpolation
+
+// Sine and cosine, with series exact to rounding for small angles (the
+// usual case between two attitude samples)
+void sin_cos(const double &x, double &s, double &c)
+{
+    if (std::abs(x) < small_angle)
+    {
+        double x2 = x * x;
+        s = x * (1.0 - x2 / 6.0 * (1.0 - x2 / 20.0 * (1.0 - x2 / 42.0 * (1.0 - x2 / 72.0 * (1.0 - x2 / 110.0)))));
+        c = 1.0 - x2 / 2.0 * (1.0 - x2 / 12.0 * (1.0 - x2 / 30.0 * (1.0 - x2 / 56.0 * (1.0 - x2 / 90.0 * (1.0 - x2 / 132.0)))));
+    }
+    else
+    {
+        s = std::sin(x);
+        c = std::cos(x);
+    }
+}
+
+// Angle between two unit quaternions (accurate for small angles, unlike acos),
+// with its cosine and the inverse of its sine (0 if negligible)
+void slerp_angle(const Quaternion &a, const Quaternion &b,
+                 double &theta, double &cos_theta, double &inv_sin)
+{
+    double dw = a.getW() - b.getW(), dx = a.getX() - b.getX(),
+           dy = a.getY() - b.getY(), dz = a.getZ() - b.getZ(),
+           sw = a.getW() + b.getW(), sx = a.getX() + b.getX(),
+           sy = a.getY() + b.getY(), sz = a.getZ() + b.getZ();
+    double d = std::sqrt(dw * dw + dx * dx + dy * dy + dz * dz),  // 2 sin(theta / 2)
+           s = std::sqrt(sw * sw + sx * sx + sy * sy + sz * sz);  // 2 cos(theta / 2)
+    if (d < small_angle) // theta = 2 asin(d / 2)
+    {
+        double u = 0.5 * d, u2 = u * u;
+        theta = 2.0 * u * (1.0 + u2 * (1.0 / 6.0 + u2 * (3.0 / 40.0 + u2 * (5.0 / 112.0 +
+                                u2 * (35.0 / 1152.0 + u2 * 63.0 / 2816.0)))));
+    }
+    else
+        theta = 2.0 * std::atan2(d, s);
+    cos_theta = a.dotProduct(b);
+    inv_sin = (theta > theta_min) ? 2.0 / (d * s) : 0.0;
+}
+
+// sin((1 - h) theta) = sin(theta) cos(h theta) - cos(theta) sin(h theta), so
+// that a single sine and cosine of the same argument are computed
+Quaternion slerp(const Quaternion &a, const Quaternion &b, const double &theta,
+                 const double &cos_theta, const double &inv_sin, const double &h)
+{
+    double wa, wb;
+    if (inv_sin == 0.0)
+    {
+        wa = 1.0 - h;
+        wb = h;
+    }
+    else
+    {
+        double sh, ch;
+        sin_cos(h * theta, sh, ch);
+        wb = sh * inv_sin;
+        wa = ch - cos_theta * wb;
+    }
+    Quaternion q(wa * a.getW() + wb * b.getW(), wa * a.getX() + wb * b.getX(),
+                 wa * a.getY() + wb * b.getY(), wa * a.getZ() + wb * b.getZ());
+    if (inv_sin == 0.0)
+        q.normalize();
+    return q;
+}
+
+// Logarithm of a unit quaternion (pure quaternion, given as a vector)
+Vector3D log_unit(const Quaternion &q)
+{
+    double sn = std::sqrt(q.getX() * q.getX() + q.getY() * q.getY() + q.getZ() * q.getZ());
+    if (sn == 0.0)
+        return Vector3D();
+    double f = std::atan2(sn, q.getW()) / sn;
+    return Vector3D(f * q.getX(), f * q.getY(), f * q.getZ());
+}
+
+// Exponential of a pure quaternion (given as a vector)
+Quaternion exp_pure(const Vector3D &v)
+{
+    double a = v.norm();
+    if (a == 0.0)
+        return Quaternion();
+    double f = std::sin(a) / a;
+    return Quaternion(std::cos(a), f * v.getX(), f * v.getY(), f * v.getZ());
+}
+
+} // Local functions
+
+// ============== CONSTRUCTOR ==============
+AttitudeSpline3D::AttitudeSpline3D(){}
+
+AttitudeSpline3D::AttitudeSpline3D(const vector &t, const std::vector<Quaternion> &q,
+                                   enum AttitudeInterpolation mode)
+    : m_mode(mode)
+{
+    this->init(t, q);
+}
+
+AttitudeSpline3D::AttitudeSpline3D(const vector &t, const std::vector<Rotation3D> &rot,
+                                   enum AttitudeInterpolation mode)
+    : m_mode(mode)
+{
+    std::vector<Quaternion> q(rot.size());
+    for (std::size_t i = 0 ; i < rot.size() ; ++i)
+        q[i] = Quaternion(rot[i]);
+    this->init(t, q);
+}
+
+// Copy constructor
+AttitudeSpline3D::AttitudeSpline3D(const AttitudeSpline3D &other)
+    : m_tmin(other.m_tmin), m_tmax(other.m_tmax),
+      m_uniform(other.m_uniform), m_inv_dt(other.m_inv_dt),
+      m_mode(other.m_mode),
+      m_seg(other.m_seg),
+      m_n(other.m_n) {}
+
+// ============== DESTRUCTOR ==============
+AttitudeSpline3D::~AttitudeSpline3D(){}
+
+// ============== CLASS METHODS ==============
+// *************** GETTER ***************
+double AttitudeSpline3D::getTmin() const { return m_tmin; }
+double AttitudeSpline3D::getTmax() const { return m_tmax; }
+vector AttitudeSpline3D::getT() const
+{
+    if (m_n == 0)
+        return vector();
+    vector t(m_n + 1);
+    for (std::size_t i = 0 ; i < m_n ; ++i)
+        t[i] = m_seg[i].t;
+    t[m_n] = m_tmax;
+    return t;
+}
+std::vector<Quaternion> AttitudeSpline3D::getQuaternions() const
+{
+    if (m_n == 0)
+        return std::vector<Quaternion>();
+    std::vector<Quaternion> q(m_n + 1);
+    for (std::size_t i = 0 ; i < m_n ; ++i)
+        q[i] = m_seg[i].q0;
+    q[m_n] = m_seg[m_n - 1].q1;
+    return q;
+}
+enum AttitudeInterpolation AttitudeSpline3D::getMode() const { return m_mode; }
+bool AttitudeSpline3D::isUniform() const { return m_uniform; }
+
+// *************** SETTER ***************
+void AttitudeSpline3D::setPoints(const vector &t, const std::vector<Quaternion> &q,
+                                 enum AttitudeInterpolation mode)
+{
+    *this = AttitudeSpline3D(t, q, mode);
+}
+
+// ============== OPERATORS ==============
+// Assignement from another AttitudeSpline3D
+AttitudeSpline3D AttitudeSpline3D::operator=(const AttitudeSpline3D &other)
+{
+    m_tmin = other.m_tmin;
+    m_tmax = other.m_tmax;
+    m_uniform = other.m_uniform;
+    m_inv_dt = other.m_inv_dt;
+    m_mode = other.m_mode;
+    m_seg = other.m_seg;
+    m_n = other.m_n;
+    return *this;
+}
+
+void AttitudeSpline3D::operator()(const double &t, Quaternion &q) const
+{
+    if (m_n == 0)
+        throw std::invalid_argument("AttitudeSpline3D::operator()\n"
+                                    "\tThe interpolator is not initialized.");
+    q = this->interpolate(t, this->search_index_for_interpolation(t));
+}
+
+void AttitudeSpline3D::operator()(const double &t, const std::size_t &index, Quaternion &q) const
+{
+    q = this->interpolate(t, index);
+}
+
+// =========== ATTITUDE SPLINE METHODS ===========
+Quaternion AttitudeSpline3D::quaternionAt(const double &t, bool extrapolate) const
+{
+    if (m_n == 0)
+        throw std::invalid_argument("AttitudeSpline3D::quaternionAt\n"
+                                    "\tThe interpolator is not initialized.");
+    if (!extrapolate && ((t < m_tmin) || (t > m_tmax)))
+        throw std::invalid_argument("AttitudeSpline3D::quaternionAt\n"
+                                    "Extrapolation is not authorized. To enable "
+                                    "extrapolation, provide argument 'extrapolate' "
+                                    "to 'true'.");
+    return this->interpolate(t, this->search_index_for_interpolation(t));
+}
+
+Rotation3D AttitudeSpline3D::rotationAt(const double &t, bool extrapolate) const
+{
+    return this->quaternionAt(t, extrapolate).toRotation3D();
+}
+
+std::size_t AttitudeSpline3D::search_index_for_interpolation(const double &teval) const
+{
+    if (teval >= m_tmax)
+        return m_n - 1;
+    if (!(teval > m_tmin)) // NaN included
+        return 0;
+    if (m_uniform)
+        return static_cast<std::size_t>(std::min((teval - m_tmin) * m_inv_dt,
+                                                 static_cast<double>(m_n - 1)));
+    std::size_t left=0, right=m_n, mid;
+    while (right - left > 1)
+    {
+        mid = (left + right) / 2;
+        if (teval >= m_seg[mid].t)
+            left = mid;
+        else
+            right = mid;
+    }
+    return left; // We want the value <= t0
+}
+
+// =========== BATCH EVALUATION ===========
+void AttitudeSpline3D::evaluate(const double *t, Quaternion *q, std::size_t n, bool sorted) const
+{
+    this->evaluate_blocks(t, n, sorted, [q](std::size_t k, const Quaternion &qk)
+    {
+        q[k] = qk;
+    });
+}
+
+void AttitudeSpline3D::evaluate(const double *t, double *qw, double *qx, double *qy, double *qz,
+                                std::size_t n, bool sorted) const
+{
+    this->evaluate_blocks(t, n, sorted, [qw, qx, qy, qz](std::size_t k, const Quaternion &qk)
+    {
+        qk.getCoefficients(qw[k], qx[k], qy[k], qz[k]);
+    });
+}
+
+void AttitudeSpline3D::evaluate(const double *t, Rotation3D *rot, std::size_t n, bool sorted) const
+{
+    this->evaluate_blocks(t, n, sorted, [rot](std::size_t k, const Quaternion &qk)
+    {
+        rot[k] = qk.toRotation3D();
+    });
+}
+
+void AttitudeSpline3D::evaluate(const vector &t, std::vector<Quaternion> &q, bool sorted) const
+{
+    q.resize(t.size());
+    this->evaluate(t.data(), q.data(), t.size(), sorted);
+}
+
+void AttitudeSpline3D::evaluate(const vector &t, std::vector<Rotation3D> &rot, bool sorted) const
+{
+    rot.resize(t.size());
+    this->evaluate(t.data(), rot.data(), t.size(), sorted);
+}
+
+// ============== PRIVATE CLASS METHODS ==============
+void AttitudeSpline3D::init(const vector &t, std::vector<Quaternion> q)
+{
+    // Assertions
+        // Checking that at least 2 points are provided
+    std::size_t tsize(t.size()), qsize(q.size());
+    if (tsize < 2)
+        throw std::invalid_argument("AttitudeSpline3D constructor:\n"
+                                    "\t't' and 'q' must be of size at least 2.");
+    if (tsize != qsize)
+        throw std::invalid_argument("AttitudeSpline3D constructor:\n"
+                                    "\t't' and 'q' must have same size.");
+        // Checking that 't' is in strictly increasing order.
+    for (vector::const_iterator it = t.begin() ; it != t.end() - 1 ; ++it)
+    {
+        if (*it >= *(it+1))
+            throw std::invalid_argument("AttitudeSpline3D constructor:\n"
+                                        "\t't' vector must be in strictly increasing order.");
+    }
+
+    // Getting min and max values of interpolator
+    m_tmin = t.front();
+    m_tmax = t.back();
+    double dt;
+    m_uniform = Maths::Arrays::is_regspaced(t, dt);
+    m_inv_dt = m_uniform ? 1.0 / dt : 0.0;
+    m_n = tsize - 1;
+
+    // Unit quaternions, made continuous (q and -q are the same rotation)
+    for (std::size_t i = 0 ; i < tsize ; ++i)
+    {
+        if (!(q[i].norm2() > 0.0))
+            throw std::invalid_argument("AttitudeSpline3D constructor:\n"
+                                        "\t'q' must not contain null quaternions.");
+        q[i].normalize();
+        if ((i > 0) && (q[i].dotProduct(q[i-1]) < 0.0))
+            q[i] = Quaternion(-q[i].getW(), -q[i].getX(), -q[i].getY(), -q[i].getZ());
+    }
+
+    // SQUAD intermediate quaternions
+    std::vector<Quaternion> s(q);
+    for (std::size_t i = 1 ; i < m_n ; ++i)
+    {
+        Quaternion qinv = q[i].conjugate();
+        Vector3D l = log_unit(qinv * q[i+1]) + log_unit(qinv * q[i-1]);
+        s[i] = q[i] * exp_pure(-0.25 * l);
+    }
+
+    // Intervals
+    m_seg.resize(m_n);
+    for (std::size_t i = 0 ; i < m_n ; ++i)
+    {
+        Segment &seg = m_seg[i];
+        seg.t = t[i];
+        seg.inv_dt = 1.0 / (t[i+1] - t[i]);
+        seg.q0 = q[i];
+        seg.q1 = q[i+1];
+        slerp_angle(seg.q0, seg.q1, seg.theta, seg.cos_theta, seg.inv_sin);
+        seg.s0 = s[i];
+        seg.s1 = s[i+1];
+        slerp_angle(seg.s0, seg.s1, seg.stheta, seg.scos_theta, seg.sinv_sin);
+    }
+}
+
+Quaternion AttitudeSpline3D::interpolate(const double &t, const std::size_t &index) const
+{
+    const Segment &seg = m_seg[index];
+    double h = (t - seg.t) * seg.inv_dt;
+    Quaternion q = slerp(seg.q0, seg.q1, seg.theta, seg.cos_theta, seg.inv_sin, h);
+    if (m_mode == AttitudeInterpolation::squad)
+    {
+        Quaternion p = slerp(seg.s0, seg.s1, seg.stheta, seg.scos_theta, seg.sinv_sin, h);
+        double w = 2.0 * h * (1.0 - h);
+        if (q.dotProduct(p) > nlerp_cos)
+        {
+            q = Quaternion(q.getW() + w * (p.getW() - q.getW()), q.getX() + w * (p.getX() - q.getX()),
+                           q.getY() + w * (p.getY() - q.getY()), q.getZ() + w * (p.getZ() - q.getZ()));
+            double n2 = q.norm2(); // Close to 1: first order renormalization
+            double f = 0.5 * (3.0 - n2);
+            q = Quaternion(f * q.getW(), f * q.getX(), f * q.getY(), f * q.getZ());
+        }
+        else
+        {
+            double theta, cos_theta, inv_sin;
+            slerp_angle(q, p, theta, cos_theta, inv_sin);
+            q = slerp(q, p, theta, cos_theta, inv_sin, w);
+        }
+    }
+    return q;
+}
+
+template <typename Output>
+void AttitudeSpline3D::evaluate_blocks(const double *t, std::size_t n, bool sorted, Output output) const
+{
+    if (m_n == 0)
+        throw std::invalid_argument("AttitudeSpline3D::evaluate\n"
+                                    "\tThe interpolator is not initialized.");
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        std::size_t index[detail::batch_size];
+        this->search_indices_for_interpolation(t + k0, index, nb, sorted);
+        for (std::size_t k = 0 ; k < nb ; ++k)
+            output(k0 + k, this->interpolate(t[k0 + k], index[k]));
+    });
+}
+
+void AttitudeSpline3D::search_indices_for_interpolation(const double *teval,
+                                                        std::size_t *index,
+                                                        std::size_t n, bool sorted) const
+{
+    if (n == 0)
+        return;
+    if (m_uniform)
+    {
+        double last = static_cast<double>(m_n - 1);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < n ; ++k)
+        {
+            double u = (teval[k] - m_tmin) * m_inv_dt;
+            u = (u >= 0.0) ? u : 0.0; // NaN included
+            index[k] = static_cast<std::size_t>((u <= last) ? u : last);
+        }
+        return;
+    }
+    if (!sorted)
+    {
+        for (std::size_t k = 0 ; k < n ; ++k)
+            index[k] = this->search_index_for_interpolation(teval[k]);
+        return;
+    }
+    // Monotone walk: a single binary search, then the index is only
+    // moved forward along the time axis.
+    std::size_t i = this->search_index_for_interpolation(teval[0]),
+                last = m_n - 1;
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        while ((i < last) && (teval[k] >= m_seg[i+1].t))
+            ++i;
+        index[k] = i;
+    }
+}
+
+} // namespace Osl::Geometry::Interpolator
+
+} // namespace Osl::Geometry
+
+} // namespace Osl
@@ -0,0 +1,276 @@
+/*! ********************************************************************
+ * \file AttitudeSpline3D.h
+ * \brief Header file of Osl::Geometry::Interpolator3D::AttitudeSpline3D
+ *        class.
+ *********************************************************************/
+
+#ifndef OSL_GEOMETRY_INTERPOLATOR3D_ATTITUDESPLINE3D_H
+#define OSL_GEOMETRY_INTERPOLATOR3D_ATTITUDESPLINE3D_H
+
+#include <algorithm>
+#include "Osl/Geometry/Quaternion.h"
+#include "Osl/Geometry/Rotation3D.h"
+#include "Osl/Maths/Arrays/is_regspaced.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geometry { // namespace Osl::Geometry
+
+namespace Interpolator3D { // namespace Osl::Geometry::Interpolator
+
+/*! ********************************************************************
+ * \enum AttitudeInterpolation
+ * \brief Enumeration for the interpolation scheme of the
+ *        AttitudeSpline3D class.
+ *********************************************************************/
+enum class AttitudeInterpolation
+{
+    /*! Spherical linear interpolation between consecutive attitudes
+     * (constant angular velocity on each interval).*/
+    slerp,
+    /*! Spherical quadrangle interpolation (smooth angular velocity at
+     * the nodes).*/
+    squad
+};
+
+/*! ********************************************************************
+ * \brief Class to construct an interpolator of attitudes (rotations)
+ *        known at given times.
+ *
+ * <h3>Principle</h3>
+ *
+ * Let a set of temporal points \f$(t_k)_{k\in[\vert0;N\vert]}\f$ in a
+ * strictly increasing order, with their corresponding unit quaternions
+ * \f$(q_k)_{k\in[\vert0;N\vert]}\f$. The quaternions are first made
+ * continuous (\f$q_k\cdot q_{k+1}\geq0\f$, \f$q\f$ and \f$-q\f$ being
+ * the same rotation), so that each interval is interpolated along the
+ * shortest path.
+ *
+ * For \f$t\in[t_k; t_{k+1}[\f$ and \f$h=(t-t_k)/(t_{k+1}-t_k)\f$, the
+ * SLERP interpolation is:
+ *
+ * \f[
+ *     \mbox{slerp}(q_k, q_{k+1}, h)=\dfrac{\sin((1-h)\theta_k)}{\sin\theta_k}q_k
+ *     +\dfrac{\sin(h\theta_k)}{\sin\theta_k}q_{k+1},\quad
+ *     \cos\theta_k=q_k\cdot q_{k+1}
+ * \f]
+ *
+ * and the SQUAD interpolation is:
+ *
+ * \f[
+ *     \mbox{squad}(h)=\mbox{slerp}(\mbox{slerp}(q_k, q_{k+1}, h),
+ *     \mbox{slerp}(s_k, s_{k+1}, h), 2h(1-h))
+ * \f]
+ *
+ * with the intermediate quaternions
+ *
+ * \f[
+ *     s_k=q_k\exp\left(-\dfrac{\log(q_k^{-1}q_{k+1})+\log(q_k^{-1}q_{k-1})}{4}\right),
+ *     \quad s_0=q_0,\ s_N=q_N
+ * \f]
+ *
+ * The angles \f$\theta_k\f$ (and the ones of the \f$s_k\f$) are computed
+ * at construction, so that a SLERP costs a sine and a cosine of the
+ * same argument (\f$\sin((1-h)\theta)\f$ being expanded). The outer
+ * SQUAD blend is between two nearby attitudes, and falls back to a
+ * normalized linear interpolation when they are close enough for it to
+ * be exact to rounding.
+ *
+ * <h3>Evaluation</h3>
+ *
+ * When the time axis is evenly spaced, the index of interpolation is
+ * computed in \f$O(1)\f$, else it is searched by dichotomy (or with a
+ * monotone walk for sorted batches). The batch versions of evaluate()
+ * share blocks of times among the OpenMP threads and fill arrays of
+ * Quaternion, of quaternion coefficients (SoA, see Quaternion::rotate())
+ * or of Rotation3D.
+ *
+ * \note The SQUAD intermediate quaternions assume an evenly spaced time
+ *       axis for the continuity of the angular velocity; the
+ *       interpolation still passes through the nodes otherwise.
+ *********************************************************************/
+class AttitudeSpline3D
+{
+public:
+    //! Default Constructor.
+    AttitudeSpline3D();
+
+    //! Copy constructor
+    AttitudeSpline3D(const AttitudeSpline3D &other);
+
+    /*!
+     * \param t, the set of time variables
+     * \param q, the set of attitudes corresponding to t (normalized at construction)
+     * \param mode, the interpolation scheme. Default to AttitudeInterpolation::squad.
+     */
+    AttitudeSpline3D(const vector &t, const std::vector<Quaternion> &q,
+                     enum AttitudeInterpolation mode=AttitudeInterpolation::squad);
+
+    /*!
+     * \param t, the set of time variables
+     * \param rot, the set of rotations corresponding to t
+     * \param mode, the interpolation scheme. Default to AttitudeInterpolation::squad.
+     */
+    AttitudeSpline3D(const vector &t, const std::vector<Rotation3D> &rot,
+                     enum AttitudeInterpolation mode=AttitudeInterpolation::squad);
+
+    //! Default Destructor
+    ~AttitudeSpline3D();
+
+    // ============== CLASS METHODS ==============
+    // *************** GETTER ***************
+    //! Get minimum t value.
+    double getTmin() const;
+
+    //! Get maximum t value.
+    double getTmax() const;
+
+    //! Get the defining t axis values.
+    vector getT() const;
+
+    //! Get the (continuous) quaternions of the nodes.
+    std::vector<Quaternion> getQuaternions() const;
+
+    //! Get the interpolation scheme.
+    enum AttitudeInterpolation getMode() const;
+
+    /*! ********************************************************************
+     * \brief Get whether the t axis is evenly spaced.
+     * \returns true if the t axis provided at construction is evenly
+     *          spaced, false otherwise. In that case the index of
+     *          interpolation is computed in \f$O(1)\f$ instead of being
+     *          searched.
+     *********************************************************************/
+    bool isUniform() const;
+
+    // *************** SETTER ***************
+    /*! ********************************************************************
+     * \brief Set the AttitudeSpline3D points from \f$t\f$ and \em q data.
+     * \note This setter method initializes a new AttitudeSpline3D through
+     *       its corresponding constructor.
+     *********************************************************************/
+    void setPoints(const vector &t, const std::vector<Quaternion> &q,
+                   enum AttitudeInterpolation mode=AttitudeInterpolation::squad);
+
+    // ============== OPERATORS ==============
+    //! Assignement from another AttitudeSpline3D
+    AttitudeSpline3D operator=(const AttitudeSpline3D &other);
+
+    /*! ********************************************************************
+     * \brief Evaluate the attitude at a given time.
+     * \param [in] t the time at which the attitude is evaluated.
+     * \param [out] q the interpolated unit quaternion.
+     * \throw std::invalid_argument if the interpolator is not initialized.
+     * \note This function call doesn't make bound checkings; a NaN time
+     *       is evaluated in the first interval.
+     *********************************************************************/
+    void operator()(const double &t, Quaternion &q) const;
+
+    /*! ********************************************************************
+     * \brief Evaluate the attitude at a given time in the interval of
+     *        given index (this avoids the search for index).
+     * \param [in] t the time at which the attitude is evaluated.
+     * \param [in] index the index of the interval.
+     * \param [out] q the interpolated unit quaternion.
+     * \note This function call doesn't make bound checkings.
+     *********************************************************************/
+    void operator()(const double &t, const std::size_t &index, Quaternion &q) const;
+
+    // =========== ATTITUDE SPLINE METHODS ===========
+    /*! ********************************************************************
+     * \brief Evaluate the attitude at a given time with bound checkings.
+     * \param [in] t the time at which the attitude is evaluated.
+     * \param [in] extrapolate whether to authorize extrapolation or not.
+     *             Default to false.
+     * \returns The interpolated unit quaternion.
+     *********************************************************************/
+    Quaternion quaternionAt(const double &t, bool extrapolate=false) const;
+
+    //! Same as quaternionAt(), returning the rotation matrix.
+    Rotation3D rotationAt(const double &t, bool extrapolate=false) const;
+
+    /*! ********************************************************************
+     * \brief Search the index for interpolation.
+     * \param [in] teval the time for which the index is searched.
+     * \returns The index \f$i\f$ of the interval such that
+     *          \f$t_{eval}\geq t[i]\f$, clamped to the first and last
+     *          intervals.
+     *********************************************************************/
+    std::size_t search_index_for_interpolation(const double &teval) const;
+
+    // =========== BATCH EVALUATION ===========
+    /*! ********************************************************************
+     * \brief Evaluate the attitudes at a set of times.
+     * \param [in] t a pointer to the \f$n\f$ times.
+     * \param [out] q a pointer to the \f$n\f$ interpolated quaternions.
+     * \param [in] n the number of times.
+     * \param [in] sorted whether \em t is in increasing order or not. If
+     *             true, indices are found with a monotone walk along the
+     *             time axis instead of one binary search per value.
+     *             Default to false.
+     * \note This function call doesn't make bound checkings.
+     *********************************************************************/
+    void evaluate(const double *t, Quaternion *q, std::size_t n, bool sorted=false) const;
+
+    /*! ********************************************************************
+     * \brief Evaluate the attitudes at a set of times, as quaternion
+     *        coefficients (SoA layout of Quaternion::rotate()).
+     * \param [in] t a pointer to the \f$n\f$ times.
+     * \param [out] qw, qx, qy, qz pointers to the \f$n\f$ coefficients.
+     * \param [in] n the number of times.
+     * \param [in] sorted whether \em t is in increasing order or not.
+     *             Default to false.
+     *********************************************************************/
+    void evaluate(const double *t, double *qw, double *qx, double *qy, double *qz,
+                  std::size_t n, bool sorted=false) const;
+
+    /*! ********************************************************************
+     * \brief Evaluate the attitudes at a set of times, as rotation matrices.
+     * \param [in] t a pointer to the \f$n\f$ times.
+     * \param [out] rot a pointer to the \f$n\f$ rotation matrices.
+     * \param [in] n the number of times.
+     * \param [in] sorted whether \em t is in increasing order or not.
+     *             Default to false.
+     *********************************************************************/
+    void evaluate(const double *t, Rotation3D *rot, std::size_t n, bool sorted=false) const;
+
+    //! Evaluate the attitudes at a set of times (\em q is resized to the size of \em t).
+    void evaluate(const vector &t, std::vector<Quaternion> &q, bool sorted=false) const;
+
+    //! Evaluate the rotations at a set of times (\em rot is resized to the size of \em t).
+    void evaluate(const vector &t, std::vector<Rotation3D> &rot, bool sorted=false) const;
+
+private:
+    struct Segment
+    {
+        double t, inv_dt;          // Start time and inverse length of the interval
+        Quaternion q0, q1;         // Attitudes at both ends
+        double theta, cos_theta,   // Angle between q0 and q1, its cosine
+               inv_sin;            // and 1/sin(theta) (0 if negligible)
+        Quaternion s0, s1;         // SQUAD intermediate quaternions
+        double stheta, scos_theta, // Same for s0 and s1
+               sinv_sin;
+    };
+    double m_tmin, m_tmax;         // Min and max value of interpolation
+    bool m_uniform = false;        // Whether t axis is evenly spaced
+    double m_inv_dt;               // Inverse spacing of evenly spaced t axis
+    enum AttitudeInterpolation m_mode = AttitudeInterpolation::squad;
+    std::vector<Segment> m_seg;    // Interpolation intervals
+    std::size_t m_n = 0;           // Number of intervals
+
+    // Private methods
+    void init(const vector &t, std::vector<Quaternion> q);
+    Quaternion interpolate(const double &t, const std::size_t &index) const;
+    template <typename Output>
+    void evaluate_blocks(const double *t, std::size_t n, bool sorted, Output output) const;
+    void search_indices_for_interpolation(const double *teval, std::size_t *index,
+                                          std::size_t n, bool sorted) const;
+};
+
+} // namespace Osl::Geometry::Interpolator3D
+
+} // namespace Osl::Geometry
+
+} // namespace Osl
+
+#endif // OSL_GEOMETRY_INTERPOLATOR3D_ATTITUDESPLINE3D_H
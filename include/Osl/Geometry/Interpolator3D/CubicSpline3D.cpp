@@ -38,28 +38,32 @@ CubicSpline3D::CubicSpline3D(const vector &t, vector3d pos, vector3d vel)
     m_tmin = t.front();
     m_tmax = t.back();
 
-    // Setting provided time axis
-    m_t = t;
+    // Setting provided time axis (only stored if not evenly spaced)
+    m_uniform = Maths::Arrays::is_regspaced(t, m_dt);
+    if (m_uniform)
+        m_inv_dt = 1.0 / m_dt;
+    else
+        m_t = t;
 
     // Setting size of x axis and coefficients vectors
     m_n = tsize - 1;
 
     // Initialization of coefficients vectors
         // x axis
-    m_ax.reserve(m_n);
-    m_bx.reserve(m_n);
-    m_cx.reserve(m_n);
-    m_dx.reserve(m_n);
+    m_ax.resize(m_n);
+    m_bx.resize(m_n);
+    m_cx.resize(m_n);
+    m_dx.resize(m_n);
         // y axis
-    m_ay.reserve(m_n);
-    m_by.reserve(m_n);
-    m_cy.reserve(m_n);
-    m_dy.reserve(m_n);
+    m_ay.resize(m_n);
+    m_by.resize(m_n);
+    m_cy.resize(m_n);
+    m_dy.resize(m_n);
         // z axis
-    m_az.reserve(m_n);
-    m_bz.reserve(m_n);
-    m_cz.reserve(m_n);
-    m_dz.reserve(m_n);
+    m_az.resize(m_n);
+    m_bz.resize(m_n);
+    m_cz.resize(m_n);
+    m_dz.resize(m_n);
 
     // Linear interpolator coefficients
     double inv_dt, inv_dt2, dxdt, dydt, dzdt;
@@ -109,6 +113,7 @@ CubicSpline3D::CubicSpline3D(const vector &t, vector3d pos, vector3d vel)
 CubicSpline3D::CubicSpline3D(const CubicSpline3D &other)
     : m_tmin(other.m_tmin), m_tmax(other.m_tmax),
       m_t(other.m_t),
+      m_uniform(other.m_uniform), m_dt(other.m_dt), m_inv_dt(other.m_inv_dt),
       m_ax(other.m_ax), m_bx(other.m_bx), m_cx(other.m_cx), m_dx(other.m_dx),
       m_ay(other.m_ay), m_by(other.m_by), m_cy(other.m_cy), m_dy(other.m_dy),
       m_az(other.m_az), m_bz(other.m_bz), m_cz(other.m_cz), m_dz(other.m_dz),
@@ -121,7 +126,16 @@ CubicSpline3D::~CubicSpline3D(){}
 // *************** GETTER ***************
 double CubicSpline3D::getTmin() const { return m_tmin; }
 double CubicSpline3D::getTmax() const { return m_tmax; }
-vector CubicSpline3D::getT() const { return m_t; }
+vector CubicSpline3D::getT() const
+{
+    if (!m_uniform)
+        return m_t;
+    vector t(m_n + 1);
+    for (std::size_t i = 0 ; i <= m_n ; ++i)
+        t[i] = this->t_node(i);
+    return t;
+}
+bool CubicSpline3D::isUniform() const { return m_uniform; }
 void CubicSpline3D::getCoeffsX(vector &a, vector &b, vector &c, vector &d)
 {
     a.resize(m_n);
@@ -178,6 +192,9 @@ CubicSpline3D CubicSpline3D::operator=(const CubicSpline3D &other)
     m_tmin = other.m_tmin;
     m_tmax = other.m_tmax;
     m_t = other.m_t;
+    m_uniform = other.m_uniform;
+    m_dt = other.m_dt;
+    m_inv_dt = other.m_inv_dt;
     m_ax = other.m_ax, m_bx = other.m_bx, m_cx = other.m_cx, m_dx = other.m_dx;
     m_ay = other.m_ay, m_by = other.m_by, m_cy = other.m_cy, m_dy = other.m_dy;
     m_az = other.m_az, m_bz = other.m_bz, m_cz = other.m_cz, m_dz = other.m_dz;
@@ -188,24 +205,9 @@ CubicSpline3D CubicSpline3D::operator=(const CubicSpline3D &other)
 void CubicSpline3D::operator()(const double &t, Vector3D &pos)
 {
     // Search index of coefficients for interpolation
-    std::size_t index;
-    if (t >= m_tmax)
-    {
-        index = m_n - 1;
-    }
-    else if (t <= m_tmin)
-    {
-        index = 0;
-    }
-    else
-    {
-        // Search index of coefficients for interpolation
-        index = m_t.rend() -
-                std::find_if(m_t.rbegin(), m_t.rend(),
-                             [&t](double tt){return tt <= t;}) - 1;
-    }
+    std::size_t index = this->search_index_for_interpolation(t);
     // Compute the interpolated values
-    double dt = t - m_t[index],
+    double dt = t - this->t_node(index),
            dt2 = dt * dt,
            dt3 = dt2 * dt;
     pos.setCoordinates(m_ax[index] * dt3 + m_bx[index] * dt2 + m_cx[index] * dt + m_dx[index],
@@ -216,24 +218,9 @@ void CubicSpline3D::operator()(const double &t, Vector3D &pos)
 void CubicSpline3D::operator()(const double &t, Vector3D &pos, Vector3D &vel)
 {
     // Search index of coefficients for interpolation
-    std::size_t index;
-    if (t >= m_tmax)
-    {
-        index = m_n - 1;
-    }
-    else if (t <= m_tmin)
-    {
-        index = 0;
-    }
-    else
-    {
-        // Search index of coefficients for interpolation
-        index = m_t.rend() -
-                std::find_if(m_t.rbegin(), m_t.rend(),
-                             [&t](double tt){return tt <= t;}) - 1;
-    }
+    std::size_t index = this->search_index_for_interpolation(t);
     // Compute the interpolated values
-    double dt = t - m_t[index],
+    double dt = t - this->t_node(index),
            dt2 = dt * dt,
            dt3 = dt2 * dt;
     double ax = m_ax[index], bx = m_bx[index], cx = m_cx[index], dx = m_dx[index],
@@ -250,24 +237,9 @@ void CubicSpline3D::operator()(const double &t, Vector3D &pos, Vector3D &vel)
 void CubicSpline3D::operator()(const double &t, Vector3D &pos, Vector3D &vel, Vector3D &acc)
 {
     // Search index of coefficients for interpolation
-    std::size_t index;
-    if (t >= m_tmax)
-    {
-        index = m_n - 1;
-    }
-    else if (t <= m_tmin)
-    {
-        index = 0;
-    }
-    else
-    {
-        // Search index of coefficients for interpolation
-        index = m_t.rend() -
-                std::find_if(m_t.rbegin(), m_t.rend(),
-                             [&t](double tt){return tt <= t;}) - 1;
-    }
+    std::size_t index = this->search_index_for_interpolation(t);
     // Compute the interpolated values
-    double dt = t - m_t[index],
+    double dt = t - this->t_node(index),
            dt2 = dt * dt,
            dt3 = dt2 * dt;
     double ax = m_ax[index], bx = m_bx[index], cx = m_cx[index], dx = m_dx[index],
@@ -288,7 +260,7 @@ void CubicSpline3D::operator()(const double &t, const std::size_t &index,
                                Vector3D &pos)
 {
     // Compute the interpolated values
-    double dt = t - m_t[index],
+    double dt = t - this->t_node(index),
            dt2 = dt * dt,
            dt3 = dt2 * dt;
     pos.setCoordinates(m_ax[index] * dt3 + m_bx[index] * dt2 + m_cx[index] * dt + m_dx[index],
@@ -300,7 +272,7 @@ void CubicSpline3D::operator()(const double &t, const std::size_t &index,
                                Vector3D &pos, Vector3D &vel)
 {
     // Compute the interpolated values
-    double dt = t - m_t[index],
+    double dt = t - this->t_node(index),
            dt2 = dt * dt,
            dt3 = dt2 * dt;
     double ax = m_ax[index], bx = m_bx[index], cx = m_cx[index], dx = m_dx[index],
@@ -318,7 +290,7 @@ void CubicSpline3D::operator()(const double &t, const std::size_t &index,
                                Vector3D &pos, Vector3D &vel, Vector3D &acc)
 {
     // Compute the interpolated values
-    double dt = t - m_t[index],
+    double dt = t - this->t_node(index),
            dt2 = dt * dt,
            dt3 = dt2 * dt;
     double ax = m_ax[index], bx = m_bx[index], cx = m_cx[index], dx = m_dx[index],
@@ -345,24 +317,9 @@ Vector3D CubicSpline3D::positionAt(const double &t, bool extrapolate)
                                     "extrapolation, provide argument 'extrapolate'"
                                     "to 'true'.");
     // Search index of coefficients for interpolation
-    std::size_t index;
-    if (t >= m_tmax)
-    {
-        index = m_n - 1;
-    }
-    else if (t <= m_tmin)
-    {
-        index = 0;
-    }
-    else
-    {
-        // Search index of coefficients for interpolation
-        index = m_t.rend() -
-                std::find_if(m_t.rbegin(), m_t.rend(),
-                             [&t](double tt){return tt <= t;}) - 1;
-    }
+    std::size_t index = this->search_index_for_interpolation(t);
     // Compute the interpolated values
-    double dt = t - m_t[index],
+    double dt = t - this->t_node(index),
            dt2 = dt * dt,
            dt3 = dt2 * dt;
     return Vector3D(m_ax[index] * dt3 + m_bx[index] * dt2 + m_cx[index] * dt + m_dx[index],
@@ -379,24 +336,9 @@ Vector3D CubicSpline3D::velocityAt(const double &t, bool extrapolate)
                                     "extrapolation, provide argument 'extrapolate'"
                                     "to 'true'.");
     // Search index of coefficients for interpolation
-    std::size_t index;
-    if (t >= m_tmax)
-    {
-        index = m_n - 1;
-    }
-    else if (t <= m_tmin)
-    {
-        index = 0;
-    }
-    else
-    {
-        // Search index of coefficients for interpolation
-        index = m_t.rend() -
-                std::find_if(m_t.rbegin(), m_t.rend(),
-                             [&t](double tt){return tt <= t;}) - 1;
-    }
+    std::size_t index = this->search_index_for_interpolation(t);
     // Compute the interpolated values
-    double dt = t - m_t[index],
+    double dt = t - this->t_node(index),
            dt2 = dt * dt;
     return Vector3D(3.0 * m_ax[index] * dt2 + 2.0 * m_bx[index] * dt + m_cx[index],
                     3.0 * m_ay[index] * dt2 + 2.0 * m_by[index] * dt + m_cy[index],
@@ -412,29 +354,35 @@ Vector3D CubicSpline3D::accelerationAt(const double &t, bool extrapolate)
                                     "extrapolation, provide argument 'extrapolate'"
                                     "to 'true'.");
     // Search index of coefficients for interpolation
-    std::size_t index;
-    if (t >= m_tmax)
-    {
-        index = m_n - 1;
-    }
-    else if (t <= m_tmin)
-    {
-        index = 0;
-    }
-    else
-    {
-        // Search index of coefficients for interpolation
-        index = m_t.rend() -
-                std::find_if(m_t.rbegin(), m_t.rend(),
-                             [&t](double tt){return tt <= t;}) - 1;
-    }
+    std::size_t index = this->search_index_for_interpolation(t);
     // Compute the interpolated values
-    double dt = t - m_t[index];
+    double dt = t - this->t_node(index);
     return Vector3D(6.0 * m_ax[index] * dt + 2.0 * m_bx[index],
                     6.0 * m_ay[index] * dt + 2.0 * m_by[index],
                     6.0 * m_az[index] * dt + 2.0 * m_bz[index]);
 }
 
+std::size_t CubicSpline3D::search_index_for_interpolation(const double &teval)
+{
+    if (teval >= m_tmax)
+        return m_n - 1;
+    if (!(teval > m_tmin)) // NaN included
+        return 0;
+    if (m_uniform)
+        return static_cast<std::size_t>(std::min((teval - m_tmin) * m_inv_dt,
+                                                 static_cast<double>(m_n - 1)));
+    std::size_t left=0, right=m_n, mid;
+    while (right - left > 1)
+    {
+        mid = (left + right) / 2;
+        if (teval >= m_t[mid])
+            left = mid;
+        else
+            right = mid;
+    }
+    return left; // We want the value <= t0
+}
+
 } // namespace Osl::Geometry::Interpolator3D
 
 } // namespace Osl::Geometry
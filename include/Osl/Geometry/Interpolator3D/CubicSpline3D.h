@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include "Osl/Geometry/Vector3D.h"
+#include "Osl/Maths/Arrays/is_regspaced.h"
 
 namespace Osl { // namespace Osl
 
@@ -153,6 +154,15 @@ public:
      *********************************************************************/
     vector getT() const;
 
+    /*! ********************************************************************
+     * \brief Get whether the t axis is evenly spaced.
+     * \returns true if the t axis provided at construction is evenly
+     *          spaced, false otherwise. In that case the t axis is not
+     *          stored and the index of interpolation is computed in
+     *          \f$O(1)\f$ instead of being searched.
+     *********************************************************************/
+    bool isUniform() const;
+
     /*! ********************************************************************
      * \brief Get the interpolator coefficients for x coordinates.
      * \param [out] a A vector containing the \f$a_k\f$ coefficients of the
@@ -327,13 +337,41 @@ public:
      *********************************************************************/
     Vector3D accelerationAt(const double &t, bool extrapolate=false);
 
+    /*! ********************************************************************
+     * \brief Search the index for spline interpolation.
+     *
+     * This function makes use of binary search (or of a direct computation
+     * for an evenly spaced axis) to find the first index \f$i\f$ of
+     * reference axis \f$t[i]\f$ (in strictly increasing order) such that,
+     * for the search value \f$t_{eval}\f$:
+     *
+     * \f[
+     *     t_{eval} \geq t[i]
+     * \f]
+     *
+     * \param [in] teval the value for which the index is searched.
+     * \returns The index to evaluate the spline function at teval.
+     * \note 1. If \f$t_{eval}\geq\underset{i}{\max}(t[i])\f$, last index minus 1
+     *          is returned.
+     * \note 2. If \f$t_{eval}\leq\underset{i}{\min}(t[i])\f$, index 0 is returned.
+     *********************************************************************/
+    std::size_t search_index_for_interpolation(const double &teval);
+
 private:
     double m_tmin, m_tmax;         // Min and max value of interpolation
-    vector m_t;                    // Provided axis for interpolation
+    vector m_t;                    // Provided axis for interpolation (empty if evenly spaced)
+    bool m_uniform = false;        // Whether t axis is evenly spaced
+    double m_dt, m_inv_dt;         // Spacing of evenly spaced t axis and its inverse
     vector m_ax, m_bx, m_cx, m_dx, // Interpolation coefficients of x axis
            m_ay, m_by, m_cy, m_dy, // y axis
            m_az, m_bz, m_cz, m_dz; // z axis
     std::size_t m_n;               // Size of coefficients container
+
+    // Get the t axis value at index
+    double t_node(const std::size_t &index) const
+    {
+        return m_uniform ? m_tmin + static_cast<double>(index) * m_dt : m_t[index];
+    }
 };
 
 } // namespace Osl::Geometry::Interpolator3D
@@ -11,5 +11,6 @@
 
 #include "LinearSpline3D.h"
 #include "CubicSpline3D.h"
+#include "AttitudeSpline3D.h"
 
 #endif // OSL_GEOMETRY_INTERPOLATOR3D_H
@@ -39,22 +39,26 @@ LinearSpline3D::LinearSpline3D(const vector &t, vector3d vec)
     m_tmin = t.front();
     m_tmax = t.back();
 
-    // Setting provided time axis
-    m_t = t;
+    // Setting provided time axis (only stored if not evenly spaced)
+    m_uniform = Maths::Arrays::is_regspaced(t, m_dt);
+    if (m_uniform)
+        m_inv_dt = 1.0 / m_dt;
+    else
+        m_t = t;
 
     // Setting size of x axis and coefficients vectors
     m_n = tsize - 1;
 
     // Initialization of coefficients vectors
         // x axis
-    m_ax.reserve(m_n);
-    m_bx.reserve(m_n);
+    m_ax.resize(m_n);
+    m_bx.resize(m_n);
         // y axis
-    m_ay.reserve(m_n);
-    m_by.reserve(m_n);
+    m_ay.resize(m_n);
+    m_by.resize(m_n);
         // z axis
-    m_az.reserve(m_n);
-    m_bz.reserve(m_n);
+    m_az.resize(m_n);
+    m_bz.resize(m_n);
 
     // Linear interpolator coefficients
     double inv_dt;
@@ -87,6 +91,7 @@ LinearSpline3D::LinearSpline3D(const vector &t, vector3d vec)
 LinearSpline3D::LinearSpline3D(const LinearSpline3D &other)
     : m_tmin(other.m_tmin), m_tmax(other.m_tmax),
       m_t(other.m_t),
+      m_uniform(other.m_uniform), m_dt(other.m_dt), m_inv_dt(other.m_inv_dt),
       m_ax(other.m_ax), m_bx(other.m_bx),
       m_ay(other.m_ay), m_by(other.m_by),
       m_az(other.m_az), m_bz(other.m_bz),
@@ -99,7 +104,16 @@ LinearSpline3D::~LinearSpline3D(){}
 // *************** GETTER ***************
 double LinearSpline3D::getTmin() const { return m_tmin; }
 double LinearSpline3D::getTmax() const { return m_tmax; }
-vector LinearSpline3D::getT() const { return m_t; }
+vector LinearSpline3D::getT() const
+{
+    if (!m_uniform)
+        return m_t;
+    vector t(m_n + 1);
+    for (std::size_t i = 0 ; i <= m_n ; ++i)
+        t[i] = this->t_node(i);
+    return t;
+}
+bool LinearSpline3D::isUniform() const { return m_uniform; }
 void LinearSpline3D::getCoeffsX(vector &a, vector &b)
 {
     a.resize(m_n);
@@ -144,6 +158,9 @@ LinearSpline3D LinearSpline3D::operator=(const LinearSpline3D &other)
     m_tmin = other.m_tmin;
     m_tmax = other.m_tmax;
     m_t = other.m_t;
+    m_uniform = other.m_uniform;
+    m_dt = other.m_dt;
+    m_inv_dt = other.m_inv_dt;
     m_ax = other.m_ax, m_bx = other.m_bx;
     m_ay = other.m_ay, m_by = other.m_by;
     m_az = other.m_az, m_bz = other.m_bz;
@@ -154,24 +171,9 @@ LinearSpline3D LinearSpline3D::operator=(const LinearSpline3D &other)
 void LinearSpline3D::operator()(const double &t, Vector3D &vec)
 {
     // Search index of coefficients for interpolation
-    std::size_t index;
-    if (t >= m_tmax)
-    {
-        index = m_n - 1;
-    }
-    else if (t <= m_tmin)
-    {
-        index = 0;
-    }
-    else
-    {
-        // Search index of coefficients for interpolation
-        index = m_t.rend() -
-                std::find_if(m_t.rbegin(), m_t.rend(),
-                             [&t](double tt){return tt <= t;}) - 1;
-    }
+    std::size_t index = this->search_index_for_interpolation(t);
     // Compute the interpolated values
-    double dt = t - m_t[index];
+    double dt = t - this->t_node(index);
     vec.setCoordinates(m_ax[index] * dt + m_bx[index],
                        m_ay[index] * dt + m_by[index],
                        m_az[index] * dt + m_bz[index]);
@@ -181,7 +183,7 @@ void LinearSpline3D::operator()(const double &t, const std::size_t &index,
                                 Vector3D &vec)
 {
     // Compute the interpolated values
-    double dt = t - m_t[index];
+    double dt = t - this->t_node(index);
     vec.setCoordinates(m_ax[index] * dt + m_bx[index],
                        m_ay[index] * dt + m_by[index],
                        m_az[index] * dt + m_bz[index]);
@@ -197,29 +199,35 @@ Vector3D LinearSpline3D::vectorAt(const double &t, bool extrapolate)
                                     "extrapolation, provide argument 'extrapolate'"
                                     "to 'true'.");
     // Search index of coefficients for interpolation
-    std::size_t index;
-    if (t >= m_tmax)
-    {
-        index = m_n - 1;
-    }
-    else if (t <= m_tmin)
-    {
-        index = 0;
-    }
-    else
-    {
-        // Search index of coefficients for interpolation
-        index = m_t.rend() -
-                std::find_if(m_t.rbegin(), m_t.rend(),
-                             [&t](double tt){return tt <= t;}) - 1;
-    }
+    std::size_t index = this->search_index_for_interpolation(t);
     // Compute the interpolated values
-    double dt = t - m_t[index];
+    double dt = t - this->t_node(index);
     return Vector3D(m_ax[index] * dt + m_bx[index],
                     m_ay[index] * dt + m_by[index],
                     m_az[index] * dt + m_bz[index]);
 }
 
+std::size_t LinearSpline3D::search_index_for_interpolation(const double &teval)
+{
+    if (teval >= m_tmax)
+        return m_n - 1;
+    if (!(teval > m_tmin)) // NaN included
+        return 0;
+    if (m_uniform)
+        return static_cast<std::size_t>(std::min((teval - m_tmin) * m_inv_dt,
+                                                 static_cast<double>(m_n - 1)));
+    std::size_t left=0, right=m_n, mid;
+    while (right - left > 1)
+    {
+        mid = (left + right) / 2;
+        if (teval >= m_t[mid])
+            left = mid;
+        else
+            right = mid;
+    }
+    return left; // We want the value <= t0
+}
+
 } // namespace Osl::Geometry::Interpolator
 
 } // namespace Osl::Geometry
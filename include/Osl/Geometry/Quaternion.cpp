@@ -0,0 +1,282 @@
+#include "Quaternion.h"
+#include "Osl/Batch.h"
+
+namespace Osl { // namespace Osl
+
+namespace Geometry { // namespace Osl::Geometry
+
+// ============== CONSTRUCTOR ==============
+    // Initialization of elementary rotations
+Quaternion::Quaternion(const char &axis, const double &angle, bool degrees)
+{
+    double half = 0.5 * (degrees ? angle * Constants::m_degtorad : angle);
+    double c = std::cos(half),  // Cosine of the half rotation angle
+           s = std::sin(half);  // Sine of the half rotation angle
+    switch (axis)
+    {
+    case 'x':
+        m_w = c, m_x = s, m_y = 0.0, m_z = 0.0;
+        break;
+    case 'y':
+        m_w = c, m_x = 0.0, m_y = s, m_z = 0.0;
+        break;
+    case 'z':
+        m_w = c, m_x = 0.0, m_y = 0.0, m_z = s;
+        break;
+    default:
+        throw std::invalid_argument("Osl::Geometry::Quaternion.Quaternion(): "
+                                    "axis must be a char between 'x', 'y' or 'z'.");
+    }
+}
+
+    // Initialization from given axis and angle
+Quaternion::Quaternion(const Vector3D &axis, const double &angle, bool degrees)
+{
+    double half = 0.5 * (degrees ? angle * Constants::m_degtorad : angle);
+    double s = std::sin(half);  // Sine of the half rotation angle
+    Vector3D n_axis = axis.normalized(); // Normalized axis
+    m_w = std::cos(half);
+    m_x = s * n_axis.getX();
+    m_y = s * n_axis.getY();
+    m_z = s * n_axis.getZ();
+}
+
+Quaternion::Quaternion(const std::string &convention,
+                       const double &a1, const double &a2, const double &a3, bool degrees)
+{
+    // Same conventions as Rotation3D: R = R(c[0],a1) * R(c[1],a2) * R(c[2],a3)
+    if ((convention.size() == 3) &&
+        (convention[0] != convention[1]) && (convention[1] != convention[2]) &&
+        (convention.find_first_not_of("xyz") == std::string::npos))
+    {
+        Quaternion q1(convention[0], a1, degrees);
+        Quaternion q2(convention[1], a2, degrees);
+        Quaternion q3(convention[2], a3, degrees);
+        *this = q1 * q2 * q3;
+    }
+    else
+        throw std::invalid_argument("Osl::Geometry::Quaternion.Quaternion(): "
+                                    "'convention' is not a recognized convention.");
+}
+
+    // Initialization from a rotation matrix (Shepperd's method)
+Quaternion::Quaternion(const Rotation3D &rot)
+{
+    const double *m = rot.data(); // Row-major coefficients
+    const double m00 = m[0], m01 = m[1], m02 = m[2],
+                 m10 = m[3], m11 = m[4], m12 = m[5],
+                 m20 = m[6], m21 = m[7], m22 = m[8];
+    const double tr = m00 + m11 + m22;
+    // The largest of the 4 coefficients is computed first to avoid cancellations
+    if (tr >= m00 && tr >= m11 && tr >= m22)
+    {
+        double s = 2.0 * std::sqrt(1.0 + tr); // s = 4w
+        m_w = 0.25 * s;
+        m_x = (m21 - m12) / s;
+        m_y = (m02 - m20) / s;
+        m_z = (m10 - m01) / s;
+    }
+    else if (m00 >= m11 && m00 >= m22)
+    {
+        double s = 2.0 * std::sqrt(1.0 + m00 - m11 - m22); // s = 4x
+        m_w = (m21 - m12) / s;
+        m_x = 0.25 * s;
+        m_y = (m01 + m10) / s;
+        m_z = (m02 + m20) / s;
+    }
+    else if (m11 >= m22)
+    {
+        double s = 2.0 * std::sqrt(1.0 + m11 - m00 - m22); // s = 4y
+        m_w = (m02 - m20) / s;
+        m_x = (m01 + m10) / s;
+        m_y = 0.25 * s;
+        m_z = (m12 + m21) / s;
+    }
+    else
+    {
+        double s = 2.0 * std::sqrt(1.0 + m22 - m00 - m11); // s = 4z
+        m_w = (m10 - m01) / s;
+        m_x = (m02 + m20) / s;
+        m_y = (m12 + m21) / s;
+        m_z = 0.25 * s;
+    }
+    if (m_w < 0.0) // Canonical quaternion (w >= 0)
+    {
+        m_w = -m_w, m_x = -m_x, m_y = -m_y, m_z = -m_z;
+    }
+    this->normalize();
+}
+
+// ============== OPERATORS ==============
+// Comparison operators
+bool Quaternion::operator==(const Quaternion &other) const
+{
+    return Maths::Comparison::almost_equal(m_w, other.m_w) &&
+           Maths::Comparison::almost_equal(m_x, other.m_x) &&
+           Maths::Comparison::almost_equal(m_y, other.m_y) &&
+           Maths::Comparison::almost_equal(m_z, other.m_z);
+}
+
+bool Quaternion::operator!=(const Quaternion &other) const
+{
+    return !(*this == other);
+}
+
+// ============== QUATERNION FUNCTIONS ==============
+void Quaternion::normalize()
+{
+    double norm = this->norm();
+    if (norm > 0.0 && !Maths::Comparison::almost_one(norm))
+    {
+        m_w /= norm;
+        m_x /= norm;
+        m_y /= norm;
+        m_z /= norm;
+    }
+}
+
+Quaternion Quaternion::normalized() const
+{
+    Quaternion q = *this;
+    q.normalize();
+    return q;
+}
+
+bool Quaternion::rotationEquals(const Quaternion &other) const
+{
+    return (*this == other) ||
+           (*this == Quaternion(-other.m_w, -other.m_x, -other.m_y, -other.m_z));
+}
+
+bool Quaternion::isIdentity() const
+{
+    return this->rotationEquals(Quaternion());
+}
+
+// ============== ROTATION FUNCTIONS ==============
+Rotation3D Quaternion::toRotation3D() const
+{
+    const double s = 2.0 / this->norm2(); // Also valid for non unit quaternions
+    const double xs = m_x * s, ys = m_y * s, zs = m_z * s;
+    const double wx = m_w * xs, wy = m_w * ys, wz = m_w * zs,
+                 xx = m_x * xs, xy = m_x * ys, xz = m_x * zs,
+                 yy = m_y * ys, yz = m_y * zs, zz = m_z * zs;
+    return Rotation3D(1.0 - (yy + zz), xy - wz, xz + wy,
+                      xy + wz, 1.0 - (xx + zz), yz - wx,
+                      xz - wy, yz + wx, 1.0 - (xx + yy));
+}
+
+Vector3D Quaternion::rotationVector(bool degrees) const
+{
+    double sn = std::sqrt(m_x * m_x + m_y * m_y + m_z * m_z); // sin(angle / 2)
+    if (sn == 0.0)
+        return Vector3D();
+    // Rotation angle in [0, pi]
+    double angle = 2.0 * std::atan2(sn, std::abs(m_w)),
+           f = (m_w < 0.0 ? -angle : angle) / sn;
+    if (degrees)
+        f *= Constants::m_radtodeg;
+    return Vector3D(f * m_x, f * m_y, f * m_z);
+}
+
+double Quaternion::angle(bool degrees) const
+{
+    double sn = std::sqrt(m_x * m_x + m_y * m_y + m_z * m_z),
+           angle = 2.0 * std::atan2(sn, std::abs(m_w));
+    return degrees ? angle * Constants::m_radtodeg : angle;
+}
+
+void Quaternion::eulerAngles(const std::string &convention,
+                             double &a1, double &a2, double &a3, bool degrees) const
+{
+    this->toRotation3D().eulerAngles(convention, a1, a2, a3, degrees);
+}
+
+    // Batch rotations
+void Quaternion::rotate(const double *x, const double *y, const double *z, std::size_t n,
+                        double *rx, double *ry, double *rz) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        rotate_block(&m_w, &m_x, &m_y, &m_z, 0,
+                     x + k0, y + k0, z + k0, nb,
+                     rx + k0, ry + k0, rz + k0);
+    });
+}
+
+void Quaternion::rotate(const vector3d &vecs, vector3d &rvecs) const
+{
+    std::size_t n = vecs.size();
+    if (rvecs.size() != n)
+        rvecs.resize(n);
+    #pragma omp parallel for schedule(static)
+    for (std::size_t k = 0 ; k < n ; ++k)
+        rvecs[k] = (*this) * vecs[k];
+}
+
+void Quaternion::rotate(const double *qw, const double *qx, const double *qy, const double *qz,
+                        const double *x, const double *y, const double *z, std::size_t n,
+                        double *rx, double *ry, double *rz)
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        rotate_block(qw + k0, qx + k0, qy + k0, qz + k0, 1,
+                     x + k0, y + k0, z + k0, nb,
+                     rx + k0, ry + k0, rz + k0);
+    });
+}
+
+void Quaternion::rotate(const std::vector<Quaternion> &quats, const vector3d &vecs, vector3d &rvecs)
+{
+    std::size_t n = vecs.size();
+    if (quats.size() != n)
+        throw std::invalid_argument("Osl::Geometry::Quaternion.rotate(): "
+                                    "'quats' and 'vecs' must have the same size.");
+    if (rvecs.size() != n)
+        rvecs.resize(n);
+    #pragma omp parallel for schedule(static)
+    for (std::size_t k = 0 ; k < n ; ++k)
+        rvecs[k] = quats[k] * vecs[k];
+}
+
+// ============== PRIVATE CLASS METHODS ==============
+void Quaternion::rotate_block(const double *qw, const double *qx, const double *qy, const double *qz,
+                              std::size_t qstride,
+                              const double *x, const double *y, const double *z, std::size_t n,
+                              double *rx, double *ry, double *rz)
+{
+    if (qstride == 0) // Same quaternion for all vectors
+    {
+        const double w = *qw, ux = *qx, uy = *qy, uz = *qz;
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < n ; ++k)
+        {
+            const double vx = x[k], vy = y[k], vz = z[k];
+            const double tx = 2.0 * (uy * vz - uz * vy),
+                         ty = 2.0 * (uz * vx - ux * vz),
+                         tz = 2.0 * (ux * vy - uy * vx);
+            rx[k] = vx + w * tx + (uy * tz - uz * ty);
+            ry[k] = vy + w * ty + (uz * tx - ux * tz);
+            rz[k] = vz + w * tz + (ux * ty - uy * tx);
+        }
+    }
+    else // One quaternion per vector
+    {
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < n ; ++k)
+        {
+            const double w = qw[k], ux = qx[k], uy = qy[k], uz = qz[k],
+                         vx = x[k], vy = y[k], vz = z[k];
+            const double tx = 2.0 * (uy * vz - uz * vy),
+                         ty = 2.0 * (uz * vx - ux * vz),
+                         tz = 2.0 * (ux * vy - uy * vx);
+            rx[k] = vx + w * tx + (uy * tz - uz * ty);
+            ry[k] = vy + w * ty + (uz * tx - ux * tz);
+            rz[k] = vz + w * tz + (ux * ty - uy * tx);
+        }
+    }
+}
+
+} // namespace Osl::Geometry
+
+} // namespace Osl
@@ -1,17 +1,54 @@
 #include "Rotation3D.h"
+#include "Osl/Batch.h"
 
 namespace Osl { // namespace Osl
 
 namespace Geometry { // namespace Osl::Geometry
 
-static const std::unordered_set<std::string> EULER_CONVENTION = {
-    "xyz", "xzy", "yxz", "yzx", "zxy", "zyx", // Tait-Bryan angles (Euler improper)
-    "xyx", "xzx", "yxy", "yzy", "zxz", "zyz"  // Euler angles
-};
+namespace { // Local functions
 
-// ============== CONSTRUCTOR ==============
-Rotation3D::Rotation3D(){}
+// Convention of a string ("xyz", ..., "zyx" for Tait-Bryan angles, "xyx",
+// ..., "zyz" for Euler angles), returns false if it is not recognized.
+// The index in EulerConvention is read from the characters, without lookup.
+bool euler_convention(const std::string &name, EulerConvention &convention)
+{
+    if (name.size() != 3)
+        return false;
+    int i = name[0] - 'x', j = name[1] - 'x', k = name[2] - 'x';
+    if ((i < 0) || (i > 2) || (j < 0) || (j > 2) || (k < 0) || (k > 2) ||
+        (i == j) || (j == k))
+        return false;
+    int index = 2 * i + (j > 3 - i - j ? 1 : 0) + (k == i ? 6 : 0);
+    convention = static_cast<EulerConvention>(index);
+    return true;
+}
+
+// Calls f with the convention as a compile-time constant
+// (std::integral_constant<EulerConvention, ...>)
+template <typename Function>
+void euler_dispatch(EulerConvention convention, Function &&f)
+{
+    using C = EulerConvention;
+    switch (convention)
+    {
+    case C::xyz: f(std::integral_constant<C, C::xyz>()); break;
+    case C::xzy: f(std::integral_constant<C, C::xzy>()); break;
+    case C::yxz: f(std::integral_constant<C, C::yxz>()); break;
+    case C::yzx: f(std::integral_constant<C, C::yzx>()); break;
+    case C::zxy: f(std::integral_constant<C, C::zxy>()); break;
+    case C::zyx: f(std::integral_constant<C, C::zyx>()); break;
+    case C::xyx: f(std::integral_constant<C, C::xyx>()); break;
+    case C::xzx: f(std::integral_constant<C, C::xzx>()); break;
+    case C::yxy: f(std::integral_constant<C, C::yxy>()); break;
+    case C::yzy: f(std::integral_constant<C, C::yzy>()); break;
+    case C::zxz: f(std::integral_constant<C, C::zxz>()); break;
+    case C::zyz: f(std::integral_constant<C, C::zyz>()); break;
+    }
+}
 
+} // Local functions
+
+// ============== CONSTRUCTOR ==============
     // Initialization of elementary rotations
 Rotation3D::Rotation3D(const char &axis, const double &angle, bool degrees)
 {
@@ -101,17 +138,20 @@ Rotation3D::Rotation3D(const Vector3D &axis, const double &angle, bool degrees)
 Rotation3D::Rotation3D(const std::string &convention,
                        const double &a1, const double &a2, const double &a3, bool degrees)
 {
-    //if (EULER_CONVENTION.contains(convention)) // C++20
-    if (EULER_CONVENTION.find(convention) != EULER_CONVENTION.end())
-    {
-        Rotation3D r1(convention[0], a1, degrees);
-        Rotation3D r2(convention[1], a2, degrees);
-        Rotation3D r3(convention[2], a3, degrees);
-        m_matrix = (r1 * r2 * r3).m_matrix;
-    }
-    else
+    EulerConvention c;
+    if (!euler_convention(convention, c))
         throw std::invalid_argument("Osl::Geometry::Rotation3D.setRotation(): "
                                     "'convention' is not a recognized convention.");
+    *this = Rotation3D(c, a1, a2, a3, degrees);
+}
+
+Rotation3D::Rotation3D(enum EulerConvention convention,
+                       const double &a1, const double &a2, const double &a3, bool degrees)
+{
+    euler_dispatch(convention, [&](auto c)
+    {
+        *this = fromEuler<decltype(c)::value>(a1, a2, a3, degrees);
+    });
 }
 
     // Initialization from two couple of vectors
@@ -146,26 +186,9 @@ Rotation3D::Rotation3D(const Vector3D &u1, const Vector3D &v1,
                    u2ny, v2ny, w2ny,
                    u2nz, v2nz, w2nz);
     // Rotation matrix from referential 1 to referential 2: R12 = R02 * R01T
-    m_matrix = (R02 * R01T).m_matrix;
+    *this = R02 * R01T;
 }
 
-    // Initialization from matrix coefficients
-Rotation3D::Rotation3D(const double &m00, const double &m01, const double &m02,
-                       const double &m10, const double &m11, const double &m12,
-                       const double &m20, const double &m21, const double &m22)
-{
-    m_matrix[0][0] = m00, m_matrix[0][1] = m01, m_matrix[0][2] = m02;
-    m_matrix[1][0] = m10, m_matrix[1][1] = m11, m_matrix[1][2] = m12;
-    m_matrix[2][0] = m20, m_matrix[2][1] = m21, m_matrix[2][2] = m22;
-}
-
-// Copy constructor
-Rotation3D::Rotation3D(const Rotation3D &other)
-    : m_matrix(other.m_matrix) {}
-
-// ============== DESTRUCTOR ==============
-Rotation3D::~Rotation3D(){}
-
 // ============== CLASS METHODS ==============
 // ********** SETTER **********
 void Rotation3D::setRotation(const char &axis, const double &angle, bool degrees)
@@ -254,17 +277,7 @@ void Rotation3D::setRotation(const Vector3D &axis, const double &angle, bool deg
 
 void Rotation3D::setRotation(const std::string &convention, const double &a1, const double &a2, const double &a3, bool degrees)
 {
-    //if (EULER_CONVENTION.contains(convention)) // C++20
-    if (EULER_CONVENTION.find(convention) != EULER_CONVENTION.end())
-    {
-        Rotation3D r1(convention[0], a1, degrees);
-        Rotation3D r2(convention[1], a2, degrees);
-        Rotation3D r3(convention[2], a3, degrees);
-        m_matrix = (r1 * r2 * r3).m_matrix;
-    }
-    else
-        throw std::invalid_argument("Osl::Geometry::Rotation3D.setRotation(): "
-                                    "'convention' is not a recognized convention.");
+    *this = Rotation3D(convention, a1, a2, a3, degrees);
 }
 
 void Rotation3D::setRotation(const Vector3D &u1, const Vector3D &v1, const Vector3D &u2, const Vector3D &v2)
@@ -297,7 +310,7 @@ void Rotation3D::setRotation(const Vector3D &u1, const Vector3D &v1, const Vecto
                    u2ny, v2ny, w2ny,
                    u2nz, v2nz, w2nz);
     // Rotation matrix from referential 1 to referential 2: R12 = R02 * R01T
-    m_matrix = (R02 * R01T).m_matrix;
+    *this = R02 * R01T;
 }
 
 void Rotation3D::setRotation(const double &m00, const double &m01, const double &m02,
@@ -321,45 +334,15 @@ double Rotation3D::getCoeff(std::size_t row, std::size_t col) const
 
 matrix Rotation3D::getMatrix() const
 {
-    return m_matrix;
+    return matrix{{m_matrix[0][0], m_matrix[0][1], m_matrix[0][2]},
+                  {m_matrix[1][0], m_matrix[1][1], m_matrix[1][2]},
+                  {m_matrix[2][0], m_matrix[2][1], m_matrix[2][2]}};
 }
 
 // ============== OPERATORS ==============
-// Assignement from another Rotation3D
-Rotation3D Rotation3D::operator=(const Rotation3D &other)
-{
-    m_matrix = other.m_matrix;
-    return *this;
-}
-
-Rotation3D Rotation3D::operator*(const Rotation3D &other)
-{
-    Rotation3D rot;
-    for (std::size_t row = 0 ; row < m_row ; ++row)
-    {
-        for (std::size_t col = 0 ; col < m_col ; ++col)
-        {
-            rot.m_matrix[row][col] = 0.0;
-            for (std::size_t k = 0 ; k < m_col ; ++k)
-                rot.m_matrix[row][col] += m_matrix[row][k] * other.m_matrix[k][col];
-        }
-    }
-    return rot;
-}
-
-Rotation3D &Rotation3D::operator*=(const Rotation3D &other)
-{
-    // Rotation3D rot = (*this) * other;
-    // m_matrix = rot.m_matrix;
-    m_matrix = ((*this) * other).m_matrix;
-    return *this;
-}
-
-Vector3D Rotation3D::operator*(const Vector3D &vec)
+Vector3D Rotation3D::operator*(const Vector3D &vec) const
 {
-    Vector3D vec_tmp = vec;
-    double x, y, z;
-    vec_tmp.getCoordinates(x, y, z);
+    double x = vec.getX(), y = vec.getY(), z = vec.getZ();
     return Vector3D(m_matrix[0][0] * x + m_matrix[0][1] * y + m_matrix[0][2] * z,
                     m_matrix[1][0] * x + m_matrix[1][1] * y + m_matrix[1][2] * z,
                     m_matrix[2][0] * x + m_matrix[2][1] * y + m_matrix[2][2] * z);
@@ -385,23 +368,6 @@ bool Rotation3D::operator!=(const Rotation3D &other) const
 }
 
 // ============== MATRIX FUNCTIONS ==============
-double Rotation3D::trace() const
-{
-    return m_matrix[0][0] + m_matrix[1][1] + m_matrix[2][2];
-}
-
-Rotation3D Rotation3D::transpose() const
-{
-    return Rotation3D(m_matrix[0][0], m_matrix[1][0], m_matrix[2][0],
-                      m_matrix[0][1], m_matrix[1][1], m_matrix[2][1],
-                      m_matrix[0][2], m_matrix[1][2], m_matrix[2][2]);
-}
-
-Rotation3D Rotation3D::inverse() const
-{
-    return this->transpose();
-}
-
 bool Rotation3D::isIdentity() const
 {
     return *this == Identity;
@@ -423,324 +389,100 @@ Vector3D Rotation3D::rotationVector(bool degrees) const
 void Rotation3D::eulerAngles(const std::string &convention,
                              double &a1, double &a2, double &a3, bool degrees) const
 {
-    if (EULER_CONVENTION.find(convention) != EULER_CONVENTION.end())
+    EulerConvention c;
+    if (!euler_convention(convention, c))
+        throw std::invalid_argument("Osl::Geometry::Rotation3D.eulerAngles(): "
+                                    "'convention' is not a recognized convention.");
+    this->eulerAngles(c, a1, a2, a3, degrees);
+}
+
+void Rotation3D::eulerAngles(enum EulerConvention convention,
+                             double &a1, double &a2, double &a3, bool degrees) const
+{
+    euler_dispatch(convention, [&](auto c)
     {
-        // ===== TAIT-BRYAN ANGLES CONVENTION =====
-        if (convention == "xyz") // R = RxRyRz
-        {
-            if (m_matrix[0][2] < 1)
-            {
-                if (m_matrix[0][2] > -1)
-                {
-                    a1 = std::atan2(-m_matrix[1][2], m_matrix[2][2]);
-                    a2 = std::asin(m_matrix[0][2]);
-                    a3 = std::atan2(-m_matrix[0][1], m_matrix[0][0]);
-                }
-                else // m02 = -1
-                {
-                    // Not a unique solution: a3 - a1 = atan2(m10, m11)
-                    a1 = -std::atan2(m_matrix[1][0], m_matrix[1][1]);
-                    a2 = -Constants::m_pi_2;
-                    a3 = 0.0;
-                }
-            }
-            else // m02 = +1
-            {
-                // Not a unique solution: a3 + a1 = atan2(m10, m11)
-                a1 = std::atan2(m_matrix[1][0], m_matrix[1][1]);
-                a2 = Constants::m_pi_2;
-                a3 = 0.0;
-            }
-        }
-        else if (convention == "xzy")
-        {
-            if (m_matrix[0][1] < 1)
-            {
-                if (m_matrix[0][1] > -1)
-                {
-                    a1 = std::atan2(m_matrix[2][1], m_matrix[1][1]);
-                    a2 = std::asin(-m_matrix[0][1]);
-                    a3 = std::atan2(m_matrix[0][2], m_matrix[0][0]);
-                }
-                else // m01 = -1
-                {
-                    // Not a unique solution: a3 - a1 = atan2(-m20, m22)
-                    a1 = -std::atan2(-m_matrix[2][0], m_matrix[2][2]);
-                    a2 = Constants::m_pi_2;
-                    a3 = 0.0;
-                }
-            }
-            else // m01 = +1
-            {
-                a1 = std::atan2(-m_matrix[2][0], m_matrix[2][2]);
-                a2 = -Constants::m_pi_2;
-                a3 = 0.0;
-            }
-        }
-        else if (convention == "yxz")
-        {
-            if (m_matrix[1][2] < 1)
-            {
-                if (m_matrix[1][2] > -1)
-                {
-                    a1 = std::atan2(m_matrix[0][2], m_matrix[2][2]);
-                    a2 = std::asin(-m_matrix[1][2]);
-                    a3 = std::atan2(m_matrix[1][0], m_matrix[1][1]);
-                }
-                else // m12 = -1
-                {
-                    // Not a unique solution: a3 - a1 = atan2(-m01, m00)
-                    a1 = -std::atan2(-m_matrix[0][1], m_matrix[0][0]);
-                    a2 = Constants::m_pi_2;
-                    a3 = 0.0;
-                }
-            }
-            else // m12 = +1
-            {
-                a1 = std::atan2(-m_matrix[0][1], m_matrix[0][0]);
-                a2 = -Constants::m_pi_2;
-                a3 = 0.0;
-            }
-        }
-        else if (convention == "yzx")
-        {
-            if (m_matrix[1][0] < 1)
-            {
-                if (m_matrix[1][0] > -1)
-                {
-                    a1 = std::atan2(-m_matrix[2][0], m_matrix[0][0]);
-                    a2 = std::asin(m_matrix[1][0]);
-                    a3 = std::atan2(-m_matrix[1][2], m_matrix[1][1]);
-                }
-                else // m10 = -1
-                {
-                    // Not a unique solution: a3 - a1 = atan2(m21, m22)
-                    a1 = -std::atan2(m_matrix[2][1], m_matrix[2][2]);
-                    a2 = -Constants::m_pi_2;
-                    a3 = 0.0;
-                }
-            }
-            else // m10 = +1
-            {
-                a1 = std::atan2(m_matrix[2][1], m_matrix[2][2]);
-                a2 = Constants::m_pi_2;
-                a3 = 0.0;
-            }
-        }
-        else if (convention == "zxy")
-        {
-            if (m_matrix[2][1] < 1)
-            {
-                if (m_matrix[2][1] > -1)
-                {
-                    a1 = std::atan2(-m_matrix[0][1], m_matrix[1][1]);
-                    a2 = std::asin(m_matrix[2][1]);
-                    a3 = std::atan2(-m_matrix[2][0], m_matrix[2][2]);
-                }
-                else // m21 = -1
-                {
-                    // Not a unique solution: a3 - a1 = atan2(m02, m00)
-                    a1 = -std::atan2(m_matrix[0][2], m_matrix[0][0]);
-                    a2 = -Constants::m_pi_2;
-                    a3 = 0.0;
-                }
-            }
-            else // m21 = +1
-            {
-                a1 = std::atan2(m_matrix[0][2], m_matrix[0][0]);
-                a2 = Constants::m_pi_2;
-                a3 = 0.0;
-            }
-        }
-        else if (convention == "zyx")
-        {
-            if (m_matrix[2][0] < 1)
-            {
-                if (m_matrix[2][0] > -1)
-                {
-                    a1 = std::atan2(m_matrix[1][0], m_matrix[0][0]);
-                    a2 = std::asin(-m_matrix[2][0]);
-                    a3 = std::atan2(m_matrix[2][1], m_matrix[2][2]);
-                }
-                else // m20 = -1
-                {
-                    // Not a unique solution: a3 - a1 = atan2(-m12, m11)
-                    a1 = -std::atan2(-m_matrix[1][2], m_matrix[1][1]);
-                    a2 = Constants::m_pi_2;
-                    a3 = 0.0;
-                }
-            }
-            else // m20 = +1
-            {
-                a1 = std::atan2(-m_matrix[1][2], m_matrix[1][1]);
-                a2 = -Constants::m_pi_2;
-                a3 = 0.0;
-            }
-        } // ===== END OF TAIT-BRYAN ANGLES CONVENTION =====
-        // ===== EULER ANGLES CONVENTION =====
-        else if (convention == "xyx")
-        {
-            if (m_matrix[0][0] < 1)
-            {
-                if (m_matrix[0][0] > -1)
-                {
-                    a1 = std::atan2(m_matrix[1][0], -m_matrix[2][0]);
-                    a2 = std::acos(m_matrix[0][0]);
-                    a3 = std::atan2(m_matrix[0][1], m_matrix[0][2]);
-                }
-                else // m00 = -1
-                {
-                    // Not a unique solution: a3 - a1 = atan2(-m12, m11)
-                    a1 = -std::atan2(-m_matrix[1][2], m_matrix[1][1]);
-                    a2 = Constants::m_pi;
-                    a3 = 0.0;
-                }
-            }
-            else // m00 = +1
-            {
-                a1 = std::atan2(-m_matrix[1][2], m_matrix[1][1]);
-                a2 = 0.0;
-                a3 = 0.0;
-            }
-        }
-        else if (convention == "xzx")
-        {
-            if (m_matrix[0][0] < 1)
-            {
-                if (m_matrix[0][0] > -1)
-                {
-                    a1 = std::atan2(m_matrix[2][0], m_matrix[1][0]);
-                    a2 = std::acos(m_matrix[0][0]);
-                    a3 = std::atan2(m_matrix[0][2], -m_matrix[0][1]);
-                }
-                else // m00 = -1
-                {
-                    // Not a unique solution: a3 - a1 = atan2(-m12, m11)
-                    a1 = -std::atan2(m_matrix[2][1], m_matrix[2][2]);
-                    a2 = Constants::m_pi;
-                    a3 = 0.0;
-                }
-            }
-            else // m00 = +1
-            {
-                a1 = std::atan2(m_matrix[2][1], m_matrix[2][2]);
-                a2 = 0.0;
-                a3 = 0.0;
-            }
-        }
-        else if (convention == "yxy")
-        {
-            if (m_matrix[1][1] < 1)
-            {
-                if (m_matrix[1][1] > -1)
-                {
-                    a1 = std::atan2(m_matrix[0][1], m_matrix[2][1]);
-                    a2 = std::acos(m_matrix[1][1]);
-                    a3 = std::atan2(m_matrix[1][0], -m_matrix[1][2]);
-                }
-                else // m11 = -1
-                {
-                    // Not a unique solution: a3 - a1 = -atan2(m02, m00)
-                    a1 = -std::atan2(m_matrix[0][2], m_matrix[0][0]);
-                    a2 = Constants::m_pi;
-                    a3 = 0.0;
-                }
-            }
-            else // m11 = +1
-            {
-                a1 = std::atan2(m_matrix[0][2], m_matrix[0][0]);
-                a2 = 0.0;
-                a3 = 0.0;
-            }
-        }
-        else if (convention == "yzy")
-        {
-            if (m_matrix[1][1] < 1)
-            {
-                if (m_matrix[1][1] > -1)
-                {
-                    a1 = std::atan2(m_matrix[2][1], -m_matrix[0][1]);
-                    a2 = std::acos(m_matrix[1][1]);
-                    a3 = std::atan2(m_matrix[1][2], m_matrix[1][0]);
-                }
-                else // m11 = -1
-                {
-                    // Not a unique solution: a3 - a1 = atan2(-m20, m22)
-                    a1 = -std::atan2(-m_matrix[2][0], m_matrix[2][2]);
-                    a2 = Constants::m_pi;
-                    a3 = 0.0;
-                }
-            }
-            else // m11 = +1
-            {
-                a1 = std::atan2(-m_matrix[2][0], m_matrix[2][2]);
-                a2 = 0.0;
-                a3 = 0.0;
-            }
-        }
-        else if (convention == "zxz")
-        {
-            if (m_matrix[2][2] < 1)
-            {
-                if (m_matrix[2][2] > -1)
-                {
-                    a1 = std::atan2(m_matrix[0][2], -m_matrix[1][2]);
-                    a2 = std::acos(m_matrix[2][2]);
-                    a3 = std::atan2(m_matrix[2][0], m_matrix[2][1]);
-                }
-                else // m22 = -1
-                {
-                    // Not a unique solution: a3 - a1 = atan2(-m01, m00)
-                    a1 = -std::atan2(-m_matrix[0][1], m_matrix[0][0]);
-                    a2 = Constants::m_pi;
-                    a3 = 0.0;
-                }
-            }
-            else // m22 = +1
-            {
-                a1 = std::atan2(-m_matrix[0][1], m_matrix[0][0]);
-                a2 = 0.0;
-                a3 = 0.0;
-            }
-        }
-        else if (convention == "zyz")
-        {
-            if (m_matrix[2][2] < 1)
-            {
-                if (m_matrix[2][2] > -1)
-                {
-                    a1 = std::atan2(m_matrix[1][2], m_matrix[0][2]);
-                    a2 = std::acos(m_matrix[2][2]);
-                    a3 = std::atan2(m_matrix[2][1], -m_matrix[2][0]);
-                }
-                else // m22 = -1
-                {
-                    // Not a unique solution: a3 - a1 = atan2(m10, m11)
-                    a1 = -std::atan2(m_matrix[1][0], m_matrix[1][1]);
-                    a2 = Constants::m_pi;
-                    a3 = 0.0;
-                }
-            }
-            else // m22 = +1
-            {
-                a1 = std::atan2(m_matrix[1][0], m_matrix[1][1]);
-                a2 = 0.0;
-                a3 = 0.0;
-            }
-        }
-        // ===== END OF EULER ANGLES CONVENTION =====
-        if (degrees)
+        this->eulerAngles<decltype(c)::value>(a1, a2, a3, degrees);
+    });
+}
+
+// ============== EULER ANGLES (COMPILE-TIME CONVENTION) ==============
+    // Batch conversions
+template <EulerConvention C>
+void Rotation3D::fromEuler(const double *a1, const double *a2, const double *a3, std::size_t n,
+                           Rotation3D *rot, bool degrees)
+{
+    const double f = degrees ? Constants::m_degtorad : 1.0;
+    // The sines and cosines of a block are computed in a vectorized loop
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        double c1[detail::batch_size], s1[detail::batch_size], c2[detail::batch_size],
+               s2[detail::batch_size], c3[detail::batch_size], s3[detail::batch_size];
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
         {
-            a1 *= Constants::m_radtodeg;
-            a2 *= Constants::m_radtodeg;
-            a3 *= Constants::m_radtodeg;
+            c1[k] = std::cos(f * a1[k0 + k]), s1[k] = std::sin(f * a1[k0 + k]);
+            c2[k] = std::cos(f * a2[k0 + k]), s2[k] = std::sin(f * a2[k0 + k]);
+            c3[k] = std::cos(f * a3[k0 + k]), s3[k] = std::sin(f * a3[k0 + k]);
         }
-    }
-    else
-        throw std::invalid_argument("Osl::Geometry::Rotation3D.eulerAngles(): "
-                                    "'convention' is not a recognized convention.");
+        for (std::size_t k = 0 ; k < nb ; ++k)
+            rot[k0 + k].setEuler<C>(c1[k], s1[k], c2[k], s2[k], c3[k], s3[k]);
+    });
 }
 
+void Rotation3D::fromEuler(enum EulerConvention convention,
+                           const double *a1, const double *a2, const double *a3, std::size_t n,
+                           Rotation3D *rot, bool degrees)
+{
+    euler_dispatch(convention, [&](auto c)
+    {
+        fromEuler<decltype(c)::value>(a1, a2, a3, n, rot, degrees);
+    });
+}
+
+template <EulerConvention C>
+void Rotation3D::eulerAngles(const Rotation3D *rot, std::size_t n,
+                             double *a1, double *a2, double *a3, bool degrees)
+{
+    #pragma omp parallel for schedule(static)
+    for (std::size_t k = 0 ; k < n ; ++k)
+        rot[k].eulerAngles<C>(a1[k], a2[k], a3[k], degrees);
+}
+
+void Rotation3D::eulerAngles(enum EulerConvention convention, const Rotation3D *rot, std::size_t n,
+                             double *a1, double *a2, double *a3, bool degrees)
+{
+    euler_dispatch(convention, [&](auto c)
+    {
+        eulerAngles<decltype(c)::value>(rot, n, a1, a2, a3, degrees);
+    });
+}
+
+    // Explicit instantiations of the batch conversions
+template void Rotation3D::fromEuler<EulerConvention::xyz>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::fromEuler<EulerConvention::xzy>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::fromEuler<EulerConvention::yxz>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::fromEuler<EulerConvention::yzx>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::fromEuler<EulerConvention::zxy>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::fromEuler<EulerConvention::zyx>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::fromEuler<EulerConvention::xyx>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::fromEuler<EulerConvention::xzx>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::fromEuler<EulerConvention::yxy>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::fromEuler<EulerConvention::yzy>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::fromEuler<EulerConvention::zxz>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::fromEuler<EulerConvention::zyz>(const double*, const double*, const double*, std::size_t, Rotation3D*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::xyz>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::xzy>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::yxz>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::yzx>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::zxy>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::zyx>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::xyx>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::xzx>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::yxy>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::yzy>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::zxz>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+template void Rotation3D::eulerAngles<EulerConvention::zyz>(const Rotation3D*, std::size_t, double*, double*, double*, bool);
+
 } // namespace Osl::Geometry
 
 } // namespace Osl
@@ -6,7 +6,7 @@
 #ifndef OSL_GEOMETRY_ROTATION3D_H
 #define OSL_GEOMETRY_ROTATION3D_H
 
-#include <unordered_set>
+#include <type_traits>
 #include "Osl/Constants.h"
 #include "Vector3D.h"
 
@@ -14,11 +14,40 @@ namespace Osl { // namespace Osl
 
 namespace Geometry { // namespace Osl::Geometry
 
+/*! ********************************************************************
+ * \enum EulerConvention
+ * \brief Enumeration of the Euler angles conventions (intrinsic
+ *        definition) of the Rotation3D class, the rotation of convention
+ *        "ijk" being \f$R = R_i(a_1)\,R_j(a_2)\,R_k(a_3)\f$.
+ *********************************************************************/
+enum class EulerConvention
+{
+    /*! Tait-Bryan angles (Euler improper).*/
+    xyz, xzy, yxz, yzx, zxy, zyx,
+    /*! Euler angles (Euler proper).*/
+    xyx, xzx, yxy, yzy, zxz, zyz
+};
+
+/*! ********************************************************************
+ * \brief Class to manage 3D rotation matrices.
+ *
+ * The 9 coefficients of the rotation matrix are stored in a fixed-size
+ * row-major array held by the object itself, so that a Rotation3D is
+ * trivially copyable and its construction, copy, composition and
+ * application to a Vector3D never allocate memory.
+ *
+ * The Euler angles conversions exist with a convention given as a string
+ * (parsed at each call), as an EulerConvention, or as a template
+ * parameter (fromEuler<EulerConvention::zyx>(), eulerAngles<...>()). In
+ * the last case, the 9 coefficients are computed from their closed-form
+ * expressions selected at compile time, and batch versions convert arrays
+ * of angle triplets.
+ *********************************************************************/
 class Rotation3D
 {
 public:
-    //! Default Constructor.
-    Rotation3D();
+    //! Default Constructor (identity matrix).
+    constexpr Rotation3D() = default;
 
     //! Initialization from axis and angle.
     /*! ********************************************************************
@@ -58,6 +87,10 @@ public:
     Rotation3D(const std::string &convention, const double &a1,
                const double &a2, const double &a3, bool degrees=true);
 
+    //! Initialization from Euler angles of a given convention (see above).
+    Rotation3D(enum EulerConvention convention, const double &a1,
+               const double &a2, const double &a3, bool degrees=true);
+
     //! Initialization from two couple of non colinear vectors.
     /*! ********************************************************************
      * \brief Rotation3D
@@ -74,19 +107,18 @@ public:
      * \brief Rotation3D
      * \param m00, m01, m02, m10, m11, m12, m20, m21, m22
      *********************************************************************/
-    Rotation3D(const double &m00, const double &m01, const double &m02,
-               const double &m10, const double &m11, const double &m12,
-               const double &m20, const double &m21, const double &m22);
+    constexpr Rotation3D(const double &m00, const double &m01, const double &m02,
+                         const double &m10, const double &m11, const double &m12,
+                         const double &m20, const double &m21, const double &m22)
+        : m_matrix{{m00, m01, m02},
+                   {m10, m11, m12},
+                   {m20, m21, m22}} {}
 
     //! Copy constructor
-    /*! ********************************************************************
-     * \brief Rotation3D
-     * \param other
-     */
-    Rotation3D(const Rotation3D &other); // Copy constructor
+    constexpr Rotation3D(const Rotation3D &other) = default;
 
     //! Default Destructor
-    ~Rotation3D();
+    ~Rotation3D() = default;
 
     // ============== CLASS METHODS ==============
     // ********** SETTER **********
@@ -112,14 +144,48 @@ public:
     /*!
      * \brief getMatrix
      * \return
+     * \note This method is kept for compatibility: it allocates a new
+     *       matrix container at each call. Prefer getCoeff() or data()
+     *       in performance critical code.
      */
     matrix getMatrix() const;
 
+    //! Get a pointer to the 9 coefficients of the rotation matrix
+    /*!
+     * \brief data
+     * \return A pointer to the coefficients stored in row-major order.
+     */
+    constexpr const double *data() const { return &m_matrix[0][0]; }
+
     // ============== OPERATORS ==============
     // Operators between matrices
-    Rotation3D operator=(const Rotation3D &other); // Assignement from another Rotation3d
-    Rotation3D operator*(const Rotation3D &other);
-    Rotation3D &operator*=(const Rotation3D &other);
+    Rotation3D &operator=(const Rotation3D &other) = default; // Assignement from another Rotation3d
+
+    //! Compute the product of this rotation matrix with another one.
+    /*!
+     * \brief operator *
+     * \param other
+     * \return
+     */
+    constexpr Rotation3D operator*(const Rotation3D &other) const
+    {
+        const double (&a)[3][3] = m_matrix, (&b)[3][3] = other.m_matrix;
+        return Rotation3D(a[0][0] * b[0][0] + a[0][1] * b[1][0] + a[0][2] * b[2][0],
+                          a[0][0] * b[0][1] + a[0][1] * b[1][1] + a[0][2] * b[2][1],
+                          a[0][0] * b[0][2] + a[0][1] * b[1][2] + a[0][2] * b[2][2],
+                          a[1][0] * b[0][0] + a[1][1] * b[1][0] + a[1][2] * b[2][0],
+                          a[1][0] * b[0][1] + a[1][1] * b[1][1] + a[1][2] * b[2][1],
+                          a[1][0] * b[0][2] + a[1][1] * b[1][2] + a[1][2] * b[2][2],
+                          a[2][0] * b[0][0] + a[2][1] * b[1][0] + a[2][2] * b[2][0],
+                          a[2][0] * b[0][1] + a[2][1] * b[1][1] + a[2][2] * b[2][1],
+                          a[2][0] * b[0][2] + a[2][1] * b[1][2] + a[2][2] * b[2][2]);
+    }
+
+    constexpr Rotation3D &operator*=(const Rotation3D &other)
+    {
+        *this = (*this) * other;
+        return *this;
+    }
 
     //! Compute the product of this rotation matrix to a vector.
     /*!
@@ -127,7 +193,7 @@ public:
      * \param vec
      * \return
      */
-    Vector3D operator*(const Vector3D &vec);
+    Vector3D operator*(const Vector3D &vec) const;
 
     // Comparison operators
     //! Check equality between two rotation matrices.
@@ -146,7 +212,10 @@ public:
      * \brief trace
      * \return
      */
-    double trace() const;
+    constexpr double trace() const
+    {
+        return m_matrix[0][0] + m_matrix[1][1] + m_matrix[2][2];
+    }
 
     //! Compute the matrix transpose of the rotation matrix
     /*!
@@ -154,7 +223,12 @@ public:
      * \return
      * \sa inverse()
      */
-    Rotation3D transpose() const;
+    constexpr Rotation3D transpose() const
+    {
+        return Rotation3D(m_matrix[0][0], m_matrix[1][0], m_matrix[2][0],
+                          m_matrix[0][1], m_matrix[1][1], m_matrix[2][1],
+                          m_matrix[0][2], m_matrix[1][2], m_matrix[2][2]);
+    }
 
     //! Compute the inverse matrix of the rotation matrix
     /*!
@@ -162,7 +236,7 @@ public:
      * \return
      * \sa transpose()
      */
-    Rotation3D inverse() const;
+    constexpr Rotation3D inverse() const { return this->transpose(); }
 
     //! Check if the rotation matrix is the identity matrix
     /*!
@@ -193,15 +267,199 @@ public:
      * \param degrees
      */
     void eulerAngles(const std::string &convention, double &a1, double &a2, double &a3, bool degrees=true) const;
+    void eulerAngles(enum EulerConvention convention, double &a1, double &a2, double &a3, bool degrees=true) const;
+
+    // ============== EULER ANGLES (COMPILE-TIME CONVENTION) ==============
+    /*! ********************************************************************
+     * \brief Rotation matrix of Euler angles of convention \em C
+     *        (see Rotation3D(const std::string&, ...)).
+     * \note The closed-form coefficients of the convention are selected at
+     *       compile time: neither string lookup nor matrix product.
+     *********************************************************************/
+    template <EulerConvention C>
+    static Rotation3D fromEuler(const double &a1, const double &a2, const double &a3, bool degrees=true);
+
+    /*! ********************************************************************
+     * \brief Batch conversion of Euler angles of convention \em C.
+     * \param [in] a1, a2, a3 Pointers to the \em n angle triplets.
+     * \param [in] n The number of triplets.
+     * \param [out] rot Pointer to the \em n rotation matrices.
+     * \param [in] degrees Whether the angles are in degrees.
+     *********************************************************************/
+    template <EulerConvention C>
+    static void fromEuler(const double *a1, const double *a2, const double *a3, std::size_t n,
+                          Rotation3D *rot, bool degrees=true);
+    static void fromEuler(enum EulerConvention convention,
+                          const double *a1, const double *a2, const double *a3, std::size_t n,
+                          Rotation3D *rot, bool degrees=true);
+
+    //! Euler angles of convention \em C of the rotation matrix (see eulerAngles()).
+    template <EulerConvention C>
+    void eulerAngles(double &a1, double &a2, double &a3, bool degrees=true) const;
+
+    /*! ********************************************************************
+     * \brief Batch extraction of Euler angles of convention \em C.
+     * \param [in] rot Pointer to the \em n rotation matrices.
+     * \param [in] n The number of rotation matrices.
+     * \param [out] a1, a2, a3 Pointers to the \em n angle triplets.
+     * \param [in] degrees Whether the angles are returned in degrees.
+     *********************************************************************/
+    template <EulerConvention C>
+    static void eulerAngles(const Rotation3D *rot, std::size_t n,
+                            double *a1, double *a2, double *a3, bool degrees=true);
+    static void eulerAngles(enum EulerConvention convention, const Rotation3D *rot, std::size_t n,
+                            double *a1, double *a2, double *a3, bool degrees=true);
 
 private:
     // Private member
-    matrix m_matrix{{1.0, 0.0, 0.0},
-                    {0.0, 1.0, 0.0},
-                    {0.0, 0.0, 1.0}};
-    const std::size_t m_row = 3, m_col = 3;
+    alignas(32) double m_matrix[3][3]{{1.0, 0.0, 0.0}, // Row-major rotation matrix
+                                      {0.0, 1.0, 0.0}, // (default to identity)
+                                      {0.0, 0.0, 1.0}};
+    static constexpr std::size_t m_row = 3, m_col = 3;
+
+    // Axes (i, j, k) of an Euler convention (k being the remaining axis
+    // for proper Euler angles) and sign of the permutation (i, j, k): the
+    // rotation is the "xyz" (or "xyx") one with relabeled axes and angles
+    // multiplied by this sign.
+    struct EulerAxes
+    {
+        std::size_t i, j, k;
+        bool proper;
+        double sign;
+    };
+    static constexpr EulerAxes eulerAxes(EulerConvention convention)
+    {
+        switch (convention)
+        {
+        case EulerConvention::xyz: return {0, 1, 2, false, 1.0};
+        case EulerConvention::xzy: return {0, 2, 1, false, -1.0};
+        case EulerConvention::yxz: return {1, 0, 2, false, -1.0};
+        case EulerConvention::yzx: return {1, 2, 0, false, 1.0};
+        case EulerConvention::zxy: return {2, 0, 1, false, 1.0};
+        case EulerConvention::zyx: return {2, 1, 0, false, -1.0};
+        case EulerConvention::xyx: return {0, 1, 2, true, 1.0};
+        case EulerConvention::xzx: return {0, 2, 1, true, -1.0};
+        case EulerConvention::yxy: return {1, 0, 2, true, -1.0};
+        case EulerConvention::yzy: return {1, 2, 0, true, 1.0};
+        case EulerConvention::zxz: return {2, 0, 1, true, 1.0};
+        default:                   return {2, 1, 0, true, -1.0}; // zyz
+        }
+    }
+
+    // Closed-form coefficients from the cosines and sines of the angles
+    template <EulerConvention C>
+    constexpr void setEuler(const double &c1, const double &s1, const double &c2,
+                            const double &s2, const double &c3, const double &s3)
+    {
+        constexpr EulerAxes ax = eulerAxes(C);
+        constexpr std::size_t i = ax.i, j = ax.j, k = ax.k;
+        constexpr double e = ax.sign;
+        double (&m)[3][3] = m_matrix;
+        if constexpr (!ax.proper) // R = Ri(a1) Rj(a2) Rk(a3)
+        {
+            m[i][i] = c2 * c3;
+            m[i][j] = -e * c2 * s3;
+            m[i][k] = e * s2;
+            m[j][i] = e * c1 * s3 + s1 * s2 * c3;
+            m[j][j] = c1 * c3 - e * s1 * s2 * s3;
+            m[j][k] = -e * s1 * c2;
+            m[k][i] = s1 * s3 - e * c1 * s2 * c3;
+            m[k][j] = e * s1 * c3 + c1 * s2 * s3;
+            m[k][k] = c1 * c2;
+        }
+        else // R = Ri(a1) Rj(a2) Ri(a3)
+        {
+            m[i][i] = c2;
+            m[i][j] = s2 * s3;
+            m[i][k] = e * s2 * c3;
+            m[j][i] = s1 * s2;
+            m[j][j] = c1 * c3 - s1 * c2 * s3;
+            m[j][k] = -e * (c1 * s3 + s1 * c2 * c3);
+            m[k][i] = -e * c1 * s2;
+            m[k][j] = e * (s1 * c3 + c1 * c2 * s3);
+            m[k][k] = c1 * c2 * c3 - s1 * s3;
+        }
+    }
 };
 
+// ============== EULER ANGLES (COMPILE-TIME CONVENTION) ==============
+template <EulerConvention C>
+inline Rotation3D Rotation3D::fromEuler(const double &a1, const double &a2, const double &a3, bool degrees)
+{
+    const double f = degrees ? Constants::m_degtorad : 1.0;
+    Rotation3D rot;
+    rot.setEuler<C>(std::cos(f * a1), std::sin(f * a1),
+                    std::cos(f * a2), std::sin(f * a2),
+                    std::cos(f * a3), std::sin(f * a3));
+    return rot;
+}
+
+template <EulerConvention C>
+inline void Rotation3D::eulerAngles(double &a1, double &a2, double &a3, bool degrees) const
+{
+    constexpr EulerAxes ax = eulerAxes(C);
+    constexpr std::size_t i = ax.i, j = ax.j, k = ax.k;
+    constexpr double e = ax.sign;
+    const double (&m)[3][3] = m_matrix;
+    if constexpr (!ax.proper) // Angles of the "xyz" convention, times the sign
+    {
+        if (m[i][k] < 1)
+        {
+            if (m[i][k] > -1)
+            {
+                a1 = e * std::atan2(-m[j][k], m[k][k]);
+                a2 = e * std::asin(m[i][k]);
+                a3 = e * std::atan2(-m[i][j], m[i][i]);
+            }
+            else // Not a unique solution: a3 - a1 = atan2(m[j][i], m[j][j])
+            {
+                a1 = -e * std::atan2(m[j][i], m[j][j]);
+                a2 = -e * Constants::m_pi_2;
+                a3 = 0.0;
+            }
+        }
+        else // Not a unique solution: a3 + a1 = atan2(m[j][i], m[j][j])
+        {
+            a1 = e * std::atan2(m[j][i], m[j][j]);
+            a2 = e * Constants::m_pi_2;
+            a3 = 0.0;
+        }
+    }
+    else // a2 in [0, pi]
+    {
+        if (m[i][i] < 1)
+        {
+            if (m[i][i] > -1)
+            {
+                a1 = std::atan2(m[j][i], -e * m[k][i]);
+                a2 = std::acos(m[i][i]);
+                a3 = std::atan2(m[i][j], e * m[i][k]);
+            }
+            else // Not a unique solution: a1 - a3 = atan2(e m[k][j], m[j][j])
+            {
+                a1 = std::atan2(e * m[k][j], m[j][j]);
+                a2 = Constants::m_pi;
+                a3 = 0.0;
+            }
+        }
+        else // Not a unique solution: a1 + a3 = atan2(e m[k][j], m[j][j])
+        {
+            a1 = std::atan2(e * m[k][j], m[j][j]);
+            a2 = 0.0;
+            a3 = 0.0;
+        }
+    }
+    if (degrees)
+    {
+        a1 *= Constants::m_radtodeg;
+        a2 *= Constants::m_radtodeg;
+        a3 *= Constants::m_radtodeg;
+    }
+}
+
+static_assert(std::is_trivially_copyable_v<Rotation3D>,
+              "Osl::Geometry::Rotation3D must be trivially copyable.");
+
 inline std::ostream &operator<<(std::ostream &os, const Rotation3D &rot)
 {
 //    os << std::fixed;
@@ -228,7 +486,7 @@ inline std::ostream &operator<<(std::ostream &os, const Rotation3D &rot)
 }
 
 // Definition of Identity matrix
-inline static Rotation3D Identity;
+inline static constexpr Rotation3D Identity;
 
 } // namespace Osl::Geometry
 
@@ -4,6 +4,10 @@
  *********************************************************************/
 
 #include "Ellipsoid3D.h"
+#include "Osl/Batch.h"
+
+#include <algorithm>
+#include <limits>
 
 namespace Osl {
 
@@ -299,6 +303,90 @@ Ellipsoid3D Ellipsoid3D::zScaled(const double &zscale)
 //    return m_rotation * point + m_center;
 //}
 
+// ============== RAY INTERSECTION ==============
+bool Ellipsoid3D::intersect(const Line3D &ray, double &t, Vector3D &point) const
+{
+    double ox, oy, oz, dx, dy, dz, px, py, pz;
+    Vector3D o = ray.getPoint(), d = ray.getDirection();
+    o.getCoordinates(ox, oy, oz);
+    d.getCoordinates(dx, dy, dz);
+    this->intersect_block(&ox, &oy, &oz, &dx, &dy, &dz, 1, &t, &px, &py, &pz);
+    point.setCoordinates(px, py, pz);
+    return !std::isnan(t);
+}
+
+void Ellipsoid3D::intersect(const double *ox, const double *oy, const double *oz,
+                            const double *dx, const double *dy, const double *dz,
+                            std::size_t n,
+                            double *t, double *px, double *py, double *pz) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        this->intersect_block(ox + k0, oy + k0, oz + k0,
+                              dx + k0, dy + k0, dz + k0, nb,
+                              t + k0, px + k0, py + k0, pz + k0);
+    });
+}
+
+void Ellipsoid3D::intersect(const Line3D *rays, std::size_t n,
+                            double *t, double *px, double *py, double *pz) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        // Unpack the block of rays in SoA layout
+        double ox[detail::batch_size], oy[detail::batch_size], oz[detail::batch_size],
+               dx[detail::batch_size], dy[detail::batch_size], dz[detail::batch_size];
+        Line3D::unpack(rays + k0, nb, ox, oy, oz, dx, dy, dz);
+        this->intersect_block(ox, oy, oz, dx, dy, dz, nb,
+                              t + k0, px + k0, py + k0, pz + k0);
+    });
+}
+
+void Ellipsoid3D::intersect_block(const double *ox, const double *oy, const double *oz,
+                                  const double *dx, const double *dy, const double *dz,
+                                  std::size_t n,
+                                  double *t, double *px, double *py, double *pz) const
+{
+    // The ray is expressed in the ellipsoid referential and scaled by its
+    // radii, so that the ellipsoid becomes the unit sphere:
+    // vec(l) = diag(1/r) * R^T * (vec(o) - vec(c)), vec(e) = diag(1/r) * R^T * vec(d)
+    const double *r = m_rotation.data();
+    const double r00 = r[0], r01 = r[1], r02 = r[2],
+                 r10 = r[3], r11 = r[4], r12 = r[5],
+                 r20 = r[6], r21 = r[7], r22 = r[8],
+                 cx = m_center.getX(), cy = m_center.getY(), cz = m_center.getZ(),
+                 ia = 1.0 / m_xradius, ib = 1.0 / m_yradius, ic = 1.0 / m_zradius,
+                 nan = std::numeric_limits<double>::quiet_NaN();
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double qx = ox[i] - cx, qy = oy[i] - cy, qz = oz[i] - cz;
+        double lx = (r00 * qx + r10 * qy + r20 * qz) * ia,
+               ly = (r01 * qx + r11 * qy + r21 * qz) * ib,
+               lz = (r02 * qx + r12 * qy + r22 * qz) * ic,
+               ex = (r00 * dx[i] + r10 * dy[i] + r20 * dz[i]) * ia,
+               ey = (r01 * dx[i] + r11 * dy[i] + r21 * dz[i]) * ib,
+               ez = (r02 * dx[i] + r12 * dy[i] + r22 * dz[i]) * ic;
+        // |vec(l) + t * vec(e)|^2 = 1
+        double a = ex * ex + ey * ey + ez * ez,
+               b = lx * ex + ly * ey + lz * ez,
+               c = lx * lx + ly * ly + lz * lz - 1.0;
+        // Numerically stable roots of a*t^2 + 2*b*t + c = 0
+        double disc = b * b - a * c,
+               q = -(b + std::copysign(std::sqrt(std::max(disc, 0.0)), b)),
+               t1 = q / a,
+               t2 = (q != 0.0) ? c / q : t1;
+        // Nearest root in front of the ray origin (the exit point if inside)
+        double tn = std::min(t1, t2), tf = std::max(t1, t2),
+               ti = (tn >= 0.0) ? tn : tf;
+        ti = ((disc >= 0.0) && (ti >= 0.0)) ? ti : nan;
+        t[i] = ti;
+        px[i] = ox[i] + ti * dx[i];
+        py[i] = oy[i] + ti * dy[i];
+        pz[i] = oz[i] + ti * dz[i];
+    }
+}
+
 } // namespace Osl::Geometry::Shape
 
 } // namespace Osl::Geometry
@@ -7,6 +7,7 @@
 #define OSL_GEOMETRY_SHAPE3D_ELLIPSOID3D_H
 
 #include "Osl/Geometry/Vector3D.h"
+#include "Line3D.h"
 #include "Osl/Geometry/Rotation3D.h"
 #include "Sphere3D.h"
 
@@ -71,7 +72,26 @@ public:
     void zScale(const double &zscale);
     Ellipsoid3D zScaled(const double &zscale);
 
+    // ============== RAY INTERSECTION ==============
+    // Nearest intersection (t >= 0) of a ray with the ellipsoid.
+    // Returns false if the ray misses it, t and point being then set to NaN.
+    bool intersect(const Line3D &ray, double &t, Vector3D &point) const;
+    // Batched intersections of n rays given in SoA layout (origins o, directions d).
+    // Outputs the distances t along the rays (in direction units) and the
+    // hit points p, set to NaN for missed rays.
+    void intersect(const double *ox, const double *oy, const double *oz,
+                   const double *dx, const double *dy, const double *dz,
+                   std::size_t n,
+                   double *t, double *px, double *py, double *pz) const;
+    void intersect(const Line3D *rays, std::size_t n,
+                   double *t, double *px, double *py, double *pz) const;
+
 private:
+    // Vectorized intersection kernel on a block of rays
+    void intersect_block(const double *ox, const double *oy, const double *oz,
+                         const double *dx, const double *dy, const double *dz,
+                         std::size_t n,
+                         double *t, double *px, double *py, double *pz) const;
     Vector3D m_center = NULL_VEC;
     double m_xradius = 0.0,
            m_yradius = 0.0,
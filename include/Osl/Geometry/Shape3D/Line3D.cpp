@@ -50,6 +50,18 @@ void Line3D::setDirection(const double &dx, const double &dy, const double &dz)
 Vector3D Line3D::getPoint() const { return m_point; }
 Vector3D Line3D::getDirection() const { return m_direction; }
 
+    // Batch
+void Line3D::unpack(const Line3D *lines, std::size_t n,
+                    double *px, double *py, double *pz,
+                    double *dx, double *dy, double *dz)
+{
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        lines[k].m_point.getCoordinates(px[k], py[k], pz[k]);
+        lines[k].m_direction.getCoordinates(dx[k], dy[k], dz[k]);
+    }
+}
+
 // ============== OPERATORS ==============
 // Operations between vectors
 Line3D Line3D::operator=(const Line3D &other)
@@ -36,6 +36,12 @@ public:
     Vector3D getPoint() const;
     Vector3D getDirection() const;
 
+        // Batch
+    // Unpacks the points p and directions d of n lines in SoA layout
+    static void unpack(const Line3D *lines, std::size_t n,
+                       double *px, double *py, double *pz,
+                       double *dx, double *dy, double *dz);
+
     // ============== OPERATORS ==============
     // Operations between vectors
     Line3D operator=(const Line3D &other); // Assignement from another Line
@@ -4,6 +4,10 @@
  *********************************************************************/
 
 #include "Plane3D.h"
+#include "Osl/Batch.h"
+
+#include <algorithm>
+#include <limits>
 
 namespace Osl {
 
@@ -161,6 +165,69 @@ double Plane3D::distanceToPoint(const Vector3D &point)
     return m_normal.dotProduct(point) + this->distanceToOrigin();
 }
 
+// ============== RAY INTERSECTION ==============
+bool Plane3D::intersect(const Line3D &ray, double &t, Vector3D &point) const
+{
+    double ox, oy, oz, dx, dy, dz, px, py, pz;
+    Vector3D o = ray.getPoint(), d = ray.getDirection();
+    o.getCoordinates(ox, oy, oz);
+    d.getCoordinates(dx, dy, dz);
+    this->intersect_block(&ox, &oy, &oz, &dx, &dy, &dz, 1, &t, &px, &py, &pz);
+    point.setCoordinates(px, py, pz);
+    return !std::isnan(t);
+}
+
+void Plane3D::intersect(const double *ox, const double *oy, const double *oz,
+                        const double *dx, const double *dy, const double *dz,
+                        std::size_t n,
+                        double *t, double *px, double *py, double *pz) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        this->intersect_block(ox + k0, oy + k0, oz + k0,
+                              dx + k0, dy + k0, dz + k0, nb,
+                              t + k0, px + k0, py + k0, pz + k0);
+    });
+}
+
+void Plane3D::intersect(const Line3D *rays, std::size_t n,
+                        double *t, double *px, double *py, double *pz) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        // Unpack the block of rays in SoA layout
+        double ox[detail::batch_size], oy[detail::batch_size], oz[detail::batch_size],
+               dx[detail::batch_size], dy[detail::batch_size], dz[detail::batch_size];
+        Line3D::unpack(rays + k0, nb, ox, oy, oz, dx, dy, dz);
+        this->intersect_block(ox, oy, oz, dx, dy, dz, nb,
+                              t + k0, px + k0, py + k0, pz + k0);
+    });
+}
+
+void Plane3D::intersect_block(const double *ox, const double *oy, const double *oz,
+                              const double *dx, const double *dy, const double *dz,
+                              std::size_t n,
+                              double *t, double *px, double *py, double *pz) const
+{
+    // vec(n).(vec(o) + t * vec(d)) + h = 0, with h the distance to origin
+    const double nx = m_normal.getX(), ny = m_normal.getY(), nz = m_normal.getZ(),
+                 h = -(nx * m_point.getX() + ny * m_point.getY() + nz * m_point.getZ()),
+                 inf = std::numeric_limits<double>::infinity(),
+                 nan = std::numeric_limits<double>::quiet_NaN();
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double ti = -(nx * ox[i] + ny * oy[i] + nz * oz[i] + h) /
+                     (nx * dx[i] + ny * dy[i] + nz * dz[i]);
+        // Rays parallel to the plane or pointing away from it are missed
+        ti = ((ti >= 0.0) && (ti < inf)) ? ti : nan;
+        t[i] = ti;
+        px[i] = ox[i] + ti * dx[i];
+        py[i] = oy[i] + ti * dy[i];
+        pz[i] = oz[i] + ti * dz[i];
+    }
+}
+
 // ============== PRIVATE FUNCTIONS ==============
 // Compute two non colinear vectors of the plane
 void Plane3D::setPlaneVectors()
@@ -4,6 +4,10 @@
  *********************************************************************/
 
 #include "Sphere3D.h"
+#include "Osl/Batch.h"
+
+#include <algorithm>
+#include <limits>
 
 namespace Osl {
 
@@ -124,6 +128,78 @@ Sphere3D Sphere3D::scaled(const double &scale)
     throw std::invalid_argument("'scale' factor must be strictly positive.");
 }
 
+// ============== RAY INTERSECTION ==============
+bool Sphere3D::intersect(const Line3D &ray, double &t, Vector3D &point) const
+{
+    double ox, oy, oz, dx, dy, dz, px, py, pz;
+    Vector3D o = ray.getPoint(), d = ray.getDirection();
+    o.getCoordinates(ox, oy, oz);
+    d.getCoordinates(dx, dy, dz);
+    this->intersect_block(&ox, &oy, &oz, &dx, &dy, &dz, 1, &t, &px, &py, &pz);
+    point.setCoordinates(px, py, pz);
+    return !std::isnan(t);
+}
+
+void Sphere3D::intersect(const double *ox, const double *oy, const double *oz,
+                         const double *dx, const double *dy, const double *dz,
+                         std::size_t n,
+                         double *t, double *px, double *py, double *pz) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        this->intersect_block(ox + k0, oy + k0, oz + k0,
+                              dx + k0, dy + k0, dz + k0, nb,
+                              t + k0, px + k0, py + k0, pz + k0);
+    });
+}
+
+void Sphere3D::intersect(const Line3D *rays, std::size_t n,
+                         double *t, double *px, double *py, double *pz) const
+{
+    detail::for_each_block(n, [&](std::size_t k0, std::size_t nb)
+    {
+        // Unpack the block of rays in SoA layout
+        double ox[detail::batch_size], oy[detail::batch_size], oz[detail::batch_size],
+               dx[detail::batch_size], dy[detail::batch_size], dz[detail::batch_size];
+        Line3D::unpack(rays + k0, nb, ox, oy, oz, dx, dy, dz);
+        this->intersect_block(ox, oy, oz, dx, dy, dz, nb,
+                              t + k0, px + k0, py + k0, pz + k0);
+    });
+}
+
+void Sphere3D::intersect_block(const double *ox, const double *oy, const double *oz,
+                               const double *dx, const double *dy, const double *dz,
+                               std::size_t n,
+                               double *t, double *px, double *py, double *pz) const
+{
+    // The sphere rotation doesn't change its surface
+    const double cx = m_center.getX(), cy = m_center.getY(), cz = m_center.getZ(),
+                 r2 = m_radius * m_radius,
+                 nan = std::numeric_limits<double>::quiet_NaN();
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double qx = ox[i] - cx, qy = oy[i] - cy, qz = oz[i] - cz;
+        // |vec(o) + t * vec(d) - vec(c)|^2 = radius^2
+        double a = dx[i] * dx[i] + dy[i] * dy[i] + dz[i] * dz[i],
+               b = qx * dx[i] + qy * dy[i] + qz * dz[i],
+               c = qx * qx + qy * qy + qz * qz - r2;
+        // Numerically stable roots of a*t^2 + 2*b*t + c = 0
+        double disc = b * b - a * c,
+               q = -(b + std::copysign(std::sqrt(std::max(disc, 0.0)), b)),
+               t1 = q / a,
+               t2 = (q != 0.0) ? c / q : t1;
+        // Nearest root in front of the ray origin (the exit point if inside)
+        double tn = std::min(t1, t2), tf = std::max(t1, t2),
+               ti = (tn >= 0.0) ? tn : tf;
+        ti = ((disc >= 0.0) && (ti >= 0.0)) ? ti : nan;
+        t[i] = ti;
+        px[i] = ox[i] + ti * dx[i];
+        py[i] = oy[i] + ti * dy[i];
+        pz[i] = oz[i] + ti * dz[i];
+    }
+}
+
 } // namespace Osl::Geometry::Shape
 
 } // namespace Osl::Geometry
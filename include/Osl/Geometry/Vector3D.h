@@ -2,6 +2,7 @@
 #define OSL_GEOMETRY_VECTOR3D_H
 
 #include "Osl/Globals.h"
+#include "Osl/Constants.h"
 #include "Osl/Maths/Comparison/almost_equal.h"
 #include "Osl/Maths/Comparison/almost_one.h"
 #include "Osl/Maths/Comparison/almost_zero.h"
@@ -9,154 +10,437 @@
 /*! ********************************************************************
  * \file Vector3D.h
  * \brief Header file of Osl::Geometry::Vector3D class.
+ *
+ * The whole class is defined in this header, its arithmetic being
+ * \em constexpr and \em noexcept so that it is inlined in the caller
+ * without link-time optimization.
+ *
+ * By default the arithmetic operators return Vector3D values. When
+ * \em OSL_VECTOR3D_EXPRESSION_TEMPLATES is defined before including this
+ * header, they return lightweight expressions instead, evaluated in a
+ * single pass on assignment to a Vector3D (e.g. \f$a+b\,s-c\f$ is
+ * computed without temporary vectors). In that mode an expression holds
+ * references to its operands, so it must not be stored in an \em auto
+ * variable beyond the statement; Vector3DExpr::eval gives its value.
+ * Both modes may be mixed between translation units.
  *********************************************************************/
 
 namespace Osl { // namespace Osl
 
 namespace Geometry { // namespace Osl::Geometry
 
-class Vector3D
+class Vector3D;
+
+/*! ********************************************************************
+ * \brief Base class of the Vector3D expressions (CRTP).
+ *
+ * An expression provides the getX(), getY() and getZ() coordinates of
+ * its value. Only coordinate-wise operations are expressions, so that
+ * the evaluation of an expression into one of its operands is safe.
+ *********************************************************************/
+template <typename E>
+class Vector3DExpr
 {
 public:
-    //! Default Constructor.
-    Vector3D();
+    //! The derived expression.
+    constexpr const E &self() const noexcept { return static_cast<const E&>(*this); }
+    //! The value of the expression.
+    constexpr Vector3D eval() const noexcept;
+};
 
-    //! Constructor taking the 3 parameters of the vector.
-    /*!
-     * \brief Vector3D
-     * \param x
-     * \param y
-     * \param z
-     */
-    Vector3D(const double &x, const double &y, const double &z);
+class Vector3D : public Vector3DExpr<Vector3D>
+{
+public:
+    // ============== CONSTRUCTOR ==============
+    //! Default Constructor (null vector).
+    constexpr Vector3D() noexcept {}
+
+    //! Constructor taking the 3 coordinates of the vector.
+    constexpr Vector3D(const double &x, const double &y, const double &z) noexcept
+        : m_x(x), m_y(y), m_z(z) {}
 
     //! Copy constructor
-    /*!
-     * \brief Vector3D
-     * \param other
-     */
-    Vector3D(const Vector3D &other); // Copy constructor
+    constexpr Vector3D(const Vector3D &other) noexcept = default;
 
-    //! Default Destructor
-    ~Vector3D();
+    //! Evaluation of an expression, in a single pass.
+    template <typename E>
+    constexpr Vector3D(const Vector3DExpr<E> &expr) noexcept
+        : m_x(expr.self().getX()), m_y(expr.self().getY()), m_z(expr.self().getZ()) {}
 
     // ============== CLASS METHODS ==============
     // ********** SETTER **********
-    void setX(const double &x);
-    void setY(const double &y);
-    void setZ(const double &z);
-    void setCoordinates(const double &x, const double &y, const double &z);
+    constexpr void setX(const double &x) noexcept { m_x = x; }
+    constexpr void setY(const double &y) noexcept { m_y = y; }
+    constexpr void setZ(const double &z) noexcept { m_z = z; }
+    constexpr void setCoordinates(const double &x, const double &y, const double &z) noexcept
+    {
+        m_x = x;
+        m_y = y;
+        m_z = z;
+    }
     // ********** GETTER **********
-    double getX() const;
-    double getY() const;
-    double getZ() const;
-    void getCoordinates(double &x, double &y, double &z);
+    constexpr double getX() const noexcept { return m_x; }
+    constexpr double getY() const noexcept { return m_y; }
+    constexpr double getZ() const noexcept { return m_z; }
+    constexpr void getCoordinates(double &x, double &y, double &z) const noexcept
+    {
+        x = m_x;
+        y = m_y;
+        z = m_z;
+    }
 
     // ============== OPERATORS ==============
-    // Unary operators
-    Vector3D operator-();
-    // Operations between vectors
-    Vector3D operator=(const Vector3D &other); // Assignement from another vector
-    Vector3D operator+(const Vector3D &other);  // Summation between vectors
-    Vector3D &operator+=(const Vector3D &other);
-    Vector3D operator-(const Vector3D &other);  // Differenciation between vectors
-    Vector3D &operator-=(const Vector3D &other);
+    // Operations between vectors (the arithmetic operators are defined below the class)
+    constexpr Vector3D &operator=(const Vector3D &other) noexcept = default; // Assignement from another vector
+    template <typename E>
+    constexpr Vector3D &operator=(const Vector3DExpr<E> &expr) noexcept // Assignement from an expression
+    {
+        // Coordinates evaluated before the stores, which may alias the operands
+        const double x = expr.self().getX(), y = expr.self().getY(), z = expr.self().getZ();
+        m_x = x;
+        m_y = y;
+        m_z = z;
+        return *this;
+    }
+    template <typename E>
+    constexpr Vector3D &operator+=(const Vector3DExpr<E> &expr) noexcept
+    {
+        // Coordinates evaluated before the stores, which may alias the operands
+        const double x = expr.self().getX(), y = expr.self().getY(), z = expr.self().getZ();
+        m_x += x;
+        m_y += y;
+        m_z += z;
+        return *this;
+    }
+    template <typename E>
+    constexpr Vector3D &operator-=(const Vector3DExpr<E> &expr) noexcept
+    {
+        // Coordinates evaluated before the stores, which may alias the operands
+        const double x = expr.self().getX(), y = expr.self().getY(), z = expr.self().getZ();
+        m_x -= x;
+        m_y -= y;
+        m_z -= z;
+        return *this;
+    }
     // Scalar operations
-    Vector3D operator*(const double &rhs);      // Multiplication
-    Vector3D &operator*=(const double &rhs);
-    Vector3D operator/(const double &rhs);      // Division
-    Vector3D &operator/=(const double &rhs);
-    // Comparison operators
-    bool operator==(const Vector3D &other) const;
-    bool operator!=(const Vector3D &other) const;
+    constexpr Vector3D &operator*=(const double &rhs) noexcept
+    {
+        m_x *= rhs;
+        m_y *= rhs;
+        m_z *= rhs;
+        return *this;
+    }
+    constexpr Vector3D &operator/=(const double &rhs) noexcept
+    {
+        m_x /= rhs;
+        m_y /= rhs;
+        m_z /= rhs;
+        return *this;
+    }
+    // Comparison operators (see Maths::Comparison::almost_equal)
+    constexpr bool operator==(const Vector3D &other) const noexcept
+    {
+        return Maths::Comparison::almost_equal(m_x, other.m_x) &&
+               Maths::Comparison::almost_equal(m_y, other.m_y) &&
+               Maths::Comparison::almost_equal(m_z, other.m_z);
+    }
+    constexpr bool operator!=(const Vector3D &other) const noexcept
+    {
+        return !(*this == other);
+    }
 
     // ============== VECTOR OPERATIONS ==============
     /*!
      * \brief norm2
-     * \return
+     * \return The squared norm of the vector.
      */
-    double norm2() const;
+    constexpr double norm2() const noexcept
+    {
+        return m_x * m_x + m_y * m_y + m_z * m_z;
+    }
 
     /*!
      * \brief norm
-     * \return
+     * \return The norm of the vector.
      */
-    double norm() const;
+    double norm() const noexcept
+    {
+        return std::hypot(m_x, m_y, m_z); // No overflow of the squares
+    }
 
     /*!
      * \brief sum
-     * \return
+     * \return The sum of the coordinates.
      */
-    double sum() const;
+    constexpr double sum() const noexcept
+    {
+        return m_x + m_y + m_z;
+    }
 
     /*!
      * \brief isNull
-     * \return
+     * \return true if the vector is (almost) the null vector.
      */
-    bool isNull() const;
+    constexpr bool isNull() const noexcept
+    {
+        return Maths::Comparison::almost_equal(m_x, 0.0) &&
+               Maths::Comparison::almost_equal(m_y, 0.0) &&
+               Maths::Comparison::almost_equal(m_z, 0.0);
+    }
 
     /*!
      * \brief In-place normalization of this vector.
      * \note If this vector is the null vector, it is returned without warning.
      * \sa normalized()
      */
-    void normalize();
+    void normalize() noexcept
+    {
+        double norm = this->norm();
+        if (norm > 0.0 && !Maths::Comparison::almost_equal(norm, 1.0))
+        {
+            m_x /= norm;
+            m_y /= norm;
+            m_z /= norm;
+        }
+    }
 
     /*!
      * \brief normalized
      * \return A normalized copy of the vector.
      * \note If the vector is the null vector, a null vector is returned.
      */
-    Vector3D normalized();
+    Vector3D normalized() const noexcept
+    {
+        double norm = this->norm();
+        if (norm > 0.0)
+            return Vector3D(m_x / norm, m_y / norm, m_z / norm);
+        return Vector3D();
+    }
 
     // Vector / Vector operations
     /*!
      * \brief dotProduct
      * \return the result of the dot product between this vector and another
      */
-    double dotProduct(const Vector3D &other);       // dot product
+    constexpr double dotProduct(const Vector3D &other) const noexcept // dot product
+    {
+        return m_x * other.m_x + m_y * other.m_y + m_z * other.m_z;
+    }
 
     /*!
      * \brief crossProduct
      * \return the resulting vector of the cross product between this vector and another
      */
-    Vector3D crossProduct(const Vector3D &other); // Cross product
+    constexpr Vector3D crossProduct(const Vector3D &other) const noexcept // Cross product
+    {
+        return Vector3D(m_y * other.m_z - m_z * other.m_y,
+                        m_z * other.m_x - m_x * other.m_z,
+                        m_x * other.m_y - m_y * other.m_x);
+    }
 
     /*!
      * \brief projectOn
      * \return the projection of this vector onto another one
      * \sa <a href="https://en.wikipedia.org/wiki/Vector_projection">WIKI</a>
      */
-    Vector3D projectOn(const Vector3D &other);    // Projection of this vector onto another one
+    constexpr Vector3D projectOn(const Vector3D &other) const noexcept // Projection of this vector onto another one
+    {
+        double norm2 = other.norm2();
+        if (norm2 > 0.0)
+        {
+            double f = this->dotProduct(other) / norm2;
+            return Vector3D(f * other.m_x, f * other.m_y, f * other.m_z);
+        }
+        return Vector3D();
+    }
 
     /*!
      * \brief rejectFrom
      * \return the rejection of this vector from another one
      * \sa <a href="https://en.wikipedia.org/wiki/Vector_projection">WIKI</a>
      */
-    Vector3D rejectFrom(const Vector3D &other);   // Rejection of this vector from another one
+    constexpr Vector3D rejectFrom(const Vector3D &other) const noexcept // Rejection of this vector from another one
+    {
+        Vector3D p = this->projectOn(other);
+        return Vector3D(m_x - p.m_x, m_y - p.m_y, m_z - p.m_z);
+    }
 
     /*!
      * \brief isColinear
      * \return true if this vector is colinear to another one, else return false.
      */
-    bool isColinear(const Vector3D &other); // Is this vector colinear to another
+    constexpr bool isColinear(const Vector3D &other) const noexcept // Is this vector colinear to another
+    {
+        return this->crossProduct(other).isNull();
+    }
 
     /*!
-     * \brief isColinear
+     * \brief isPerpendicular
      * \return true if this vector is perpendicular to another one, else return false.
      */
-    bool isPerpendicular(const Vector3D &other); // Is this vector perpendicular to another
+    constexpr bool isPerpendicular(const Vector3D &other) const noexcept // Is this vector perpendicular to another
+    {
+        return Maths::Comparison::almost_equal(this->dotProduct(other), 0.0);
+    }
 
 private:
     double m_x = 0.0, m_y = 0.0, m_z = 0.0; // Default vector to null vector
 };
 
-// Reverse scalar multiplication (made global to the class)
-inline Vector3D operator*(double lhs, Vector3D vec)
+template <typename E>
+constexpr Vector3D Vector3DExpr<E>::eval() const noexcept
+{
+    return Vector3D(this->self());
+}
+
+#ifndef OSL_VECTOR3D_EXPRESSION_TEMPLATES
+// ============== ARITHMETIC OPERATORS ==============
+// Unary operators
+constexpr Vector3D operator-(const Vector3D &vec) noexcept
+{
+    return Vector3D(-vec.getX(), -vec.getY(), -vec.getZ());
+}
+
+// Summation between vectors
+constexpr Vector3D operator+(const Vector3D &lhs, const Vector3D &rhs) noexcept
+{
+    return Vector3D(lhs.getX() + rhs.getX(), lhs.getY() + rhs.getY(), lhs.getZ() + rhs.getZ());
+}
+
+// Differenciation between vectors
+constexpr Vector3D operator-(const Vector3D &lhs, const Vector3D &rhs) noexcept
+{
+    return Vector3D(lhs.getX() - rhs.getX(), lhs.getY() - rhs.getY(), lhs.getZ() - rhs.getZ());
+}
+
+// Scalar multiplication
+constexpr Vector3D operator*(const Vector3D &vec, const double &rhs) noexcept
+{
+    return Vector3D(vec.getX() * rhs, vec.getY() * rhs, vec.getZ() * rhs);
+}
+
+// Reverse scalar multiplication
+constexpr Vector3D operator*(const double &lhs, const Vector3D &vec) noexcept
+{
+    return Vector3D(lhs * vec.getX(), lhs * vec.getY(), lhs * vec.getZ());
+}
+
+// Scalar division
+constexpr Vector3D operator/(const Vector3D &vec, const double &rhs) noexcept
+{
+    return Vector3D(vec.getX() / rhs, vec.getY() / rhs, vec.getZ() / rhs);
+}
+#else
+// ============== EXPRESSION TEMPLATES ==============
+namespace Expression { // namespace Osl::Geometry::Expression
+
+// Operands are held by reference for vectors, by value for (temporary) expressions
+template <typename E> struct Operand { typedef const E type; };
+template <> struct Operand<Vector3D> { typedef const Vector3D &type; };
+
+template <typename E>
+class Negation : public Vector3DExpr<Negation<E>>
+{
+public:
+    constexpr explicit Negation(const E &e) noexcept : m_e(e) {}
+    constexpr double getX() const noexcept { return -m_e.getX(); }
+    constexpr double getY() const noexcept { return -m_e.getY(); }
+    constexpr double getZ() const noexcept { return -m_e.getZ(); }
+private:
+    typename Operand<E>::type m_e;
+};
+
+template <typename L, typename R>
+class Sum : public Vector3DExpr<Sum<L, R>>
+{
+public:
+    constexpr Sum(const L &l, const R &r) noexcept : m_l(l), m_r(r) {}
+    constexpr double getX() const noexcept { return m_l.getX() + m_r.getX(); }
+    constexpr double getY() const noexcept { return m_l.getY() + m_r.getY(); }
+    constexpr double getZ() const noexcept { return m_l.getZ() + m_r.getZ(); }
+private:
+    typename Operand<L>::type m_l;
+    typename Operand<R>::type m_r;
+};
+
+template <typename L, typename R>
+class Difference : public Vector3DExpr<Difference<L, R>>
+{
+public:
+    constexpr Difference(const L &l, const R &r) noexcept : m_l(l), m_r(r) {}
+    constexpr double getX() const noexcept { return m_l.getX() - m_r.getX(); }
+    constexpr double getY() const noexcept { return m_l.getY() - m_r.getY(); }
+    constexpr double getZ() const noexcept { return m_l.getZ() - m_r.getZ(); }
+private:
+    typename Operand<L>::type m_l;
+    typename Operand<R>::type m_r;
+};
+
+template <typename E>
+class Product : public Vector3DExpr<Product<E>>
+{
+public:
+    constexpr Product(const E &e, const double &s) noexcept : m_e(e), m_s(s) {}
+    constexpr double getX() const noexcept { return m_e.getX() * m_s; }
+    constexpr double getY() const noexcept { return m_e.getY() * m_s; }
+    constexpr double getZ() const noexcept { return m_e.getZ() * m_s; }
+private:
+    typename Operand<E>::type m_e;
+    double m_s;
+};
+
+template <typename E>
+class Quotient : public Vector3DExpr<Quotient<E>>
+{
+public:
+    constexpr Quotient(const E &e, const double &s) noexcept : m_e(e), m_s(s) {}
+    constexpr double getX() const noexcept { return m_e.getX() / m_s; }
+    constexpr double getY() const noexcept { return m_e.getY() / m_s; }
+    constexpr double getZ() const noexcept { return m_e.getZ() / m_s; }
+private:
+    typename Operand<E>::type m_e;
+    double m_s;
+};
+
+} // namespace Osl::Geometry::Expression
+
+// ============== ARITHMETIC OPERATORS ==============
+template <typename E>
+constexpr Expression::Negation<E> operator-(const Vector3DExpr<E> &e) noexcept
+{
+    return Expression::Negation<E>(e.self());
+}
+
+template <typename L, typename R>
+constexpr Expression::Sum<L, R> operator+(const Vector3DExpr<L> &l, const Vector3DExpr<R> &r) noexcept
+{
+    return Expression::Sum<L, R>(l.self(), r.self());
+}
+
+template <typename L, typename R>
+constexpr Expression::Difference<L, R> operator-(const Vector3DExpr<L> &l, const Vector3DExpr<R> &r) noexcept
+{
+    return Expression::Difference<L, R>(l.self(), r.self());
+}
+
+template <typename E>
+constexpr Expression::Product<E> operator*(const Vector3DExpr<E> &e, const double &rhs) noexcept
+{
+    return Expression::Product<E>(e.self(), rhs);
+}
+
+template <typename E>
+constexpr Expression::Product<E> operator*(const double &lhs, const Vector3DExpr<E> &e) noexcept
+{
+    return Expression::Product<E>(e.self(), lhs);
+}
+
+template <typename E>
+constexpr Expression::Quotient<E> operator/(const Vector3DExpr<E> &e, const double &rhs) noexcept
 {
-    return vec * lhs;
+    return Expression::Quotient<E>(e.self(), rhs);
 }
+#endif // OSL_VECTOR3D_EXPRESSION_TEMPLATES
 
 inline std::ostream &operator<<(std::ostream &os, const Vector3D &vec)
 {
@@ -165,10 +449,10 @@ inline std::ostream &operator<<(std::ostream &os, const Vector3D &vec)
 }
 
 // Definition of classical vectors
-inline static Vector3D NULL_VEC(0.0, 0.0, 0.0);
-inline static Vector3D XAXIS(1.0, 0.0, 0.0),
-                       YAXIS(0.0, 1.0, 0.0),
-                       ZAXIS(0.0, 0.0, 1.0);
+inline constexpr Vector3D NULL_VEC(0.0, 0.0, 0.0);
+inline constexpr Vector3D XAXIS(1.0, 0.0, 0.0),
+                          YAXIS(0.0, 1.0, 0.0),
+                          ZAXIS(0.0, 0.0, 1.0);
 
 //! A vector container of Vector3D
 typedef std::vector<Vector3D> vector3d;
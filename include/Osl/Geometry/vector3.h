@@ -8,6 +8,9 @@
 /*! ********************************************************************
  * \file Vector3.h
  * \brief Header file of Osl::Geometry::Vector3 class.
+ *
+ * The whole class is defined in this header (\em constexpr and
+ * \em noexcept arithmetic).
  *********************************************************************/
 
 namespace Osl { // namespace Osl
@@ -18,7 +21,7 @@ class Vector3
 {
 public:
     //! Default Constructor.
-    Vector3();
+    constexpr Vector3() noexcept {}
 
     //! Constructor taking the 3 parameters of the vector.
     /*!
@@ -27,128 +30,243 @@ public:
      * \param y
      * \param z
      */
-    Vector3(const double &x, const double &y, const double &z);
+    constexpr Vector3(const double &x, const double &y, const double &z) noexcept
+        : m_x(x), m_y(y), m_z(z) {}
 
     //! Copy constructor
     /*!
      * \brief Vector3
      * \param other
      */
-    Vector3(const Vector3 &other); // Copy constructor
-
-    //! Default Destructor
-    ~Vector3();
+    constexpr Vector3(const Vector3 &other) noexcept = default; // Copy constructor
 
     // ============== CLASS METHODS ==============
     // ********** SETTER **********
-    void setX(const double &x);
-    void setY(const double &y);
-    void setZ(const double &z);
-    void setCoordinates(const double &x, const double &y, const double &z);
+    constexpr void setX(const double &x) noexcept { m_x = x; }
+    constexpr void setY(const double &y) noexcept { m_y = y; }
+    constexpr void setZ(const double &z) noexcept { m_z = z; }
+    constexpr void setCoordinates(const double &x, const double &y, const double &z) noexcept
+    {
+        m_x = x;
+        m_y = y;
+        m_z = z;
+    }
     // ********** GETTER **********
-    double getX() const;
-    double getY() const;
-    double getZ() const;
-    void getCoordinates(double &x, double &y, double &z);
+    constexpr double getX() const noexcept { return m_x; }
+    constexpr double getY() const noexcept { return m_y; }
+    constexpr double getZ() const noexcept { return m_z; }
+    constexpr void getCoordinates(double &x, double &y, double &z) const noexcept
+    {
+        x = m_x;
+        y = m_y;
+        z = m_z;
+    }
 
     // ============== OPERATORS ==============
-    // Unary operators
-    void operator-();
+    // Unary operators (in-place)
+    constexpr void operator-() noexcept
+    {
+        m_x = -m_x;
+        m_y = -m_y;
+        m_z = -m_z;
+    }
     // Operations between vectors
-    Vector3 operator=(const Vector3 &other); // Assignement from another vector
-    Vector3 operator+(const Vector3 &other); // Summation between vectors
-    void operator+=(const Vector3 &other);
-    Vector3 operator-(const Vector3 &other); // Differenciation between vectors
-    void operator-=(const Vector3 &other);
+    constexpr Vector3 &operator=(const Vector3 &other) noexcept = default; // Assignement from another vector
+    constexpr Vector3 operator+(const Vector3 &other) const noexcept // Summation between vectors
+    {
+        return Vector3(m_x + other.m_x, m_y + other.m_y, m_z + other.m_z);
+    }
+    constexpr void operator+=(const Vector3 &other) noexcept
+    {
+        m_x += other.m_x;
+        m_y += other.m_y;
+        m_z += other.m_z;
+    }
+    constexpr Vector3 operator-(const Vector3 &other) const noexcept // Differenciation between vectors
+    {
+        return Vector3(m_x - other.m_x, m_y - other.m_y, m_z - other.m_z);
+    }
+    constexpr void operator-=(const Vector3 &other) noexcept
+    {
+        m_x -= other.m_x;
+        m_y -= other.m_y;
+        m_z -= other.m_z;
+    }
     // Scalar operations
-    Vector3 operator*(const double &rhs);    // Multiplication
-    void operator*=(const double &rhs);
-    Vector3 operator/(const double &rhs);    // Division
-    void operator/=(const double &rhs);
-    // Comparison operators
-    bool operator==(const Vector3 &other) const;
-    bool operator!=(const Vector3 &other) const;
+    constexpr Vector3 operator*(const double &rhs) const noexcept // Multiplication
+    {
+        return Vector3(m_x * rhs, m_y * rhs, m_z * rhs);
+    }
+    constexpr void operator*=(const double &rhs) noexcept
+    {
+        m_x *= rhs;
+        m_y *= rhs;
+        m_z *= rhs;
+    }
+    constexpr Vector3 operator/(const double &rhs) const noexcept // Division
+    {
+        return Vector3(m_x / rhs, m_y / rhs, m_z / rhs);
+    }
+    constexpr void operator/=(const double &rhs) noexcept
+    {
+        m_x /= rhs;
+        m_y /= rhs;
+        m_z /= rhs;
+    }
+    // Comparison operators (see Maths::Comparison::almost_equal)
+    constexpr bool operator==(const Vector3 &other) const noexcept
+    {
+        return Maths::Comparison::almost_equal(m_x, other.m_x) &&
+               Maths::Comparison::almost_equal(m_y, other.m_y) &&
+               Maths::Comparison::almost_equal(m_z, other.m_z);
+    }
+    constexpr bool operator!=(const Vector3 &other) const noexcept
+    {
+        return !(*this == other);
+    }
 
     // Copy of this vector
-    Vector3 clone();
+    constexpr Vector3 clone() const noexcept
+    {
+        return Vector3(m_x, m_y, m_z);
+    }
 
     // ============== VECTOR OPERATIONS ==============
     /*!
      * \brief norm2
      * \return
      */
-    double norm2() const;
+    constexpr double norm2() const noexcept
+    {
+        return m_x * m_x + m_y * m_y + m_z * m_z;
+    }
 
     /*!
      * \brief norm
      * \return
      */
-    double norm() const;
+    double norm() const noexcept
+    {
+        return std::hypot(m_x, m_y, m_z); // No overflow of the squares
+    }
 
     /*!
      * \brief sum
      * \return
      */
-    double sum() const;
+    constexpr double sum() const noexcept
+    {
+        return m_x + m_y + m_z;
+    }
 
     /*!
      * \brief isNull
      * \return
      */
-    bool isNull() const;
+    constexpr bool isNull() const noexcept
+    {
+        return Maths::Comparison::almost_equal(m_x, 0.0) &&
+               Maths::Comparison::almost_equal(m_y, 0.0) &&
+               Maths::Comparison::almost_equal(m_z, 0.0);
+    }
 
     /*!
      * \brief In-place normalization of this vector.
      * \note If this vector is the null vector, it is returned without warning.
      * \sa normalized()
      */
-    void normalize();
+    void normalize() noexcept
+    {
+        double norm = this->norm();
+        if (norm > 0.0)
+        {
+            m_x /= norm;
+            m_y /= norm;
+            m_z /= norm;
+        }
+    }
 
     // Vector / Vector operations
     /*!
      * \brief dotProduct
      * \return the result of the dot product between this vector and another
      */
-    double dotProduct(const Vector3 &other);       // dot product
+    constexpr double dotProduct(const Vector3 &other) const noexcept // dot product
+    {
+        return m_x * other.m_x + m_y * other.m_y + m_z * other.m_z;
+    }
 
     /*!
      * \brief crossProduct
      * \return the resulting vector of the cross product between this vector and another
      */
-    void crossProduct(const Vector3 &other); // Cross product
+    constexpr void crossProduct(const Vector3 &other) noexcept // Cross product
+    {
+        double x = m_y * other.m_z - m_z * other.m_y,
+               y = m_z * other.m_x - m_x * other.m_z,
+               z = m_x * other.m_y - m_y * other.m_x;
+        m_x = x;
+        m_y = y;
+        m_z = z;
+    }
 
     /*!
      * \brief projectOn
      * \return the projection of this vector onto another one
      * \sa <a href="https://en.wikipedia.org/wiki/Vector_projection">WIKI</a>
      */
-    void projectOn(const Vector3 &other);    // Projection of this vector onto another one
+    constexpr void projectOn(const Vector3 &other) noexcept // Projection of this vector onto another one
+    {
+        double norm2 = other.norm2();
+        if (norm2 > 0.0)
+        {
+            double f = this->dotProduct(other) / norm2;
+            m_x = f * other.m_x;
+            m_y = f * other.m_y;
+            m_z = f * other.m_z;
+        }
+    }
 
     /*!
      * \brief rejectFrom
      * \return the rejection of this vector from another one
      * \sa <a href="https://en.wikipedia.org/wiki/Vector_projection">WIKI</a>
      */
-    void rejectFrom(const Vector3 &other);   // Rejection of this vector from another one
+    constexpr void rejectFrom(const Vector3 &other) noexcept // Rejection of this vector from another one
+    {
+        double x = m_x, y = m_y, z = m_z; // We keep old coordinates
+        this->projectOn(other);
+        m_x = x - m_x;
+        m_y = y - m_y;
+        m_z = z - m_z;
+    }
 
     /*!
      * \brief isColinear
      * \return true if this vector is colinear to another one, else return false.
      */
-    bool isColinear(const Vector3 &other); // Is this vector colinear to another
+    constexpr bool isColinear(const Vector3 &other) const noexcept // Is this vector colinear to another
+    {
+        Vector3 tmp = this->clone();
+        tmp.crossProduct(other);
+        return tmp.isNull();
+    }
 
     /*!
      * \brief isColinear
      * \return true if this vector is perpendicular to another one, else return false.
      */
-    bool isPerpendicular(const Vector3 &other); // Is this vector perpendicular to another
+    constexpr bool isPerpendicular(const Vector3 &other) const noexcept // Is this vector perpendicular to another
+    {
+        return Maths::Comparison::almost_equal(this->dotProduct(other), 0.0);
+    }
 
 private:
     double m_x = 0.0, m_y = 0.0, m_z = 0.0; // Default vector to null vector
 };
 
 // Reverse scalar multiplication (made global to the class)
-inline Vector3 operator*(double lhs, Vector3 vec)
+constexpr Vector3 operator*(const double &lhs, const Vector3 &vec) noexcept
 {
     return vec * lhs;
 }
@@ -160,10 +278,10 @@ inline std::ostream &operator<<(std::ostream &os, const Vector3 &vec)
 }
 
 // Definition of classical vectors
-inline static Vector3 NULL_VEC;
-inline static Vector3 XAXIS(1.0, 0.0, 0.0),
-                      YAXIS(0.0, 1.0, 0.0),
-                      ZAXIS(0.0, 0.0, 1.0);
+inline constexpr Vector3 NULL_VEC;
+inline constexpr Vector3 XAXIS(1.0, 0.0, 0.0),
+                         YAXIS(0.0, 1.0, 0.0),
+                         ZAXIS(0.0, 0.0, 1.0);
 
 } // namespace Osl::Geometry
 
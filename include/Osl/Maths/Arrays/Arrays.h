@@ -12,5 +12,6 @@
 #include "linspace.h"
 #include "logspace.h"
 #include "regspace.h"
+#include "is_regspaced.h"
 
 #endif // OSL_MATHS_ARRAYS_H
@@ -0,0 +1,61 @@
+/*! ********************************************************************
+ * \file is_regspaced.h
+ * \brief Header file for Osl::Maths::Arrays::is_regspaced function.
+ *
+ * This header provides a convenient function to check whether a
+ * vector is regularly spaced.
+ *********************************************************************/
+
+#ifndef OSL_MATHS_ARRAYS_IS_REGSPACED_H
+#define OSL_MATHS_ARRAYS_IS_REGSPACED_H
+
+#include "Osl/Globals.h"
+
+namespace Osl { // Osl namespace
+
+namespace  Maths { // Osl::Maths namespace
+
+namespace  Arrays { // Osl::Maths::Arrays namespace
+
+/*! ********************************************************************
+ * \brief Check whether a vector is regularly spaced.
+ *
+ * The vector \f$x\f$ of size \f$N\f$ is considered as regularly spaced
+ * when each of its values matches
+ *
+ * \f[
+ *     x[i]=x[0]+i\Delta x,\quad\Delta x=\dfrac{x[N-1]-x[0]}{N-1}
+ * \f]
+ *
+ * within a relative tolerance of the vector span \f$x[N-1]-x[0]\f$.
+ *
+ * \param [in] x the vector to be checked (of size at least 2).
+ * \param [out] delta the regular spacing \f$\Delta x\f$ (only meaningful
+ *              when the function returns true).
+ * \param [in] rtol the relative tolerance. Default to 1e-10.
+ * \returns true if x is regularly spaced, false otherwise.
+ *********************************************************************/
+inline bool is_regspaced(const vector &x, double &delta, const double &rtol=1e-10)
+{
+    std::size_t n = x.size();
+    if (n < 2)
+        return false;
+    double x0 = x.front(),
+           span = x.back() - x0,
+           tol = rtol * std::abs(span);
+    delta = span / static_cast<double>(n - 1);
+    for (std::size_t i = 1 ; i < n - 1 ; ++i)
+    {
+        if (std::abs(x[i] - (x0 + static_cast<double>(i) * delta)) > tol)
+            return false;
+    }
+    return delta != 0.0;
+}
+
+} // namespace Osl::Maths::Arrays
+
+} // namespace Osl::Maths
+
+} // namespace Osl
+
+#endif // OSL_MATHS_ARRAYS_IS_REGSPACED_H
@@ -34,9 +34,11 @@ namespace Comparison { // Osl::Maths::Comparison namespace
  * \returns true if x and y are equal in a machine sense, false otherwise.
  * \sa bool almost_equal(complex x, complex y)
  *********************************************************************/
-inline bool almost_equal(double x, double y)
+constexpr bool almost_equal(double x, double y) noexcept
 {
-    return std::abs(x - y) <= Constants::n_machine_res;
+    // |x - y| <= res, written without std::abs to be usable in constant
+    // expressions (false if x or y is NaN)
+    return (x - y <= Constants::n_machine_res) && (y - x <= Constants::n_machine_res);
 }
 
 /*! ********************************************************************
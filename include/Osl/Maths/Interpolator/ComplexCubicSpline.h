@@ -7,7 +7,9 @@
 #ifndef OSL_MATHS_INTERPOLATOR_COMPLEXCUBICSPLINE_H
 #define OSL_MATHS_INTERPOLATOR_COMPLEXCUBICSPLINE_H
 
+#include <algorithm>
 #include "Osl/Globals.h"
+#include "Osl/Maths/Arrays/is_regspaced.h"
 #include "Osl/Constants.h"
 #include "InterpolatorEnum.h"
 
@@ -252,6 +254,14 @@ namespace Interpolator { // Osl::Maths::Interpolator namespace
  *         \end{pmatrix}
  *     \f]
  *
+ * <h3>Memory layout</h3>
+ *
+ * The four complex coefficients \f$(a_k,b_k,c_k,d_k)\f$ of each
+ * interpolation function are packed in a 64 bytes aligned structure, so
+ * that they are read from a single cache line. The nodes \f$x_k\f$ are
+ * kept apart (they are the values read by the binary search), and are not
+ * stored for an evenly spaced axis.
+ *
  * \sa CubicSpline a cubic spline interpolator class
  *     for real data.
  *********************************************************************/
@@ -310,6 +320,15 @@ public:
      *********************************************************************/
     vector getX() const;
 
+    /*! ********************************************************************
+     * \brief Get whether the x axis is evenly spaced.
+     * \returns true if the x axis provided at construction is evenly
+     *          spaced, false otherwise. In that case the x axis is not
+     *          stored and the index of interpolation is computed in
+     *          \f$O(1)\f$ instead of being searched.
+     *********************************************************************/
+    bool isUniform() const;
+
     /*! ********************************************************************
      * \brief Get the interpolator complex coefficients.
      * \param [out] a A vector containing the \f$a_k\f$ coefficients of the
@@ -499,11 +518,108 @@ public:
      *********************************************************************/
     std::size_t search_index_for_interpolation(const double &xeval);
 
+    // =========== BATCH EVALUATION ===========
+    /*! ********************************************************************
+     * \brief Evaluate the function at a set of points.
+     *
+     * Indices of the interpolation functions are searched by blocks, then
+     * the polynomials are evaluated with Horner's scheme in a vectorized
+     * loop.
+     *
+     * \param [in] x a pointer to the \f$n\f$ values at which the function is
+     *             evaluated.
+     * \param [out] y a pointer to the \f$n\f$ interpolated values of the
+     *              function.
+     * \param [in] n the number of values to evaluate.
+     * \param [in] sorted whether \em x is in increasing order or not. If
+     *             true, indices are found with a monotone merge-walk along
+     *             the reference axis instead of one binary search per value.
+     *             Default to false.
+     * \note This function call doesn't make bound checkings.
+     *********************************************************************/
+    void evaluate(const double *x, complex *y, std::size_t n, bool sorted=false);
+
+    /*! ********************************************************************
+     * \brief Evaluate the function and its first derivative at a set of
+     *        points.
+     * \param [in] x a pointer to the \f$n\f$ values at which the function is
+     *             evaluated.
+     * \param [out] y a pointer to the \f$n\f$ interpolated values of the
+     *              function.
+     * \param [out] yp a pointer to the \f$n\f$ interpolated values of the
+     *              first derivative of the function.
+     * \param [in] n the number of values to evaluate.
+     * \param [in] sorted whether \em x is in increasing order or not.
+     *             Default to false.
+     * \note This function call doesn't make bound checkings.
+     *********************************************************************/
+    void evaluate(const double *x, complex *y, complex *yp, std::size_t n,
+                  bool sorted=false);
+
+    /*! ********************************************************************
+     * \brief Evaluate the function, its first and second derivatives at a
+     *        set of points.
+     * \param [in] x a pointer to the \f$n\f$ values at which the function is
+     *             evaluated.
+     * \param [out] y a pointer to the \f$n\f$ interpolated values of the
+     *              function.
+     * \param [out] yp a pointer to the \f$n\f$ interpolated values of the
+     *              first derivative of the function.
+     * \param [out] ypp a pointer to the \f$n\f$ interpolated values of the
+     *              second derivative of the function.
+     * \param [in] n the number of values to evaluate.
+     * \param [in] sorted whether \em x is in increasing order or not.
+     *             Default to false.
+     * \note This function call doesn't make bound checkings.
+     *********************************************************************/
+    void evaluate(const double *x, complex *y, complex *yp, complex *ypp,
+                  std::size_t n, bool sorted=false);
+
+    /*! ********************************************************************
+     * \brief Evaluate the function at a set of points.
+     * \param [in] x the values at which the function is evaluated.
+     * \param [out] y the interpolated values of the function (resized to
+     *              the size of \em x).
+     * \param [in] sorted whether \em x is in increasing order or not.
+     *             Default to false.
+     * \note This function call doesn't make bound checkings.
+     *********************************************************************/
+    void evaluate(const vector &x, cvector &y, bool sorted=false);
+
+    /*! ********************************************************************
+     * \brief Search the indices for spline interpolation of a set of values.
+     * \param [in] xeval a pointer to the \f$n\f$ values for which the
+     *             indices are searched.
+     * \param [out] index a pointer to the \f$n\f$ found indices.
+     * \param [in] n the number of values.
+     * \param [in] sorted whether \em xeval is in increasing order or not.
+     *             If true, a single binary search is made for the first
+     *             value and the index is then moved forward along the
+     *             reference axis. Default to false.
+     * \sa search_index_for_interpolation
+     *********************************************************************/
+    void search_indices_for_interpolation(const double *xeval, std::size_t *index,
+                                          std::size_t n, bool sorted=false);
+
 private:
     double m_xmin, m_xmax;              // Min and max value of interpolation
-    vector m_x;                         // Provided axis for interpolation
-    cvector m_a, m_b, m_c, m_d;          // Interpolation coefficients of complex function
+    vector m_x;                         // Provided axis for interpolation (empty if evenly spaced)
+    bool m_uniform = false;             // Whether x axis is evenly spaced
+    double m_dx, m_inv_dx;              // Spacing of evenly spaced x axis and its inverse
+    // Interpolation coefficients of a segment, packed in a single cache line
+    struct alignas(64) Segment
+    {
+        complex a, b, c, d;
+    };
+    std::vector<Segment> m_seg;         // Segments of the interpolator
     std::size_t m_n;                    // Size of coefficients vectors
+
+
+    // Get the x axis value at index
+    double x_node(const std::size_t &index) const
+    {
+        return m_uniform ? m_xmin + static_cast<double>(index) * m_dx : m_x[index];
+    }
 };
 
 } // namespace Osl::Maths::Interpolator
@@ -5,6 +5,7 @@
  *********************************************************************/
 
 #include "ComplexLinearSpline.h"
+#include "Osl/Batch.h"
 
 namespace Osl { // Osl namespace
 
@@ -39,15 +40,19 @@ ComplexLinearSpline::ComplexLinearSpline(const vector &x, const cvector &y)
     m_xmin = x.front();
     m_xmax = x.back();
 
-    // Setting provided x axis
-    m_x = x;
+    // Setting provided x axis (only stored if not evenly spaced)
+    m_uniform = Arrays::is_regspaced(x, m_dx);
+    if (m_uniform)
+        m_inv_dx = 1.0 / m_dx;
+    else
+        m_x = x;
 
     // Setting size of x axis and coefficients vectors
     m_n = xsize - 1;
 
     // Initialization of coefficients vectors
-    m_a.reserve(m_n);
-    m_b.reserve(m_n);
+    m_a.resize(m_n);
+    m_b.resize(m_n);
 
     // Linear interpolator coefficients
     for (std::size_t i = 0 ; i < m_n ; ++i)
@@ -61,6 +66,7 @@ ComplexLinearSpline::ComplexLinearSpline(const vector &x, const cvector &y)
 ComplexLinearSpline::ComplexLinearSpline(const ComplexLinearSpline &other)
     : m_xmin(other.m_xmin), m_xmax(other.m_xmax),
       m_x(other.m_x),
+      m_uniform(other.m_uniform), m_dx(other.m_dx), m_inv_dx(other.m_inv_dx),
       m_a(other.m_a), m_b(other.m_b),
       m_n(other.m_n) {}
 
@@ -71,7 +77,16 @@ ComplexLinearSpline::~ComplexLinearSpline(){}
 // *************** GETTER ***************
 double ComplexLinearSpline::getXmin() const { return m_xmin; }
 double ComplexLinearSpline::getXmax() const { return m_xmax; }
-vector ComplexLinearSpline::getX() const { return m_x; }
+vector ComplexLinearSpline::getX() const
+{
+    if (!m_uniform)
+        return m_x;
+    vector x(m_n + 1);
+    for (std::size_t i = 0 ; i <= m_n ; ++i)
+        x[i] = this->x_node(i);
+    return x;
+}
+bool ComplexLinearSpline::isUniform() const { return m_uniform; }
 void ComplexLinearSpline::getCoeffs(cvector &a, cvector &b)
 {
     a.resize(m_n);
@@ -96,6 +111,9 @@ ComplexLinearSpline ComplexLinearSpline::operator=(const ComplexLinearSpline &ot
     m_xmin = other.m_xmin;
     m_xmax = other.m_xmax;
     m_x = other.m_x;
+    m_uniform = other.m_uniform;
+    m_dx = other.m_dx;
+    m_inv_dx = other.m_inv_dx;
     m_a = other.m_a;
     m_b = other.m_b;
     m_n = other.m_n;
@@ -107,12 +125,12 @@ void ComplexLinearSpline::operator()(const double &x, complex &y)
 {
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
-    y = m_a[index] * (x - m_x[index]) + m_b[index];
+    y = m_a[index] * (x - this->x_node(index)) + m_b[index];
 }
 
 void ComplexLinearSpline::operator()(const double &x, const std::size_t &index, complex &y)
 {
-    y = m_a[index] * (x - m_x[index]) + m_b[index];
+    y = m_a[index] * (x - this->x_node(index)) + m_b[index];
 }
 
 // =========== LINEAR SPLINE METHODS ===========
@@ -125,15 +143,27 @@ complex ComplexLinearSpline::at(const double &x, bool extrapolate)
                                     "to 'true'.");
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
-    return m_a[index] * (x - m_x[index]) + m_b[index];
+    return m_a[index] * (x - this->x_node(index)) + m_b[index];
 }
 
 std::size_t ComplexLinearSpline::search_index_for_interpolation(const double &xeval)
 {
     if (xeval >= m_xmax)
         return m_n - 1;
-    if (xeval <= m_xmin)
+    if (!(xeval > m_xmin)) // NaN included
         return 0;
+    if (m_uniform)
+    {
+        std::size_t i = static_cast<std::size_t>(std::min((xeval - m_xmin) * m_inv_dx,
+                                                          static_cast<double>(m_n - 1)));
+        // The rounding of the quotient may give the neighbouring segment
+        // for a value at a knot
+        if ((i + 1 < m_n) && (xeval >= this->x_node(i + 1)))
+            return i + 1;
+        if ((i > 0) && (xeval < this->x_node(i)))
+            return i - 1;
+        return i;
+    }
     std::size_t left=0, right=m_n, mid;
     while (right - left > 1)
     {
@@ -146,6 +176,94 @@ std::size_t ComplexLinearSpline::search_index_for_interpolation(const double &xe
     return left; // We want the value <= x0
 }
 
+// =========== BATCH EVALUATION ===========
+void ComplexLinearSpline::evaluate(const double *x, complex *y,
+                                   std::size_t n, bool sorted)
+{
+    std::size_t index[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        const double *xb = x + k0;
+        complex *yb = y + k0;
+        this->search_indices_for_interpolation(xb, index, nb, sorted);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
+        {
+            std::size_t i = index[k];
+            double dx = xb[k] - this->x_node(i);
+            yb[k] = m_a[i] * dx + m_b[i];
+        }
+    }
+}
+
+void ComplexLinearSpline::evaluate(const double *x, complex *y, complex *yp,
+                                   std::size_t n, bool sorted)
+{
+    std::size_t index[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        const double *xb = x + k0;
+        complex *yb = y + k0, *ypb = yp + k0;
+        this->search_indices_for_interpolation(xb, index, nb, sorted);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
+        {
+            std::size_t i = index[k];
+            double dx = xb[k] - this->x_node(i);
+            complex a = m_a[i];
+            yb[k] = a * dx + m_b[i];
+            ypb[k] = a;
+        }
+    }
+}
+
+void ComplexLinearSpline::evaluate(const vector &x, cvector &y, bool sorted)
+{
+    y.resize(x.size());
+    this->evaluate(x.data(), y.data(), x.size(), sorted);
+}
+
+void ComplexLinearSpline::search_indices_for_interpolation(const double *xeval,
+                                                           std::size_t *index,
+                                                           std::size_t n, bool sorted)
+{
+    if (n == 0)
+        return;
+    if (m_uniform)
+    {
+        double last = static_cast<double>(m_n - 1);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < n ; ++k)
+        {
+            double u = (xeval[k] - m_xmin) * m_inv_dx;
+            u = (u >= 0.0) ? u : 0.0; // NaN included
+            std::size_t i = static_cast<std::size_t>((u <= last) ? u : last);
+            // Same correction at the knots as search_index_for_interpolation()
+            i += ((i + 1 < m_n) && (xeval[k] >= m_xmin + static_cast<double>(i + 1) * m_dx));
+            i -= ((i > 0) && (xeval[k] < m_xmin + static_cast<double>(i) * m_dx));
+            index[k] = i;
+        }
+        return;
+    }
+    if (!sorted)
+    {
+        for (std::size_t k = 0 ; k < n ; ++k)
+            index[k] = this->search_index_for_interpolation(xeval[k]);
+        return;
+    }
+    // Monotone merge-walk: a single binary search, then the index is only
+    // moved forward along the reference axis.
+    std::size_t i = this->search_index_for_interpolation(xeval[0]),
+                last = m_n - 1;
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        while ((i < last) && (xeval[k] >= m_x[i+1]))
+            ++i;
+        index[k] = i;
+    }
+}
 
 } // namespace Osl::Maths::Interpolator
 
@@ -5,6 +5,7 @@
  *********************************************************************/
 
 #include "ComplexQuadraticSpline.h"
+#include "Osl/Batch.h"
 
 namespace Osl { // Osl namespace
 
@@ -20,6 +21,7 @@ ComplexQuadraticSpline::ComplexQuadraticSpline(){}
 ComplexQuadraticSpline::ComplexQuadraticSpline(const ComplexQuadraticSpline &other)
     : m_xmin(other.m_xmin), m_xmax(other.m_xmax),
       m_x(other.m_x),
+      m_uniform(other.m_uniform), m_dx(other.m_dx), m_inv_dx(other.m_inv_dx),
       m_a(other.m_a), m_b(other.m_b), m_c(other.m_c),
       m_n(other.m_n) {}
 
@@ -48,16 +50,20 @@ ComplexQuadraticSpline::ComplexQuadraticSpline(const vector &x, const cvector &y
     m_xmin = x.front();
     m_xmax = x.back();
 
-    // Setting provided x axis
-    m_x = x;
+    // Setting provided x axis (only stored if not evenly spaced)
+    m_uniform = Arrays::is_regspaced(x, m_dx);
+    if (m_uniform)
+        m_inv_dx = 1.0 / m_dx;
+    else
+        m_x = x;
 
     // Setting size of x axis and coefficients vectors
     m_n = xsize - 1;
 
     // Initialization of coefficients vectors
-    m_a.reserve(m_n);
-    m_b.reserve(m_n);
-    m_c.reserve(m_n);
+    m_a.resize(m_n);
+    m_b.resize(m_n);
+    m_c.resize(m_n);
 
     switch (bc)
     {
@@ -107,7 +113,16 @@ ComplexQuadraticSpline::~ComplexQuadraticSpline(){}
 // *************** GETTER ***************
 double ComplexQuadraticSpline::getXmin() const { return m_xmin; }
 double ComplexQuadraticSpline::getXmax() const { return m_xmax; }
-vector ComplexQuadraticSpline::getX() const { return m_x; }
+vector ComplexQuadraticSpline::getX() const
+{
+    if (!m_uniform)
+        return m_x;
+    vector x(m_n + 1);
+    for (std::size_t i = 0 ; i <= m_n ; ++i)
+        x[i] = this->x_node(i);
+    return x;
+}
+bool ComplexQuadraticSpline::isUniform() const { return m_uniform; }
 void ComplexQuadraticSpline::getCoeffs(cvector &a, cvector &b, cvector &c)
 {
     a.resize(m_n);
@@ -135,6 +150,9 @@ ComplexQuadraticSpline ComplexQuadraticSpline::operator=(const ComplexQuadraticS
     m_xmin = other.m_xmin;
     m_xmax = other.m_xmax;
     m_x = other.m_x;
+    m_uniform = other.m_uniform;
+    m_dx = other.m_dx;
+    m_inv_dx = other.m_inv_dx;
     m_a = other.m_a;
     m_b = other.m_b;
     m_c = other.m_c;
@@ -147,7 +165,7 @@ void ComplexQuadraticSpline::operator()(const double &x, complex &y)
 {
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     y = m_a[index] * dx * dx + m_b[index] * dx + m_c[index];
 }
 
@@ -155,7 +173,7 @@ void ComplexQuadraticSpline::operator()(const double &x, complex &y, complex &yp
 {
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     complex a = m_a[index], b = m_b[index];
     y = a * dx * dx + b * dx + m_c[index];
     yp = 2.0 * a * dx + b;
@@ -164,14 +182,14 @@ void ComplexQuadraticSpline::operator()(const double &x, complex &y, complex &yp
 void ComplexQuadraticSpline::operator()(const double &x, const std::size_t &index,
                                         complex &y)
 {
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     y = m_a[index] * dx * dx + m_b[index] * dx + m_c[index];
 }
 
 void ComplexQuadraticSpline::operator()(const double &x, const std::size_t &index,
                                         complex &y, complex &yp)
 {
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     complex a = m_a[index], b = m_b[index];
     y = a * dx * dx + b * dx + m_c[index];
     yp = 2.0 * a * dx + b;
@@ -188,7 +206,7 @@ complex ComplexQuadraticSpline::at(const double &x, bool extrapolate)
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
     // Compute the interpolated value
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     return m_a[index] * dx * dx + m_b[index] * dx + m_c[index];
 }
 
@@ -202,15 +220,27 @@ complex ComplexQuadraticSpline::prime(const double &x, bool extrapolate)
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
     // Compute the interpolated value
-    return 2.0 * m_a[index] * (x - m_x[index]) + m_b[index];
+    return 2.0 * m_a[index] * (x - this->x_node(index)) + m_b[index];
 }
 
 std::size_t ComplexQuadraticSpline::search_index_for_interpolation(const double &xeval)
 {
     if (xeval >= m_xmax)
         return m_n - 1;
-    if (xeval <= m_xmin)
+    if (!(xeval > m_xmin)) // NaN included
         return 0;
+    if (m_uniform)
+    {
+        std::size_t i = static_cast<std::size_t>(std::min((xeval - m_xmin) * m_inv_dx,
+                                                          static_cast<double>(m_n - 1)));
+        // The rounding of the quotient may give the neighbouring segment
+        // for a value at a knot
+        if ((i + 1 < m_n) && (xeval >= this->x_node(i + 1)))
+            return i + 1;
+        if ((i > 0) && (xeval < this->x_node(i)))
+            return i - 1;
+        return i;
+    }
     std::size_t left=0, right=m_n, mid;
     while (right - left > 1)
     {
@@ -223,6 +253,96 @@ std::size_t ComplexQuadraticSpline::search_index_for_interpolation(const double
     return left; // We want the value <= x0
 }
 
+// =========== BATCH EVALUATION ===========
+void ComplexQuadraticSpline::evaluate(const double *x, complex *y,
+                                      std::size_t n, bool sorted)
+{
+    std::size_t index[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        const double *xb = x + k0;
+        complex *yb = y + k0;
+        this->search_indices_for_interpolation(xb, index, nb, sorted);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
+        {
+            std::size_t i = index[k];
+            double dx = xb[k] - this->x_node(i);
+            complex a = m_a[i], b = m_b[i];
+            yb[k] = (a * dx + b) * dx + m_c[i];
+        }
+    }
+}
+
+void ComplexQuadraticSpline::evaluate(const double *x, complex *y, complex *yp,
+                                      std::size_t n, bool sorted)
+{
+    std::size_t index[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        const double *xb = x + k0;
+        complex *yb = y + k0, *ypb = yp + k0;
+        this->search_indices_for_interpolation(xb, index, nb, sorted);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
+        {
+            std::size_t i = index[k];
+            double dx = xb[k] - this->x_node(i);
+            complex a = m_a[i], b = m_b[i];
+            yb[k] = (a * dx + b) * dx + m_c[i];
+            ypb[k] = 2.0 * a * dx + b;
+        }
+    }
+}
+
+void ComplexQuadraticSpline::evaluate(const vector &x, cvector &y, bool sorted)
+{
+    y.resize(x.size());
+    this->evaluate(x.data(), y.data(), x.size(), sorted);
+}
+
+void ComplexQuadraticSpline::search_indices_for_interpolation(const double *xeval,
+                                                              std::size_t *index,
+                                                              std::size_t n, bool sorted)
+{
+    if (n == 0)
+        return;
+    if (m_uniform)
+    {
+        double last = static_cast<double>(m_n - 1);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < n ; ++k)
+        {
+            double u = (xeval[k] - m_xmin) * m_inv_dx;
+            u = (u >= 0.0) ? u : 0.0; // NaN included
+            std::size_t i = static_cast<std::size_t>((u <= last) ? u : last);
+            // Same correction at the knots as search_index_for_interpolation()
+            i += ((i + 1 < m_n) && (xeval[k] >= m_xmin + static_cast<double>(i + 1) * m_dx));
+            i -= ((i > 0) && (xeval[k] < m_xmin + static_cast<double>(i) * m_dx));
+            index[k] = i;
+        }
+        return;
+    }
+    if (!sorted)
+    {
+        for (std::size_t k = 0 ; k < n ; ++k)
+            index[k] = this->search_index_for_interpolation(xeval[k]);
+        return;
+    }
+    // Monotone merge-walk: a single binary search, then the index is only
+    // moved forward along the reference axis.
+    std::size_t i = this->search_index_for_interpolation(xeval[0]),
+                last = m_n - 1;
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        while ((i < last) && (xeval[k] >= m_x[i+1]))
+            ++i;
+        index[k] = i;
+    }
+}
+
 } // namespace Osl::Maths::Interpolator
 
 } // namespace Osl::Maths
@@ -0,0 +1,160 @@
+/*! ********************************************************************
+ * \file ComplexWindowedSinc.cpp
+ * \brief Source file of Osl::Maths::Interpolator::ComplexWindowedSinc class.
+ *********************************************************************/
+
+#include "ComplexWindowedSinc.h"
+
+namespace Osl { // Osl namespace
+
+namespace Maths { // Osl::Maths namespace
+
+namespace Interpolator { // Osl::Maths::Interpolator namespace
+
+// ============== COMPLEX WINDOWED SINC INTERPOLATOR ==============
+// ============== CONSTRUCTOR ==============
+ComplexWindowedSinc::ComplexWindowedSinc(){}
+
+// Copy constructor
+ComplexWindowedSinc::ComplexWindowedSinc(const ComplexWindowedSinc &other)
+    : m_xmin(other.m_xmin), m_xmax(other.m_xmax),
+      m_inv_dx(other.m_inv_dx),
+      m_y(other.m_y),
+      m_n(other.m_n),
+      m_kernel(other.m_kernel){}
+
+//
+ComplexWindowedSinc::ComplexWindowedSinc(const vector &x, const cvector &y,
+                           std::size_t halfWidth, SincWindow window,
+                           std::size_t oversampling, double beta)
+    : m_kernel(halfWidth, window, oversampling, beta)
+{
+    this->setPoints(x, y);
+}
+
+// ============== DESTRUCTOR ==============
+ComplexWindowedSinc::~ComplexWindowedSinc(){}
+
+// ============== CLASS METHODS ==============
+// *************** GETTER ***************
+double ComplexWindowedSinc::getXmin() const { return m_xmin; }
+double ComplexWindowedSinc::getXmax() const { return m_xmax; }
+const SincKernel &ComplexWindowedSinc::getKernel() const { return m_kernel; }
+
+// *************** SETTER ***************
+void ComplexWindowedSinc::setPoints(const vector &x, const cvector &y)
+{
+    // Assertions
+        // Checking that at least 2 points are provided
+    std::size_t xsize(x.size()), ysize(y.size());
+    if (xsize < 2)
+        throw std::invalid_argument("ComplexWindowedSinc constructor:\n"
+                                    "\t'x' and 'y' must be of size at least 2.");
+    if (xsize != ysize)
+        throw std::invalid_argument("ComplexWindowedSinc constructor:\n"
+                                    "\t'x' and 'y' must have same size.");
+        // Checking that 'x' is in strictly increasing order.
+    for (vector::const_iterator it = x.begin() ; it != x.end() - 1 ; ++it)
+    {
+        if (*it >= *(it+1))
+            throw std::invalid_argument("ComplexWindowedSinc constructor:\n"
+                                        "\t'x' vector must be in strictly increasing order.");
+    }
+        // Checking that 'x' is evenly spaced
+    double dx;
+    if (!Arrays::is_regspaced(x, dx))
+        throw std::invalid_argument("ComplexWindowedSinc constructor:\n"
+                                    "\t'x' vector must be evenly spaced.");
+
+    // Getting min and max values of interpolator
+    m_xmin = x.front();
+    m_xmax = x.back();
+
+    // Setting provided y values
+    m_y = y;
+
+    // inverse of xaxis variation
+    m_inv_dx = 1.0 / dx;
+    //
+    m_n = xsize;
+}
+
+// ============== OPERATORS ==============
+// Assignement from another ComplexWindowedSinc
+ComplexWindowedSinc ComplexWindowedSinc::operator=(const ComplexWindowedSinc &other)
+{
+    m_xmin = other.m_xmin;
+    m_xmax = other.m_xmax;
+    m_inv_dx = other.m_inv_dx;
+    m_y = other.m_y;
+    m_n = other.m_n;
+    m_kernel = other.m_kernel;
+    return *this;
+}
+
+// Function call
+void ComplexWindowedSinc::operator()(const double &x, complex &y) const
+{
+    // Reduced abscissa u = i0 + delta
+    double u = (x - m_xmin) * m_inv_dx;
+    // Undefined abscissa: no conversion of NaN or infinity to an index
+    if (!std::isfinite(u))
+    {
+        y = complex(std::numeric_limits<double>::quiet_NaN(),
+                    std::numeric_limits<double>::quiet_NaN());
+        return;
+    }
+    std::ptrdiff_t taps = static_cast<std::ptrdiff_t>(m_kernel.getTaps()),
+                   n = static_cast<std::ptrdiff_t>(m_n);
+    // No sample within the kernel support (this also keeps the index below
+    // in range for huge abscissas)
+    if ((u <= -static_cast<double>(taps)) || (u >= static_cast<double>(n + taps)))
+    {
+        y = 0.0;
+        return;
+    }
+    double fl = std::floor(u),
+           alpha;
+    std::ptrdiff_t k0 = static_cast<std::ptrdiff_t>(fl) + 1
+                      - static_cast<std::ptrdiff_t>(m_kernel.getHalfWidth());
+    // Both tabulated phases are applied to the samples, then linearly
+    // interpolated: this avoids building the weights for each call.
+    const double *w0 = m_kernel.phase(u - fl, alpha),
+                 *w1 = w0 + taps;
+    // Real and imaginary parts are accumulated separately to keep the
+    // reduction vectorizable.
+    double s0r = 0.0, s0i = 0.0, s1r = 0.0, s1i = 0.0;
+    std::ptrdiff_t tmin = std::max<std::ptrdiff_t>(0, -k0),
+                   tmax = std::min<std::ptrdiff_t>(taps, n - k0);
+    const double *yd = reinterpret_cast<const double*>(m_y.data()); // Interleaved (re, im)
+    // Samples outside of the data are taken as null
+    #pragma omp simd reduction(+:s0r,s0i,s1r,s1i)
+    for (std::ptrdiff_t t = tmin ; t < tmax ; ++t)
+    {
+        std::ptrdiff_t k = 2 * (k0 + t);
+        s0r += w0[t] * yd[k];
+        s0i += w0[t] * yd[k+1];
+        s1r += w1[t] * yd[k];
+        s1i += w1[t] * yd[k+1];
+    }
+    y = complex(s0r + alpha * (s1r - s0r), s0i + alpha * (s1i - s0i));
+}
+
+// =========== COMPLEX WINDOWED SINC METHODS ===========
+complex ComplexWindowedSinc::at(const double &x, bool extrapolate) const
+{
+    if (!extrapolate && ((x < m_xmin) || (x > m_xmax)))
+        throw std::invalid_argument("ComplexWindowedSinc.at()\n"
+                                    "Extrapolation is not authorized. To enable"
+                                    "extrapolation, set argument 'extrapolate'"
+                                    "to 'true'.");
+    complex y;
+    (*this)(x, y);
+    return y;
+}
+
+} // namespace Osl::Maths::Interpolator
+
+} // namespace Osl::Maths
+
+} // namespace Osl
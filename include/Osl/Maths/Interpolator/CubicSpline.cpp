@@ -4,6 +4,7 @@
  *********************************************************************/
 
 #include "CubicSpline.h"
+#include "Osl/Batch.h"
 
 namespace Osl { // Osl namespace
 
@@ -19,7 +20,8 @@ CubicSpline::CubicSpline(){}
 CubicSpline::CubicSpline(const CubicSpline &other)
     : m_xmin(other.m_xmin), m_xmax(other.m_xmax),
       m_x(other.m_x),
-      m_a(other.m_a), m_b(other.m_b), m_c(other.m_c), m_d(other.m_d),
+      m_uniform(other.m_uniform), m_dx(other.m_dx), m_inv_dx(other.m_inv_dx),
+      m_seg(other.m_seg),
       m_n(other.m_n) {}
 
 // Initialization with set of points
@@ -46,17 +48,18 @@ CubicSpline::CubicSpline(const vector &x, const vector&y, CubicSplineBoundary bc
     m_xmin = x.front();
     m_xmax = x.back();
 
-    // Setting provided x axis
-    m_x = x;
+    // Setting provided x axis (only stored if not evenly spaced)
+    m_uniform = Arrays::is_regspaced(x, m_dx);
+    if (m_uniform)
+        m_inv_dx = 1.0 / m_dx;
+    else
+        m_x = x;
 
     // Setting size of x axis and coefficients vectors
     m_n = xsize - 1;
 
-    // Initialization of coefficients vectors
-    m_a.reserve(m_n);
-    m_b.reserve(m_n);
-    m_c.reserve(m_n);
-    m_d.reserve(m_n);
+    // Initialization of segments
+    m_seg.resize(m_n);
 
     switch (bc)
     {
@@ -68,7 +71,7 @@ CubicSpline::CubicSpline(const vector &x, const vector&y, CubicSplineBoundary bc
         // STEP 0 - 1
         for (std::size_t i = 0 ; i < m_n ; ++i)
         {
-            m_d[i] = y[i];                     // Fill in d coefficient
+            m_seg[i].d = y[i];                     // Fill in d coefficient
             dx[i] = x[i+1] - x[i];             // Compute differential x values
             dydx[i] = (y[i+1] - y[i]) / dx[i]; // Compute differential dy/dx values
         }
@@ -86,14 +89,14 @@ CubicSpline::CubicSpline(const vector &x, const vector&y, CubicSplineBoundary bc
             // First index of the loop
         std::size_t i = m_n - 1;
         // Here bn=0
-        m_b[i] = z[i];
-        m_c[i] = dydx[i] - Constants::m_2_3 * dx[i] * m_b[i];
-        m_a[i] = -Constants::m_1_3 * m_b[i] / dx[i];
+        m_seg[i].b = z[i];
+        m_seg[i].c = dydx[i] - Constants::m_2_3 * dx[i] * m_seg[i].b;
+        m_seg[i].a = -Constants::m_1_3 * m_seg[i].b / dx[i];
         for (std::size_t j = i ; j-- > 0 ;) // loop
         {
-            m_b[j] = z[j] - u[j] * m_b[j+1];
-            m_c[j] = dydx[j] - Constants::m_1_3 * dx[j] * (m_b[j+1] + 2.0 * m_b[j]);
-            m_a[j] = Constants::m_1_3 * (m_b[j+1] - m_b[j]) / dx[j];
+            m_seg[j].b = z[j] - u[j] * m_seg[j+1].b;
+            m_seg[j].c = dydx[j] - Constants::m_1_3 * dx[j] * (m_seg[j+1].b + 2.0 * m_seg[j].b);
+            m_seg[j].a = Constants::m_1_3 * (m_seg[j+1].b - m_seg[j].b) / dx[j];
         }
         break;
     }
@@ -105,7 +108,7 @@ CubicSpline::CubicSpline(const vector &x, const vector&y, CubicSplineBoundary bc
         // STEP 0 - 1
         for (std::size_t i = 0 ; i < m_n ; ++i)
         {
-            m_d[i] = y[i];                     // Fill in d coefficient
+            m_seg[i].d = y[i];                     // Fill in d coefficient
             dx[i] = x[i+1] - x[i];             // Compute differential x values
             dydx[i] = (y[i+1] - y[i]) / dx[i]; // Compute differential dy/dx values
         }
@@ -122,14 +125,14 @@ CubicSpline::CubicSpline(const vector &x, const vector&y, CubicSplineBoundary bc
         // STEP 6
             // First index of the loop
         std::size_t i = m_n - 1;
-        m_b[i] = z[i] / (1.0 + u[i]); // b(n-1)=b(n)
-        m_c[i] = dydx[i] - dx[i] * m_b[i];
-        m_a[i] = 0.0;
+        m_seg[i].b = z[i] / (1.0 + u[i]); // b(n-1)=b(n)
+        m_seg[i].c = dydx[i] - dx[i] * m_seg[i].b;
+        m_seg[i].a = 0.0;
         for (std::size_t j = i ; j-- > 0 ;) // loop
         {
-            m_b[j] = z[j] - u[j] * m_b[j+1];
-            m_c[j] = dydx[j] - Constants::m_1_3 * dx[j] * (m_b[j+1] + 2.0 * m_b[j]);
-            m_a[j] = Constants::m_1_3 * (m_b[j+1] - m_b[j]) / dx[j];
+            m_seg[j].b = z[j] - u[j] * m_seg[j+1].b;
+            m_seg[j].c = dydx[j] - Constants::m_1_3 * dx[j] * (m_seg[j+1].b + 2.0 * m_seg[j].b);
+            m_seg[j].a = Constants::m_1_3 * (m_seg[j+1].b - m_seg[j].b) / dx[j];
         }
         break;
     }
@@ -168,17 +171,18 @@ CubicSpline::CubicSpline(const vector &x, const vector &y, const vector &yp)
     m_xmin = x.front();
     m_xmax = x.back();
 
-    // Setting provided x axis
-    m_x = x;
+    // Setting provided x axis (only stored if not evenly spaced)
+    m_uniform = Arrays::is_regspaced(x, m_dx);
+    if (m_uniform)
+        m_inv_dx = 1.0 / m_dx;
+    else
+        m_x = x;
 
     // Setting size of x axis and coefficients vectors
     m_n = xsize - 1;
 
-    // Initialization of coefficients vectors
-    m_a.reserve(m_n);
-    m_b.reserve(m_n);
-    m_c.reserve(m_n);
-    m_d.reserve(m_n);
+    // Initialization of segments
+    m_seg.resize(m_n);
 
     // Cubic interpolator coefficients
     double inv_dx, dydx;
@@ -194,10 +198,10 @@ CubicSpline::CubicSpline(const vector &x, const vector &y, const vector &yp)
 
         // Compute the Cubic Spline Interpolator coefficients
         dydx = (yip1 - yi) * inv_dx;
-        m_a[i] = (-2.0 * dydx + ypi + ypip1) * inv_dx * inv_dx;
-        m_b[i] = (3.0 * dydx - 2.0 * ypi - ypip1) * inv_dx;
-        m_c[i] = ypi;
-        m_d[i] = yi;
+        m_seg[i].a = (-2.0 * dydx + ypi + ypip1) * inv_dx * inv_dx;
+        m_seg[i].b = (3.0 * dydx - 2.0 * ypi - ypip1) * inv_dx;
+        m_seg[i].c = ypi;
+        m_seg[i].d = yi;
 
         // Update y and yp values for next index
         yi = yip1;
@@ -212,7 +216,16 @@ CubicSpline::~CubicSpline(){}
 // *************** GETTER ***************
 double CubicSpline::getXmin() const { return m_xmin; }
 double CubicSpline::getXmax() const { return m_xmax; }
-vector CubicSpline::getX() const { return m_x; }
+vector CubicSpline::getX() const
+{
+    if (!m_uniform)
+        return m_x;
+    vector x(m_n + 1);
+    for (std::size_t i = 0 ; i <= m_n ; ++i)
+        x[i] = this->x_node(i);
+    return x;
+}
+bool CubicSpline::isUniform() const { return m_uniform; }
 void CubicSpline::getCoeffs(vector &a, vector &b, vector &c, vector &d)
 {
     a.resize(m_n);
@@ -221,10 +234,10 @@ void CubicSpline::getCoeffs(vector &a, vector &b, vector &c, vector &d)
     d.resize(m_n);
     for (std::size_t i = 0 ; i < m_n ; ++i)
     {
-        a[i] = m_a[i];
-        b[i] = m_b[i];
-        c[i] = m_c[i];
-        d[i] = m_d[i];
+        a[i] = m_seg[i].a;
+        b[i] = m_seg[i].b;
+        c[i] = m_seg[i].c;
+        d[i] = m_seg[i].d;
     }
 }
 
@@ -246,11 +259,11 @@ CubicSpline CubicSpline::operator=(const CubicSpline &other)
 {
     m_xmin = other.m_xmin;
     m_xmax = other.m_xmax;
+    m_uniform = other.m_uniform;
+    m_dx = other.m_dx;
+    m_inv_dx = other.m_inv_dx;
     m_x = other.m_x;
-    m_a = other.m_a;
-    m_b = other.m_b;
-    m_c = other.m_c;
-    m_d = other.m_d;
+    m_seg = other.m_seg;
     m_n = other.m_n;
     return *this;
 }
@@ -261,9 +274,9 @@ void CubicSpline::operator()(const double &x, double &y)
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
     // Compute the interpolated value
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     double dx2 = dx * dx;
-    y = m_a[index] * dx2 * dx + m_b[index] * dx2 + m_c[index] * dx + m_d[index];
+    y = m_seg[index].a * dx2 * dx + m_seg[index].b * dx2 + m_seg[index].c * dx + m_seg[index].d;
 }
 
 void CubicSpline::operator()(const double &x, double &y, double &yp)
@@ -271,9 +284,9 @@ void CubicSpline::operator()(const double &x, double &y, double &yp)
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
     // Compute the interpolated value
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     double dx2 = dx * dx;
-    double a = m_a[index], b = m_b[index], c = m_c[index], d = m_d[index];
+    double a = m_seg[index].a, b = m_seg[index].b, c = m_seg[index].c, d = m_seg[index].d;
     y = a * dx2 * dx + b * dx2 + c * dx + d;
     yp = 3.0 * a * dx2 + 2.0 * b * dx + c;
 }
@@ -283,9 +296,9 @@ void CubicSpline::operator()(const double &x, double &y, double &yp, double &ypp
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
     // Compute the interpolated value
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     double dx2 = dx * dx;
-    double a = m_a[index], b = m_b[index], c = m_c[index], d = m_d[index];
+    double a = m_seg[index].a, b = m_seg[index].b, c = m_seg[index].c, d = m_seg[index].d;
     y = a * dx2 * dx + b * dx2 + c * dx + d;
     yp = 3.0 * a * dx2 + 2.0 * b * dx + c;
     ypp = 6.0 * a * dx + 2.0 * b;
@@ -295,19 +308,19 @@ void CubicSpline::operator()(const double &x, const std::size_t &index,
                              double &y)
 {
     // Compute the interpolated value
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     double dx2 = dx * dx;
-    y = m_a[index] * dx2 * dx + m_b[index] * dx2 + m_c[index] * dx + m_d[index];
+    y = m_seg[index].a * dx2 * dx + m_seg[index].b * dx2 + m_seg[index].c * dx + m_seg[index].d;
 }
 
 void CubicSpline::operator()(const double &x, const std::size_t &index,
                              double &y, double &yp)
 {
     // Compute the interpolated value
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     double dx2 = dx * dx;
-    double a = m_a[index], b = m_b[index], c = m_c[index];
-    y = a * dx2 * dx + b * dx2 + c * dx + m_d[index];
+    double a = m_seg[index].a, b = m_seg[index].b, c = m_seg[index].c;
+    y = a * dx2 * dx + b * dx2 + c * dx + m_seg[index].d;
     yp = 3.0 * a * dx2 + 2.0 * b * dx + c;
 }
 
@@ -315,10 +328,10 @@ void CubicSpline::operator()(const double &x, const std::size_t &index,
                              double &y, double &yp, double &ypp)
 {
     // Compute the interpolated value
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     double dx2 = dx * dx;
-    double a = m_a[index], b = m_b[index], c = m_c[index];
-    y = a * dx2 * dx + b * dx2 + c * dx + m_d[index];
+    double a = m_seg[index].a, b = m_seg[index].b, c = m_seg[index].c;
+    y = a * dx2 * dx + b * dx2 + c * dx + m_seg[index].d;
     yp = 3.0 * a * dx2 + 2.0 * b * dx + c;
     ypp = 6.0 * a * dx + 2.0 * b;
 }
@@ -334,12 +347,12 @@ double CubicSpline::at(const double &x, bool extrapolate)
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
     // Compute the interpolated value
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     double dx2 = dx * dx;
-    return m_a[index] * dx2 * dx +
-           m_b[index] * dx2 +
-           m_c[index] * dx +
-           m_d[index];
+    return m_seg[index].a * dx2 * dx +
+           m_seg[index].b * dx2 +
+           m_seg[index].c * dx +
+           m_seg[index].d;
 }
 
 double CubicSpline::prime(const double &x, bool extrapolate)
@@ -352,10 +365,10 @@ double CubicSpline::prime(const double &x, bool extrapolate)
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
     // Compute the interpolated value
-    double dx = x - m_x[index];
-    return 3.0 * m_a[index] * dx * dx +
-           2.0 * m_b[index] * dx +
-           m_c[index];
+    double dx = x - this->x_node(index);
+    return 3.0 * m_seg[index].a * dx * dx +
+           2.0 * m_seg[index].b * dx +
+           m_seg[index].c;
 }
 
 double CubicSpline::primeprime(const double &x, bool extrapolate)
@@ -368,15 +381,27 @@ double CubicSpline::primeprime(const double &x, bool extrapolate)
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
     // Compute the interpolated value
-    return 6.0 * m_a[index] * (x - m_x[index]) + 2.0 * m_b[index];
+    return 6.0 * m_seg[index].a * (x - this->x_node(index)) + 2.0 * m_seg[index].b;
 }
 
 std::size_t CubicSpline::search_index_for_interpolation(const double &xeval)
 {
     if (xeval >= m_xmax)
         return m_n - 1;
-    if (xeval <= m_xmin)
+    if (!(xeval > m_xmin)) // NaN included
         return 0;
+    if (m_uniform)
+    {
+        std::size_t i = static_cast<std::size_t>(std::min((xeval - m_xmin) * m_inv_dx,
+                                                          static_cast<double>(m_n - 1)));
+        // The rounding of the quotient may give the neighbouring segment
+        // for a value at a knot
+        if ((i + 1 < m_n) && (xeval >= this->x_node(i + 1)))
+            return i + 1;
+        if ((i > 0) && (xeval < this->x_node(i)))
+            return i - 1;
+        return i;
+    }
     std::size_t left=0, right=m_n, mid;
     while (right - left > 1)
     {
@@ -389,6 +414,119 @@ std::size_t CubicSpline::search_index_for_interpolation(const double &xeval)
     return left; // We want the value <= x0
 }
 
+// =========== BATCH EVALUATION ===========
+void CubicSpline::evaluate(const double *x, double *y,
+                           std::size_t n, bool sorted)
+{
+    std::size_t index[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        const double *xb = x + k0;
+        double *yb = y + k0;
+        this->search_indices_for_interpolation(xb, index, nb, sorted);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
+        {
+            std::size_t i = index[k];
+            double dx = xb[k] - this->x_node(i);
+            double a = m_seg[i].a, b = m_seg[i].b, c = m_seg[i].c;
+            yb[k] = ((a * dx + b) * dx + c) * dx + m_seg[i].d;
+        }
+    }
+}
+
+void CubicSpline::evaluate(const double *x, double *y, double *yp,
+                           std::size_t n, bool sorted)
+{
+    std::size_t index[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        const double *xb = x + k0;
+        double *yb = y + k0, *ypb = yp + k0;
+        this->search_indices_for_interpolation(xb, index, nb, sorted);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
+        {
+            std::size_t i = index[k];
+            double dx = xb[k] - this->x_node(i);
+            double a = m_seg[i].a, b = m_seg[i].b, c = m_seg[i].c;
+            yb[k] = ((a * dx + b) * dx + c) * dx + m_seg[i].d;
+            ypb[k] = (3.0 * a * dx + 2.0 * b) * dx + c;
+        }
+    }
+}
+
+void CubicSpline::evaluate(const double *x, double *y, double *yp, double *ypp,
+                           std::size_t n, bool sorted)
+{
+    std::size_t index[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        const double *xb = x + k0;
+        double *yb = y + k0, *ypb = yp + k0, *yppb = ypp + k0;
+        this->search_indices_for_interpolation(xb, index, nb, sorted);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
+        {
+            std::size_t i = index[k];
+            double dx = xb[k] - this->x_node(i);
+            double a = m_seg[i].a, b = m_seg[i].b, c = m_seg[i].c;
+            yb[k] = ((a * dx + b) * dx + c) * dx + m_seg[i].d;
+            ypb[k] = (3.0 * a * dx + 2.0 * b) * dx + c;
+            yppb[k] = 6.0 * a * dx + 2.0 * b;
+        }
+    }
+}
+
+void CubicSpline::evaluate(const vector &x, vector &y, bool sorted)
+{
+    y.resize(x.size());
+    this->evaluate(x.data(), y.data(), x.size(), sorted);
+}
+
+void CubicSpline::search_indices_for_interpolation(const double *xeval,
+                                                   std::size_t *index,
+                                                   std::size_t n, bool sorted)
+{
+    if (n == 0)
+        return;
+    if (m_uniform)
+    {
+        double last = static_cast<double>(m_n - 1);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < n ; ++k)
+        {
+            double u = (xeval[k] - m_xmin) * m_inv_dx;
+            u = (u >= 0.0) ? u : 0.0; // NaN included
+            std::size_t i = static_cast<std::size_t>((u <= last) ? u : last);
+            // Same correction at the knots as search_index_for_interpolation()
+            i += ((i + 1 < m_n) && (xeval[k] >= m_xmin + static_cast<double>(i + 1) * m_dx));
+            i -= ((i > 0) && (xeval[k] < m_xmin + static_cast<double>(i) * m_dx));
+            index[k] = i;
+        }
+        return;
+    }
+    if (!sorted)
+    {
+        for (std::size_t k = 0 ; k < n ; ++k)
+            index[k] = this->search_index_for_interpolation(xeval[k]);
+        return;
+    }
+    // Monotone merge-walk: a single binary search, then the index is only
+    // moved forward along the reference axis.
+    std::size_t i = this->search_index_for_interpolation(xeval[0]),
+                last = m_n - 1;
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        while ((i < last) && (xeval[k] >= m_x[i+1]))
+            ++i;
+        index[k] = i;
+    }
+}
+
 } // namespace Osl::Maths::Interpolator
 
 } // namespace Osl::Maths
@@ -14,6 +14,9 @@
 #include "ComplexLinearSpline.h"
 #include "ComplexQuadraticSpline.h"
 #include "ComplexCubicSpline.h"
+#include "StreamingCubicSpline.h"
 #include "Sinc.h"
+#include "WindowedSinc.h"
+#include "ComplexWindowedSinc.h"
 
 #endif // OSL_MATHS_INTERPOLATOR_H
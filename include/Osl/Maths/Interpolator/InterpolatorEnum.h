@@ -43,6 +43,23 @@ enum class QuadraticSplineBoundary
     linearLast
 };
 
+/*! ********************************************************************
+ * \enum SincWindow
+ * \brief Enumeration for the window applied to the truncated sinc kernel
+ *        of the Windowed Sinc Interpolator classes.
+ *********************************************************************/
+enum class SincWindow
+{
+    /*! Truncated sinc kernel without windowing.*/
+    rectangular,
+    /*! Sinc kernel windowed by a Hann (raised cosine) window.*/
+    hann,
+    /*! Sinc kernel windowed by a Lanczos (sinc) window.*/
+    lanczos,
+    /*! Sinc kernel windowed by a Kaiser-Bessel window.*/
+    kaiser
+};
+
 } // namespace Osl::Maths::Interpolator
 
 } // namespace Osl::Maths
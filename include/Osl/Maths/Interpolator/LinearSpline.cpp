@@ -4,6 +4,7 @@
  *********************************************************************/
 
 #include "LinearSpline.h"
+#include "Osl/Batch.h"
 
 namespace Osl { // Osl namespace
 
@@ -38,15 +39,19 @@ LinearSpline::LinearSpline(const vector &x, const vector &y)
     m_xmin = x.front();
     m_xmax = x.back();
 
-    // Setting provided x axis
-    m_x = x;
+    // Setting provided x axis (only stored if not evenly spaced)
+    m_uniform = Arrays::is_regspaced(x, m_dx);
+    if (m_uniform)
+        m_inv_dx = 1.0 / m_dx;
+    else
+        m_x = x;
 
     // Setting size of x axis and coefficients vectors
     m_n = xsize - 1;
 
     // Initialization of coefficients vectors
-    m_a.reserve(m_n);
-    m_b.reserve(m_n);
+    m_a.resize(m_n);
+    m_b.resize(m_n);
 
     // Linear interpolator coefficients
     for (std::size_t i = 0 ; i < m_n ; ++i)
@@ -60,6 +65,7 @@ LinearSpline::LinearSpline(const vector &x, const vector &y)
 LinearSpline::LinearSpline(const LinearSpline &other)
     : m_xmin(other.m_xmin), m_xmax(other.m_xmax),
       m_x(other.m_x),
+      m_uniform(other.m_uniform), m_dx(other.m_dx), m_inv_dx(other.m_inv_dx),
       m_a(other.m_a), m_b(other.m_b),
       m_n(other.m_n) {}
 
@@ -70,7 +76,16 @@ LinearSpline::~LinearSpline(){}
 // *************** GETTER ***************
 double LinearSpline::getXmin() const { return m_xmin; }
 double LinearSpline::getXmax() const { return m_xmax; }
-vector LinearSpline::getX() const { return m_x; }
+vector LinearSpline::getX() const
+{
+    if (!m_uniform)
+        return m_x;
+    vector x(m_n + 1);
+    for (std::size_t i = 0 ; i <= m_n ; ++i)
+        x[i] = this->x_node(i);
+    return x;
+}
+bool LinearSpline::isUniform() const { return m_uniform; }
 void LinearSpline::getCoeffs(vector &a, vector &b)
 {
     a.resize(m_n);
@@ -95,6 +110,9 @@ LinearSpline LinearSpline::operator=(const LinearSpline &other)
     m_xmin = other.m_xmin;
     m_xmax = other.m_xmax;
     m_x = other.m_x;
+    m_uniform = other.m_uniform;
+    m_dx = other.m_dx;
+    m_inv_dx = other.m_inv_dx;
     m_a = other.m_a;
     m_b = other.m_b;
     m_n = other.m_n;
@@ -106,12 +124,12 @@ void LinearSpline::operator()(const double &x, double &y)
 {
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
-    y = m_a[index] * (x - m_x[index]) + m_b[index];
+    y = m_a[index] * (x - this->x_node(index)) + m_b[index];
 }
 
 void LinearSpline::operator()(const double &x, const std::size_t &index, double &y)
 {
-    y = m_a[index] * (x - m_x[index]) + m_b[index];
+    y = m_a[index] * (x - this->x_node(index)) + m_b[index];
 }
 
 // =========== LINEAR SPLINE METHODS ===========
@@ -124,15 +142,27 @@ double LinearSpline::at(const double &x, bool extrapolate)
                                     "to 'true'.");
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
-    return m_a[index] * (x - m_x[index]) + m_b[index];
+    return m_a[index] * (x - this->x_node(index)) + m_b[index];
 }
 
 std::size_t LinearSpline::search_index_for_interpolation(const double &xeval)
 {
     if (xeval >= m_xmax)
         return m_n - 1;
-    if (xeval <= m_xmin)
+    if (!(xeval > m_xmin)) // NaN included
         return 0;
+    if (m_uniform)
+    {
+        std::size_t i = static_cast<std::size_t>(std::min((xeval - m_xmin) * m_inv_dx,
+                                                          static_cast<double>(m_n - 1)));
+        // The rounding of the quotient may give the neighbouring segment
+        // for a value at a knot
+        if ((i + 1 < m_n) && (xeval >= this->x_node(i + 1)))
+            return i + 1;
+        if ((i > 0) && (xeval < this->x_node(i)))
+            return i - 1;
+        return i;
+    }
     std::size_t left=0, right=m_n, mid;
     while (right - left > 1)
     {
@@ -145,6 +175,95 @@ std::size_t LinearSpline::search_index_for_interpolation(const double &xeval)
     return left; // We want the value <= x0
 }
 
+// =========== BATCH EVALUATION ===========
+void LinearSpline::evaluate(const double *x, double *y,
+                            std::size_t n, bool sorted)
+{
+    std::size_t index[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        const double *xb = x + k0;
+        double *yb = y + k0;
+        this->search_indices_for_interpolation(xb, index, nb, sorted);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
+        {
+            std::size_t i = index[k];
+            double dx = xb[k] - this->x_node(i);
+            yb[k] = m_a[i] * dx + m_b[i];
+        }
+    }
+}
+
+void LinearSpline::evaluate(const double *x, double *y, double *yp,
+                            std::size_t n, bool sorted)
+{
+    std::size_t index[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        const double *xb = x + k0;
+        double *yb = y + k0, *ypb = yp + k0;
+        this->search_indices_for_interpolation(xb, index, nb, sorted);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
+        {
+            std::size_t i = index[k];
+            double dx = xb[k] - this->x_node(i);
+            double a = m_a[i];
+            yb[k] = a * dx + m_b[i];
+            ypb[k] = a;
+        }
+    }
+}
+
+void LinearSpline::evaluate(const vector &x, vector &y, bool sorted)
+{
+    y.resize(x.size());
+    this->evaluate(x.data(), y.data(), x.size(), sorted);
+}
+
+void LinearSpline::search_indices_for_interpolation(const double *xeval,
+                                                    std::size_t *index,
+                                                    std::size_t n, bool sorted)
+{
+    if (n == 0)
+        return;
+    if (m_uniform)
+    {
+        double last = static_cast<double>(m_n - 1);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < n ; ++k)
+        {
+            double u = (xeval[k] - m_xmin) * m_inv_dx;
+            u = (u >= 0.0) ? u : 0.0; // NaN included
+            std::size_t i = static_cast<std::size_t>((u <= last) ? u : last);
+            // Same correction at the knots as search_index_for_interpolation()
+            i += ((i + 1 < m_n) && (xeval[k] >= m_xmin + static_cast<double>(i + 1) * m_dx));
+            i -= ((i > 0) && (xeval[k] < m_xmin + static_cast<double>(i) * m_dx));
+            index[k] = i;
+        }
+        return;
+    }
+    if (!sorted)
+    {
+        for (std::size_t k = 0 ; k < n ; ++k)
+            index[k] = this->search_index_for_interpolation(xeval[k]);
+        return;
+    }
+    // Monotone merge-walk: a single binary search, then the index is only
+    // moved forward along the reference axis.
+    std::size_t i = this->search_index_for_interpolation(xeval[0]),
+                last = m_n - 1;
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        while ((i < last) && (xeval[k] >= m_x[i+1]))
+            ++i;
+        index[k] = i;
+    }
+}
+
 
 double linear_interpolation(const vector &x, const vector &y, const double &xeval)
 {
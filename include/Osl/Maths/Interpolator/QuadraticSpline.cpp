@@ -4,6 +4,7 @@
  *********************************************************************/
 
 #include "QuadraticSpline.h"
+#include "Osl/Batch.h"
 
 namespace Osl { // Osl namespace
 
@@ -19,6 +20,7 @@ QuadraticSpline::QuadraticSpline(){}
 QuadraticSpline::QuadraticSpline(const QuadraticSpline &other)
     : m_xmin(other.m_xmin), m_xmax(other.m_xmax),
       m_x(other.m_x),
+      m_uniform(other.m_uniform), m_dx(other.m_dx), m_inv_dx(other.m_inv_dx),
       m_a(other.m_a), m_b(other.m_b), m_c(other.m_c),
       m_n(other.m_n) {}
 
@@ -47,16 +49,20 @@ QuadraticSpline::QuadraticSpline(const vector &x, const vector &y,
     m_xmin = x.front();
     m_xmax = x.back();
 
-    // Setting provided x axis
-    m_x = x;
+    // Setting provided x axis (only stored if not evenly spaced)
+    m_uniform = Arrays::is_regspaced(x, m_dx);
+    if (m_uniform)
+        m_inv_dx = 1.0 / m_dx;
+    else
+        m_x = x;
 
     // Setting size of x axis and coefficients vectors
     m_n = xsize - 1;
 
     // Initialization of coefficients vectors
-    m_a.reserve(m_n);
-    m_b.reserve(m_n);
-    m_c.reserve(m_n);
+    m_a.resize(m_n);
+    m_b.resize(m_n);
+    m_c.resize(m_n);
 
     switch (bc)
     {
@@ -106,7 +112,16 @@ QuadraticSpline::~QuadraticSpline(){}
 // *************** GETTER ***************
 double QuadraticSpline::getXmin() const { return m_xmin; }
 double QuadraticSpline::getXmax() const { return m_xmax; }
-vector QuadraticSpline::getX() const { return m_x; }
+vector QuadraticSpline::getX() const
+{
+    if (!m_uniform)
+        return m_x;
+    vector x(m_n + 1);
+    for (std::size_t i = 0 ; i <= m_n ; ++i)
+        x[i] = this->x_node(i);
+    return x;
+}
+bool QuadraticSpline::isUniform() const { return m_uniform; }
 void QuadraticSpline::getCoeffs(vector &a, vector &b, vector &c)
 {
     a.resize(m_n);
@@ -134,6 +149,9 @@ QuadraticSpline QuadraticSpline::operator=(const QuadraticSpline &other)
     m_xmin = other.m_xmin;
     m_xmax = other.m_xmax;
     m_x = other.m_x;
+    m_uniform = other.m_uniform;
+    m_dx = other.m_dx;
+    m_inv_dx = other.m_inv_dx;
     m_a = other.m_a;
     m_b = other.m_b;
     m_c = other.m_c;
@@ -146,7 +164,7 @@ void QuadraticSpline::operator()(const double &x, double &y)
 {
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     y = m_a[index] * dx * dx + m_b[index] * dx + m_c[index];
 }
 
@@ -154,7 +172,7 @@ void QuadraticSpline::operator()(const double &x, double &y, double &yp)
 {
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     double a = m_a[index], b = m_b[index];
     y = a * dx * dx + b * dx + m_c[index];
     yp = 2.0 * a * dx + b;
@@ -163,14 +181,14 @@ void QuadraticSpline::operator()(const double &x, double &y, double &yp)
 void QuadraticSpline::operator()(const double &x, const std::size_t &index,
                                  double &y)
 {
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     y = m_a[index] * dx * dx + m_b[index] * dx + m_c[index];
 }
 
 void QuadraticSpline::operator()(const double &x, const std::size_t &index,
                                  double &y, double &yp)
 {
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     double a = m_a[index], b = m_b[index];
     y = a * dx * dx + b * dx + m_c[index];
     yp = 2.0 * a * dx + b;
@@ -187,7 +205,7 @@ double QuadraticSpline::at(const double &x, bool extrapolate)
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
     // Compute the interpolated value
-    double dx = x - m_x[index];
+    double dx = x - this->x_node(index);
     return m_a[index] * dx * dx + m_b[index] * dx + m_c[index];
 }
 
@@ -201,15 +219,27 @@ double QuadraticSpline::prime(const double &x, bool extrapolate)
     // Search index of coefficients for interpolation
     std::size_t index = this->search_index_for_interpolation(x);
     // Compute the interpolated value
-    return 2.0 * m_a[index] * (x - m_x[index]) + m_b[index];
+    return 2.0 * m_a[index] * (x - this->x_node(index)) + m_b[index];
 }
 
 std::size_t QuadraticSpline::search_index_for_interpolation(const double &xeval)
 {
     if (xeval >= m_xmax)
         return m_n - 1;
-    if (xeval <= m_xmin)
+    if (!(xeval > m_xmin)) // NaN included
         return 0;
+    if (m_uniform)
+    {
+        std::size_t i = static_cast<std::size_t>(std::min((xeval - m_xmin) * m_inv_dx,
+                                                          static_cast<double>(m_n - 1)));
+        // The rounding of the quotient may give the neighbouring segment
+        // for a value at a knot
+        if ((i + 1 < m_n) && (xeval >= this->x_node(i + 1)))
+            return i + 1;
+        if ((i > 0) && (xeval < this->x_node(i)))
+            return i - 1;
+        return i;
+    }
     std::size_t left=0, right=m_n, mid;
     while (right - left > 1)
     {
@@ -222,6 +252,96 @@ std::size_t QuadraticSpline::search_index_for_interpolation(const double &xeval)
     return left; // We want the value <= x0
 }
 
+// =========== BATCH EVALUATION ===========
+void QuadraticSpline::evaluate(const double *x, double *y,
+                               std::size_t n, bool sorted)
+{
+    std::size_t index[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        const double *xb = x + k0;
+        double *yb = y + k0;
+        this->search_indices_for_interpolation(xb, index, nb, sorted);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
+        {
+            std::size_t i = index[k];
+            double dx = xb[k] - this->x_node(i);
+            double a = m_a[i], b = m_b[i];
+            yb[k] = (a * dx + b) * dx + m_c[i];
+        }
+    }
+}
+
+void QuadraticSpline::evaluate(const double *x, double *y, double *yp,
+                               std::size_t n, bool sorted)
+{
+    std::size_t index[detail::batch_size];
+    for (std::size_t k0 = 0 ; k0 < n ; k0 += detail::batch_size)
+    {
+        std::size_t nb = std::min(detail::batch_size, n - k0);
+        const double *xb = x + k0;
+        double *yb = y + k0, *ypb = yp + k0;
+        this->search_indices_for_interpolation(xb, index, nb, sorted);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < nb ; ++k)
+        {
+            std::size_t i = index[k];
+            double dx = xb[k] - this->x_node(i);
+            double a = m_a[i], b = m_b[i];
+            yb[k] = (a * dx + b) * dx + m_c[i];
+            ypb[k] = 2.0 * a * dx + b;
+        }
+    }
+}
+
+void QuadraticSpline::evaluate(const vector &x, vector &y, bool sorted)
+{
+    y.resize(x.size());
+    this->evaluate(x.data(), y.data(), x.size(), sorted);
+}
+
+void QuadraticSpline::search_indices_for_interpolation(const double *xeval,
+                                                       std::size_t *index,
+                                                       std::size_t n, bool sorted)
+{
+    if (n == 0)
+        return;
+    if (m_uniform)
+    {
+        double last = static_cast<double>(m_n - 1);
+        #pragma omp simd
+        for (std::size_t k = 0 ; k < n ; ++k)
+        {
+            double u = (xeval[k] - m_xmin) * m_inv_dx;
+            u = (u >= 0.0) ? u : 0.0; // NaN included
+            std::size_t i = static_cast<std::size_t>((u <= last) ? u : last);
+            // Same correction at the knots as search_index_for_interpolation()
+            i += ((i + 1 < m_n) && (xeval[k] >= m_xmin + static_cast<double>(i + 1) * m_dx));
+            i -= ((i > 0) && (xeval[k] < m_xmin + static_cast<double>(i) * m_dx));
+            index[k] = i;
+        }
+        return;
+    }
+    if (!sorted)
+    {
+        for (std::size_t k = 0 ; k < n ; ++k)
+            index[k] = this->search_index_for_interpolation(xeval[k]);
+        return;
+    }
+    // Monotone merge-walk: a single binary search, then the index is only
+    // moved forward along the reference axis.
+    std::size_t i = this->search_index_for_interpolation(xeval[0]),
+                last = m_n - 1;
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        while ((i < last) && (xeval[k] >= m_x[i+1]))
+            ++i;
+        index[k] = i;
+    }
+}
+
 } // namespace Osl::Maths::Interpolator
 
 } // namespace Osl::Maths
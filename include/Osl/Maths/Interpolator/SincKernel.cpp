@@ -0,0 +1,135 @@
+/*! ********************************************************************
+ * \file SincKernel.cpp
+ * \brief Source file of Osl::Maths::Interpolator::SincKernel class.
+ *********************************************************************/
+
+#include "SincKernel.h"
+
+namespace Osl { // Osl namespace
+
+namespace Maths { // Osl::Maths namespace
+
+namespace Interpolator { // Osl::Maths::Interpolator namespace
+
+// ============== SINC KERNEL ==============
+// ============== CONSTRUCTOR ==============
+SincKernel::SincKernel(){}
+
+// Copy constructor
+SincKernel::SincKernel(const SincKernel &other)
+    : m_hw(other.m_hw), m_taps(other.m_taps), m_L(other.m_L),
+      m_window(other.m_window),
+      m_table(other.m_table) {}
+
+SincKernel::SincKernel(std::size_t halfWidth, SincWindow window,
+                       std::size_t oversampling, double beta)
+    : m_hw(halfWidth), m_taps(2 * halfWidth), m_L(oversampling),
+      m_window(window)
+{
+    // Assertions
+    if (halfWidth < 1)
+        throw std::invalid_argument("SincKernel constructor:\n"
+                                    "\t'halfWidth' must be at least 1.");
+    if (oversampling < 1)
+        throw std::invalid_argument("SincKernel constructor:\n"
+                                    "\t'oversampling' must be at least 1.");
+
+    double M = static_cast<double>(m_hw),
+           inv_M = 1.0 / M,
+           inv_L = 1.0 / static_cast<double>(m_L),
+           inv_i0_beta = 1.0 / std::cyl_bessel_i(0.0, beta);
+    m_table.resize((m_L + 1) * m_taps);
+    for (std::size_t p = 0 ; p <= m_L ; ++p)
+    {
+        double delta = static_cast<double>(p) * inv_L,
+               sum = 0.0;
+        double *w = m_table.data() + p * m_taps;
+        for (std::size_t t = 0 ; t < m_taps ; ++t)
+        {
+            // Distance from the evaluation point to sample i0 - M + 1 + t
+            double d = delta + M - 1.0 - static_cast<double>(t),
+                   r = d * inv_M, // Reduced distance in ]-1;1]
+                   win;
+            if (std::abs(r) >= 1.0)
+            {
+                w[t] = 0.0;
+                continue;
+            }
+            switch (window)
+            {
+            case SincWindow::rectangular:
+                win = 1.0;
+                break;
+            case SincWindow::hann:
+                win = 0.5 * (1.0 + std::cos(Constants::m_pi * r));
+                break;
+            case SincWindow::lanczos:
+                win = Functions::sinc(r);
+                break;
+            case SincWindow::kaiser:
+                win = std::cyl_bessel_i(0.0, beta * std::sqrt(1.0 - r * r)) * inv_i0_beta;
+                break;
+            default:
+                throw std::invalid_argument("SincKernel constructor:\n"
+                                            "\t'window' is not a valid enumeration.");
+            }
+            w[t] = Functions::sinc(d) * win;
+            sum += w[t];
+        }
+        // Normalization of the phase to a unit sum
+        double inv_sum = 1.0 / sum;
+        for (std::size_t t = 0 ; t < m_taps ; ++t)
+            w[t] *= inv_sum;
+    }
+}
+
+// ============== DESTRUCTOR ==============
+SincKernel::~SincKernel(){}
+
+// ============== CLASS METHODS ==============
+// *************** GETTER ***************
+std::size_t SincKernel::getHalfWidth() const { return m_hw; }
+std::size_t SincKernel::getTaps() const { return m_taps; }
+std::size_t SincKernel::getOversampling() const { return m_L; }
+SincWindow SincKernel::getWindow() const { return m_window; }
+
+// ============== OPERATORS ==============
+// Assignement from another SincKernel
+SincKernel SincKernel::operator=(const SincKernel &other)
+{
+    m_hw = other.m_hw;
+    m_taps = other.m_taps;
+    m_L = other.m_L;
+    m_window = other.m_window;
+    m_table = other.m_table;
+    return *this;
+}
+
+// =========== SINC KERNEL METHODS ===========
+void SincKernel::weights(const double &delta, double *w) const
+{
+    // Linear interpolation between the two nearest tabulated phases
+    double alpha;
+    const double *w0 = this->phase(delta, alpha),
+                 *w1 = w0 + m_taps;
+    #pragma omp simd
+    for (std::size_t t = 0 ; t < m_taps ; ++t)
+        w[t] = w0[t] + alpha * (w1[t] - w0[t]);
+}
+
+const double *SincKernel::phase(const double &delta, double &alpha) const
+{
+    double u = delta * static_cast<double>(m_L);
+    // Clamped before the conversion: delta rounded up to 1, and NaN which
+    // gives NaN weights through alpha
+    std::size_t p = (u >= static_cast<double>(m_L - 1)) ? m_L - 1
+                    : ((u > 0.0) ? static_cast<std::size_t>(u) : 0);
+    alpha = u - static_cast<double>(p);
+    return m_table.data() + p * m_taps;
+}
+
+} // namespace Osl::Maths::Interpolator
+
+} // namespace Osl::Maths
+
+} // namespace Osl
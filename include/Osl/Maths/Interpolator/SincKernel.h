@@ -0,0 +1,157 @@
+/*! ********************************************************************
+ * \file SincKernel.h
+ * \brief Header file of Osl::Maths::Interpolator::SincKernel class.
+ *********************************************************************/
+
+#ifndef OSL_MATHS_INTERPOLATOR_SINCKERNEL_H
+#define OSL_MATHS_INTERPOLATOR_SINCKERNEL_H
+
+#include "Osl/Globals.h"
+#include "Osl/Constants.h"
+#include "Osl/Maths/Functions/sinc.h"
+#include "InterpolatorEnum.h"
+
+namespace Osl { // Osl namespace
+
+namespace Maths { // Osl::Maths namespace
+
+namespace Interpolator { // Osl::Maths::Interpolator namespace
+
+/*! ********************************************************************
+ * \brief Class to precompute an oversampled, windowed and truncated sinc
+ *        interpolation kernel.
+ *
+ * <h3>Principle</h3>
+ *
+ * For a kernel half-width of \f$M\f$ samples, the interpolation kernel is
+ * the normalized sinc function truncated to \f$]-M;M[\f$ and weighted by a
+ * window \f$w\f$:
+ *
+ * \f[
+ *     h(d)=\mathrm{sinc}(d)\,w\left(\dfrac{d}{M}\right),\quad |d|<M
+ * \f]
+ *
+ * with the following available windows (see SincWindow):
+ *
+ * - rectangular: \f$w(t)=1\f$,
+ * - Hann: \f$w(t)=\dfrac{1}{2}\big(1+\cos(\pi t)\big)\f$,
+ * - Lanczos: \f$w(t)=\mathrm{sinc}(t)\f$,
+ * - Kaiser: \f$w(t)=\dfrac{I_0\big(\beta\sqrt{1-t^2}\big)}{I_0(\beta)}\f$.
+ *
+ * Interpolating a regularly sampled signal at the reduced abscissa
+ * \f$u=i_0+\delta\f$, with \f$i_0=\lfloor u\rfloor\f$ and
+ * \f$\delta\in[0;1[\f$, needs the \f$2M\f$ weights
+ * \f$h(\delta+M-1-t)\f$, \f$t\in[\vert0;2M-1\vert]\f$, applied to samples
+ * \f$i_0-M+1+t\f$.
+ *
+ * <h3>Kernel table</h3>
+ *
+ * At construction, these \f$2M\f$ weights are computed for the \f$L+1\f$
+ * fractional offsets \f$\delta_p=p/L\f$ (\f$L\f$ being the oversampling
+ * factor) and stored contiguously phase by phase. The weights of each
+ * phase are normalized to a unit sum, so that a constant signal is
+ * exactly reproduced. At evaluation, the weights for any \f$\delta\f$ are
+ * linearly interpolated between the two nearest phases: the cost is
+ * \f$O(M)\f$ with no transcendental function call.
+ *
+ * \sa WindowedSinc, ComplexWindowedSinc
+ *********************************************************************/
+class SincKernel
+{
+public:
+    //! Default Constructor.
+    SincKernel();
+
+    //! Copy constructor
+    SincKernel(const SincKernel &other);
+
+    /*! ********************************************************************
+     * \brief Sinc kernel table constructor.
+     * \param [in] halfWidth the half-width \f$M\f$ of the kernel in samples
+     *             (the kernel uses \f$2M\f$ taps). Default to 8.
+     * \param [in] window the window applied to the truncated sinc kernel.
+     *             Default to SincWindow::kaiser.
+     * \param [in] oversampling the number \f$L\f$ of tabulated fractional
+     *             offsets per sample. Default to 512.
+     * \param [in] beta the shape parameter \f$\beta\f$ of the Kaiser window
+     *             (unused by the other windows). Default to 6.
+     *********************************************************************/
+    SincKernel(std::size_t halfWidth,
+               enum SincWindow window=SincWindow::kaiser,
+               std::size_t oversampling=512,
+               double beta=6.0);
+
+    //! Default Destructor
+    ~SincKernel();
+
+    // ============== CLASS METHODS ==============
+    // *************** GETTER ***************
+    /*! ********************************************************************
+     * \brief Get the half-width \f$M\f$ of the kernel in samples.
+     *********************************************************************/
+    std::size_t getHalfWidth() const;
+
+    /*! ********************************************************************
+     * \brief Get the number of taps \f$2M\f$ of the kernel.
+     *********************************************************************/
+    std::size_t getTaps() const;
+
+    /*! ********************************************************************
+     * \brief Get the oversampling factor \f$L\f$ of the kernel table.
+     *********************************************************************/
+    std::size_t getOversampling() const;
+
+    /*! ********************************************************************
+     * \brief Get the window applied to the truncated sinc kernel.
+     *********************************************************************/
+    enum SincWindow getWindow() const;
+
+    // ============== OPERATORS ==============
+    //! Assignement from another SincKernel
+    SincKernel operator=(const SincKernel &other);
+
+    // =========== SINC KERNEL METHODS ===========
+    /*! ********************************************************************
+     * \brief Get the kernel weights for a given fractional offset.
+     * \param [in] delta the fractional offset \f$\delta\in[0;1[\f$ of the
+     *             evaluation point from the sample at its left.
+     * \param [out] w a pointer to \f$2M\f$ values receiving the weights
+     *              to be applied to samples \f$i_0-M+1\f$ to \f$i_0+M\f$.
+     * \note This function call doesn't make bound checkings.
+     *********************************************************************/
+    void weights(const double &delta, double *w) const;
+
+    /*! ********************************************************************
+     * \brief Get the tabulated phase to use for a given fractional offset.
+     *
+     * The weights for \f$\delta\f$ are given by
+     * \f$(1-\alpha)w_0[t]+\alpha w_1[t]\f$ where \f$w_0\f$ is the returned
+     * phase and \f$w_1=w_0+2M\f$ the next one. This allows interpolators
+     * to apply both tabulated phases to the samples without building the
+     * weights.
+     *
+     * \param [in] delta the fractional offset \f$\delta\in[0;1[\f$ of the
+     *             evaluation point from the sample at its left.
+     * \param [out] alpha the linear interpolation factor between the
+     *              returned phase and the next one.
+     * \returns A pointer to the \f$2M\f$ weights of the tabulated phase at
+     *          the left of \f$\delta\f$.
+     * \note This function call doesn't make bound checkings.
+     *********************************************************************/
+    const double *phase(const double &delta, double &alpha) const;
+
+private:
+    std::size_t m_hw,       // Half-width of the kernel
+                m_taps,     // Number of taps (2 * m_hw)
+                m_L;        // Oversampling factor of the table
+    enum SincWindow m_window;
+    vector m_table;         // (m_L + 1) phases of m_taps weights
+};
+
+} // namespace Osl::Maths::Interpolator
+
+} // namespace Osl::Maths
+
+} // namespace Osl
+
+#endif // OSL_MATHS_INTERPOLATOR_SINCKERNEL_H
@@ -0,0 +1,258 @@
+/*! ********************************************************************
+ * \file StreamingCubicSpline.cpp
+ * \brief Source file of Osl::Maths::Interpolator::StreamingCubicSpline
+ *        class.
+ *********************************************************************/
+
+#include "StreamingCubicSpline.h"
+#include <cmath>
+
+namespace Osl { // Osl namespace
+
+namespace Maths { // Osl::Maths namespace
+
+namespace Interpolator { // Osl::Maths::Interpolator namespace
+
+// ============== STREAMING CUBIC INTERPOLATOR ==============
+// ============== CONSTRUCTOR ==============
+StreamingCubicSpline::StreamingCubicSpline(){}
+
+// Copy constructor
+StreamingCubicSpline::StreamingCubicSpline(const StreamingCubicSpline &other)
+    : m_seg(other.m_seg),
+      m_capacity(other.m_capacity), m_head(other.m_head),
+      m_n(other.m_n), m_nsamples(other.m_nsamples),
+      m_x0(other.m_x0), m_y0(other.m_y0), m_yp0(other.m_yp0),
+      m_x1(other.m_x1), m_y1(other.m_y1) {}
+
+StreamingCubicSpline::StreamingCubicSpline(std::size_t capacity)
+    : m_capacity(capacity)
+{
+    // Assertions
+    if (capacity < 1)
+        throw std::invalid_argument("StreamingCubicSpline constructor:\n"
+                                    "\t'capacity' must be at least 1.");
+    m_seg.resize(m_capacity);
+}
+
+// ============== DESTRUCTOR ==============
+StreamingCubicSpline::~StreamingCubicSpline(){}
+
+// ============== CLASS METHODS ==============
+// *************** GETTER ***************
+double StreamingCubicSpline::getXmin() const
+{
+    return this->isReady() ? m_seg[m_head].x : std::numeric_limits<double>::quiet_NaN();
+}
+double StreamingCubicSpline::getXmax() const
+{
+    return this->isReady() ? m_x1 : std::numeric_limits<double>::quiet_NaN();
+}
+std::size_t StreamingCubicSpline::size() const { return m_n; }
+std::size_t StreamingCubicSpline::getCapacity() const { return m_capacity; }
+bool StreamingCubicSpline::isReady() const { return m_n > 0; }
+
+// *************** SETTER ***************
+void StreamingCubicSpline::append(const double &x, const double &y)
+{
+    if (m_capacity == 0)
+        throw std::invalid_argument("StreamingCubicSpline.append()\n"
+                                    "\tThe interpolator has no capacity.");
+    if (std::isnan(x) || ((m_nsamples > 0) && !(x > m_x1)))
+        throw std::invalid_argument("StreamingCubicSpline.append()\n"
+                                    "\t'x' must be strictly greater than the last appended value.");
+
+    switch (m_nsamples)
+    {
+    case 0: // First sample
+    {
+        m_x1 = x;
+        m_y1 = y;
+        m_nsamples = 1;
+        break;
+    }
+    case 1: // Second sample: linear segment until the next sample is known
+    {
+        m_x0 = m_x1;
+        m_y0 = m_y1;
+        m_yp0 = (y - m_y0) / (x - m_x0);
+        m_x1 = x;
+        m_y1 = y;
+        hermite(this->push_segment(), m_x0, m_y0, m_yp0, m_x1, m_y1, m_yp0);
+        m_nsamples = 2;
+        break;
+    }
+    default:
+    {
+        double h0 = m_x1 - m_x0,
+               h1 = x - m_x1,
+               d0 = (m_y1 - m_y0) / h0,
+               d1 = (y - m_y1) / h1,
+               inv_h = 1.0 / (h0 + h1);
+        // Derivative at the last sample, now interior
+        double yp1 = (h1 * d0 + h0 * d1) * inv_h;
+        // One-sided estimate for the very first sample
+        if (m_nsamples == 2)
+            m_yp0 = ((2.0 * h0 + h1) * d0 - h0 * d1) * inv_h;
+        // The last segment is now final
+        hermite(this->segment(m_n - 1), m_x0, m_y0, m_yp0, m_x1, m_y1, yp1);
+        // Provisional new segment with a one-sided estimate at the new sample
+        double ypn = ((2.0 * h1 + h0) * d1 - h1 * d0) * inv_h;
+        hermite(this->push_segment(), m_x1, m_y1, yp1, x, y, ypn);
+        // Update last samples
+        m_x0 = m_x1;
+        m_y0 = m_y1;
+        m_yp0 = yp1;
+        m_x1 = x;
+        m_y1 = y;
+        m_nsamples = 3;
+    }
+    }
+}
+
+void StreamingCubicSpline::clear()
+{
+    m_head = 0;
+    m_n = 0;
+    m_nsamples = 0;
+}
+
+// ============== OPERATORS ==============
+// Assignement from another StreamingCubicSpline
+StreamingCubicSpline StreamingCubicSpline::operator=(const StreamingCubicSpline &other)
+{
+    m_seg = other.m_seg;
+    m_capacity = other.m_capacity;
+    m_head = other.m_head;
+    m_n = other.m_n;
+    m_nsamples = other.m_nsamples;
+    m_x0 = other.m_x0;
+    m_y0 = other.m_y0;
+    m_yp0 = other.m_yp0;
+    m_x1 = other.m_x1;
+    m_y1 = other.m_y1;
+    return *this;
+}
+
+// Function call
+void StreamingCubicSpline::operator()(const double &x, double &y)
+{
+    if (!this->isReady())
+    {
+        y = std::numeric_limits<double>::quiet_NaN();
+        return;
+    }
+    // Search index of coefficients for interpolation
+    const Segment &s = this->segment(this->search_index_for_interpolation(x));
+    // Compute the interpolated value
+    double dx = x - s.x;
+    y = ((s.a * dx + s.b) * dx + s.c) * dx + s.d;
+}
+
+void StreamingCubicSpline::operator()(const double &x, double &y, double &yp)
+{
+    if (!this->isReady())
+    {
+        y = yp = std::numeric_limits<double>::quiet_NaN();
+        return;
+    }
+    // Search index of coefficients for interpolation
+    const Segment &s = this->segment(this->search_index_for_interpolation(x));
+    // Compute the interpolated value
+    double dx = x - s.x;
+    y = ((s.a * dx + s.b) * dx + s.c) * dx + s.d;
+    yp = (3.0 * s.a * dx + 2.0 * s.b) * dx + s.c;
+}
+
+// =========== STREAMING CUBIC SPLINE METHODS ===========
+double StreamingCubicSpline::at(const double &x, bool extrapolate)
+{
+    if (!this->isReady())
+        throw std::invalid_argument("StreamingCubicSpline.at()\n"
+                                    "At least two samples must be appended.");
+    if (!extrapolate && ((x < this->getXmin()) || (x > m_x1)))
+        throw std::invalid_argument("StreamingCubicSpline.at()\n"
+                                    "Extrapolation is not authorized. To enable"
+                                    "extrapolation, set argument 'extrapolate'"
+                                    "to 'true'.");
+    double y;
+    (*this)(x, y);
+    return y;
+}
+
+void StreamingCubicSpline::evaluate(const double *x, double *y, std::size_t n,
+                                    bool sorted)
+{
+    if (n == 0)
+        return;
+    if (!this->isReady())
+    {
+        std::fill(y, y + n, std::numeric_limits<double>::quiet_NaN());
+        return;
+    }
+    std::size_t i = this->search_index_for_interpolation(x[0]),
+                last = m_n - 1;
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        if (sorted) // Monotone merge-walk
+        {
+            while ((i < last) && (x[k] >= this->segment(i+1).x))
+                ++i;
+        }
+        else
+            i = this->search_index_for_interpolation(x[k]);
+        const Segment &s = this->segment(i);
+        double dx = x[k] - s.x;
+        y[k] = ((s.a * dx + s.b) * dx + s.c) * dx + s.d;
+    }
+}
+
+std::size_t StreamingCubicSpline::search_index_for_interpolation(const double &xeval)
+{
+    if (!this->isReady())
+        throw std::invalid_argument("StreamingCubicSpline.search_index_for_interpolation()\n"
+                                    "\tAt least two samples must be appended.");
+    if (xeval >= this->segment(m_n - 1).x)
+        return m_n - 1;
+    if (xeval <= this->segment(0).x)
+        return 0;
+    std::size_t left=0, right=m_n, mid;
+    while (right - left > 1)
+    {
+        mid = (left + right) / 2;
+        if (xeval >= this->segment(mid).x)
+            left = mid;
+        else
+            right = mid;
+    }
+    return left; // We want the value <= x0
+}
+
+// ============== PRIVATE METHODS ==============
+void StreamingCubicSpline::hermite(Segment &s,
+                                   const double &x0, const double &y0, const double &yp0,
+                                   const double &x1, const double &y1, const double &yp1)
+{
+    double inv_dx = 1.0 / (x1 - x0),
+           dydx = (y1 - y0) * inv_dx;
+    s.x = x0;
+    s.a = (-2.0 * dydx + yp0 + yp1) * inv_dx * inv_dx;
+    s.b = (3.0 * dydx - 2.0 * yp0 - yp1) * inv_dx;
+    s.c = yp0;
+    s.d = y0;
+}
+
+StreamingCubicSpline::Segment &StreamingCubicSpline::push_segment()
+{
+    if (m_n < m_capacity)
+        ++m_n;
+    else // Eviction of the oldest segment
+        m_head = (m_head + 1 == m_capacity) ? 0 : m_head + 1;
+    return this->segment(m_n - 1);
+}
+
+} // namespace Osl::Maths::Interpolator
+
+} // namespace Osl::Maths
+
+} // namespace Osl
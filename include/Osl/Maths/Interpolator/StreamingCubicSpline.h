@@ -0,0 +1,228 @@
+/*! ********************************************************************
+ * \file StreamingCubicSpline.h
+ * \brief Header file of Osl::Maths::Interpolator::StreamingCubicSpline
+ *        class.
+ *********************************************************************/
+
+#ifndef OSL_MATHS_INTERPOLATOR_STREAMINGCUBICSPLINE_H
+#define OSL_MATHS_INTERPOLATOR_STREAMINGCUBICSPLINE_H
+
+#include <algorithm>
+#include <limits>
+#include "Osl/Globals.h"
+
+namespace Osl { // Osl namespace
+
+namespace Maths { // Osl::Maths namespace
+
+namespace Interpolator { // Osl::Maths::Interpolator namespace
+
+/*! ********************************************************************
+ * \brief Class to construct a piecewise cubic interpolator from real data
+ *        received sample by sample, over a sliding window.
+ *
+ * <h3>Principle</h3>
+ *
+ * Contrary to the CubicSpline class, whose coefficients depend on the
+ * whole data set through a tridiagonal system, this interpolator is a
+ * piecewise cubic Hermite interpolator whose derivatives at the nodes are
+ * estimated from the neighbouring samples only. At an interior node
+ * \f$x_k\f$, with \f$h_0=x_k-x_{k-1}\f$, \f$h_1=x_{k+1}-x_k\f$ and the
+ * slopes \f$\delta_0=(y_k-y_{k-1})/h_0\f$, \f$\delta_1=(y_{k+1}-y_k)/h_1\f$,
+ * the second order estimate is:
+ *
+ * \f[
+ *     y'_k=\dfrac{h_1\delta_0+h_0\delta_1}{h_0+h_1}
+ * \f]
+ *
+ * while the first and last nodes use the one-sided second order estimate.
+ * The interpolation function on \f$[x_k;x_{k+1}[\f$ is then:
+ *
+ * \f[
+ *     f_k(x)=a_k(x-x_k)^3+b_k(x-x_k)^2+c_k(x-x_k)+d_k
+ * \f]
+ *
+ * with the same coefficients as CubicSpline(const vector &x, const vector &y, const vector &yp).
+ *
+ * <h3>Streaming</h3>
+ *
+ * Appending a sample \f$(x_{n},y_{n})\f$ only needs the two previous
+ * samples: it fixes the derivative at \f$x_{n-1}\f$, so that the segment
+ * \f$[x_{n-2};x_{n-1}[\f$ becomes final, and provides a provisional last
+ * segment \f$[x_{n-1};x_{n}]\f$ which is updated at the next append.
+ * The cost of an append is thus \f$O(1)\f$. Segments are stored in a ring
+ * buffer of fixed capacity: once full, each append evicts the oldest
+ * segment, bounding the memory used whatever the length of the stream.
+ *
+ * \sa CubicSpline a cubic spline interpolator class built from the whole
+ *     data set.
+ *********************************************************************/
+class StreamingCubicSpline
+{
+public:
+    //! Default Constructor.
+    StreamingCubicSpline();
+
+    //! Copy constructor
+    StreamingCubicSpline(const StreamingCubicSpline &other);
+
+    /*! ********************************************************************
+     * \brief Streaming cubic interpolator constructor.
+     * \param [in] capacity the maximum number of segments kept in the
+     *             sliding window (the window spans at most
+     *             \f$capacity+1\f$ samples).
+     *********************************************************************/
+    StreamingCubicSpline(std::size_t capacity);
+
+    //! Default Destructor
+    ~StreamingCubicSpline();
+
+    // ============== CLASS METHODS ==============
+    // *************** GETTER ***************
+    /*! ********************************************************************
+     * \brief Get minimum x value.
+     * \returns The minimum x value of the current window, NaN if the
+     *          interpolator is not ready.
+     *********************************************************************/
+    double getXmin() const;
+
+    /*! ********************************************************************
+     * \brief Get maximum x value.
+     * \returns The maximum x value of the current window (the last
+     *          appended sample), NaN if the interpolator is not ready.
+     *********************************************************************/
+    double getXmax() const;
+
+    /*! ********************************************************************
+     * \brief Get the number of segments in the current window.
+     *********************************************************************/
+    std::size_t size() const;
+
+    /*! ********************************************************************
+     * \brief Get the maximum number of segments of the window.
+     *********************************************************************/
+    std::size_t getCapacity() const;
+
+    /*! ********************************************************************
+     * \brief Get whether the interpolator can be evaluated, that is if at
+     *        least two samples were appended.
+     *********************************************************************/
+    bool isReady() const;
+
+    // *************** SETTER ***************
+    /*! ********************************************************************
+     * \brief Append a sample to the stream.
+     *
+     * If the window is full, the oldest segment is evicted.
+     *
+     * \param [in] x the abscissa of the sample (not NaN and strictly
+     *             greater than the previous one).
+     * \param [in] y the value of the sample.
+     *********************************************************************/
+    void append(const double &x, const double &y);
+
+    /*! ********************************************************************
+     * \brief Remove all the samples, keeping the capacity.
+     *********************************************************************/
+    void clear();
+
+    // ============== OPERATORS ==============
+    //! Assignement from another StreamingCubicSpline
+    StreamingCubicSpline operator=(const StreamingCubicSpline &other);
+
+    /*! ********************************************************************
+     * \brief Evaluate the function at a given point.
+     * \param [in] x the value at which the function is evaluated.
+     * \param [out] y the interpolated value of the function, NaN if the
+     *              interpolator is not ready.
+     * \note This function call doesn't make bound checkings.
+     *********************************************************************/
+    void operator()(const double &x, double &y);
+
+    /*! ********************************************************************
+     * \brief Evaluate the function and its first derivative at a given point.
+     * \param [in] x the value at which the function is evaluated.
+     * \param [out] y the interpolated value of the function.
+     * \param [out] yp the interpolated value of the first derivative of the
+     *              function.
+     * \note This function call doesn't make bound checkings. \em y and
+     *       \em yp are NaN if the interpolator is not ready.
+     *********************************************************************/
+    void operator()(const double &x, double &y, double &yp);
+
+    // =========== STREAMING CUBIC SPLINE METHODS ===========
+    /*! ********************************************************************
+     * \brief Evaluate the function at a given point with bound checkings.
+     * \param [in] x the value at which the function is evaluated.
+     * \param [in] extrapolate whether to authorize extrapolation or not.
+     *             Default to false.
+     * \returns The value of the function at the given point.
+     *********************************************************************/
+    double at(const double &x, bool extrapolate=false);
+
+    /*! ********************************************************************
+     * \brief Evaluate the function at a set of points.
+     * \param [in] x a pointer to the \f$n\f$ values at which the function is
+     *             evaluated.
+     * \param [out] y a pointer to the \f$n\f$ interpolated values of the
+     *              function.
+     * \param [in] n the number of values to evaluate.
+     * \param [in] sorted whether \em x is in increasing order or not. If
+     *             true, indices are found with a monotone merge-walk.
+     *             Default to false.
+     * \note This function call doesn't make bound checkings. \em y is
+     *       filled with NaN if the interpolator is not ready.
+     *********************************************************************/
+    void evaluate(const double *x, double *y, std::size_t n, bool sorted=false);
+
+    /*! ********************************************************************
+     * \brief Search the index of the segment for interpolation.
+     * \param [in] xeval the value for which the index is searched.
+     * \returns The index, from the oldest segment of the window, of the
+     *          segment to evaluate the function at xeval.
+     * \note 1. If \f$x_{eval}\f$ is greater than the last node, the index of
+     *          the last segment is returned.
+     * \note 2. If \f$x_{eval}\f$ is lower than the first node (or NaN),
+     *          index 0 is returned.
+     * \throw std::invalid_argument if the interpolator is not ready.
+     *********************************************************************/
+    std::size_t search_index_for_interpolation(const double &xeval);
+
+private:
+    // Node and interpolation coefficients of a segment, packed in a single
+    // cache line
+    struct alignas(64) Segment
+    {
+        double x, a, b, c, d;
+    };
+    std::vector<Segment> m_seg;     // Ring buffer of segments
+    std::size_t m_capacity = 0,     // Size of the ring buffer
+                m_head = 0,         // Position of the oldest segment
+                m_n = 0,            // Number of segments in the window
+                m_nsamples = 0;     // Number of appended samples (saturated to 3)
+    double m_x0, m_y0, m_yp0,       // Second to last sample and its derivative
+           m_x1, m_y1;              // Last sample
+
+    // Get the segment at index from the oldest one
+    Segment &segment(const std::size_t &index)
+    {
+        std::size_t p = m_head + index;
+        return m_seg[p < m_capacity ? p : p - m_capacity];
+    }
+
+    // Set the coefficients of a cubic Hermite segment
+    static void hermite(Segment &s,
+                        const double &x0, const double &y0, const double &yp0,
+                        const double &x1, const double &y1, const double &yp1);
+
+    // Push a new segment, evicting the oldest one if the window is full
+    Segment &push_segment();
+};
+
+} // namespace Osl::Maths::Interpolator
+
+} // namespace Osl::Maths
+
+} // namespace Osl
+
+#endif // OSL_MATHS_INTERPOLATOR_STREAMINGCUBICSPLINE_H
@@ -0,0 +1,164 @@
+/*! ********************************************************************
+ * \file WindowedSinc.cpp
+ * \brief Source file of Osl::Maths::Interpolator::WindowedSinc class.
+ *********************************************************************/
+
+#include "WindowedSinc.h"
+
+namespace Osl { // Osl namespace
+
+namespace Maths { // Osl::Maths namespace
+
+namespace Interpolator { // Osl::Maths::Interpolator namespace
+
+// ============== WINDOWED SINC INTERPOLATOR ==============
+// ============== CONSTRUCTOR ==============
+WindowedSinc::WindowedSinc(){}
+
+// Copy constructor
+WindowedSinc::WindowedSinc(const WindowedSinc &other)
+    : m_xmin(other.m_xmin), m_xmax(other.m_xmax),
+      m_inv_dx(other.m_inv_dx),
+      m_y(other.m_y),
+      m_n(other.m_n),
+      m_kernel(other.m_kernel){}
+
+//
+WindowedSinc::WindowedSinc(const vector &x, const vector &y,
+                           std::size_t halfWidth, SincWindow window,
+                           std::size_t oversampling, double beta)
+    : m_kernel(halfWidth, window, oversampling, beta)
+{
+    this->setPoints(x, y);
+}
+
+// ============== DESTRUCTOR ==============
+WindowedSinc::~WindowedSinc(){}
+
+// ============== CLASS METHODS ==============
+// *************** GETTER ***************
+double WindowedSinc::getXmin() const { return m_xmin; }
+double WindowedSinc::getXmax() const { return m_xmax; }
+const SincKernel &WindowedSinc::getKernel() const { return m_kernel; }
+
+// *************** SETTER ***************
+void WindowedSinc::setPoints(const vector &x, const vector &y)
+{
+    // Assertions
+        // Checking that at least 2 points are provided
+    std::size_t xsize(x.size()), ysize(y.size());
+    if (xsize < 2)
+        throw std::invalid_argument("WindowedSinc constructor:\n"
+                                    "\t'x' and 'y' must be of size at least 2.");
+    if (xsize != ysize)
+        throw std::invalid_argument("WindowedSinc constructor:\n"
+                                    "\t'x' and 'y' must have same size.");
+        // Checking that 'x' is in strictly increasing order.
+    for (vector::const_iterator it = x.begin() ; it != x.end() - 1 ; ++it)
+    {
+        if (*it >= *(it+1))
+            throw std::invalid_argument("WindowedSinc constructor:\n"
+                                        "\t'x' vector must be in strictly increasing order.");
+    }
+        // Checking that 'x' is evenly spaced
+    double dx;
+    if (!Arrays::is_regspaced(x, dx))
+        throw std::invalid_argument("WindowedSinc constructor:\n"
+                                    "\t'x' vector must be evenly spaced.");
+
+    // Getting min and max values of interpolator
+    m_xmin = x.front();
+    m_xmax = x.back();
+
+    // Setting provided y values
+    m_y = y;
+
+    // inverse of xaxis variation
+    m_inv_dx = 1.0 / dx;
+    //
+    m_n = xsize;
+}
+
+// ============== OPERATORS ==============
+// Assignement from another WindowedSinc
+WindowedSinc WindowedSinc::operator=(const WindowedSinc &other)
+{
+    m_xmin = other.m_xmin;
+    m_xmax = other.m_xmax;
+    m_inv_dx = other.m_inv_dx;
+    m_y = other.m_y;
+    m_n = other.m_n;
+    m_kernel = other.m_kernel;
+    return *this;
+}
+
+// Function call
+void WindowedSinc::operator()(const double &x, double &y) const
+{
+    // Reduced abscissa u = i0 + delta
+    double u = (x - m_xmin) * m_inv_dx;
+    // Undefined abscissa: no conversion of NaN or infinity to an index
+    if (!std::isfinite(u))
+    {
+        y = std::numeric_limits<double>::quiet_NaN();
+        return;
+    }
+    std::ptrdiff_t taps = static_cast<std::ptrdiff_t>(m_kernel.getTaps()),
+                   n = static_cast<std::ptrdiff_t>(m_n);
+    // No sample within the kernel support (this also keeps the index below
+    // in range for huge abscissas)
+    if ((u <= -static_cast<double>(taps)) || (u >= static_cast<double>(n + taps)))
+    {
+        y = 0.0;
+        return;
+    }
+    double fl = std::floor(u),
+           alpha;
+    std::ptrdiff_t k0 = static_cast<std::ptrdiff_t>(fl) + 1
+                      - static_cast<std::ptrdiff_t>(m_kernel.getHalfWidth());
+    // Both tabulated phases are applied to the samples, then linearly
+    // interpolated: this avoids building the weights for each call.
+    const double *w0 = m_kernel.phase(u - fl, alpha),
+                 *w1 = w0 + taps;
+    double s0 = 0.0, s1 = 0.0;
+    if ((k0 >= 0) && (k0 + taps <= n))
+    {
+        const double *yk = m_y.data() + k0;
+        #pragma omp simd reduction(+:s0,s1)
+        for (std::ptrdiff_t t = 0 ; t < taps ; ++t)
+        {
+            s0 += w0[t] * yk[t];
+            s1 += w1[t] * yk[t];
+        }
+    }
+    else // Samples outside of the data are taken as null
+    {
+        std::ptrdiff_t tmin = std::max<std::ptrdiff_t>(0, -k0),
+                       tmax = std::min<std::ptrdiff_t>(taps, n - k0);
+        for (std::ptrdiff_t t = tmin ; t < tmax ; ++t)
+        {
+            s0 += w0[t] * m_y[k0 + t];
+            s1 += w1[t] * m_y[k0 + t];
+        }
+    }
+    y = s0 + alpha * (s1 - s0);
+}
+
+// =========== WINDOWED SINC METHODS ===========
+double WindowedSinc::at(const double &x, bool extrapolate) const
+{
+    if (!extrapolate && ((x < m_xmin) || (x > m_xmax)))
+        throw std::invalid_argument("WindowedSinc.at()\n"
+                                    "Extrapolation is not authorized. To enable"
+                                    "extrapolation, set argument 'extrapolate'"
+                                    "to 'true'.");
+    double y;
+    (*this)(x, y);
+    return y;
+}
+
+} // namespace Osl::Maths::Interpolator
+
+} // namespace Osl::Maths
+
+} // namespace Osl
@@ -0,0 +1,147 @@
+/*! ********************************************************************
+ * \file WindowedSinc.h
+ * \brief Header file of Osl::Maths::Interpolator::WindowedSinc class.
+ *********************************************************************/
+
+#ifndef OSL_MATHS_INTERPOLATOR_WINDOWEDSINC_H
+#define OSL_MATHS_INTERPOLATOR_WINDOWEDSINC_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "Osl/Globals.h"
+#include "Osl/Maths/Arrays/is_regspaced.h"
+#include "SincKernel.h"
+
+namespace Osl { // Osl namespace
+
+namespace Maths { // Osl::Maths namespace
+
+namespace Interpolator { // Osl::Maths::Interpolator namespace
+
+/*! ********************************************************************
+ * \brief Class to construct a windowed and truncated Sinc interpolator
+ *        from evenly spaced real data.
+ *
+ * <h3>Principle</h3>
+ *
+ * Contrary to the Sinc interpolator, which sums the contribution of the
+ * \f$N\f$ samples weighted by the sinc kernel for each evaluation point,
+ * this interpolator only uses the \f$2M\f$ samples closest to the
+ * evaluation point:
+ *
+ * \f[
+ *     f(x)=\sum\limits_{t=0}^{2M-1}h(\delta+M-1-t)\,y_{i_0-M+1+t},
+ *     \quad u=\dfrac{x-x_0}{\Delta x}=i_0+\delta
+ * \f]
+ *
+ * where \f$h\f$ is the windowed sinc kernel tabulated by a SincKernel.
+ * Each evaluation thus costs \f$O(M)\f$ operations with no
+ * transcendental function call. Samples lying outside of the provided
+ * data are taken as null.
+ *
+ * \sa ComplexWindowedSinc a windowed sinc interpolator class for complex
+ *     data, Sinc the full (non truncated) sinc interpolator.
+ *********************************************************************/
+class WindowedSinc
+{
+public:
+    //! Default Constructor.
+    WindowedSinc();
+
+    //! Copy constructor
+    WindowedSinc(const WindowedSinc &other);
+
+    /*! ********************************************************************
+     * \brief Windowed Sinc interpolator constructor.
+     * \param [in] x the axis where the function is evaluated.
+     * \param [in] y the values of the function evaluated at \f$x\f$
+     *        values.
+     * \param [in] halfWidth the half-width \f$M\f$ of the kernel in samples
+     *             (the kernel uses \f$2M\f$ taps). Default to 8.
+     * \param [in] window the window applied to the truncated sinc kernel.
+     *             Default to SincWindow::kaiser.
+     * \param [in] oversampling the oversampling factor of the kernel table.
+     *             Default to 512.
+     * \param [in] beta the shape parameter of the Kaiser window. Default
+     *             to 6.
+     * \throw std::invalid_argument if x axis is not evenly spaced.
+     *********************************************************************/
+    WindowedSinc(const vector &x, const vector &y,
+                 std::size_t halfWidth=8,
+                 enum SincWindow window=SincWindow::kaiser,
+                 std::size_t oversampling=512,
+                 double beta=6.0);
+
+    //! Default Destructor
+    ~WindowedSinc();
+
+    // ============== CLASS METHODS ==============
+    // *************** GETTER ***************
+    /*! ********************************************************************
+     * \brief Get minimum x value.
+     * \returns The minimum x value of the constructed interpolator.
+     *********************************************************************/
+    double getXmin() const;
+
+    /*! ********************************************************************
+     * \brief Get maximum x value.
+     * \returns The maximum x value of the constructed interpolator.
+     *********************************************************************/
+    double getXmax() const;
+
+    /*! ********************************************************************
+     * \brief Get the interpolation kernel.
+     * \returns A reference to the tabulated sinc kernel.
+     *********************************************************************/
+    const SincKernel &getKernel() const;
+
+    // *************** SETTER ***************
+    /*! ********************************************************************
+     * \brief Set the WindowedSinc interpolator points from \f$x\f$ and
+     *        \f$y\f$ data, keeping the current kernel.
+     * \param [in] x the axis where the function is evaluated.
+     * \param [in] y the values of the function evaluated at \f$x\f$ values.
+     * \throw std::invalid_argument if x axis is not evenly spaced.
+     *********************************************************************/
+    void setPoints(const vector &x, const vector &y);
+
+    // ============== OPERATORS ==============
+    //! Assignement from another WindowedSinc
+    WindowedSinc operator=(const WindowedSinc &other);
+
+    /*! ********************************************************************
+     * \brief Evaluate the function at a given point.
+     * \param [in] x the value at which the function is evaluated.
+     * \param [out] y the interpolated value of the function.
+     * \note This function call doesn't make bound checkings. A NaN or
+     *       infinite \f$x\f$ gives NaN, and the function is null far
+     *       enough from the data.
+     *********************************************************************/
+    void operator()(const double &x, double &y) const;
+
+    // =========== WINDOWED SINC METHODS ===========
+    /*! ********************************************************************
+     * \brief Evaluate the function at a given point with bound checkings.
+     * \param [in] x the value at which the function is evaluated.
+     * \param [in] extrapolate whether to authorize extrapolation or not.
+     *             Default to false.
+     * \returns The value of the function at the given point.
+     *********************************************************************/
+    double at(const double &x, bool extrapolate=false) const;
+
+private:
+    double m_xmin, m_xmax;              // Min and max value of interpolation
+    double m_inv_dx;                    // inverse of xaxis variation
+    vector m_y;                         // Function values
+    std::size_t m_n;                    // Size of function values vector
+    SincKernel m_kernel;                // Tabulated interpolation kernel
+};
+
+} // namespace Osl::Maths::Interpolator
+
+} // namespace Osl::Maths
+
+} // namespace Osl
+
+#endif // OSL_MATHS_INTERPOLATOR_WINDOWEDSINC_H
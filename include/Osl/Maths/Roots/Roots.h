@@ -8,6 +8,7 @@
 #ifndef OSL_MATHS_ROOTS_H
 #define OSL_MATHS_ROOTS_H
 
+#include "real_roots.h"
 #include "linear_root.h"
 #include "quadratic_roots.h"
 #include "cubic_roots.h"
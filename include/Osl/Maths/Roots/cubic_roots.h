@@ -11,6 +11,7 @@
 
 #include "Osl/Globals.h"
 #include "Osl/Maths/Comparison/true_zero.h"
+#include "Osl/Maths/Roots/real_roots.h"
 
 namespace Osl { // Osl namespace
 
@@ -108,6 +109,64 @@ inline void cubic_roots(const double &a, const double &b, const double &c, const
                 x1, x2, x3);
 }
 
+/*! ********************************************************************
+ * \brief Function to find the real roots of a third order (cubic)
+ *        polynomial with real coefficients.
+ *
+ * This function finds the real roots of a third order polynomial of the
+ * form:
+ *
+ * \f[
+ *      f(x)=ax^3+bx^2+cx+d
+ * \f]
+ *
+ * with \f$a\f$, \f$b\f$, \f$c\f$ and \f$d\f$ real coefficients, in
+ * real arithmetic: the trigonometric solution is used when the three roots
+ * are real, Cardano's formula with real cubic roots otherwise (see
+ * RealRoots::cubic()).
+ *
+ * \param [in] a, b, c, d the polynomial coefficients starting from its higher
+ *        order.
+ * \param [out] x1, x2, x3 the real roots in increasing order, NaN for the
+ *        missing ones.
+ * \returns The number of real roots: 1 or 3.
+ *********************************************************************/
+inline std::size_t cubic_roots(const double &a, const double &b, const double &c, const double &d,
+                               double &x1, double &x2, double &x3)
+{
+    if (a == 0.0)
+        throw std::invalid_argument("Osl::Maths::Roots::cubic_roots(): "
+                                    "Coefficient 'a' can't be zero.");
+    return RealRoots::cubic(a, b, c, d, x1, x2, x3);
+}
+
+/*! ********************************************************************
+ * \brief Function to find the real roots of a set of third order (cubic)
+ *        polynomials with real coefficients.
+ *
+ * Batch version of cubic_roots(const double &a, const double &b, const double &c, const double &d, double &x1, double &x2, double &x3)
+ * over arrays of coefficients in structure-of-arrays layout. The loop is
+ * branch-free and vectorized when the compiler provides vector versions
+ * of the elementary functions.
+ *
+ * \param [in] a, b, c, d pointers to the \f$n\f$ coefficients of each
+ *        order.
+ * \param [in] n the number of polynomials.
+ * \param [out] x1, x2, x3 pointers to the \f$n\f$ first, second and third
+ *        real roots, NaN for the missing ones.
+ * \param [out] nroots a pointer to the \f$n\f$ numbers of real roots.
+ *********************************************************************/
+inline void cubic_roots(const double *a, const double *b, const double *c, const double *d,
+                        std::size_t n,
+                        double *x1, double *x2, double *x3, std::size_t *nroots)
+{
+    if (RealRoots::any_zero(a, n))
+        throw std::invalid_argument("Osl::Maths::Roots::cubic_roots(): "
+                                    "Coefficients 'a' can't be zero.");
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+        nroots[i] = RealRoots::cubic(a[i], b[i], c[i], d[i], x1[i], x2[i], x3[i]);
+}
 
 } // namespace Osl::Maths::Roots
 
@@ -11,6 +11,7 @@
 
 #include "Osl/Globals.h"
 #include "Osl/Maths/Comparison/true_zero.h"
+#include "Osl/Maths/Roots/real_roots.h"
 
 namespace Osl { // Osl namespace
 
@@ -75,6 +76,67 @@ inline void quadratic_roots(const double &a, const double &b, const double &c,
     quadratic_roots(complex(a, 0.0), complex(b, 0.0), complex(c, 0.0), x1, x2);
 }
 
+/*! ********************************************************************
+ * \brief Function to find the real roots of a second order (quadratic)
+ *        polynomial with real coefficients.
+ *
+ * This function finds the real roots of a second order polynomial of the
+ * form:
+ *
+ * \f[
+ *      f(x)=ax^2+bx+c
+ * \f]
+ *
+ * with \f$a\f$, \f$b\f$ and \f$c\f$ real coefficients, in real
+ * arithmetic. The roots are computed with the cancellation free form:
+ *
+ * \f[
+ *      q=-\dfrac{1}{2}\left(b+\mathrm{sgn}(b)\sqrt{b^2-4ac}\right),\quad
+ *      x=\dfrac{q}{a},\quad x=\dfrac{c}{q}
+ * \f]
+ *
+ * \param [in] a, b, c the polynomial coefficients starting from its higher
+ *        order.
+ * \param [out] x1, x2 the real roots in increasing order (a double root
+ *        is returned twice), NaN if there is no real root.
+ * \returns The number of real roots: 0 or 2.
+ *********************************************************************/
+inline std::size_t quadratic_roots(const double &a, const double &b, const double &c,
+                                   double &x1, double &x2)
+{
+    if (a == 0.0)
+        throw std::invalid_argument("Osl::Maths::Roots::quadratic_roots(): "
+                                    "Coefficient 'a' can't be zero.");
+    return RealRoots::quadratic(a, b, c, x1, x2);
+}
+
+/*! ********************************************************************
+ * \brief Function to find the real roots of a set of second order
+ *        (quadratic) polynomials with real coefficients.
+ *
+ * Batch version of quadratic_roots(const double &a, const double &b, const double &c, double &x1, double &x2)
+ * over arrays of coefficients in structure-of-arrays layout. The loop is
+ * branch-free and vectorized.
+ *
+ * \param [in] a, b, c pointers to the \f$n\f$ coefficients of each
+ *        order.
+ * \param [in] n the number of polynomials.
+ * \param [out] x1, x2 pointers to the \f$n\f$ first and second real
+ *        roots, NaN if there is no real root.
+ * \param [out] nroots a pointer to the \f$n\f$ numbers of real roots.
+ *********************************************************************/
+inline void quadratic_roots(const double *a, const double *b, const double *c,
+                            std::size_t n,
+                            double *x1, double *x2, std::size_t *nroots)
+{
+    if (RealRoots::any_zero(a, n))
+        throw std::invalid_argument("Osl::Maths::Roots::quadratic_roots(): "
+                                    "Coefficients 'a' can't be zero.");
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+        nroots[i] = RealRoots::quadratic(a[i], b[i], c[i], x1[i], x2[i]);
+}
+
 } // namespace Osl::Maths::Roots
 
 } // namespace Osl::Maths
@@ -129,6 +129,68 @@ inline void quartic_roots(const double &a, const double &b, const double &c,
                   complex(d, 0.0), complex(e, 0.0), x1, x2, x3, x4);
 }
 
+/*! ********************************************************************
+ * \brief Function to find the real roots of a fourth order (quartic)
+ *        polynomial with real coefficients.
+ *
+ * This function finds the real roots of a fourth order polynomial of the
+ * form:
+ *
+ * \f[
+ *      f(x)=ax^4+bx^3+cx^2+dx+e
+ * \f]
+ *
+ * with \f$a\f$, \f$b\f$, \f$c\f$, \f$d\f$ and \f$e\f$ real
+ * coefficients, using Ferrari's solution in real arithmetic with a real
+ * resolvent (see RealRoots::quartic()).
+ *
+ * \param [in] a, b, c, d, e the polynomial coefficients starting from its higher
+ *        order.
+ * \param [out] x1, x2, x3, x4 the real roots in increasing order, NaN for
+ *        the missing ones.
+ * \returns The number of real roots: 0, 2 or 4.
+ *********************************************************************/
+inline std::size_t quartic_roots(const double &a, const double &b, const double &c,
+                                 const double &d, const double &e,
+                                 double &x1, double &x2, double &x3, double &x4)
+{
+    if (a == 0.0)
+        throw std::invalid_argument("Osl::Maths::Roots::quartic_roots(): "
+                                    "Coefficient 'a' can't be zero.");
+    return RealRoots::quartic(a, b, c, d, e, x1, x2, x3, x4);
+}
+
+/*! ********************************************************************
+ * \brief Function to find the real roots of a set of fourth order
+ *        (quartic) polynomials with real coefficients.
+ *
+ * Batch version of quartic_roots(const double &a, const double &b, const double &c, const double &d, const double &e, double &x1, double &x2, double &x3, double &x4)
+ * over arrays of coefficients in structure-of-arrays layout. The loop is
+ * branch-free and vectorized when the compiler provides vector versions
+ * of the elementary functions.
+ *
+ * \param [in] a, b, c, d, e pointers to the \f$n\f$ coefficients of each
+ *        order.
+ * \param [in] n the number of polynomials.
+ * \param [out] x1, x2, x3, x4 pointers to the \f$n\f$ real roots in
+ *        increasing order, NaN for the missing ones.
+ * \param [out] nroots a pointer to the \f$n\f$ numbers of real roots.
+ *********************************************************************/
+inline void quartic_roots(const double *a, const double *b, const double *c,
+                          const double *d, const double *e,
+                          std::size_t n,
+                          double *x1, double *x2, double *x3, double *x4,
+                          std::size_t *nroots)
+{
+    if (RealRoots::any_zero(a, n))
+        throw std::invalid_argument("Osl::Maths::Roots::quartic_roots(): "
+                                    "Coefficients 'a' can't be zero.");
+    #pragma omp simd
+    for (std::size_t i = 0 ; i < n ; ++i)
+        nroots[i] = RealRoots::quartic(a[i], b[i], c[i], d[i], e[i],
+                                       x1[i], x2[i], x3[i], x4[i]);
+}
+
 } // namespace Osl::Maths::Roots
 
 } // namespace Osl::Maths
@@ -0,0 +1,199 @@
+/*! ********************************************************************
+ * \file real_roots.h
+ * \brief Header file for Osl::Maths::Roots::RealRoots kernels.
+ *
+ * This header provides the real arithmetic kernels used by the real
+ * roots overloads of quadratic_roots, cubic_roots and quartic_roots.
+ * They make no checking on their coefficients and are written without
+ * branches (all the cases are computed and selected), so that loops
+ * over arrays of polynomials are vectorized.
+ *********************************************************************/
+
+#ifndef OSL_MATHS_ROOTS_REAL_ROOTS_H
+#define OSL_MATHS_ROOTS_REAL_ROOTS_H
+
+#include <algorithm>
+#include <limits>
+#include "Osl/Globals.h"
+#include "Osl/Constants.h"
+
+namespace Osl { // Osl namespace
+
+namespace  Maths { // Osl::Maths namespace
+
+namespace  Roots { // Osl::Maths::Roots namespace
+
+namespace  RealRoots { // Osl::Maths::Roots::RealRoots namespace
+
+/*! ********************************************************************
+ * \brief Check if any of the \f$n\f$ leading coefficients is zero.
+ *********************************************************************/
+inline bool any_zero(const double *a, std::size_t n)
+{
+    bool zero = false;
+    #pragma omp simd reduction(||:zero)
+    for (std::size_t i = 0 ; i < n ; ++i)
+        zero = zero || (a[i] == 0.0);
+    return zero;
+}
+
+/*! ********************************************************************
+ * \brief Real roots of \f$ax^2+bx+c\f$ in increasing order.
+ * \returns The number of real roots: 0 or 2 (a double root, within
+ *          rounding errors, being returned twice). Missing roots are NaN.
+ * \note \f$a\f$ is assumed non zero.
+ *********************************************************************/
+inline std::size_t quadratic(const double &a, const double &b, const double &c,
+                             double &x1, double &x2)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double tol = 8.0 * std::numeric_limits<double>::epsilon();
+    double disc = b * b - 4.0 * a * c,
+           q = -0.5 * (b + std::copysign(std::sqrt(std::max(disc, 0.0)), b)),
+           r1 = q / a,
+           r2 = (q != 0.0) ? c / q : r1;
+    // A discriminant within rounding of zero is a double root
+    bool real = disc >= -tol * std::max(b * b, std::abs(4.0 * a * c));
+    x1 = real ? std::min(r1, r2) : nan;
+    x2 = real ? std::max(r1, r2) : nan;
+    return real ? 2 : 0;
+}
+
+/*! ********************************************************************
+ * \brief Real roots of \f$ax^3+bx^2+cx+d\f$ in increasing order.
+ *
+ * With \f$s=b/3a\f$, \f$Q=s^2-c/3a\f$ and \f$R=s^3-sc/2a+d/2a\f$, the
+ * three real roots, when \f$R^2\le Q^3\f$, are given by the trigonometric
+ * solution:
+ *
+ * \f[
+ *     x_k=-2\sqrt{Q}\cos\left(\dfrac{\theta+2k\pi}{3}\right)-s,\quad
+ *     \theta=\arccos\left(\dfrac{R}{\sqrt{Q^3}}\right)
+ * \f]
+ *
+ * the discriminant \f$R^2-Q^3\f$ being taken as zero (double or triple
+ * root, returned as repeated roots) within rounding errors relative to
+ * the coefficients. Otherwise the single real root is given by Cardano's
+ * formula with real cubic roots:
+ *
+ * \f[
+ *     x=A+\dfrac{Q}{A}-s,\quad
+ *     A=-\mathrm{sgn}(R)\sqrt[3]{|R|+\sqrt{R^2-Q^3}}
+ * \f]
+ *
+ * \returns The number of real roots: 1 or 3 (counted with their
+ *          multiplicity). Missing roots are NaN.
+ * \note \f$a\f$ is assumed non zero.
+ *********************************************************************/
+inline std::size_t cubic(const double &a, const double &b, const double &c, const double &d,
+                         double &x1, double &x2, double &x3)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN(),
+                 two_pi_3 = 2.0 * Constants::m_pi * Constants::m_1_3;
+    double inva = 1.0 / a,
+           nc = c * inva,
+           s = b * inva * Constants::m_1_3,
+           Q = s * s - nc * Constants::m_1_3,
+           R = s * s * s - 0.5 * s * nc + 0.5 * d * inva,
+           Qp = std::max(Q, 0.0),
+           Q3 = Q * Q * Q,
+           R2 = R * R;
+    // A discriminant R^2 - Q^3 within rounding of zero (relatively to the
+    // coefficients) is a double (Q > 0) or triple (Q = 0) root
+    double t = std::max(std::max(std::abs(s), std::sqrt(std::abs(nc))), std::cbrt(std::abs(d * inva))),
+           t2 = t * t,
+           tol = 64.0 * std::numeric_limits<double>::epsilon() * t2;
+    bool three = (Q >= -tol) && (R2 <= Qp * Qp * Qp + tol * t2 * t2);
+    // Three real roots (repeated roots included): trigonometric solution
+    double sqrtQ = std::sqrt(Qp),
+           ratio = (three && (Qp > 0.0)) ? R / (Qp * sqrtQ) : 0.0,
+           theta = std::acos(std::min(std::max(ratio, -1.0), 1.0)) * Constants::m_1_3,
+           m2sqrtQ = -2.0 * sqrtQ;
+    // Single real root: Cardano's formula
+    double A = -std::copysign(std::cbrt(std::abs(R) + std::sqrt(std::max(R2 - Q3, 0.0))), R),
+           B = (A != 0.0) ? Q / A : 0.0;
+    x1 = three ? m2sqrtQ * std::cos(theta) - s : A + B - s;
+    x2 = three ? m2sqrtQ * std::cos(theta - two_pi_3) - s : nan;
+    x3 = three ? m2sqrtQ * std::cos(theta + two_pi_3) - s : nan;
+    return three ? 3 : 1;
+}
+
+/*! ********************************************************************
+ * \brief Real roots of \f$ax^4+bx^3+cx^2+dx+e\f$ in increasing order.
+ *
+ * Ferrari's method in real arithmetic: with \f$s=b/4a\f$, the depressed
+ * quartic \f$y^4+py^2+qy+r\f$ (\f$x=y-s\f$) is written as
+ *
+ * \f[
+ *     \left(y^2+\dfrac{p}{2}+m\right)^2=\left(\sqrt{2m}\,y-h\right)^2
+ * \f]
+ *
+ * where \f$m\ge0\f$ is the greatest real root of the resolvent cubic
+ * \f$m^3+pm^2+(p^2/4-r)m-q^2/8\f$ and
+ * \f$h=\mathrm{sgn}(q)\sqrt{m^2+pm+p^2/4-r}\f$, which also holds for the
+ * biquadratic case \f$q=0\f$. The roots are those of the two real
+ * quadratics \f$y^2\mp\sqrt{2m}\,y+p/2+m\pm h\f$, polished by a Newton
+ * iteration on the original polynomial.
+ *
+ * \returns The number of real roots: 0, 2 or 4 (counted with their
+ *          multiplicity). Missing roots are NaN, at the end.
+ * \note \f$a\f$ is assumed non zero.
+ *********************************************************************/
+inline std::size_t quartic(const double &a, const double &b, const double &c,
+                           const double &d, const double &e,
+                           double &x1, double &x2, double &x3, double &x4)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN(),
+                 inf = std::numeric_limits<double>::infinity();
+    double inva = 1.0 / a,
+           nb = b * inva, nc = c * inva, nd = d * inva, ne = e * inva;
+    // Depressed quartic
+    double s = 0.25 * nb, s2 = s * s,
+           p = nc - 6.0 * s2,
+           q = nd - 2.0 * nc * s + 8.0 * s2 * s,
+           r = ne - nd * s + nc * s2 - 3.0 * s2 * s2;
+    // Greatest root of the resolvent cubic
+    double m1, m2, m3;
+    std::size_t nm = cubic(1.0, p, 0.25 * p * p - r, -0.125 * q * q, m1, m2, m3);
+    double m = std::max((nm == 3) ? m3 : m1, 0.0),
+           sqrt2m = std::sqrt(2.0 * m),
+           h = std::copysign(std::sqrt(std::max(m * m + m * p + 0.25 * p * p - r, 0.0)), q),
+           k = 0.5 * p + m;
+    // Roots of the two quadratic factors
+    double y1, y2, y3, y4;
+    std::size_t n1 = quadratic(1.0, -sqrt2m, k + h, y1, y2),
+                n2 = quadratic(1.0, sqrt2m, k - h, y3, y4);
+    // Newton polishing, missing roots being pushed at the end
+    double v[4] = {y1 - s, y2 - s, y3 - s, y4 - s};
+    for (std::size_t j = 0 ; j < 4 ; ++j)
+    {
+        double x = v[j],
+               f = (((x + nb) * x + nc) * x + nd) * x + ne,
+               fp = ((4.0 * x + 3.0 * nb) * x + 2.0 * nc) * x + nd,
+               dx = f / fp;
+        x = (std::abs(dx) < std::abs(x) + 1.0) ? x - dx : x; // Skips infinite and NaN steps
+        v[j] = (x == x) ? x : inf;
+    }
+    // Sorting network
+    double lo, hi;
+    lo = std::min(v[0], v[1]); hi = std::max(v[0], v[1]); v[0] = lo; v[1] = hi;
+    lo = std::min(v[2], v[3]); hi = std::max(v[2], v[3]); v[2] = lo; v[3] = hi;
+    lo = std::min(v[0], v[2]); hi = std::max(v[0], v[2]); v[0] = lo; v[2] = hi;
+    lo = std::min(v[1], v[3]); hi = std::max(v[1], v[3]); v[1] = lo; v[3] = hi;
+    lo = std::min(v[1], v[2]); hi = std::max(v[1], v[2]); v[1] = lo; v[2] = hi;
+    x1 = (v[0] < inf) ? v[0] : nan;
+    x2 = (v[1] < inf) ? v[1] : nan;
+    x3 = (v[2] < inf) ? v[2] : nan;
+    x4 = (v[3] < inf) ? v[3] : nan;
+    return n1 + n2;
+}
+
+} // namespace Osl::Maths::Roots::RealRoots
+
+} // namespace Osl::Maths::Roots
+
+} // namespace Osl::Maths
+
+} // namespace Osl
+
+#endif // OSL_MATHS_ROOTS_REAL_ROOTS_H
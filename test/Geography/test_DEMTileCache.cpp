@@ -0,0 +1,170 @@
+// ===== TESTS RasterFile and DEMTileCache =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+int main()
+{
+   using namespace Osl;
+   using Geography::DEMTileCache,
+         Geography::DEMCacheStats,
+         Geography::RasterType;
+
+   using OslTest::check;
+   const bool little = (Endian::Endianness::native == Endian::Endianness::little);
+
+   // Synthetic SRTM-like 1° tiles of 11 x 11 big-endian samples (0.1°
+   // spacing), from N00E000 to N01E002: h = 100 lat + 10 lon, so that
+   // the bilinear interpolation is exact. N00E002 has a void sample at
+   // its center.
+   std::filesystem::path dir = std::filesystem::temp_directory_path() / "osl_test_dem";
+   std::filesystem::create_directories(dir);
+   const std::size_t ns = 11, tileBytes = ns * ns * sizeof(float);
+   for (int ilat = 0 ; ilat < 2 ; ++ilat)
+       for (int ilon = 0 ; ilon < 3 ; ++ilon)
+       {
+           std::vector<std::int16_t> samples(ns * ns);
+           for (std::size_t i = 0 ; i < ns ; ++i)
+               for (std::size_t j = 0 ; j < ns ; ++j)
+                   samples[i * ns + j] = static_cast<std::int16_t>(
+                               10 * (10 * ilat + 10 - int(i)) + 10 * ilon + int(j));
+           if ((ilat == 0) && (ilon == 2))
+               samples[5 * ns + 5] = -32768;
+           for (std::int16_t &s : samples)
+               if (little)
+                   Endian::swapEndianInplace(s);
+           char name[32];
+           std::snprintf(name, sizeof(name), "N%02dE%03d.hgt", ilat, ilon);
+           std::ofstream out(dir / name, std::ios::binary);
+           out.write(reinterpret_cast<const char*>(samples.data()),
+                     static_cast<std::streamsize>(samples.size() * sizeof(std::int16_t)));
+       }
+   auto exact = [](double lon, double lat) { return 100.0 * lat + 10.0 * lon; };
+
+   // ***** RasterFile *****
+   std::cout << "RasterFile:" << std::endl;
+   check("rasterSampleSize(int16)", Geography::rasterSampleSize(RasterType::int16), 2.0, 0.0);
+   check("rasterSampleSize(float32)", Geography::rasterSampleSize(RasterType::float32), 4.0, 0.0);
+   check("rasterSampleSize(float64)", Geography::rasterSampleSize(RasterType::float64), 8.0, 0.0);
+   std::string tile00 = (dir / "N00E000.hgt").string();
+   std::shared_ptr<const unsigned char> data =
+       Geography::mapRasterFile(tile00, 2 * ns, (ns - 1) * ns * 2, "test");
+   // Second row (lat 0.9°), its first and last samples
+   check("readRasterSample(0, 0)", Geography::readRasterSample<std::int16_t>(data.get(), little), 90.0, 0.0);
+   check("readRasterSample(0, 10)",
+         Geography::readRasterSample<std::int16_t>(data.get() + 2 * (ns - 1), little), 100.0, 0.0);
+   bool thrown = false;
+   try { Geography::mapRasterFile(tile00, 2, ns * ns * 2, "test"); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("mapRasterFile (too small) throws", thrown);
+   thrown = false;
+   try { Geography::mapRasterFile((dir / "missing.hgt").string(), 0, 2, "test"); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("mapRasterFile (missing) throws", thrown);
+
+   // ***** Hits, misses and evictions (budget of two tiles) *****
+   std::cout << "DEMTileCache, budget of two tiles:" << std::endl;
+   DEMTileCache dem(dir.string(), ns, 2 * tileBytes);
+   check("h(0.55°, 0.55°)", dem.height(0.55, 0.55), exact(0.55, 0.55), 1e-12);
+   check("h(0.25°, 0.35°)", dem.height(0.25, 0.35), exact(0.25, 0.35), 1e-12);
+   DEMCacheStats stats = dem.getStats();
+   check("misses", stats.misses, 1.0, 0.0);
+   check("hits", stats.hits, 1.0, 0.0);
+   check("tiles", stats.tiles, 1.0, 0.0);
+   check("memoryUsage", stats.memoryUsage, tileBytes, 0.0);
+   check("h(1.5°, 0.5°)", dem.height(1.5, 0.5), exact(1.5, 0.5), 1e-12);
+   check("h(0.5°, 1.5°)", dem.height(0.5, 1.5), exact(0.5, 1.5), 1e-12);
+   stats = dem.getStats();
+   check("misses", stats.misses, 3.0, 0.0);
+   check("evictions", stats.evictions, 1.0, 0.0);
+   check("tiles", stats.tiles, 2.0, 0.0);
+   check("memoryUsage", stats.memoryUsage, 2 * tileBytes, 0.0);
+   // The least recently used tile (N00E000) was evicted, N00E001 is kept
+   dem.height(1.5, 0.5);
+   check("hits (N00E001 kept)", dem.getStats().hits, 2.0, 0.0);
+   dem.height(0.5, 0.5);
+   check("misses (N00E000 evicted)", dem.getStats().misses, 4.0, 0.0);
+   // Shared borders: both tiles give the same height
+   check("h(1°, 0.5°) (tile border)", dem.height(1.0, 0.5), exact(1.0, 0.5), 1e-12);
+   check("h(0.5°, 1°) (tile border)", dem.height(0.5, 1.0), exact(0.5, 1.0), 1e-12);
+   check("h(360.5°, 0.5°) (wrapped)", dem.height(360.5, 0.5), exact(0.5, 0.5), 1e-12);
+   check("h(0.5°, 0.5°) [rad]",
+         dem.height(0.5 * Constants::m_degtorad, 0.5 * Constants::m_degtorad, false),
+         exact(0.5, 0.5), 1e-9);
+
+   // Missing tiles have a height of 0 m and no memory, voids are NaN
+   check("h(5.5°, 5.5°) (missing tile)", dem.height(5.5, 5.5), 0.0, 0.0);
+   stats = dem.getStats();
+   check("missingTiles", stats.missingTiles, 1.0, 0.0);
+   check("memoryUsage", stats.memoryUsage, 2 * tileBytes, 0.0);
+   check("h(2.5°, 0.5°) (void)", dem.height(2.5, 0.5), std::nan(""), 0.0);
+   check("h(2.45°, 0.45°) (void)", dem.height(2.45, 0.45), std::nan(""), 0.0);
+   check("h(2.05°, 0.95°) (next to a void)", dem.height(2.05, 0.95), exact(2.05, 0.95), 1e-12);
+   check("h(NaN, 0.5°)", dem.height(std::nan(""), 0.5), std::nan(""), 0.0);
+   check("h(0.5°, NaN)", dem.height(0.5, std::nan("")), std::nan(""), 0.0);
+   check("h(inf, 0.5°)", dem.height(INFINITY, 0.5), std::nan(""), 0.0);
+
+   // ***** Prefetching *****
+   std::cout << "DEMTileCache, prefetching:" << std::endl;
+   dem.clear();
+   dem.resetStats();
+   dem.setMemoryBudget(100 * tileBytes);
+   dem.prefetch(0.5, 0.5); // 3 x 3 tiles, 4 of them with a file
+   stats = dem.getStats();
+   check("prefetches", stats.prefetches, 9.0, 0.0);
+   check("missingTiles", stats.missingTiles, 5.0, 0.0);
+   check("memoryUsage", stats.memoryUsage, 4 * tileBytes, 0.0);
+   dem.height(1.5, 1.5);
+   check("hits (prefetched tile)", dem.getStats().hits, 1.0, 0.0);
+   check("misses", dem.getStats().misses, 0.0, 0.0);
+   dem.clear();
+   dem.resetStats();
+   dem.setPrefetchRadius(1);
+   dem.height(1.5, 0.5); // Loads N00E001 and prefetches its 8 neighbours
+   stats = dem.getStats();
+   check("misses (prefetch on miss)", stats.misses, 1.0, 0.0);
+   check("prefetches (prefetch on miss)", stats.prefetches, 8.0, 0.0);
+   check("tiles", stats.tiles, 9.0, 0.0);
+   dem.setMemoryBudget(tileBytes);
+   check("memoryUsage (budget reduced)", dem.getStats().memoryUsage, tileBytes, 0.0);
+   thrown = false;
+   try { dem.prefetch(std::nan(""), 0.5); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("prefetch(NaN) throws", thrown);
+
+   // ***** Batch heights *****
+   std::cout << "DEMTileCache, batch heights:" << std::endl;
+   dem.setPrefetchRadius(0);
+   dem.setMemoryBudget(2 * tileBytes);
+   std::size_t n = 2000;
+   std::mt19937 gen(20);
+   std::uniform_real_distribution<double> ulon(0.0, 2.0), ulat(0.0, 2.0);
+   vector lon(n), lat(n), h;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       lon[i] = ulon(gen);
+       lat[i] = ulat(gen);
+   }
+   lat[7] = std::nan("");
+   dem.height(lon, lat, h);
+   double max_err = 0.0, max_scalar = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       if (i == 7)
+           continue;
+       max_err = std::max(max_err, std::abs(h[i] - exact(lon[i], lat[i])));
+       max_scalar = std::max(max_scalar, std::abs(h[i] - dem.height(lon[i], lat[i])));
+   }
+   check("Batch: max error [m]", max_err, 0.0, 1e-11);
+   check("Batch vs scalar: max error [m]", max_scalar, 0.0, 0.0);
+   check("Batch: h(NaN)", h[7], std::nan(""), 0.0);
+   check("Batch: memoryUsage within budget", dem.getStats().memoryUsage <= 2 * tileBytes, 1.0, 0.0);
+
+   std::filesystem::remove_all(dir);
+   return OslTest::report();
+}
@@ -0,0 +1,121 @@
+// ===== TESTS DatumTransform =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iostream>
+#include <random>
+
+int main()
+{
+   using namespace Osl;
+   using Geography::WGS84,
+         Geography::GRS80,
+         Geography::Clk80IGN,
+         Geography::GeoPoint,
+         Geography::GeoPointArray,
+         Geography::DatumTransform;
+
+   using OslTest::check;
+   auto dist = [](double x1, double y1, double z1, double x2, double y2, double z2)
+   {
+       return std::sqrt((x1 - x2) * (x1 - x2) + (y1 - y2) * (y1 - y2) + (z1 - z2) * (z1 - z2));
+   };
+
+   // NTF (Clarke 1880 IGN) to WGS84 translation, and a 7-parameters
+   // transform from WGS84 to GRS80 (angles in arc-seconds, scale in ppm)
+   const double sec = Constants::m_pi / (180.0 * 3600.0);
+   DatumTransform ntf(Clk80IGN, WGS84, -168.0, -60.0, 320.0),
+                  helm(WGS84, GRS80, 0.1, -0.2, 0.3, 0.5 * sec, -0.3 * sec, 0.8 * sec, 1.5e-6);
+
+   // Analytic cases: pure translation and small rotation about z
+   double a = Clk80IGN->getEquatorialRadius(), x, y, z;
+   ntf.transformGeocentric(a, 0.0, 0.0, x, y, z);
+   check("Translation: error [m]", dist(x, y, z, a - 168.0, -60.0, 320.0), 0.0);
+   DatumTransform rz(WGS84, WGS84, 0.0, 0.0, 0.0, 0.0, 0.0, 1e-6, 2e-6);
+   rz.transformGeocentric(1e7, 0.0, 0.0, x, y, z);
+   check("Rotation about z: error [m]", dist(x, y, z, 1e7 * (1.0 + 2e-6), 10.0 * (1.0 + 2e-6), 0.0), 1e-8);
+
+   // Same transform as GeoPoint::toEllipsoid
+   GeoPoint p(Clk80IGN, 2.35, 48.85, 35.0);
+   GeoPoint q = ntf.transform(p),
+            r = p.toEllipsoid(WGS84, -168.0, -60.0, 320.0);
+   check("transform(GeoPoint) vs toEllipsoid: error [m]",
+         dist(q.getX(), q.getY(), q.getZ(), r.getX(), r.getY(), r.getZ()), 1e-8);
+
+   // Random points near the ground
+   std::size_t n = 1000;
+   std::mt19937 gen(23);
+   std::uniform_real_distribution<double> ulon(-180.0, 180.0), ulat(-89.0, 89.0), ualt(-100.0, 3000.0);
+   vector lon(n), lat(n), alt(n), x1, y1, z1;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       lon[i] = ulon(gen);
+       lat[i] = ulat(gen);
+       alt[i] = ualt(gen);
+   }
+   Clk80IGN->geodeticToGeocentric(lon, lat, alt, x1, y1, z1);
+
+   // Round trips with the exact inverse, geocentric and geodetic
+   DatumTransform chain = ntf.then(helm), back = chain.inverse();
+   vector x2, y2, z2, x3, y3, z3, lon2, lat2, alt2, lon3, lat3, alt3;
+   chain.transformGeocentric(x1, y1, z1, x2, y2, z2);
+   back.transformGeocentric(x2, y2, z2, x3, y3, z3);
+   chain.transformGeodetic(lon, lat, alt, lon2, lat2, alt2);
+   back.transformGeodetic(lon2, lat2, alt2, lon3, lat3, alt3);
+   double max_rt = 0.0, max_dll = 0.0, max_dalt = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       max_rt = std::max(max_rt, dist(x1[i], y1[i], z1[i], x3[i], y3[i], z3[i]));
+       max_dll = std::max(max_dll, std::abs(std::remainder(lon3[i] - lon[i], 360.0)) + std::abs(lat3[i] - lat[i]));
+       max_dalt = std::max(max_dalt, std::abs(alt3[i] - alt[i]));
+   }
+   check("Geocentric round trip: max error [m]", max_rt, 1e-8);
+   check("Geodetic round trip: max |dlonlat| [°]", max_dll, 1e-12);
+   check("Geodetic round trip: max |dalt| [m]", max_dalt, 1e-7);
+
+   // Composition against the chained transforms, batch against scalar
+   double max_then = 0.0, max_batch = 0.0, max_geo = 0.0;
+   vector xg, yg, zg;
+   chain.geodeticToGeocentric(lon, lat, alt, xg, yg, zg);
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       double xa, ya, za, xb, yb, zb;
+       ntf.transformGeocentric(x1[i], y1[i], z1[i], xa, ya, za);
+       helm.transformGeocentric(xa, ya, za, xb, yb, zb);
+       max_then = std::max(max_then, dist(xb, yb, zb, x2[i], y2[i], z2[i]));
+       chain.transformGeocentric(x1[i], y1[i], z1[i], xa, ya, za);
+       max_batch = std::max(max_batch, dist(xa, ya, za, x2[i], y2[i], z2[i]));
+       max_geo = std::max(max_geo, dist(xg[i], yg[i], zg[i], x2[i], y2[i], z2[i]));
+   }
+   check("then() vs chained transforms: max error [m]", max_then, 1e-8);
+   check("Batch vs scalar: max error [m]", max_batch, 1e-8);
+   check("geodeticToGeocentric vs transformGeocentric: max error [m]", max_geo, 1e-8);
+
+   // Transform of a GeoPointArray
+   GeoPointArray pts(Clk80IGN, lon, lat, alt), tpts = chain.transform(pts);
+   double max_arr = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       tpts.getGeocentricPoint(i, x, y, z);
+       max_arr = std::max(max_arr, dist(x, y, z, x2[i], y2[i], z2[i]));
+   }
+   check("transform(GeoPointArray): max error [m]", max_arr, 1e-8);
+
+   // Composition of mismatched transforms
+   bool thrown = false;
+   try { helm.then(ntf); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("then() with mismatched ellipsoids throws", thrown);
+
+   // Points not on the source ellipsoid
+   thrown = false;
+   try { helm.transform(p); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("transform(GeoPoint) on the wrong ellipsoid throws", thrown);
+   thrown = false;
+   try { helm.transform(pts); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("transform(GeoPointArray) on the wrong ellipsoid throws", thrown);
+
+   return OslTest::report();
+}
@@ -1,7 +1,9 @@
 // ===== TESTS Ellipsoid =====
 #include "Osl.h"
+#include "OslTest.h"
 #include <chrono>
 #include <iomanip>
+#include <iostream>
 
 int main()
 {
@@ -10,16 +12,17 @@ int main()
          Geography::GRS80,
          Geography::Clk80IGN;
 
-   std::cout << "WGS84 == WGS84 ? " << ((WGS84 == WGS84) ? "true" : "false") << std::endl;
-   std::cout << "WGS84 == GRS80 ? " << ((WGS84 == GRS80) ? "true" : "false") << std::endl;
-   std::cout << "WGS84 == Clk80IGN ? " << ((WGS84 == Clk80IGN) ? "true" : "false") << std::endl;
+   Geography::Ellipsoid wgs84(*WGS84);
+   OslTest::check("*WGS84 == copy of *WGS84", *WGS84 == wgs84);
+   OslTest::check("*WGS84 != *GRS80", !(*WGS84 == *GRS80) && (*WGS84 != *GRS80));
+   OslTest::check("*WGS84 != *Clk80IGN", !(*WGS84 == *Clk80IGN) && (*WGS84 != *Clk80IGN));
 
-   double a = WGS84.getEquatorialRadius(),
-          b = WGS84.getPolarRadius(),
-          f = WGS84.getFirstFlattening(),
-          f2 = WGS84.getSecondFlattening(),
-          n = WGS84.getThirdFlattening(),
-          e = WGS84.getEccentricity();
+   double a = WGS84->getEquatorialRadius(),
+          b = WGS84->getPolarRadius(),
+          f = WGS84->getFirstFlattening(),
+          f2 = WGS84->getSecondFlattening(),
+          n = WGS84->getThirdFlattening(),
+          e = WGS84->getEccentricity();
 
    std::cout << std::setprecision(14);
    std::cout << "a = " << a << std::endl
@@ -36,7 +39,7 @@ int main()
    for (auto it = lat.begin() ; it != lat.end() ; ++it)
    {
        std::cout << "lat(" << *it << ") = "
-                 << WGS84.inverseGeocentricLatitude(WGS84.geocentricLatitude(*it))
+                 << WGS84->inverseGeocentricLatitude(WGS84->geocentricLatitude(*it))
                  << "°" << std::endl;
    }
    std::cout << std::endl;
@@ -46,7 +49,7 @@ int main()
    for (auto it = lat.begin() ; it != lat.end() ; ++it)
    {
        std::cout << "lat(" << *it << ") = "
-                 << WGS84.inverseParametricLatitude(WGS84.parametricLatitude(*it))
+                 << WGS84->inverseParametricLatitude(WGS84->parametricLatitude(*it))
                  << "°" << std::endl;
    }
    std::cout << std::endl;
@@ -56,7 +59,7 @@ int main()
    for (auto it = lat.begin() ; it != lat.end() ; ++it)
    {
        std::cout << "lat(" << *it << ") = "
-                 << WGS84.inverseRectifyingLatitude(WGS84.rectifyingLatitude(*it))
+                 << WGS84->inverseRectifyingLatitude(WGS84->rectifyingLatitude(*it))
                  << "°" << std::endl;
    }
    std::cout << std::endl;
@@ -66,7 +69,7 @@ int main()
    for (auto it = lat.begin() ; it != lat.end() ; ++it)
    {
        std::cout << "lat(" << *it << ") = "
-                 << WGS84.inverseAuthalicLatitude(WGS84.authalicLatitude(*it))
+                 << WGS84->inverseAuthalicLatitude(WGS84->authalicLatitude(*it))
                  << "°" << std::endl;
    }
    std::cout << std::endl;
@@ -76,7 +79,7 @@ int main()
    for (auto it = lat.begin() ; it != lat.end() ; ++it)
    {
        std::cout << "lat(" << *it << ") = "
-                 << WGS84.inverseConformalLatitude(WGS84.conformalLatitude(*it))
+                 << WGS84->inverseConformalLatitude(WGS84->conformalLatitude(*it))
                  << "°" << std::endl;
    }
    std::cout << std::endl;
@@ -86,7 +89,7 @@ int main()
    for (auto it = lat.begin() ; it != lat.end() ; ++it)
    {
        std::cout << "lat(" << *it << ") = "
-                 << WGS84.inverseIsometricLatitude(WGS84.isometricLatitude(*it))
+                 << WGS84->inverseIsometricLatitude(WGS84->isometricLatitude(*it))
                  << "°" << std::endl;
    }
    std::cout << std::endl;
@@ -100,8 +103,8 @@ int main()
    {
        for (auto ila = lat.begin() ; ila != lat.end() ; ++ila)
        {
-           WGS84.geodeticToGeocentric(*ilo, *ila, alt, x, y, z);
-           WGS84.geocentricToGeodetic(x, y, z, lo, la, h);
+           WGS84->geodeticToGeocentric(*ilo, *ila, alt, x, y, z);
+           WGS84->geocentricToGeodetic(x, y, z, lo, la, h);
            std::cout << "(lon, lat, alt) = ("
                      << *ilo << "°, " << *ila << "°, " << alt << ") = ("
                      << lo << "°, " << la << "°, " << h << " m)"
@@ -110,5 +113,79 @@ int main()
    }
    std::cout << std::endl;
 
-   return 0;
+   // Test batch geodetic to geocentric and vice-versa
+   std::cout << "Test batch geodetic to geocentric and vice-versa:" << std::endl;
+   std::size_t npts = lon.size() * lat.size();
+   vector blon(npts), blat(npts), balt(npts, 1000.0), bx, by, bz, blon2, blat2, balt2;
+   for (std::size_t i = 0 ; i < lon.size() ; ++i)
+   {
+       for (std::size_t j = 0 ; j < lat.size() ; ++j)
+       {
+           blon[i * lat.size() + j] = lon[i];
+           blat[i * lat.size() + j] = lat[j];
+       }
+   }
+   WGS84->geodeticToGeocentric(blon, blat, balt, bx, by, bz);
+   WGS84->geocentricToGeodetic(bx, by, bz, blon2, blat2, balt2);
+   double max_dlat = 0.0, max_dalt = 0.0;
+   for (std::size_t i = 0 ; i < npts ; ++i)
+   {
+       max_dlat = std::max(max_dlat, std::abs(blat2[i] - blat[i]));
+       max_dalt = std::max(max_dalt, std::abs(balt2[i] - balt[i]));
+   }
+   OslTest::check("batch round trip: max |dlat| [°]", max_dlat, 1e-13);
+   OslTest::check("batch round trip: max |dalt| [m]", max_dalt, 1e-8);
+   // Batch against scalar inverse (documented tolerance: 1e-13° and 1e-8 m)
+   max_dlat = 0.0;
+   max_dalt = 0.0;
+   for (std::size_t i = 0 ; i < npts ; ++i)
+   {
+       double lo, la, h;
+       WGS84->geocentricToGeodetic(bx[i], by[i], bz[i], lo, la, h);
+       max_dlat = std::max(max_dlat, std::abs(blat2[i] - la));
+       max_dalt = std::max(max_dalt, std::abs(balt2[i] - h));
+   }
+   OslTest::check("batch vs scalar: max |dlat| [°]", max_dlat, 1e-13);
+   OslTest::check("batch vs scalar: max |dalt| [m]", max_dalt, 1e-8);
+   std::cout << std::endl;
+
+   // Test batch latitudes against scalar ones
+   std::cout << "Test batch latitudes against scalar ones:" << std::endl;
+   vector bmu, blat3;
+   WGS84->rectifyingLatitude(lat, bmu);
+   WGS84->inverseRectifyingLatitude(bmu, blat3);
+   double max_dmu = 0.0, max_dinv = 0.0;
+   for (std::size_t i = 0 ; i < lat.size() ; ++i)
+   {
+       max_dmu = std::max(max_dmu, std::abs(bmu[i] - WGS84->rectifyingLatitude(lat[i])));
+       max_dinv = std::max(max_dinv, std::abs(blat3[i] - WGS84->inverseRectifyingLatitude(bmu[i])));
+   }
+   OslTest::check("batch vs scalar rectifying latitude: max |dmu| [°]", max_dmu, 1e-13);
+   OslTest::check("batch vs scalar inverse rectifying latitude: max |dlat| [°]", max_dinv, 1e-13);
+   max_dinv = 0.0;
+   for (std::size_t i = 0 ; i < lat.size() ; ++i)
+       max_dinv = std::max(max_dinv, std::abs(blat3[i] - lat[i]));
+   OslTest::check("batch rectifying latitude round trip: max |dlat| [°]", max_dinv, 1e-12);
+   std::cout << std::endl;
+
+   // Test meridian distance series against the elliptic integral
+   std::cout << "Test meridian distance:" << std::endl;
+   vector mlat = Maths::Arrays::linspace(-90.0, 90.0, 361), bm;
+   WGS84->meridianDistance(mlat, bm);
+   double max_dser = 0.0, max_dbatch = 0.0;
+   for (std::size_t i = 0 ; i < mlat.size() ; ++i)
+   {
+       double ms = WGS84->meridianDistance(mlat[i]),
+              me = WGS84->meridianDistance(mlat[i], true,
+                                           Geography::MeridianDistanceMethod::fromEllipticIntegral);
+       max_dser = std::max(max_dser, std::abs(ms - me));
+       max_dbatch = std::max(max_dbatch, std::abs(bm[i] - ms));
+   }
+   OslTest::check("series vs elliptic integral: max |dm| [m]", max_dser, 1e-6);
+   OslTest::check("batch vs scalar: max |dm| [m]", max_dbatch, 1e-8);
+   // WGS84 quarter meridian (Karney 2011)
+   OslTest::check("m(90°) [m]", WGS84->meridianDistance(90.0), 10001965.7293127, 1e-6);
+   std::cout << std::endl;
+
+   return OslTest::report();
 }
@@ -0,0 +1,90 @@
+// ===== TESTS GeoPointArray =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iostream>
+#include <random>
+
+int main()
+{
+   using namespace Osl;
+   using Geography::WGS84,
+         Geography::GeoPoint,
+         Geography::GeoPointArray,
+         Geography::GeoPointInit;
+
+   using OslTest::check;
+
+   std::size_t n = 1000;
+   std::mt19937 gen(17);
+   std::uniform_real_distribution<double> ulon(-180.0, 180.0), ulat(-90.0, 90.0), ualt(-500.0, 9000.0);
+   vector lon(n), lat(n), alt(n), x, y, z;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       lon[i] = ulon(gen);
+       lat[i] = ulat(gen);
+       alt[i] = ualt(gen);
+   }
+   WGS84->geodeticToGeocentric(lon, lat, alt, x, y, z);
+
+   // Geodetic columns set: the geocentric ones are computed lazily
+   GeoPointArray pts(WGS84, lon, lat, alt);
+   check("size", pts.size() == n);
+   check("geodetic up to date, geocentric stale",
+         pts.isGeodeticUpToDate() && !pts.isGeocentricUpToDate());
+   const vector &px = pts.getX(), &py = pts.getY(), &pz = pts.getZ();
+   check("geocentric up to date after getX()", pts.isGeocentricUpToDate());
+   double max_dxyz = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+       max_dxyz = std::max(max_dxyz, std::abs(px[i] - x[i]) + std::abs(py[i] - y[i]) + std::abs(pz[i] - z[i]));
+   std::cout << "max |dxyz| = " << max_dxyz << " m" << std::endl;
+   check("geocentric columns", max_dxyz <= 1e-8);
+
+   // Geocentric columns set: the geodetic ones are computed lazily
+   GeoPointArray gpts(WGS84, x, y, z, GeoPointInit::fromGeocentric);
+   check("geocentric up to date, geodetic stale",
+         gpts.isGeocentricUpToDate() && !gpts.isGeodeticUpToDate());
+   vector lon2, lat2, alt2;
+   gpts.getGeodeticCoords(lon2, lat2, alt2);
+   double max_dll = 0.0, max_dalt = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       max_dll = std::max(max_dll, std::abs(std::remainder(lon2[i] - lon[i], 360.0)) + std::abs(lat2[i] - lat[i]));
+       max_dalt = std::max(max_dalt, std::abs(alt2[i] - alt[i]));
+   }
+   std::cout << "max |dlonlat| = " << max_dll << "° ; max |dalt| = " << max_dalt << " m" << std::endl;
+   check("geodetic columns", (max_dll <= 1e-12) && (max_dalt <= 1e-7));
+   check("radian columns", std::abs(gpts.getLatRad()[0] - lat[0] * Constants::m_degtorad) <= 1e-14);
+
+   // Setting one point only makes the other representation stale for it
+   pts.setGeodeticPoint(10, 2.35, 48.85, 35.0);
+   check("geocentric stale after setGeodeticPoint()", !pts.isGeocentricUpToDate());
+   double xi, yi, zi, xr, yr, zr;
+   pts.getGeocentricPoint(10, xi, yi, zi);
+   WGS84->geodeticToGeocentric(2.35, 48.85, 35.0, xr, yr, zr);
+   check("geocentric point updated", std::abs(xi - xr) + std::abs(yi - yr) + std::abs(zi - zr) <= 1e-8);
+   pts.getGeocentricPoint(11, xi, yi, zi);
+   check("other points unchanged", std::abs(xi - x[11]) + std::abs(yi - y[11]) + std::abs(zi - z[11]) <= 1e-8);
+   pts.setGeocentricPoint(20, x[21], y[21], z[21]);
+   double lo, la, al;
+   pts.getGeodeticPoint(20, lo, la, al);
+   check("geodetic point updated", (std::abs(la - lat[21]) <= 1e-12) && (std::abs(al - alt[21]) <= 1e-7));
+   GeoPoint gp = pts.getGeoPoint(10);
+   check("getGeoPoint()", (std::abs(gp.getLat() - 48.85) <= 1e-12) && (std::abs(gp.getAlt() - 35.0) <= 1e-7));
+
+   // Copies are independent
+   GeoPointArray cpy(pts);
+   cpy.setGeodeticPoint(0, 0.0, 0.0, 0.0);
+   pts.getGeodeticPoint(0, lo, la, al);
+   check("copy is independent", std::abs(la - lat[0]) <= 1e-12);
+
+   // Out of range index and clear()
+   bool thrown = false;
+   try { pts.setGeodeticPoint(n, 0.0, 0.0, 0.0); }
+   catch (const std::out_of_range &) { thrown = true; }
+   check("out of range index throws", thrown);
+   pts.clear();
+   check("clear()", pts.empty() && (pts.size() == 0));
+
+   return OslTest::report();
+}
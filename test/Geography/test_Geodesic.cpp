@@ -0,0 +1,88 @@
+// ===== TESTS Geodesic =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+int main()
+{
+   using namespace Osl;
+   using Geography::WGS84,
+         Geography::Geodesic;
+
+   Geodesic geod(WGS84);
+   using OslTest::check;
+   std::cout << std::setprecision(15);
+
+   // Direct problem, example of Karney (2013), Algorithms for geodesics
+   std::cout << "Direct: lat1 = 40°, azi1 = 30°, s12 = 10000 km" << std::endl;
+   double lon2, lat2, azi1, azi2;
+   geod.direct(0.0, 40.0, 30.0, 10e6, lon2, lat2, azi2);
+   check("lat2", lat2, 41.79331020506, 1e-11);
+   check("lon2", lon2, 137.84490004377, 1e-11);
+   check("azi2", azi2, 149.09016931807, 1e-11);
+
+   // Inverse problem, example of Karney (2013): nearly antipodal points
+   std::cout << "Inverse: lat1 = -30°, lat2 = 29.9°, lon12 = 179.8°" << std::endl;
+   double s12 = geod.inverse(0.0, -30.0, 179.8, 29.9, azi1, azi2);
+   check("s12", s12, 19989832.82761, 1e-5);
+   check("azi1", azi1, 161.89052473633, 1e-11);
+   check("azi2", azi2, 18.09073724574, 1e-11);
+
+   // Antipodal points on the equator: the geodesic goes over a pole, the
+   // distance being half a meridian
+   std::cout << "Inverse: antipodal points on the equator" << std::endl;
+   s12 = geod.inverse(0.0, 0.0, 180.0, 0.0, azi1, azi2);
+   check("s12", s12, 20003931.4586254, 1e-6);
+   check("azi1", std::abs(azi1), 0.0, 1e-12);
+   check("azi2", azi2, 180.0, 1e-12);
+   s12 = geod.inverse(0.0, 90.0, 0.0, -90.0, azi1, azi2);
+   check("s12 (pole to pole)", s12, 20003931.4586254, 1e-6);
+   // Nearly antipodal equatorial points (GeographicLib test case)
+   s12 = geod.inverse(0.0, 0.0, 179.5, 0.5, azi1, azi2);
+   check("s12 (0°, 0°) -> (179.5°, 0.5°)", s12, 19936288.579, 1e-3);
+   // Quarter of the equator and coincident points
+   check("s12 (quarter of equator)", geod.distance(0.0, 0.0, 90.0, 0.0),
+         0.5 * Constants::m_pi * WGS84->getEquatorialRadius(), 1e-6);
+   check("s12 (coincident points)", geod.distance(12.0, 34.0, 12.0, 34.0), 0.0, 0.0);
+
+   // Inverse then direct on random points, in radians
+   std::mt19937 gen(7);
+   std::uniform_real_distribution<double> ulon(-Constants::m_pi, Constants::m_pi),
+                                          ulat(-0.5 * Constants::m_pi, 0.5 * Constants::m_pi);
+   std::size_t n = 1000;
+   vector lon1(n), lat1(n), lonb(n), latb(n);
+   double max_dpos = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       lon1[i] = ulon(gen); lat1[i] = ulat(gen);
+       lonb[i] = ulon(gen); latb[i] = ulat(gen);
+       s12 = geod.inverse(lon1[i], lat1[i], lonb[i], latb[i], azi1, azi2, false);
+       geod.direct(lon1[i], lat1[i], azi1, s12, lon2, lat2, azi2, false);
+       // Distance on the ground between the target and the reached point
+       max_dpos = std::max(max_dpos, geod.distance(lonb[i], latb[i], lon2, lat2, false));
+   }
+   check("Inverse/direct round trip: max distance [m]", max_dpos, 0.0, 1e-6);
+
+   // Batch distances and distance matrix against the scalar inverse
+   vector s(n), mat;
+   geod.distance(lon1.data(), lat1.data(), lonb.data(), latb.data(), s.data(), n, false);
+   double max_ds = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+       max_ds = std::max(max_ds, std::abs(s[i] - geod.distance(lon1[i], lat1[i], lonb[i], latb[i], false)));
+   check("Batch distances: max |ds| [m]", max_ds, 0.0, 1e-6);
+   std::size_t n1 = 37, n2 = 53;
+   vector mlon1(lon1.begin(), lon1.begin() + n1), mlat1(lat1.begin(), lat1.begin() + n1),
+          mlon2(lonb.begin(), lonb.begin() + n2), mlat2(latb.begin(), latb.begin() + n2);
+   geod.distanceMatrix(mlon1, mlat1, mlon2, mlat2, mat, false);
+   max_ds = 0.0;
+   for (std::size_t i = 0 ; i < n1 ; ++i)
+       for (std::size_t j = 0 ; j < n2 ; ++j)
+           max_ds = std::max(max_ds, std::abs(mat[i * n2 + j] -
+                                              geod.distance(mlon1[i], mlat1[i], mlon2[j], mlat2[j], false)));
+   check("Distance matrix: max |ds| [m]", max_ds, 0.0, 1e-6);
+
+   return OslTest::report();
+}
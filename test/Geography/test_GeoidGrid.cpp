@@ -0,0 +1,135 @@
+// ===== TESTS GeoidGrid =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+int main()
+{
+   using namespace Osl;
+   using Geography::GeoidGrid,
+         Geography::GeoidGridType,
+         Geography::GeoidInterpolation;
+
+   using OslTest::check;
+   std::filesystem::path dir = std::filesystem::temp_directory_path() / "osl_test_geoid";
+   std::filesystem::create_directories(dir);
+   const GeoidInterpolation bilinear = GeoidInterpolation::bilinear,
+                            bicubic = GeoidInterpolation::bicubic;
+
+   // Global float32 little-endian grid, 30° spacing from (0°, 90°):
+   // N = 10 + 0.1 lat + lon / 100 at the nodes
+   std::size_t nlon = 12, nlat = 7;
+   {
+       std::ofstream out(dir / "global.bin", std::ios::binary);
+       for (std::size_t i = 0 ; i < nlat ; ++i)
+           for (std::size_t j = 0 ; j < nlon ; ++j)
+           {
+               float v = static_cast<float>(10.0 + 0.1 * (90.0 - 30.0 * i) + 0.3 * j);
+               if (Endian::Endianness::native == Endian::Endianness::big)
+                   Endian::swapEndianInplace(v);
+               out.write(reinterpret_cast<const char*>(&v), sizeof(v));
+           }
+   }
+   GeoidGrid global((dir / "global.bin").string(), nlon, nlat, 0.0, 90.0, 30.0, -30.0);
+   std::cout << "Global grid:" << std::endl;
+   check("isGlobal", global.isGlobal(), 1.0, 0.0);
+   check("N(60°, 30°) (node)", global.undulation(60.0, 30.0), 10.0 + 3.0 + 0.6, 1e-5);
+   check("N(45°, 45°) bilinear", global.undulation(45.0, 45.0, true, bilinear), 10.0 + 4.5 + 0.45, 1e-5);
+   check("N(-15°, 0°) (wrapped)", global.undulation(-15.0, 0.0), 0.5 * (10.0 + 3.3 + 10.0), 1e-5);
+   check("N(375°, 0°) (wrapped)", global.undulation(375.0, 0.0), global.undulation(15.0, 0.0), 0.0);
+   check("N(0°, 90°) (first row)", global.undulation(0.0, 90.0), 19.0, 1e-5);
+   check("N(0°, -90°) (last row)", global.undulation(0.0, -90.0), 1.0, 1e-5);
+   check("N(30°, 30°) bicubic (node)", global.undulation(30.0, 30.0, true, bicubic), 13.3, 1e-5);
+   check("N(pi/6, pi/6 rad)", global.undulation(Constants::m_pi / 6.0, Constants::m_pi / 6.0, false), 13.3, 1e-5);
+   double nan = std::nan("");
+   check("N(NaN, 0°)", global.undulation(nan, 0.0), nan, 0.0);
+   check("N(0°, NaN)", global.undulation(0.0, nan), nan, 0.0);
+   check("N(inf, 0°)", global.undulation(INFINITY, 0.0), nan, 0.0);
+   check("N(0°, NaN) bicubic", global.undulation(0.0, nan, true, bicubic), nan, 0.0);
+
+   // Regional int16 big-endian grid in centimeters after a 16 bytes header,
+   // 0.5° spacing from (-10°, 40°): N = 0.01 (100 i + 3 j) - 5, which is
+   // bilinear, so that it is reproduced by both interpolations
+   nlon = 21;
+   nlat = 11;
+   {
+       std::ofstream out(dir / "regional.bin", std::ios::binary);
+       char header[16] = {};
+       out.write(header, sizeof(header));
+       for (std::size_t i = 0 ; i < nlat ; ++i)
+           for (std::size_t j = 0 ; j < nlon ; ++j)
+           {
+               std::int16_t v = static_cast<std::int16_t>(100 * i + 3 * j);
+               if (Endian::Endianness::native == Endian::Endianness::little)
+                   Endian::swapEndianInplace(v);
+               out.write(reinterpret_cast<const char*>(&v), sizeof(v));
+           }
+   }
+   GeoidGrid regional((dir / "regional.bin").string(), nlon, nlat, -10.0, 40.0, 0.5, 0.5,
+                      GeoidGridType::int16, Endian::Endianness::big, 0.01, -5.0, 16);
+   auto exact = [](double lon, double lat)
+   {
+       double fx = std::min(std::max((lon + 10.0) / 0.5, 0.0), 20.0),
+              fy = std::min(std::max((lat - 40.0) / 0.5, 0.0), 10.0);
+       return 0.01 * (100.0 * fy + 3.0 * fx) - 5.0;
+   };
+   std::cout << "Regional grid:" << std::endl;
+   check("isGlobal", regional.isGlobal(), 0.0, 0.0);
+   check("getNode(2, 3)", regional.getNode(2, 3), 0.01 * 209.0 - 5.0, 1e-12);
+   check("N(-9.25°, 41.2°)", regional.undulation(-9.25, 41.2), exact(-9.25, 41.2), 1e-12);
+   check("N(-20°, 41°) (clamped)", regional.undulation(-20.0, 41.0), exact(-10.0, 41.0), 1e-12);
+   check("N(5°, 60°) (clamped)", regional.undulation(5.0, 60.0), exact(0.0, 45.0), 1e-12);
+
+   std::size_t n = 1000;
+   std::mt19937 gen(29);
+   std::uniform_real_distribution<double> ulon(-9.5, -0.5), ulat(40.5, 44.5);
+   vector lon(n), lat(n), N, Nc, h(n, 100.0), H(n), hb(n);
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       lon[i] = ulon(gen);
+       lat[i] = ulat(gen);
+   }
+   regional.undulation(lon, lat, N);
+   regional.undulation(lon, lat, Nc, true, bicubic);
+   double max_lin = 0.0, max_cub = 0.0, max_scalar = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       max_lin = std::max(max_lin, std::abs(N[i] - exact(lon[i], lat[i])));
+       max_cub = std::max(max_cub, std::abs(Nc[i] - exact(lon[i], lat[i])));
+       max_scalar = std::max(max_scalar, std::abs(N[i] - regional.undulation(lon[i], lat[i])));
+   }
+   check("Batch bilinear: max error [m]", max_lin, 0.0, 1e-12);
+   check("Batch bicubic: max error [m]", max_cub, 0.0, 1e-12);
+   check("Batch vs scalar: max error [m]", max_scalar, 0.0, 0.0);
+
+   // Orthometric and ellipsoidal heights, the latter in place
+   regional.orthometricHeight(lon.data(), lat.data(), h.data(), H.data(), n);
+   hb = H;
+   regional.ellipsoidalHeight(lon.data(), lat.data(), hb.data(), hb.data(), n);
+   double max_H = 0.0, max_h = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       max_H = std::max(max_H, std::abs(H[i] - (h[i] - N[i])));
+       max_h = std::max(max_h, std::abs(hb[i] - h[i]));
+   }
+   check("H = h - N: max error [m]", max_H, 0.0, 1e-12);
+   check("h = H + N in place: max error [m]", max_h, 0.0, 1e-12);
+
+   // Missing and too small files
+   bool thrown = false;
+   try { GeoidGrid((dir / "missing.bin").string(), 2, 2, 0.0, 0.0, 1.0, 1.0); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("Missing file throws", thrown);
+   thrown = false;
+   try { GeoidGrid((dir / "regional.bin").string(), 100, 100, 0.0, 0.0, 1.0, 1.0); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("Too small file throws", thrown);
+
+   std::filesystem::remove_all(dir);
+   return OslTest::report();
+}
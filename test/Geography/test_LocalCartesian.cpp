@@ -0,0 +1,88 @@
+// ===== TESTS LocalENU and LocalNED =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+int main()
+{
+   using namespace Osl;
+   using Geography::WGS84,
+         Geography::LocalCartesian::LocalENU,
+         Geography::LocalCartesian::LocalNED;
+
+   auto check = [](const char *name, double x, double y, double z,
+                   double xr, double yr, double zr, double tol)
+   {
+       std::ostringstream label;
+       label << name << " = (" << x << ", " << y << ", " << z << ") (expected ("
+             << xr << ", " << yr << ", " << zr << "))";
+       OslTest::check(label.str(), (std::abs(x - xr) <= tol) && (std::abs(y - yr) <= tol) &&
+                                   (std::abs(z - zr) <= tol));
+   };
+
+   // Frames at lon = lat = alt = 0: east is +Y, north is +Z and up is +X
+   double a = WGS84->getEquatorialRadius(), x, y, z;
+   LocalENU enu0;
+   LocalNED ned0;
+   enu0.geocentricPointToENUPoint(a + 100.0, 10.0, 20.0, x, y, z);
+   check("ENU(a + 100, 10, 20)", x, y, z, 10.0, 20.0, 100.0, 1e-9);
+   ned0.geocentricPointToNEDPoint(a + 100.0, 10.0, 20.0, x, y, z);
+   check("NED(a + 100, 10, 20)", x, y, z, 20.0, 10.0, -100.0, 1e-9);
+   enu0.geocentricVectorToENUVector(1.0, 2.0, 3.0, x, y, z);
+   check("ENU vector (1, 2, 3)", x, y, z, 2.0, 3.0, 1.0, 1e-15);
+
+   // Frame at the north pole: up is +Z, north is -X (lon = 0)
+   LocalENU enup(WGS84, 0.0, 90.0, 0.0);
+   enup.geocentricVectorToENUVector(-1.0, 0.0, 0.0, x, y, z);
+   check("ENU at pole, vector (-1, 0, 0)", x, y, z, 0.0, 1.0, 0.0, 1e-15);
+
+   // Up of a point above the origin is its height
+   LocalENU enu(WGS84, 2.35, 48.85, 35.0);
+   LocalNED ned(WGS84, 2.35, 48.85, 35.0);
+   enu.geodeticPointToENUPoint(2.35, 48.85, 1035.0, x, y, z);
+   check("ENU of origin + 1000 m up", x, y, z, 0.0, 0.0, 1000.0, 1e-8);
+   ned.geodeticPointToNEDPoint(2.35, 48.85, 1035.0, x, y, z);
+   check("NED of origin + 1000 m up", x, y, z, 0.0, 0.0, -1000.0, 1e-8);
+
+   // Batch against scalar transforms, round trips and in-place transforms
+   std::size_t n = 1000;
+   std::mt19937 gen(11);
+   std::uniform_real_distribution<double> u(-1e5, 1e5);
+   vector xg(n), yg(n), zg(n), xe, ye, ze, xn, yn, zn, xb, yb, zb;
+   double x0, y0, z0;
+   enu.getOriginCoordinates(x0, y0, z0);
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       xg[i] = x0 + u(gen);
+       yg[i] = y0 + u(gen);
+       zg[i] = z0 + u(gen);
+   }
+   enu.geocentricPointToENUPoint(xg, yg, zg, xe, ye, ze);
+   ned.geocentricPointToNEDPoint(xg, yg, zg, xn, yn, zn);
+   enu.ENUPointToGeocentricPoint(xe, ye, ze, xb, yb, zb);
+   double max_ds = 0.0, max_dned = 0.0, max_drt = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       enu.geocentricPointToENUPoint(xg[i], yg[i], zg[i], x, y, z);
+       max_ds = std::max(max_ds, std::abs(x - xe[i]) + std::abs(y - ye[i]) + std::abs(z - ze[i]));
+       max_dned = std::max(max_dned, std::abs(xn[i] - ye[i]) + std::abs(yn[i] - xe[i]) + std::abs(zn[i] + ze[i]));
+       max_drt = std::max(max_drt, std::abs(xb[i] - xg[i]) + std::abs(yb[i] - yg[i]) + std::abs(zb[i] - zg[i]));
+   }
+   check("Batch ENU vs scalar, NED vs ENU, round trip [m]", max_ds, max_dned, max_drt,
+         0.0, 0.0, 0.0, 1e-8);
+
+   vector xi(xg), yi(yg), zi(zg);
+   enu.geocentricVectorToENUVector(xi.data(), yi.data(), zi.data(),
+                                   xi.data(), yi.data(), zi.data(), n);
+   enu.ENUVectorToGeocentricVector(xi.data(), yi.data(), zi.data(),
+                                   xi.data(), yi.data(), zi.data(), n);
+   max_drt = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+       max_drt = std::max(max_drt, std::abs(xi[i] - xg[i]) + std::abs(yi[i] - yg[i]) + std::abs(zi[i] - zg[i]));
+   check("In-place vector round trip [m]", max_drt, 0.0, 0.0, 0.0, 0.0, 0.0, 1e-8);
+
+   return OslTest::report();
+}
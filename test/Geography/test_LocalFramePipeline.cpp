@@ -0,0 +1,95 @@
+// ===== TESTS fused geodetic to local frame transforms and LocalFramePipeline =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iostream>
+#include <random>
+
+int main()
+{
+   using namespace Osl;
+   using Geography::WGS84,
+         Geography::LocalCartesian::LocalENU,
+         Geography::LocalCartesian::LocalNED,
+         Geography::LocalCartesian::LocalFramePipeline,
+         Geometry::Rotation3D,
+         Geometry::Vector3D;
+
+   using OslTest::check;
+
+   // Random geodetic points around the origin of the frames
+   std::size_t n = 1000;
+   std::mt19937 gen(5);
+   std::uniform_real_distribution<double> ulon(-1.0, 1.0), ulat(-1.0, 1.0), ualt(-100.0, 5000.0);
+   vector lon(n), lat(n), alt(n), xg, yg, zg;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       lon[i] = 7.0 + ulon(gen);
+       lat[i] = 43.5 + ulat(gen);
+       alt[i] = ualt(gen);
+   }
+   WGS84->geodeticToGeocentric(lon, lat, alt, xg, yg, zg);
+   LocalENU enu(WGS84, 7.0, 43.5, 150.0);
+   LocalNED ned(WGS84, 7.0, 43.5, 150.0);
+
+   // Fused transforms against geodeticToGeocentric then the local transform
+   vector xe, ye, ze, xf, yf, zf, xn, yn, zn, xnf, ynf, znf;
+   enu.geocentricPointToENUPoint(xg, yg, zg, xe, ye, ze);
+   enu.geodeticPointToENUPoint(lon, lat, alt, xf, yf, zf);
+   ned.geocentricPointToNEDPoint(xg, yg, zg, xn, yn, zn);
+   ned.geodeticPointToNEDPoint(lon, lat, alt, xnf, ynf, znf);
+   double max_enu = 0.0, max_ned = 0.0, max_scalar = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       double x, y, z;
+       enu.geodeticPointToENUPoint(lon[i], lat[i], alt[i], x, y, z);
+       max_scalar = std::max(max_scalar, std::abs(x - xf[i]) + std::abs(y - yf[i]) + std::abs(z - zf[i]));
+       max_enu = std::max(max_enu, std::abs(xe[i] - xf[i]) + std::abs(ye[i] - yf[i]) + std::abs(ze[i] - zf[i]));
+       max_ned = std::max(max_ned, std::abs(xn[i] - xnf[i]) + std::abs(yn[i] - ynf[i]) + std::abs(zn[i] - znf[i]));
+   }
+   check("Fused ENU vs two steps: max error [m]", max_enu, 1e-8);
+   check("Fused NED vs two steps: max error [m]", max_ned, 1e-8);
+   check("Fused ENU batch vs scalar: max error [m]", max_scalar, 1e-8);
+
+   // Fused transform in place (the outputs are the inputs)
+   vector xi(lon), yi(lat), zi(alt);
+   enu.geodeticPointToENUPoint(xi.data(), yi.data(), zi.data(),
+                               xi.data(), yi.data(), zi.data(), n);
+   double max_inplace = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+       max_inplace = std::max(max_inplace, std::abs(xi[i] - xf[i]) + std::abs(yi[i] - yf[i]) + std::abs(zi[i] - zf[i]));
+   check("Fused ENU in place: max error [m]", max_inplace, 1e-8);
+
+   // Pipeline: ENU frame followed by a body attitude and a sensor mounting
+   Rotation3D body("zyx", 30.0, 5.0, -2.0),
+              mount('y', 90.0);
+   LocalFramePipeline pipe(enu);
+   pipe.append(body).append(mount);
+   vector xp, yp, zp, xpg, ypg, zpg;
+   pipe.geodeticToOutput(lon, lat, alt, xp, yp, zp);
+   pipe.geocentricToOutput(xg, yg, zg, xpg, ypg, zpg);
+   double max_pipe = 0.0, max_geo = 0.0, max_ps = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       Vector3D ref = mount * (body * Vector3D(xe[i], ye[i], ze[i]));
+       max_pipe = std::max(max_pipe, (ref - Vector3D(xp[i], yp[i], zp[i])).norm());
+       max_geo = std::max(max_geo, (ref - Vector3D(xpg[i], ypg[i], zpg[i])).norm());
+       double x, y, z;
+       pipe.geodeticToOutput(lon[i], lat[i], alt[i], x, y, z);
+       max_ps = std::max(max_ps, std::abs(x - xp[i]) + std::abs(y - yp[i]) + std::abs(z - zp[i]));
+   }
+   check("Pipeline geodetic vs chained rotations: max error [m]", max_pipe, 1e-8);
+   check("Pipeline geocentric vs chained rotations: max error [m]", max_geo, 1e-8);
+   check("Pipeline batch vs scalar: max error [m]", max_ps, 1e-8);
+
+   // A pipeline from a NED frame gives the NED coordinates
+   LocalFramePipeline pned(ned);
+   vector xq, yq, zq;
+   pned.geodeticToOutput(lon, lat, alt, xq, yq, zq);
+   double max_pned = 0.0;
+   for (std::size_t i = 0 ; i < n ; ++i)
+       max_pned = std::max(max_pned, std::abs(xq[i] - xn[i]) + std::abs(yq[i] - yn[i]) + std::abs(zq[i] - zn[i]));
+   check("NED pipeline vs NED frame: max error [m]", max_pned, 1e-8);
+
+   return OslTest::report();
+}
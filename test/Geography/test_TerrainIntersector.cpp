@@ -0,0 +1,171 @@
+// ===== TESTS TerrainIntersector =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iostream>
+#include <random>
+
+int main()
+{
+   using namespace Osl;
+   using Geography::WGS84,
+         Geography::TerrainIntersector,
+         Geometry::Vector3D,
+         Geometry::Shape3D::Line3D;
+
+   using OslTest::check;
+   const double d2r = Constants::m_degtorad;
+   // Unit vector of the ellipsoid normal at (lon, lat) [deg]
+   auto normal = [d2r](double lon, double lat)
+   {
+       return Vector3D(std::cos(lat * d2r) * std::cos(lon * d2r),
+                       std::cos(lat * d2r) * std::sin(lon * d2r),
+                       std::sin(lat * d2r));
+   };
+   auto geocentric = [](double lon, double lat, double alt)
+   {
+       double x, y, z;
+       WGS84->geodeticToGeocentric(lon, lat, alt, x, y, z);
+       return Vector3D(x, y, z);
+   };
+
+   // 101 x 101 grid of 0.01° from (0°, 45°)
+   const std::size_t nlon = 101, nlat = 101;
+   const double lon0 = 0.0, lat0 = 45.0, step = 0.01;
+
+   // ***** Flat terrain at 500 m *****
+   std::cout << "Flat terrain:" << std::endl;
+   TerrainIntersector flat(WGS84, vector(nlon * nlat, 500.0), nlon, nlat, lon0, lat0, step, step);
+   check("getMinHeight", flat.getMinHeight(), 500.0, 0.0);
+   check("getMaxHeight", flat.getMaxHeight(), 500.0, 0.0);
+   check("getLevels > 1", flat.getLevels() > 1, 1.0, 0.0);
+   check("height(0.5°, 45.5°)", flat.height(0.5, 45.5), 500.0, 1e-9);
+   check("height(1.5°, 45.5°) (outside)", flat.height(1.5, 45.5), std::nan(""), 0.0);
+   double t, lon, lat, alt;
+   Vector3D p;
+   // Vertical ray from 10 km
+   bool hit = flat.intersect(Line3D(geocentric(0.5, 45.5, 10000.0), -normal(0.5, 45.5)), t, p);
+   WGS84->geocentricToGeodetic(p.getX(), p.getY(), p.getZ(), lon, lat, alt);
+   check("Vertical ray: hit", hit, 1.0, 0.0);
+   check("Vertical ray: t [m]", t, 9500.0, flat.getTolerance());
+   check("Vertical ray: lon [deg]", lon, 0.5, 1e-9);
+   check("Vertical ray: lat [deg]", lat, 45.5, 1e-9);
+   check("Vertical ray: alt [m]", alt, 500.0, flat.getTolerance());
+   // Non unit direction: t is in direction units
+   flat.intersect(Line3D(geocentric(0.5, 45.5, 10000.0), -4.0 * normal(0.5, 45.5)), t, p);
+   check("Vertical ray (|d| = 4): t", t, 2375.0, flat.getTolerance());
+   // Slanted ray of 45° towards the east, from 1000 m above the terrain
+   Vector3D east(-std::sin(0.5 * d2r), std::cos(0.5 * d2r), 0.0);
+   hit = flat.intersect(Line3D(geocentric(0.3, 45.5, 1500.0), east - normal(0.3, 45.5)), t, p);
+   WGS84->geocentricToGeodetic(p.getX(), p.getY(), p.getZ(), lon, lat, alt);
+   check("Slanted ray: alt [m]", alt, 500.0, 2.0 * flat.getTolerance());
+   // Ray going up, ray outside of the grid
+   hit = flat.intersect(Line3D(geocentric(0.5, 45.5, 10000.0), normal(0.5, 45.5)), t, p);
+   check("Upward ray: hit", hit, 0.0, 0.0);
+   check("Upward ray: t", t, std::nan(""), 0.0);
+   check("Upward ray: x", p.getX(), std::nan(""), 0.0);
+   hit = flat.intersect(Line3D(geocentric(2.0, 45.5, 10000.0), -normal(2.0, 45.5)), t, p);
+   check("Ray outside of the grid: hit", hit, 0.0, 0.0);
+
+   // ***** Gaussian hill of 2000 m, rows from north to south *****
+   std::cout << "Gaussian hill:" << std::endl;
+   vector heights(nlon * nlat);
+   auto hill = [](double lon, double lat)
+   {
+       double u = (lon - 0.5) / 0.15, v = (lat - 45.5) / 0.15;
+       return 100.0 + 2000.0 * std::exp(-0.5 * (u * u + v * v));
+   };
+   for (std::size_t i = 0 ; i < nlat ; ++i)
+       for (std::size_t j = 0 ; j < nlon ; ++j)
+           heights[i * nlon + j] = hill(lon0 + j * step, 46.0 - i * step);
+   TerrainIntersector dem(WGS84, heights, nlon, nlat, lon0, 46.0, step, -step);
+   check("height(0.5°, 45.5°)", dem.height(0.5, 45.5), 2100.0, 1e-3);
+   check("height(0.53°, 45.47°) (node)", dem.height(0.53, 45.47), hill(0.53, 45.47), 1e-3);
+   check("height(0.5°, 45.5°) [rad]", dem.height(0.5 * d2r, 45.5 * d2r, false), 2100.0, 1e-3);
+
+   // Brute-force march (steps of 1 m then bisection) along the ray, the
+   // terrain being the same bilinear surface
+   auto above = [&dem](const Vector3D &o, const Vector3D &d, double s)
+   {
+       double lo, la, al;
+       WGS84->geocentricToGeodetic(o.getX() + s * d.getX(), o.getY() + s * d.getY(),
+                                   o.getZ() + s * d.getZ(), lo, la, al);
+       double h = dem.height(lo, la);
+       return std::isnan(h) ? 1.0 : al - h;
+   };
+   auto brute = [&above](const Vector3D &o, const Vector3D &d, double smax)
+   {
+       double s0 = 0.0;
+       for (double s = 1.0 ; s <= smax ; s += 1.0)
+       {
+           if (above(o, d, s) <= 0.0)
+           {
+               double s1 = s;
+               for (int k = 0 ; k < 40 ; ++k)
+               {
+                   double sm = 0.5 * (s0 + s1);
+                   (above(o, d, sm) > 0.0 ? s0 : s1) = sm;
+               }
+               return 0.5 * (s0 + s1);
+           }
+           s0 = s;
+       }
+       return std::nan("");
+   };
+
+   // Rays from 5 km, towards random points of the grid with a random slant
+   const std::size_t n = 200;
+   std::mt19937 gen(21);
+   std::uniform_real_distribution<double> ulon(0.1, 0.9), ulat(45.1, 45.9), uslant(-1.0, 1.0);
+   vector ox(n), oy(n), oz(n), dx(n), dy(n), dz(n), tb(n), px(n), py(n), pz(n);
+   double max_bf = 0.0, max_alt = 0.0, max_batch = 0.0;
+   std::size_t nhits = 0, nmiss_bf = 0;
+   for (std::size_t k = 0 ; k < n ; ++k)
+   {
+       double lo = ulon(gen), la = ulat(gen);
+       Vector3D o = geocentric(lo, la, 5000.0),
+                d = -normal(lo, la) + uslant(gen) * east + uslant(gen) * Vector3D(0.0, 0.0, 0.5);
+       o.getCoordinates(ox[k], oy[k], oz[k]);
+       d.getCoordinates(dx[k], dy[k], dz[k]);
+       hit = dem.intersect(Line3D(o, d), t, p);
+       double tbf = brute(o, d, 20000.0);
+       if (!hit || std::isnan(tbf))
+       {
+           nmiss_bf += (hit != !std::isnan(tbf));
+           continue;
+       }
+       ++nhits;
+       max_bf = std::max(max_bf, std::abs(t - tbf) * d.norm());
+       WGS84->geocentricToGeodetic(p.getX(), p.getY(), p.getZ(), lon, lat, alt);
+       max_alt = std::max(max_alt, std::abs(alt - dem.height(lon, lat)));
+   }
+   check("Random rays: hits", nhits, n, 0.0);
+   check("Random rays: disagreements with brute force", nmiss_bf, 0.0, 0.0);
+   check("Random rays: max |t - t_brute| [m]", max_bf, 0.0, 2.0 * dem.getTolerance());
+   check("Random rays: max |alt - height| [m]", max_alt, 0.0, 2.0 * dem.getTolerance());
+
+   // Ray grazing above the top of the hill, then the same ray lowered by
+   // 300 m, which hits its western side
+   Vector3D o = geocentric(0.0, 45.5, 2400.0);
+   hit = dem.intersect(Line3D(o, east), t, p);
+   check("Ray above the hill: hit", hit, 0.0, 0.0);
+   o = geocentric(0.0, 45.5, 2100.0);
+   hit = dem.intersect(Line3D(o, east), t, p);
+   WGS84->geocentricToGeodetic(p.getX(), p.getY(), p.getZ(), lon, lat, alt);
+   check("Ray into the hill: hit", hit, 1.0, 0.0);
+   check("Ray into the hill: t vs brute force [m]", t, brute(o, east, 100000.0), 2.0 * dem.getTolerance());
+   check("Ray into the hill: west side", lon < 0.5, 1.0, 0.0);
+
+   // Batch vs scalar
+   dem.intersect(ox.data(), oy.data(), oz.data(), dx.data(), dy.data(), dz.data(), n,
+                 tb.data(), px.data(), py.data(), pz.data());
+   for (std::size_t k = 0 ; k < n ; ++k)
+   {
+       dem.intersect(Line3D(Vector3D(ox[k], oy[k], oz[k]), Vector3D(dx[k], dy[k], dz[k])), t, p);
+       max_batch = std::max({max_batch, std::abs(tb[k] - t), std::abs(px[k] - p.getX()),
+                             std::abs(py[k] - p.getY()), std::abs(pz[k] - p.getZ())});
+   }
+   check("Batch vs scalar: max error", max_batch, 0.0, 0.0);
+
+   return OslTest::report();
+}
@@ -0,0 +1,106 @@
+// ===== TESTS TransverseMercator and UTM =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+int main()
+{
+   using namespace Osl;
+   using Geography::WGS84,
+         Geography::TransverseMercator,
+         Geography::UTM;
+
+   using OslTest::check;
+   std::cout << std::setprecision(12);
+
+   // Standard zones and their edges
+   std::cout << "Standard UTM zones:" << std::endl;
+   check("zone(-180°)", UTM::zone(-180.0), 1, 0);
+   check("zone(180°)", UTM::zone(180.0), 1, 0);
+   check("zone(-174.000001°)", UTM::zone(-174.000001), 1, 0);
+   check("zone(-174°)", UTM::zone(-174.0), 2, 0);
+   check("zone(-0.000001°)", UTM::zone(-0.000001), 30, 0);
+   check("zone(0°)", UTM::zone(0.0), 31, 0);
+   check("zone(179.999999°)", UTM::zone(179.999999), 60, 0);
+   check("zone(360° + 3°)", UTM::zone(363.0), 31, 0);
+   check("zone(pi/2 rad)", UTM::zone(0.5 * Constants::m_pi, false), 46, 0);
+
+   // Exceptions of Norway (band V) and Svalbard (band X)
+   std::cout << "Norway and Svalbard exceptions:" << std::endl;
+   check("zone(3°, 60°)", UTM::zone(3.0, 60.0), 32, 0);
+   check("zone(2.999999°, 60°)", UTM::zone(2.999999, 60.0), 31, 0);
+   check("zone(3°, 55.999999°)", UTM::zone(3.0, 55.999999), 31, 0);
+   check("zone(3°, 64°)", UTM::zone(3.0, 64.0), 31, 0);
+   check("zone(11.999999°, 63°)", UTM::zone(11.999999, 63.0), 32, 0);
+   check("zone(12°, 63°)", UTM::zone(12.0, 63.0), 33, 0);
+   check("zone(8.999999°, 78°)", UTM::zone(8.999999, 78.0), 31, 0);
+   check("zone(9°, 78°)", UTM::zone(9.0, 78.0), 33, 0);
+   check("zone(20.999999°, 78°)", UTM::zone(20.999999, 78.0), 33, 0);
+   check("zone(21°, 78°)", UTM::zone(21.0, 78.0), 35, 0);
+   check("zone(33°, 78°)", UTM::zone(33.0, 78.0), 37, 0);
+   check("zone(41.999999°, 84°)", UTM::zone(41.999999, 84.0), 37, 0);
+   check("zone(42°, 78°)", UTM::zone(42.0, 78.0), 38, 0);
+   check("zone(9°, 71.999999°)", UTM::zone(9.0, 71.999999), 32, 0);
+   check("zone(-3°, 78°)", UTM::zone(-3.0, 78.0), 30, 0);
+
+   // Central meridian: x = E0 and y = k0 * m(lat) + N0
+   std::cout << "Central meridian:" << std::endl;
+   UTM utm31n(WGS84, 31, true), utm31s(WGS84, 31, false);
+   double x, y, lon, lat;
+   utm31n.forward(3.0, 45.0, x, y);
+   check("x(3°, 45°)", x, 500000.0, 1e-9);
+   check("y(3°, 45°)", y, 0.9996 * WGS84->meridianDistance(45.0), 1e-6);
+   utm31n.forward(3.0, 90.0, x, y);
+   check("y(3°, 90°)", y, 0.9996 * WGS84->getQuarterMeridianDistance(), 1e-6);
+   utm31s.forward(3.0, -45.0, x, y);
+   check("y(3°, -45°) (south)", y, 1e7 - 0.9996 * WGS84->meridianDistance(45.0), 1e-6);
+
+   // Symmetries about the central meridian and the equator
+   std::cout << "Symmetries:" << std::endl;
+   double xe, ye, xw, yw;
+   utm31n.forward(3.0 + 2.5, 37.0, xe, ye);
+   utm31n.forward(3.0 - 2.5, 37.0, xw, yw);
+   check("x(E) + x(W) - 2 E0", xe + xw - 1e6, 0.0, 1e-8);
+   check("y(E) - y(W)", ye - yw, 0.0, 1e-8);
+   utm31s.forward(3.0 + 2.5, -37.0, xw, yw);
+   check("y(N) + y(S) - N0", ye + yw - 1e7, 0.0, 1e-8);
+
+   // Round trips at the zone edges and beyond (Krüger's series stay
+   // accurate far from the central meridian)
+   std::cout << "Round trips:" << std::endl;
+   TransverseMercator tm(WGS84, 3.0, 0.9996, 500000.0, 0.0);
+   double max_dlon = 0.0, max_dlat = 0.0;
+   vector blon, blat, bx, by, blon2, blat2;
+   for (double dl : {-9.0, -3.0, -2.999999, 0.0, 2.999999, 3.0, 9.0})
+   {
+       for (double la = -80.0 ; la <= 84.0 ; la += 4.0)
+       {
+           tm.forward(3.0 + dl, la, x, y);
+           tm.inverse(x, y, lon, lat);
+           max_dlon = std::max(max_dlon, std::abs(lon - 3.0 - dl));
+           max_dlat = std::max(max_dlat, std::abs(lat - la));
+           blon.push_back(3.0 + dl);
+           blat.push_back(la);
+       }
+   }
+   check("max |dlon| [°]", max_dlon, 0.0, 1e-11);
+   check("max |dlat| [°]", max_dlat, 0.0, 1e-11);
+
+   // Batch against scalar projections
+   tm.forward(blon, blat, bx, by);
+   tm.inverse(bx, by, blon2, blat2);
+   double max_dxy = 0.0, max_dll = 0.0;
+   for (std::size_t i = 0 ; i < blon.size() ; ++i)
+   {
+       tm.forward(blon[i], blat[i], x, y);
+       tm.inverse(bx[i], by[i], lon, lat);
+       max_dxy = std::max(max_dxy, std::max(std::abs(bx[i] - x), std::abs(by[i] - y)));
+       max_dll = std::max(max_dll, std::max(std::abs(blon2[i] - lon), std::abs(blat2[i] - lat)));
+   }
+   check("Batch forward: max |dxy| [m]", max_dxy, 0.0, 1e-8);
+   check("Batch inverse: max |dlonlat| [°]", max_dll, 0.0, 1e-12);
+
+   return OslTest::report();
+}
@@ -0,0 +1,141 @@
+// ===== TESTS AttitudeSpline3D =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+int main()
+{
+   using namespace Osl;
+   using Geometry::Quaternion,
+         Geometry::Rotation3D,
+         Geometry::Vector3D,
+         Geometry::Interpolator3D::AttitudeSpline3D,
+         Geometry::Interpolator3D::AttitudeInterpolation;
+
+   using OslTest::check;
+   // Distance between two rotations (q and -q are the same rotation)
+   auto qdiff = [](const Quaternion &a, const Quaternion &b)
+   {
+       return std::min((a.getVector() - b.getVector()).norm() + std::abs(a.getW() - b.getW()),
+                       (a.getVector() + b.getVector()).norm() + std::abs(a.getW() + b.getW()));
+   };
+   const AttitudeInterpolation modes[2] = {AttitudeInterpolation::slerp, AttitudeInterpolation::squad};
+   const char *names[2] = {"SLERP", "SQUAD"};
+
+   // Random attitudes at non evenly spaced times, some given as -q or not
+   // normalized
+   std::mt19937 gen(24);
+   std::uniform_real_distribution<double> u(-1.0, 1.0);
+   const std::size_t size = 30;
+   vector t(size);
+   std::vector<Quaternion> q(size);
+   t[0] = 0.0;
+   q[0] = Quaternion(Vector3D(u(gen), u(gen), u(gen)), 40.0 * u(gen));
+   for (std::size_t k = 1 ; k < size ; ++k)
+   {
+       t[k] = t[k-1] + 0.5 + 0.5 * std::abs(u(gen));
+       q[k] = q[k-1] * Quaternion(Vector3D(u(gen), u(gen), u(gen)), 60.0 * u(gen));
+   }
+   q[3] = Quaternion(-q[3].getW(), -q[3].getX(), -q[3].getY(), -q[3].getZ());
+   q[5] = Quaternion(3.0 * q[5].getW(), 3.0 * q[5].getX(), 3.0 * q[5].getY(), 3.0 * q[5].getZ());
+
+   for (std::size_t m = 0 ; m < 2 ; ++m)
+   {
+       std::cout << names[m] << ":" << std::endl;
+       AttitudeSpline3D spline(t, q, modes[m]);
+       check("isUniform", spline.isUniform(), 0.0, 0.0);
+       // Through the nodes
+       double max_node = 0.0;
+       for (std::size_t k = 0 ; k < size ; ++k)
+           max_node = std::max(max_node, qdiff(spline.quaternionAt(t[k]), q[k].normalized()));
+       check("Nodes: max error", max_node, 0.0, 1e-14);
+       // Unit quaternions, continuity and batch evaluation
+       std::size_t n = 5000;
+       vector te(n);
+       for (std::size_t i = 0 ; i < n ; ++i)
+           te[i] = t[0] + (t[size-1] - t[0]) * double(i) / double(n - 1);
+       std::vector<Quaternion> qs, qu;
+       std::vector<Rotation3D> rots;
+       spline.evaluate(te, qs, true);
+       spline.evaluate(te, rots);
+       vector tr(te);
+       std::shuffle(tr.begin(), tr.end(), gen);
+       spline.evaluate(tr, qu, false);
+       double max_norm = 0.0, max_step = 0.0, max_batch = 0.0, max_rot = 0.0, max_unsorted = 0.0;
+       for (std::size_t i = 0 ; i < n ; ++i)
+       {
+           Quaternion qi;
+           spline(te[i], qi);
+           max_norm = std::max(max_norm, std::abs(qi.norm() - 1.0));
+           if (i > 0)
+               max_step = std::max(max_step, qdiff(qs[i], qs[i-1]));
+           max_batch = std::max(max_batch, qdiff(qs[i], qi));
+           for (std::size_t c = 0 ; c < 9 ; ++c)
+               max_rot = std::max(max_rot, std::abs(rots[i].data()[c] - qi.toRotation3D().data()[c]));
+           max_unsorted = std::max(max_unsorted, qdiff(qu[i], spline.quaternionAt(tr[i])));
+       }
+       check("max |norm - 1|", max_norm, 0.0, 1e-14);
+       check("Max step between close times (continuity)", max_step, 0.0, 0.01);
+       check("Batch (sorted) vs scalar: max error", max_batch, 0.0, 0.0);
+       check("Batch Rotation3D vs scalar: max error", max_rot, 0.0, 1e-15);
+       check("Batch (unsorted) vs scalar: max error", max_unsorted, 0.0, 0.0);
+   }
+
+   // Constant rotation rate around a fixed axis (evenly spaced times):
+   // both schemes are exact
+   std::cout << "Constant rotation rate:" << std::endl;
+   Vector3D axis = Vector3D(1.0, 2.0, -2.0).normalized();
+   auto exact = [&axis](double s) { return Quaternion(axis, 25.0 * s); };
+   vector tu(11);
+   std::vector<Quaternion> qe(11);
+   std::vector<Rotation3D> re(11);
+   for (std::size_t k = 0 ; k < 11 ; ++k)
+   {
+       tu[k] = double(k);
+       qe[k] = exact(tu[k]);
+       re[k] = qe[k].toRotation3D();
+   }
+   for (std::size_t m = 0 ; m < 2 ; ++m)
+   {
+       AttitudeSpline3D spline(tu, re, modes[m]);
+       double max_err = 0.0;
+       for (double s = 0.0 ; s <= 10.0 ; s += 0.01)
+           max_err = std::max(max_err, qdiff(spline.quaternionAt(s), exact(s)));
+       std::cout << names[m] << ": ";
+       check("max error", max_err, 0.0, 1e-13);
+   }
+   AttitudeSpline3D uniform(tu, qe);
+   check("isUniform", uniform.isUniform(), 1.0, 0.0);
+   check("Extrapolation at t = 11", qdiff(uniform.quaternionAt(11.0, true), exact(11.0)), 0.0, 1e-13);
+   check("rotationAt(2.5) angle [deg]", uniform.rotationAt(2.5).rotationVector().norm(), 62.5, 1e-10);
+   Quaternion qnan;
+   uniform(std::nan(""), qnan);
+   check("q(NaN) (first interval)", qnan.getW(), std::nan(""), 0.0);
+
+   // Errors
+   std::cout << "Errors:" << std::endl;
+   auto throws = [](auto f)
+   {
+       try { f(); }
+       catch (const std::invalid_argument &) { return true; }
+       return false;
+   };
+   check("Extrapolation not authorized", throws([&]() { uniform.quaternionAt(10.5); }), 1.0, 0.0);
+   AttitudeSpline3D empty;
+   Quaternion qe0;
+   check("Not initialized: operator()", throws([&]() { empty(0.5, qe0); }), 1.0, 0.0);
+   check("Not initialized: quaternionAt", throws([&]() { empty.quaternionAt(0.5); }), 1.0, 0.0);
+   std::vector<Quaternion> qb;
+   check("Not initialized: evaluate", throws([&]() { empty.evaluate(tu, qb); }), 1.0, 0.0);
+   check("Empty getT", empty.getT().size(), 0.0, 0.0);
+   check("Single point", throws([&]() { AttitudeSpline3D(vector{0.0}, std::vector<Quaternion>(1)); }), 1.0, 0.0);
+   check("Sizes mismatch", throws([&]() { AttitudeSpline3D(vector{0.0, 1.0}, std::vector<Quaternion>(3)); }), 1.0, 0.0);
+   check("Non increasing t", throws([&]() { AttitudeSpline3D(vector{1.0, 1.0}, std::vector<Quaternion>(2)); }), 1.0, 0.0);
+   check("Null quaternion", throws([&]() { AttitudeSpline3D(vector{0.0, 1.0},
+                                            std::vector<Quaternion>{Quaternion(), Quaternion(0, 0, 0, 0)}); }), 1.0, 0.0);
+
+   return OslTest::report();
+}
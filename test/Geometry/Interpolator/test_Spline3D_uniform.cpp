@@ -0,0 +1,82 @@
+// ===== TESTS Spline3D O(1) index lookup on evenly spaced axes =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iostream>
+
+int main()
+{
+   using namespace Osl;
+   using Geometry::Vector3D,
+         Geometry::vector3d,
+         Geometry::Interpolator3D::LinearSpline3D,
+         Geometry::Interpolator3D::CubicSpline3D;
+
+   // Evenly spaced axis and a cubic trajectory, exactly reproduced by the
+   // cubic Hermite spline and, at the nodes, by the linear one
+   std::size_t size(21);
+   vector t(size);
+   vector3d pos(size), vel(size);
+   auto p = [](double s) { return Vector3D(s * s * s, 2.0 * s - 1.0, -0.5 * s * s); };
+   auto v = [](double s) { return Vector3D(3.0 * s * s, 2.0, -s); };
+   for (std::size_t i = 0 ; i < size ; ++i)
+   {
+       t[i] = 0.1 * static_cast<double>(i) - 1.0;
+       pos[i] = p(t[i]);
+       vel[i] = v(t[i]);
+   }
+   LinearSpline3D ls(t, pos);
+   CubicSpline3D cs(t, pos, vel);
+   std::cout << "isUniform: linear = " << ls.isUniform()
+             << " ; cubic = " << cs.isUniform() << std::endl;
+
+   // O(1) index against the definition: last node such that t[i] <= teval,
+   // clamped to the first and last intervals
+   std::size_t nbad = 0;
+   for (double te = -1.25 ; te <= 1.25 ; te += 0.0125)
+   {
+       std::size_t ref = 0;
+       while ((ref + 2 < size) && (t[ref + 1] <= te))
+           ++ref;
+       std::size_t il = ls.search_index_for_interpolation(te),
+                   ic = cs.search_index_for_interpolation(te);
+       // Evenly spaced nodes may be off by one rounding at the nodes
+       bool ok = (il == ic) && ((il == ref) || (std::abs(te - t[il]) < 1e-12) ||
+                                (std::abs(te - t[ref]) < 1e-12));
+       if (!ok)
+       {
+           ++nbad;
+           std::cout << "t = " << te << " : index " << il << ", " << ic
+                     << " (expected " << ref << ")" << std::endl;
+       }
+   }
+   OslTest::check("Index lookup", nbad == 0);
+
+   // Interpolated values
+   double max_dpos = 0.0, max_dvel = 0.0, max_dnode = 0.0;
+   for (double te = -1.0 ; te <= 1.0 ; te += 0.001)
+   {
+       Vector3D pc, vc;
+       cs(te, pc, vc);
+       max_dpos = std::max(max_dpos, (pc - p(te)).norm());
+       max_dvel = std::max(max_dvel, (vc - v(te)).norm());
+   }
+   for (std::size_t i = 0 ; i < size ; ++i)
+   {
+       Vector3D pl;
+       ls(t[i], pl);
+       max_dnode = std::max(max_dnode, (pl - pos[i]).norm());
+   }
+   OslTest::check("Cubic: max |dpos|", max_dpos, 1e-12);
+   OslTest::check("Cubic: max |dvel|", max_dvel, 1e-12);
+   OslTest::check("Linear at nodes: max |dpos|", max_dnode, 1e-12);
+
+   // Out of range and NaN times fall in the first or last interval
+   double nan = std::nan("");
+   OslTest::check("Cubic index(NaN) == 0", cs.search_index_for_interpolation(nan) == 0);
+   OslTest::check("Linear index(NaN) == 0", ls.search_index_for_interpolation(nan) == 0);
+   OslTest::check("Cubic index(-10) == 0", cs.search_index_for_interpolation(-10.0) == 0);
+   OslTest::check("Cubic index(10) == size - 2", cs.search_index_for_interpolation(10.0) == size - 2);
+
+   return OslTest::report();
+}
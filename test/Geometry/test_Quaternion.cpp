@@ -0,0 +1,143 @@
+// ===== TESTS Quaternion vs Rotation3D =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iostream>
+#include <random>
+
+int main()
+{
+   using namespace Osl;
+   using Geometry::Quaternion,
+         Geometry::Rotation3D,
+         Geometry::Vector3D,
+         Geometry::vector3d;
+
+   using OslTest::check;
+   // Largest difference of the coefficients of two matrices
+   auto mdiff = [](const Rotation3D &a, const Rotation3D &b)
+   {
+       double d = 0.0;
+       for (std::size_t k = 0 ; k < 9 ; ++k)
+           d = std::max(d, std::abs(a.data()[k] - b.data()[k]));
+       return d;
+   };
+   auto vdiff = [](const Vector3D &a, const Vector3D &b) { return (a - b).norm(); };
+
+   std::mt19937 gen(23);
+   std::uniform_real_distribution<double> u(-1.0, 1.0), uangle(-180.0, 180.0);
+   auto random_axis = [&]() { return Vector3D(u(gen), u(gen), u(gen)).normalized(); };
+
+   // ***** Elementary rotations *****
+   std::cout << "Elementary rotations:" << std::endl;
+   double max_elem = 0.0;
+   for (char axis : {'x', 'y', 'z'})
+       for (double angle : {-170.0, -30.0, 0.0, 45.0, 90.0, 180.0})
+           max_elem = std::max(max_elem, mdiff(Quaternion(axis, angle).toRotation3D(),
+                                               Rotation3D(axis, angle)));
+   check("max |q(axis, a) - R(axis, a)|", max_elem, 0.0, 1e-15);
+   Vector3D r = Quaternion('z', 90.0) * Vector3D(1.0, 0.0, 0.0);
+   check("q(z, 90°) * ex: x", r.getX(), 0.0, 1e-15);
+   check("q(z, 90°) * ex: y", r.getY(), 1.0, 1e-15);
+   check("q(z, pi/2 rad): w", Quaternion('z', Constants::m_pi / 2.0, false).getW(),
+         std::sqrt(0.5), 1e-15);
+
+   // ***** Random rotations *****
+   std::cout << "Random rotations:" << std::endl;
+   const std::size_t n = 1000;
+   double max_mat = 0.0, max_vec = 0.0, max_from = 0.0, max_prod = 0.0,
+          max_inv = 0.0, max_angle = 0.0, max_rotvec = 0.0, max_euler = 0.0;
+   std::size_t nequal = 0;
+   std::vector<Quaternion> quats(n);
+   vector3d vecs(n);
+   for (std::size_t k = 0 ; k < n ; ++k)
+   {
+       Vector3D axis = random_axis(), v(u(gen), u(gen), u(gen));
+       double angle = uangle(gen);
+       Quaternion q(axis, angle), p(random_axis(), uangle(gen));
+       Rotation3D R(axis, angle), P = p.toRotation3D();
+       quats[k] = q;
+       vecs[k] = v;
+       max_mat = std::max(max_mat, mdiff(q.toRotation3D(), R));
+       max_vec = std::max(max_vec, vdiff(q * v, R * v));
+       // Back and forth conversion (q and -q are the same rotation)
+       Quaternion qr(R);
+       nequal += qr.rotationEquals(q);
+       max_from = std::max(max_from, mdiff(qr.toRotation3D(), R));
+       // The product of quaternions is the product of matrices
+       max_prod = std::max(max_prod, mdiff((q * p).toRotation3D(), R * P));
+       Quaternion qp(q);
+       qp *= p;
+       max_prod = std::max(max_prod, mdiff(qp.toRotation3D(), R * P));
+       max_inv = std::max({max_inv, mdiff(q.conjugate().toRotation3D(), R.transpose()),
+                           mdiff(q.inverse().toRotation3D(), R.transpose())});
+       max_angle = std::max(max_angle, std::abs(q.angle() - std::abs(angle)));
+       max_rotvec = std::max(max_rotvec, vdiff(q.rotationVector(), R.rotationVector()));
+       double a1, a2, a3, b1, b2, b3;
+       q.eulerAngles("zyx", a1, a2, a3);
+       R.eulerAngles("zyx", b1, b2, b3);
+       max_euler = std::max({max_euler, std::abs(a1 - b1), std::abs(a2 - b2), std::abs(a3 - b3)});
+   }
+   check("toRotation3D: max error", max_mat, 0.0, 1e-14);
+   check("q * v vs R * v: max error", max_vec, 0.0, 1e-14);
+   check("Quaternion(R) == q", nequal, n, 0.0);
+   check("Quaternion(R): max error", max_from, 0.0, 1e-14);
+   check("q * p vs R * P: max error", max_prod, 0.0, 1e-14);
+   check("Inverse vs transpose: max error", max_inv, 0.0, 1e-14);
+   check("angle: max error [deg]", max_angle, 0.0, 1e-10);
+   check("rotationVector: max error [deg]", max_rotvec, 0.0, 1e-10);
+   check("Euler angles zyx: max error [deg]", max_euler, 0.0, 1e-10);
+   double a1 = 30.0, a2 = -20.0, a3 = 75.0;
+   check("Quaternion(\"zxz\") vs Rotation3D(\"zxz\")",
+         mdiff(Quaternion("zxz", a1, a2, a3).toRotation3D(), Rotation3D("zxz", a1, a2, a3)), 0.0, 1e-14);
+   check("Quaternion(\"xyz\") vs Rotation3D(\"xyz\")",
+         mdiff(Quaternion("xyz", a1, a2, a3).toRotation3D(), Rotation3D("xyz", a1, a2, a3)), 0.0, 1e-14);
+
+   // ***** Batch rotations *****
+   std::cout << "Batch rotations:" << std::endl;
+   vector x(n), y(n), z(n), rx(n), ry(n), rz(n), qw(n), qx(n), qy(n), qz(n);
+   for (std::size_t k = 0 ; k < n ; ++k)
+   {
+       vecs[k].getCoordinates(x[k], y[k], z[k]);
+       quats[k].getCoefficients(qw[k], qx[k], qy[k], qz[k]);
+   }
+   const Quaternion &q0 = quats[0];
+   const Rotation3D R0 = q0.toRotation3D();
+   q0.rotate(x.data(), y.data(), z.data(), n, rx.data(), ry.data(), rz.data());
+   vector3d rvecs;
+   q0.rotate(vecs, rvecs);
+   double max_one = 0.0, max_each = 0.0;
+   for (std::size_t k = 0 ; k < n ; ++k)
+       max_one = std::max({max_one, vdiff(Vector3D(rx[k], ry[k], rz[k]), R0 * vecs[k]),
+                           vdiff(rvecs[k], R0 * vecs[k])});
+   check("One quaternion: max error", max_one, 0.0, 1e-14);
+   Quaternion::rotate(qw.data(), qx.data(), qy.data(), qz.data(), x.data(), y.data(), z.data(), n,
+                      x.data(), y.data(), z.data()); // In place
+   Quaternion::rotate(quats, vecs, rvecs);
+   for (std::size_t k = 0 ; k < n ; ++k)
+   {
+       Vector3D ref = quats[k].toRotation3D() * vecs[k];
+       max_each = std::max({max_each, vdiff(Vector3D(x[k], y[k], z[k]), ref), vdiff(rvecs[k], ref)});
+   }
+   check("One quaternion per vector (in place): max error", max_each, 0.0, 1e-14);
+
+   // ***** Long compositions of small rotations *****
+   std::cout << "Compositions:" << std::endl;
+   Quaternion q, qraw;
+   Rotation3D R;
+   for (std::size_t k = 0 ; k < 100000 ; ++k)
+   {
+       Quaternion dq(random_axis(), 0.01 * uangle(gen));
+       q.composeNormalized(dq);
+       qraw *= dq;
+       R *= dq.toRotation3D();
+   }
+   check("composeNormalized: |norm - 1|", std::abs(q.norm() - 1.0), 0.0, 1e-14);
+   check("composeNormalized vs matrix product: max error", mdiff(q.toRotation3D(), R), 0.0, 1e-11);
+   check("operator*=: |norm - 1|", std::abs(qraw.norm() - 1.0), 0.0, 1e-10);
+   Quaternion big(2.0, 0.0, 0.0, 0.0);
+   big.composeNormalized(Quaternion('x', 30.0));
+   check("composeNormalized (norm 2): |norm - 1|", std::abs(big.norm() - 1.0), 0.0, 1e-15);
+
+   return OslTest::report();
+}
@@ -0,0 +1,134 @@
+// ===== TESTS Rotation3D Euler conventions =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace {
+
+using namespace Osl;
+using Geometry::Rotation3D,
+      Geometry::EulerConvention;
+
+using OslTest::check;
+
+// Largest difference of the coefficients of two matrices
+double mdiff(const Rotation3D &a, const Rotation3D &b)
+{
+    double d = 0.0;
+    for (std::size_t k = 0 ; k < 9 ; ++k)
+        d = std::max(d, std::abs(a.data()[k] - b.data()[k]));
+    return d;
+}
+
+// Compares the compile-time, enum and string versions of the convention C
+// to the product of its elementary rotations, on random angles within the
+// range of eulerAngles() (second angle in ]-90°, 90°[ for Tait-Bryan
+// angles, ]0°, 180°[ for proper Euler angles)
+template <EulerConvention C>
+void test_convention(const std::string &convention, std::mt19937 &gen)
+{
+    const bool proper = (convention[0] == convention[2]);
+    std::uniform_real_distribution<double> u(-179.0, 179.0),
+                                           u2(proper ? 1.0 : -89.0, proper ? 179.0 : 89.0);
+    const std::size_t n = 500;
+    vector a1(n), a2(n), a3(n), b1(n), b2(n), b3(n);
+    std::vector<Rotation3D> rot(n), rot_enum(n);
+    double max_tmpl = 0.0, max_enum = 0.0, max_string = 0.0, max_rad = 0.0,
+           max_angles = 0.0, max_enum_angles = 0.0, max_string_angles = 0.0;
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        a1[k] = u(gen);
+        a2[k] = u2(gen);
+        a3[k] = u(gen);
+        Rotation3D ref = Rotation3D(convention[0], a1[k]) * Rotation3D(convention[1], a2[k]) *
+                         Rotation3D(convention[2], a3[k]);
+        Rotation3D R = Rotation3D::fromEuler<C>(a1[k], a2[k], a3[k]);
+        max_tmpl = std::max(max_tmpl, mdiff(R, ref));
+        max_enum = std::max(max_enum, mdiff(Rotation3D(C, a1[k], a2[k], a3[k]), ref));
+        max_string = std::max(max_string, mdiff(Rotation3D(convention, a1[k], a2[k], a3[k]), ref));
+        const double d2r = Constants::m_degtorad;
+        max_rad = std::max(max_rad, mdiff(Rotation3D::fromEuler<C>(a1[k] * d2r, a2[k] * d2r,
+                                                                    a3[k] * d2r, false), ref));
+        // Round trips
+        double c1, c2, c3;
+        R.eulerAngles<C>(c1, c2, c3);
+        max_angles = std::max({max_angles, std::abs(c1 - a1[k]), std::abs(c2 - a2[k]), std::abs(c3 - a3[k])});
+        R.eulerAngles(C, c1, c2, c3);
+        max_enum_angles = std::max({max_enum_angles, std::abs(c1 - a1[k]),
+                                    std::abs(c2 - a2[k]), std::abs(c3 - a3[k])});
+        R.eulerAngles(convention, c1, c2, c3);
+        max_string_angles = std::max({max_string_angles, std::abs(c1 - a1[k]),
+                                      std::abs(c2 - a2[k]), std::abs(c3 - a3[k])});
+    }
+    check(convention + ": fromEuler<C> vs product", max_tmpl, 0.0, 1e-15);
+    check(convention + ": Rotation3D(enum) vs product", max_enum, 0.0, 1e-15);
+    check(convention + ": Rotation3D(string) vs product", max_string, 0.0, 1e-15);
+    check(convention + ": fromEuler<C> [rad] vs product", max_rad, 0.0, 1e-15);
+    check(convention + ": eulerAngles<C> round trip [deg]", max_angles, 0.0, 1e-9);
+    check(convention + ": eulerAngles(enum) round trip [deg]", max_enum_angles, 0.0, 1e-9);
+    check(convention + ": eulerAngles(string) round trip [deg]", max_string_angles, 0.0, 1e-9);
+
+    // Batch versions
+    Rotation3D::fromEuler<C>(a1.data(), a2.data(), a3.data(), n, rot.data());
+    Rotation3D::fromEuler(C, a1.data(), a2.data(), a3.data(), n, rot_enum.data());
+    double max_batch = 0.0;
+    for (std::size_t k = 0 ; k < n ; ++k)
+        max_batch = std::max({max_batch, mdiff(rot[k], Rotation3D::fromEuler<C>(a1[k], a2[k], a3[k])),
+                              mdiff(rot_enum[k], rot[k])});
+    check(convention + ": batch fromEuler vs scalar", max_batch, 0.0, 0.0);
+    Rotation3D::eulerAngles<C>(rot.data(), n, b1.data(), b2.data(), b3.data());
+    Rotation3D::eulerAngles(C, rot.data(), n, a1.data(), a2.data(), a3.data());
+    max_batch = 0.0;
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        double c1, c2, c3;
+        rot[k].eulerAngles<C>(c1, c2, c3);
+        max_batch = std::max({max_batch, std::abs(b1[k] - c1), std::abs(b2[k] - c2), std::abs(b3[k] - c3),
+                              std::abs(a1[k] - c1), std::abs(a2[k] - c2), std::abs(a3[k] - c3)});
+    }
+    check(convention + ": batch eulerAngles vs scalar", max_batch, 0.0, 0.0);
+
+    // Gimbal lock at both ends of the range of the second angle: the angles
+    // are not unique, but give back the rotation and the second angle
+    for (double lock2 : {proper ? 0.0 : 90.0, proper ? 180.0 : -90.0})
+    {
+        Rotation3D lock = Rotation3D::fromEuler<C>(30.0, lock2, -50.0);
+        double c1, c2, c3;
+        lock.eulerAngles<C>(c1, c2, c3);
+        const std::string name = convention + ": gimbal lock a2 = " + std::to_string(int(lock2));
+        check(name + " round trip", mdiff(Rotation3D::fromEuler<C>(c1, c2, c3), lock), 0.0, 1e-12);
+        check(name + " second angle", c2, lock2, 1e-6);
+        double d1, d2, d3;
+        Rotation3D::eulerAngles<C>(&lock, 1, &d1, &d2, &d3);
+        check(name + " batch vs scalar", (d1 == c1) && (d2 == c2) && (d3 == c3));
+    }
+}
+
+} // namespace
+
+int main()
+{
+   std::mt19937 gen(25);
+   test_convention<EulerConvention::xyz>("xyz", gen);
+   test_convention<EulerConvention::xzy>("xzy", gen);
+   test_convention<EulerConvention::yxz>("yxz", gen);
+   test_convention<EulerConvention::yzx>("yzx", gen);
+   test_convention<EulerConvention::zxy>("zxy", gen);
+   test_convention<EulerConvention::zyx>("zyx", gen);
+   test_convention<EulerConvention::xyx>("xyx", gen);
+   test_convention<EulerConvention::xzx>("xzx", gen);
+   test_convention<EulerConvention::yxy>("yxy", gen);
+   test_convention<EulerConvention::yzy>("yzy", gen);
+   test_convention<EulerConvention::zxz>("zxz", gen);
+   test_convention<EulerConvention::zyz>("zyz", gen);
+
+   bool thrown = false;
+   try { Rotation3D("zzy", 10.0, 20.0, 30.0); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("Invalid convention throws", thrown);
+
+   return OslTest::report();
+}
@@ -0,0 +1,106 @@
+// ===== TESTS Shape3D ray intersections =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+int main()
+{
+   using namespace Osl;
+   using Geometry::Vector3D,
+         Geometry::Rotation3D,
+         Geometry::Shape3D::Line3D,
+         Geometry::Shape3D::Sphere3D,
+         Geometry::Shape3D::Plane3D,
+         Geometry::Shape3D::Ellipsoid3D;
+
+   auto check = [](const char *name, bool hit, double t, const Vector3D &p,
+                   bool hit_ref, double t_ref, const Vector3D &p_ref)
+   {
+       std::ostringstream label;
+       label << name << ": hit = " << hit << " ; t = " << t << " ; p = " << p;
+       OslTest::check(label.str(),
+                      (hit == hit_ref) &&
+                      (hit_ref ? ((std::abs(t - t_ref) < 1e-12) && ((p - p_ref).norm() < 1e-12))
+                               : std::isnan(t)));
+   };
+   double t, nan = std::nan("");
+   Vector3D p, pnan(nan, nan, nan);
+
+   // Sphere: from outside, from inside, pointing away and tangent
+   Sphere3D sphere(Vector3D(1, 2, 3), 2.0);
+   bool hit = sphere.intersect(Line3D(Vector3D(1, 2, 10), Vector3D(0, 0, -1)), t, p);
+   check("Sphere outside", hit, t, p, true, 5.0, Vector3D(1, 2, 5));
+   hit = sphere.intersect(Line3D(Vector3D(1, 2, 3), Vector3D(0, 0, -2)), t, p);
+   check("Sphere inside", hit, t, p, true, 1.0, Vector3D(1, 2, 1));
+   hit = sphere.intersect(Line3D(Vector3D(1, 2, 10), Vector3D(0, 0, 1)), t, p);
+   check("Sphere behind", hit, t, p, false, nan, pnan);
+   hit = sphere.intersect(Line3D(Vector3D(3, 2, 10), Vector3D(0, 0, -1)), t, p);
+   check("Sphere tangent", hit, t, p, true, 7.0, Vector3D(3, 2, 3));
+   hit = sphere.intersect(Line3D(Vector3D(4, 2, 10), Vector3D(0, 0, -1)), t, p);
+   check("Sphere miss", hit, t, p, false, nan, pnan);
+
+   // Plane z = 1: direction units, parallel and receding rays
+   Plane3D plane(Vector3D(0, 0, 1), Vector3D(0, 0, 1));
+   hit = plane.intersect(Line3D(Vector3D(1, 1, 0), Vector3D(0, 0, 2)), t, p);
+   check("Plane", hit, t, p, true, 0.5, Vector3D(1, 1, 1));
+   hit = plane.intersect(Line3D(Vector3D(1, 1, 0), Vector3D(1, 0, 0)), t, p);
+   check("Plane parallel", hit, t, p, false, nan, pnan);
+   hit = plane.intersect(Line3D(Vector3D(1, 1, 0), Vector3D(0, 0, -1)), t, p);
+   check("Plane behind", hit, t, p, false, nan, pnan);
+
+   // Ellipsoid of radii (3, 2, 1), axis aligned then turned by 90° about z
+   Ellipsoid3D elps(Vector3D(0, 0, 0), 3.0, 2.0, 1.0);
+   hit = elps.intersect(Line3D(Vector3D(10, 0, 0), Vector3D(-1, 0, 0)), t, p);
+   check("Ellipsoid x", hit, t, p, true, 7.0, Vector3D(3, 0, 0));
+   hit = elps.intersect(Line3D(Vector3D(0, 0, -10), Vector3D(0, 0, 1)), t, p);
+   check("Ellipsoid z", hit, t, p, true, 9.0, Vector3D(0, 0, -1));
+   Ellipsoid3D relps(Vector3D(0, 0, 0), 3.0, 2.0, 1.0, Rotation3D('z', 90.0));
+   hit = relps.intersect(Line3D(Vector3D(10, 0, 0), Vector3D(-1, 0, 0)), t, p);
+   check("Rotated ellipsoid x", hit, t, p, true, 8.0, Vector3D(2, 0, 0));
+   hit = relps.intersect(Line3D(Vector3D(10, 0, 5), Vector3D(-1, 0, 0)), t, p);
+   check("Rotated ellipsoid miss", hit, t, p, false, nan, pnan);
+
+   // Batch (SoA and Line3D) against scalar intersections on random rays,
+   // more than one block of rays
+   std::size_t n = 1000;
+   std::mt19937 gen(42);
+   std::uniform_real_distribution<double> u(-5.0, 5.0);
+   vector ox(n), oy(n), oz(n), dx(n), dy(n), dz(n), bt(n), px(n), py(n), pz(n),
+          lt(n), lx(n), ly(n), lz(n);
+   std::vector<Line3D> rays(n);
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       ox[i] = u(gen); oy[i] = u(gen); oz[i] = u(gen);
+       dx[i] = u(gen); dy[i] = u(gen); dz[i] = u(gen);
+       rays[i] = Line3D(Vector3D(ox[i], oy[i], oz[i]), Vector3D(dx[i], dy[i], dz[i]));
+   }
+   auto batch = [&](const char *name, const auto &shape)
+   {
+       shape.intersect(ox.data(), oy.data(), oz.data(), dx.data(), dy.data(), dz.data(), n,
+                       bt.data(), px.data(), py.data(), pz.data());
+       shape.intersect(rays.data(), n, lt.data(), lx.data(), ly.data(), lz.data());
+       std::size_t nhit = 0, nbad = 0;
+       for (std::size_t i = 0 ; i < n ; ++i)
+       {
+           bool h = shape.intersect(rays[i], t, p);
+           nhit += h;
+           bool same = h ? ((std::abs(bt[i] - t) <= 1e-9 * (1.0 + t)) &&
+                            (std::abs(lt[i] - bt[i]) == 0.0) &&
+                            ((Vector3D(px[i], py[i], pz[i]) - p).norm() <= 1e-9 * (1.0 + t)))
+                         : (std::isnan(bt[i]) && std::isnan(lt[i]) && std::isnan(px[i]));
+           nbad += !same;
+       }
+       std::ostringstream label;
+       label << name << " batch: " << nhit << " hits over " << n << " rays, "
+             << nbad << " mismatches";
+       OslTest::check(label.str(), nbad == 0);
+   };
+   batch("Sphere", sphere);
+   batch("Plane", plane);
+   batch("Ellipsoid", relps);
+
+   return OslTest::report();
+}
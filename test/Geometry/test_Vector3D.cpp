@@ -0,0 +1,85 @@
+// ===== TESTS Vector3D arithmetic =====
+// Built twice: with the default operators (test_Vector3D) and with
+// OSL_VECTOR3D_EXPRESSION_TEMPLATES defined (test_Vector3D_expr).
+#include "Osl/Geometry/Vector3D.h"
+#include "OslTest.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+
+using Osl::Geometry::Vector3D;
+
+// Largest coordinate difference of two vectors
+double vdiff(const Vector3D &a, const Vector3D &b)
+{
+    return std::max({std::abs(a.getX() - b.getX()),
+                     std::abs(a.getY() - b.getY()),
+                     std::abs(a.getZ() - b.getZ())});
+}
+
+// Compile-time evaluation of a fused expression
+constexpr Vector3D ca(1.0, 2.0, 3.0), cb(-4.0, 0.5, 2.0), cc(0.25, -1.0, 8.0);
+constexpr Vector3D ce = (ca + cb * 2.0 - cc).eval();
+static_assert(ce.getX() == -7.25 && ce.getY() == 4.0 && ce.getZ() == -1.0,
+              "constexpr eval() of a + b*s - c");
+static_assert((ca - ca).eval().isNull(), "constexpr eval() of a - a");
+static_assert(ca.crossProduct(cb).dotProduct(ca) == 0.0, "constexpr crossProduct");
+
+} // namespace
+
+int main()
+{
+   using OslTest::check;
+
+#ifdef OSL_VECTOR3D_EXPRESSION_TEMPLATES
+   std::cout << "Mode: expression templates" << std::endl;
+#else
+   std::cout << "Mode: value operators" << std::endl;
+#endif
+
+   Vector3D a(1.0, 2.0, 3.0), b(-4.0, 0.5, 2.0), c(0.25, -1.0, 8.0);
+   double s = 2.0;
+
+   // Fused expressions against the coordinates
+   Vector3D r = a + b * s - c;
+   check("a + b*s - c", vdiff(r, Vector3D(-7.25, 4.0, -1.0)), 0.0);
+   r = -a + s * b / 4.0;
+   check("-a + s*b/4", vdiff(r, Vector3D(-3.0, -1.75, -2.0)), 0.0);
+   check("(a + b*s - c).eval()", vdiff((a + b * s - c).eval(), Vector3D(-7.25, 4.0, -1.0)), 0.0);
+   check("constexpr eval()", vdiff(ce, Vector3D(-7.25, 4.0, -1.0)), 0.0);
+
+   // Evaluation into one of the operands
+   Vector3D x = a;
+   x = b - x;
+   check("a = b - a", vdiff(x, Vector3D(-5.0, -1.5, -1.0)), 0.0);
+   x = a;
+   x += -x * 0.5;
+   check("a += -a*0.5", vdiff(x, Vector3D(0.5, 1.0, 1.5)), 0.0);
+   x = a;
+   x -= x + x;
+   check("a -= a + a", vdiff(x, Vector3D(-1.0, -2.0, -3.0)), 0.0);
+   x = a;
+   x = x * s + x - b;
+   check("a = a*s + a - b", vdiff(x, Vector3D(7.0, 5.5, 7.0)), 0.0);
+
+   // Cross product with an expression argument
+   Vector3D bc = b + c;
+   check("a.crossProduct(b + c)", vdiff(a.crossProduct(b + c), a.crossProduct(bc)), 0.0);
+   check("a.crossProduct(a*s) is null", a.crossProduct(a * s).isNull());
+   check("a x b . a", std::abs(a.crossProduct(b).dotProduct(a)), 1e-15);
+
+   // Norm without overflow nor underflow of the squares
+   check("norm of (3, 4, 12)", Vector3D(3.0, 4.0, 12.0).norm(), 13.0, 0.0);
+   check("norm of (3e200, 4e200, 12e200)", Vector3D(3e200, 4e200, 12e200).norm(), 13e200, 1e186);
+   check("norm of (3e-200, 4e-200, 12e-200)", Vector3D(3e-200, 4e-200, 12e-200).norm(), 13e-200, 1e-214);
+   check("normalized (1e300, 0, 0)", vdiff(Vector3D(1e300, 0.0, 0.0).normalized(), Vector3D(1.0, 0.0, 0.0)), 0.0);
+
+   // Projection and rejection
+   Vector3D p = a.projectOn(b), q = a.rejectFrom(b);
+   check("projection + rejection", vdiff(p + q, a), 1e-15);
+   check("rejection perpendicular", q.isPerpendicular(b));
+
+   return OslTest::report();
+}
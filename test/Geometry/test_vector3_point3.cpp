@@ -0,0 +1,78 @@
+// ===== TESTS legacy Vector3 and Point3 =====
+// Both headers define Osl::Geometry::NULL_VEC, so this test is built twice:
+// for Vector3 (test_vector3_point3) and with OSL_TEST_POINT3 defined for Point3
+// (test_point3).
+#ifdef OSL_TEST_POINT3
+#include "Osl/Geometry/point3.h"
+typedef Osl::Geometry::Point3 Vec;
+#else
+#include "Osl/Geometry/vector3.h"
+typedef Osl::Geometry::Vector3 Vec;
+#endif
+#include "OslTest.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+
+// Largest coordinate difference of a vector with given coordinates
+double vdiff(const Vec &a, double x, double y, double z)
+{
+    return std::max({std::abs(a.getX() - x), std::abs(a.getY() - y), std::abs(a.getZ() - z)});
+}
+
+// The in-place operations are constexpr
+constexpr Vec negated(Vec v)
+{
+    -v;
+    return v;
+}
+static_assert(negated(Vec(1.0, -2.0, 3.0)).getY() == 2.0, "constexpr in-place negation");
+
+} // namespace
+
+int main()
+{
+   using OslTest::check;
+
+   const Vec a(1.0, 2.0, 3.0), b(-4.0, 0.5, 2.0);
+
+   // Unary minus negates the vector in place
+   Vec v = a;
+   -v;
+   check("-v negates v in place", vdiff(v, -1.0, -2.0, -3.0), 0.0);
+
+   // crossProduct, projectOn and rejectFrom modify the vector in place
+   v = a;
+   v.crossProduct(b);
+   check("v.crossProduct(b) in place", vdiff(v, 2.5, -14.0, 8.5), 0.0);
+   v = a;
+   v.crossProduct(v);
+   check("v.crossProduct(v) is null", v.isNull());
+   v = a;
+   v.projectOn(b);
+   Vec w = a;
+   w.rejectFrom(b);
+   check("projectOn + rejectFrom", vdiff(v + w, 1.0, 2.0, 3.0), 1e-15);
+   check("rejectFrom perpendicular", w.isPerpendicular(b));
+   check("isColinear leaves the vector unchanged", a.isColinear(a * 2.0) && !a.isColinear(b) &&
+                                                   (vdiff(a, 1.0, 2.0, 3.0) == 0.0));
+
+   // Compound operators
+   v = a;
+   v += b;
+   v -= a * 2.0;
+   v *= 2.0;
+   v /= 4.0;
+   check("compound operators", vdiff(v, -2.5, -0.75, -0.5), 0.0);
+   check("scalar * vector", vdiff(2.0 * a, 2.0, 4.0, 6.0), 0.0);
+
+   // Norm without overflow of the squares
+   check("norm of (3e200, 4e200, 12e200)", Vec(3e200, 4e200, 12e200).norm(), 13e200, 1e186);
+   v = Vec(1e300, 0.0, 0.0);
+   v.normalize();
+   check("normalize (1e300, 0, 0)", vdiff(v, 1.0, 0.0, 0.0), 0.0);
+
+   return OslTest::report();
+}
@@ -45,5 +45,64 @@ int main()
               << std::chrono::duration_cast<std::chrono::milliseconds>( t2 - t1 ).count()
               << " ms [" << n << " iterations]" << std::endl;
 
+    // Windowed sinc on a band-limited signal, compared to the full sinc
+    vector ys(x.size());
+    for (std::size_t i = 0 ; i < x.size() ; ++i)
+        ys[i] = std::cos(2.0 * x[i]);
+    Interpolator::Sinc fsf(x, ys);
+    Interpolator::WindowedSinc fws(x, ys, 8, Interpolator::SincWindow::kaiser);
+    double vs, err = 0.0, errs = 0.0;
+    n = 0;
+    t1 = std::chrono::high_resolution_clock::now();
+    for (double xi = x.front() ; xi <= x.back() ; xi += 0.00001)
+    {
+        fws(xi, v);
+        n++;
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "WindowedSinc execution time = "
+              << std::chrono::duration_cast<std::chrono::milliseconds>( t2 - t1 ).count()
+              << " ms [" << n << " iterations]" << std::endl;
+    for (double xi = x[20] ; xi <= x[80] ; xi += 0.001)
+    {
+        fws(xi, v);
+        fsf(xi, vs);
+        err = std::max(err, std::abs(v - std::cos(2.0 * xi)));
+        errs = std::max(errs, std::abs(vs - std::cos(2.0 * xi)));
+    }
+    std::cout << "Max error inside the data: WindowedSinc = " << err
+              << ", Sinc = " << errs << std::endl;
+
+    cvector yc(x.size());
+    for (std::size_t i = 0 ; i < x.size() ; ++i)
+        yc[i] = std::polar(1.0, 2.0 * x[i]);
+    Interpolator::ComplexWindowedSinc fcws(x, yc);
+    complex vc;
+    err = 0.0;
+    for (double xi = x[20] ; xi <= x[80] ; xi += 0.001)
+    {
+        fcws(xi, vc);
+        err = std::max(err, std::abs(vc - std::polar(1.0, 2.0 * xi)));
+    }
+    std::cout << "Max error inside the data: ComplexWindowedSinc = " << err << std::endl;
+
+    // Streaming cubic interpolator over a sliding window of 1000 segments
+    Interpolator::StreamingCubicSpline fst(1000);
+    n = 0;
+    err = 0.0;
+    t1 = std::chrono::high_resolution_clock::now();
+    for (double xi = 0.0 ; xi < 1000.0 ; xi += 0.01)
+    {
+        fst.append(xi, std::cos(xi));
+        n++;
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "StreamingCubicSpline append time = "
+              << std::chrono::duration_cast<std::chrono::milliseconds>( t2 - t1 ).count()
+              << " ms [" << n << " samples, " << fst.size() << " segments kept]" << std::endl;
+    for (double xi = fst.getXmin() ; xi <= fst.getXmax() ; xi += 0.0001)
+        err = std::max(err, std::abs(fst.at(xi) - std::cos(xi)));
+    std::cout << "Max error inside the window: StreamingCubicSpline = " << err << std::endl;
+
     return 0;
 }
@@ -0,0 +1,201 @@
+// ===== TESTS batch evaluation of the 1D splines =====
+// The batch evaluate() and search_indices_for_interpolation() of the real
+// and complex linear, quadratic and cubic splines are compared to the
+// scalar operator() and search_index_for_interpolation(), on evenly and
+// unevenly spaced axes, for sorted and unsorted queries.
+#include "Osl.h"
+#include "OslTest.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+
+namespace {
+
+using namespace Osl;
+using namespace Osl::Maths::Interpolator;
+using OslTest::check;
+
+const double nan = std::numeric_limits<double>::quiet_NaN();
+
+// Difference of two values, zero if both are NaN
+double diff(double a, double b)
+{
+    if (std::isnan(a) || std::isnan(b))
+        return (std::isnan(a) && std::isnan(b)) ? 0.0 : std::numeric_limits<double>::infinity();
+    return std::abs(a - b) / std::max(1.0, std::abs(b));
+}
+
+double diff(const complex &a, const complex &b)
+{
+    return std::max(diff(a.real(), b.real()), diff(a.imag(), b.imag()));
+}
+
+// Scalar evaluation of the function and of its first derivative; the
+// linear splines have no such operator(), their derivative is the slope of
+// the segment
+template <class Spline, class T>
+void scalar(Spline &s, double x, T &y, T &yp)
+{
+    s(x, y, yp);
+}
+
+void scalar(LinearSpline &s, double x, double &y, double &yp)
+{
+    vector a, b;
+    s.getCoeffs(a, b);
+    s(x, y);
+    yp = a[s.search_index_for_interpolation(x)];
+}
+
+void scalar(ComplexLinearSpline &s, double x, complex &y, complex &yp)
+{
+    cvector a, b;
+    s.getCoeffs(a, b);
+    s(x, y);
+    yp = a[s.search_index_for_interpolation(x)];
+}
+
+// Compares the batch evaluation of the function and of its first
+// \em order derivatives to the scalar one
+template <int order, class Spline, class T>
+void test_evaluate(const std::string &name, Spline &s, const vector &xq, bool sorted)
+{
+    const std::size_t n = xq.size();
+    // Outputs are filled with a marker to detect the values not written
+    std::vector<T> y(n, T(-7.0)), yp(n, T(-7.0)), ypp(n, T(-7.0));
+    if constexpr (order == 0)
+        s.evaluate(xq.data(), y.data(), n, sorted);
+    else if constexpr (order == 1)
+        s.evaluate(xq.data(), y.data(), yp.data(), n, sorted);
+    else
+        s.evaluate(xq.data(), y.data(), yp.data(), ypp.data(), n, sorted);
+    double err = 0.0;
+    for (std::size_t k = 0 ; k < n ; ++k)
+    {
+        T v, vp, vpp;
+        if constexpr (order == 0)
+            s(xq[k], v);
+        else if constexpr (order == 1)
+            scalar(s, xq[k], v, vp);
+        else
+            s(xq[k], v, vp, vpp);
+        err = std::max(err, diff(y[k], v));
+        if constexpr (order >= 1)
+            err = std::max(err, diff(yp[k], vp));
+        if constexpr (order >= 2)
+            err = std::max(err, diff(ypp[k], vpp));
+    }
+    check(name + ": evaluate(order " + std::to_string(order) + ") vs operator()", err, 1e-13);
+}
+
+// Runs the batch checks of one spline on one set of queries
+template <int max_order, class Spline, class T>
+void test_queries(const std::string &name, Spline &s, const vector &xq, bool sorted)
+{
+    const std::size_t n = xq.size();
+    const std::string qname = name + " [n = " + std::to_string(n) +
+                              (sorted ? ", sorted]" : ", unsorted]");
+    std::vector<std::size_t> index(n, std::size_t(-1));
+    s.search_indices_for_interpolation(xq.data(), index.data(), n, sorted);
+    bool same = true;
+    for (std::size_t k = 0 ; k < n ; ++k)
+        same = same && (index[k] == s.search_index_for_interpolation(xq[k]));
+    check(qname + ": search_indices vs search_index", same);
+    test_evaluate<0, Spline, T>(qname, s, xq, sorted);
+    if constexpr (max_order >= 1)
+        test_evaluate<1, Spline, T>(qname, s, xq, sorted);
+    if constexpr (max_order >= 2)
+        test_evaluate<2, Spline, T>(qname, s, xq, sorted);
+    // vector overload
+    if (!sorted)
+    {
+        std::vector<T> yv, y(n);
+        s.evaluate(xq, yv, sorted);
+        s.evaluate(xq.data(), y.data(), n, sorted);
+        double err = (yv.size() == n) ? 0.0 : 1.0;
+        for (std::size_t k = 0 ; (k < n) && (yv.size() == n) ; ++k)
+            err = std::max(err, diff(yv[k], y[k]));
+        check(qname + ": evaluate(vector) vs evaluate(pointer)", err, 0.0);
+    }
+}
+
+// Runs the batch checks of one spline on the sets of queries
+template <int max_order, class Spline, class T>
+void test_spline(const std::string &name, Spline &s, const vector &x, std::mt19937 &gen)
+{
+    const double xmin = x.front(), xmax = x.back(), h = (xmax - xmin) / double(x.size() - 1);
+    std::uniform_real_distribution<double> u(xmin - 2.0 * h, xmax + 2.0 * h);
+    // Unsorted queries: random values, knots, values just around the knots,
+    // out-of-range and NaN values
+    vector xq(257);
+    for (std::size_t k = 0 ; k < xq.size() ; ++k)
+        xq[k] = u(gen);
+    for (std::size_t k = 0 ; k < 20 ; ++k)
+    {
+        const double xk = x[(7 * k) % x.size()];
+        xq[3 * k] = xk;
+        xq[3 * k + 1] = std::nextafter(xk, -1e300);
+        xq[3 * k + 2] = std::nextafter(xk, 1e300);
+    }
+    xq[100] = nan;
+    xq[101] = xmin - 1e3;
+    xq[102] = xmax + 1e3;
+    xq[103] = xmin;
+    xq[104] = xmax;
+    xq[256] = nan;
+    test_queries<max_order, Spline, T>(name, s, vector(), false);
+    test_queries<max_order, Spline, T>(name, s, vector(1, nan), false);
+    test_queries<max_order, Spline, T>(name, s, vector(1, u(gen)), false);
+    test_queries<max_order, Spline, T>(name, s, xq, false);
+    // Sorted queries (without NaN)
+    xq[100] = xmin - 2.0 * h;
+    xq[256] = xmax + 2.0 * h;
+    std::sort(xq.begin(), xq.end());
+    test_queries<max_order, Spline, T>(name, s, vector(), true);
+    test_queries<max_order, Spline, T>(name, s, vector(1, xmax - 0.5 * h), true);
+    test_queries<max_order, Spline, T>(name, s, xq, true);
+}
+
+} // namespace
+
+int main()
+{
+   std::mt19937 gen(4);
+
+   // Evenly and unevenly spaced axes
+   const std::size_t n = 41;
+   vector xu = Maths::Arrays::linspace(-3.0, 7.0, n), xj(n);
+   for (std::size_t i = 0 ; i < n ; ++i)
+       xj[i] = -3.0 + 0.25 * double(i) + 0.08 * std::sin(3.0 * double(i));
+   for (const vector *px : {&xu, &xj})
+   {
+       const vector &x = *px;
+       vector y(n);
+       cvector yc(n);
+       for (std::size_t i = 0 ; i < n ; ++i)
+       {
+           y[i] = std::sin(x[i]) + 0.1 * x[i] * x[i];
+           yc[i] = complex(y[i], std::cos(2.0 * x[i]));
+       }
+       const std::string axis = (px == &xu) ? " (uniform axis)" : " (uneven axis)";
+
+       LinearSpline ls(x, y);
+       QuadraticSpline qs(x, y);
+       CubicSpline cs(x, y);
+       ComplexLinearSpline cls(x, yc);
+       ComplexQuadraticSpline cqs(x, yc);
+       ComplexCubicSpline ccs(x, yc);
+
+       test_spline<1, LinearSpline, double>("LinearSpline" + axis, ls, x, gen);
+       test_spline<1, QuadraticSpline, double>("QuadraticSpline" + axis, qs, x, gen);
+       test_spline<2, CubicSpline, double>("CubicSpline" + axis, cs, x, gen);
+       test_spline<1, ComplexLinearSpline, complex>("ComplexLinearSpline" + axis, cls, x, gen);
+       test_spline<1, ComplexQuadraticSpline, complex>("ComplexQuadraticSpline" + axis, cqs, x, gen);
+       test_spline<2, ComplexCubicSpline, complex>("ComplexCubicSpline" + axis, ccs, x, gen);
+   }
+
+   return OslTest::report();
+}
@@ -0,0 +1,101 @@
+// ===== TESTS evenly spaced axis of the 1D splines =====
+// On an evenly spaced axis the real and complex linear, quadratic and cubic
+// splines don't store the axis and compute the index of interpolation in
+// O(1): the index is compared to a binary search on the axis.
+#include "Osl.h"
+#include "OslTest.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+
+namespace {
+
+using namespace Osl;
+using namespace Osl::Maths::Interpolator;
+using OslTest::check;
+
+// Index of the segment of the axis x containing xeval, by binary search
+std::size_t binary_search(const vector &x, double xeval)
+{
+    std::size_t i = std::upper_bound(x.begin(), x.end(), xeval) - x.begin();
+    return std::min(std::max(i, std::size_t(1)), x.size() - 1) - 1;
+}
+
+template <class Spline>
+void test_spline(const std::string &name, Spline &s, const vector &x, bool uniform)
+{
+    check(name + ": isUniform()", s.isUniform() == uniform);
+
+    // Axis given back from the spacing or from the stored axis
+    vector xs = s.getX();
+    double err = (xs.size() == x.size()) ? 0.0 : 1.0;
+    for (std::size_t i = 0 ; (i < x.size()) && (xs.size() == x.size()) ; ++i)
+        err = std::max(err, std::abs(xs[i] - x[i]));
+    check(name + ": getX()", err, 1e-12);
+    check(name + ": getXmin()", s.getXmin(), x.front(), 0.0);
+    check(name + ": getXmax()", s.getXmax(), x.back(), 0.0);
+
+    // Index at, just below and just above the knots, and in the middle of
+    // the segments
+    bool same = true;
+    for (std::size_t i = 0 ; i < xs.size() ; ++i)
+    {
+        double xi[4] = {xs[i], std::nextafter(xs[i], -1e300), std::nextafter(xs[i], 1e300),
+                        (i + 1 < xs.size()) ? 0.5 * (xs[i] + xs[i+1]) : xs[i] + 1.0};
+        for (double xe : xi)
+            same = same && (s.search_index_for_interpolation(xe) == binary_search(xs, xe));
+    }
+    check(name + ": index vs binary search at and around the knots", same);
+
+    // NaN and below xmin give index 0, above xmax the last index
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    check(name + ": index of NaN", s.search_index_for_interpolation(nan) == 0);
+    check(name + ": index below xmin", (s.search_index_for_interpolation(x.front() - 1.0) == 0) &&
+                                       (s.search_index_for_interpolation(-1e300) == 0));
+    check(name + ": index above xmax", (s.search_index_for_interpolation(x.back() + 1.0) == x.size() - 2) &&
+                                       (s.search_index_for_interpolation(1e300) == x.size() - 2));
+}
+
+} // namespace
+
+int main()
+{
+   // Evenly spaced axis, and the same axis with one jittered knot
+   const std::size_t n = 37;
+   vector xu = Maths::Arrays::linspace(-1.3, 2.3, n), xj = xu;
+   xj[n / 3] += 1e-3;
+   for (const vector *px : {&xu, &xj})
+   {
+       const vector &x = *px;
+       const bool uniform = (px == &xu);
+       const std::string axis = uniform ? " (uniform axis)" : " (jittered axis)";
+       vector y(n);
+       cvector yc(n);
+       for (std::size_t i = 0 ; i < n ; ++i)
+       {
+           y[i] = std::exp(-x[i] * x[i]);
+           yc[i] = complex(y[i], x[i]);
+       }
+
+       LinearSpline ls(x, y);
+       QuadraticSpline qs(x, y);
+       CubicSpline cs(x, y);
+       ComplexLinearSpline cls(x, yc);
+       ComplexQuadraticSpline cqs(x, yc);
+       ComplexCubicSpline ccs(x, yc);
+       test_spline("LinearSpline" + axis, ls, x, uniform);
+       test_spline("QuadraticSpline" + axis, qs, x, uniform);
+       test_spline("CubicSpline" + axis, cs, x, uniform);
+       test_spline("ComplexLinearSpline" + axis, cls, x, uniform);
+       test_spline("ComplexQuadraticSpline" + axis, cqs, x, uniform);
+       test_spline("ComplexCubicSpline" + axis, ccs, x, uniform);
+
+       // Copies keep the layout of the axis
+       CubicSpline cs_copy(cs);
+       test_spline("CubicSpline copy" + axis, cs_copy, x, uniform);
+   }
+
+   return OslTest::report();
+}
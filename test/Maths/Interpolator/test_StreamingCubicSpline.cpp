@@ -0,0 +1,174 @@
+// ===== TESTS StreamingCubicSpline =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+
+namespace {
+
+using Osl::vector;
+using Osl::Maths::Interpolator::StreamingCubicSpline;
+using OslTest::check;
+
+double f(double x) { return std::sin(0.8 * x) + 0.05 * x * x; }
+
+// Whether a call throws std::invalid_argument
+template <class F>
+bool throws(F &&call)
+{
+    try { call(); }
+    catch (const std::invalid_argument &) { return true; }
+    return false;
+}
+
+// Largest difference between two interpolators on a set of values
+double sdiff(StreamingCubicSpline &s, StreamingCubicSpline &ref, const vector &x)
+{
+    double d = 0.0;
+    for (double xk : x)
+    {
+        double y, yr, yp, ypr;
+        s(xk, y, yp);
+        ref(xk, yr, ypr);
+        d = std::max({d, std::abs(y - yr), std::abs(yp - ypr)});
+    }
+    return d;
+}
+
+} // namespace
+
+int main()
+{
+   const double nan = std::numeric_limits<double>::quiet_NaN();
+
+   // Reference stream keeping all the segments
+   StreamingCubicSpline ref(100);
+   vector xs(12);
+   for (std::size_t k = 0 ; k < xs.size() ; ++k)
+   {
+       xs[k] = double(k) + 0.3 * std::sin(double(k));
+       ref.append(xs[k], f(xs[k]));
+   }
+   double err = 0.0;
+   for (double xk : xs)
+       err = std::max(err, std::abs(ref.at(xk) - f(xk)));
+   check("Interpolation at the samples", err, 1e-14);
+
+   // Construction
+   check("Capacity 0 throws", throws([] { StreamingCubicSpline s(0); }));
+   StreamingCubicSpline s0;
+   check("Append without capacity throws", throws([&] { s0.append(0.0, 0.0); }));
+
+   // Not ready: no or a single sample
+   StreamingCubicSpline s(5);
+   double y = 0.0, yp = 0.0, yb[3] = {0.0, 0.0, 0.0}, xb[3] = {0.0, 1.0, 2.0};
+   for (int nsamples = 0 ; nsamples < 2 ; ++nsamples)
+   {
+       const std::string name = "Not ready (" + std::to_string(nsamples) + " sample): ";
+       check(name + "isReady()", !s.isReady() && (s.size() == 0));
+       check(name + "getXmin()", s.getXmin(), nan, 0.0);
+       check(name + "getXmax()", s.getXmax(), nan, 0.0);
+       s(1.0, y);
+       check(name + "operator()(x, y)", y, nan, 0.0);
+       y = 0.0;
+       s(1.0, y, yp);
+       check(name + "operator()(x, y, yp)", std::isnan(y) && std::isnan(yp));
+       s.evaluate(xb, yb, 3);
+       check(name + "evaluate()", std::isnan(yb[0]) && std::isnan(yb[1]) && std::isnan(yb[2]));
+       check(name + "at() throws", throws([&] { s.at(1.0, true); }));
+       check(name + "search_index_for_interpolation() throws",
+             throws([&] { s.search_index_for_interpolation(1.0); }));
+       if (nsamples == 0)
+           s.append(xs[0], f(xs[0]));
+   }
+
+   // Non-increasing abscissas are rejected, leaving the stream unchanged
+   s.append(xs[1], f(xs[1]));
+   check("Append of the last x throws", throws([&] { s.append(xs[1], 0.0); }));
+   check("Append of a lower x throws", throws([&] { s.append(xs[0], 0.0); }));
+   check("Append of NaN throws", throws([&] { s.append(nan, 0.0); }));
+   check("Stream unchanged by the rejected appends", (s.size() == 1) &&
+                                                     (s.getXmin() == xs[0]) && (s.getXmax() == xs[1]));
+
+   // Ring buffer: after wrap-around only the last 5 segments are kept, equal
+   // to the ones of the reference stream
+   for (std::size_t k = 2 ; k < xs.size() ; ++k)
+       s.append(xs[k], f(xs[k]));
+   check("Wrap-around: size()", (s.size() == 5) && (s.getCapacity() == 5));
+   check("Wrap-around: getXmin()", s.getXmin(), xs[xs.size() - 6], 0.0);
+   check("Wrap-around: getXmax()", s.getXmax(), xs.back(), 0.0);
+   vector xq = Osl::Maths::Arrays::linspace(xs[xs.size() - 6], xs.back(), 101);
+   check("Wrap-around: values vs reference", sdiff(s, ref, xq), 0.0, 0.0);
+   check("Wrap-around: at() out of the window throws", throws([&] { s.at(xs[2]); }));
+   check("Wrap-around: search_index_for_interpolation()",
+         (s.search_index_for_interpolation(xs[7] + 0.1) == 1) &&
+         (s.search_index_for_interpolation(-1e300) == 0) &&
+         (s.search_index_for_interpolation(nan) == 0) &&
+         (s.search_index_for_interpolation(1e300) == 4));
+
+   // Batch evaluation, sorted (merge-walk across the ring buffer) and
+   // unsorted, including values out of the window
+   std::mt19937 gen(7);
+   std::uniform_real_distribution<double> u(s.getXmin() - 1.0, s.getXmax() + 1.0);
+   for (std::size_t n : {std::size_t(1), std::size_t(257)})
+   {
+       vector x(n), ys(n), yu(n);
+       for (double &xk : x)
+           xk = u(gen);
+       x[0] = (n > 1) ? s.getXmin() - 0.5 : x[0];
+       s.evaluate(x.data(), yu.data(), n);
+       std::sort(x.begin(), x.end());
+       s.evaluate(x.data(), ys.data(), n, true);
+       double err_sorted = 0.0, err_unsorted = 0.0;
+       for (std::size_t k = 0 ; k < n ; ++k)
+       {
+           s(x[k], y);
+           err_sorted = std::max(err_sorted, std::abs(ys[k] - y));
+       }
+       // Same values in sorted order
+       std::sort(yu.begin(), yu.end());
+       std::sort(ys.begin(), ys.end());
+       for (std::size_t k = 0 ; k < n ; ++k)
+           err_unsorted = std::max(err_unsorted, std::abs(yu[k] - ys[k]));
+       const std::string name = "evaluate() [n = " + std::to_string(n) + "]";
+       check(name + " sorted vs operator()", err_sorted, 0.0, 0.0);
+       check(name + " unsorted vs sorted", err_unsorted, 0.0, 0.0);
+   }
+
+   // Capacity 1: only the last segment, provisional, is kept
+   StreamingCubicSpline s1(1);
+   s1.append(xs[0], f(xs[0]));
+   s1.append(xs[1], f(xs[1]));
+   check("Capacity 1: first segment", (s1.size() == 1) && (s1.getXmin() == xs[0]) &&
+                                      (s1.getXmax() == xs[1]));
+   StreamingCubicSpline ref2(2);
+   ref2.append(xs[0], f(xs[0]));
+   ref2.append(xs[1], f(xs[1]));
+   check("Capacity 1: linear first segment", sdiff(s1, ref2, vector{xs[0], 0.5 * (xs[0] + xs[1])}), 0.0, 0.0);
+   for (std::size_t k = 2 ; k < 6 ; ++k)
+   {
+       s1.append(xs[k], f(xs[k]));
+       ref2.append(xs[k], f(xs[k]));
+   }
+   check("Capacity 1: size()", s1.size() == 1);
+   check("Capacity 1: getXmin()", s1.getXmin(), xs[4], 0.0);
+   check("Capacity 1: getXmax()", s1.getXmax(), xs[5], 0.0);
+   check("Capacity 1: last segment vs capacity 2",
+         sdiff(s1, ref2, Osl::Maths::Arrays::linspace(xs[4], xs[5], 11)), 0.0, 0.0);
+   s1.evaluate(xb, yb, 3, true);
+   check("Capacity 1: sorted evaluate()", (s1.search_index_for_interpolation(xb[2]) == 0) &&
+                                          (yb[2] == s1.at(xb[2], true)));
+
+   // clear() keeps the capacity
+   s.clear();
+   check("clear()", !s.isReady() && (s.size() == 0) && (s.getCapacity() == 5));
+   s.append(1.0, 2.0);
+   s.append(2.0, 4.0);
+   check("Append after clear()", s.at(1.5), 3.0, 1e-15);
+
+   return OslTest::report();
+}
@@ -0,0 +1,73 @@
+// ===== TESTS WindowedSinc and ComplexWindowedSinc =====
+#include "Osl.h"
+#include "OslTest.h"
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+int main()
+{
+   using namespace Osl;
+   using Maths::Interpolator::WindowedSinc,
+         Maths::Interpolator::ComplexWindowedSinc;
+   using OslTest::check;
+
+   // Band-limited signal sampled well above its Nyquist rate
+   std::size_t n = 256;
+   vector x = Maths::Arrays::linspace(0.0, 25.5, n), y(n);
+   cvector yc(n);
+   auto f = [](double t) { return std::sin(0.7 * t) + 0.5 * std::cos(1.3 * t); };
+   for (std::size_t i = 0 ; i < n ; ++i)
+   {
+       y[i] = f(x[i]);
+       yc[i] = complex(y[i], -y[i]);
+   }
+   WindowedSinc ws(x, y);
+   ComplexWindowedSinc cws(x, yc);
+
+   // Accuracy away from the edges of the data
+   double max_err = 0.0, max_cerr = 0.0;
+   for (double t = 2.0 ; t <= 23.5 ; t += 0.013)
+   {
+       double v;
+       complex c;
+       ws(t, v);
+       cws(t, c);
+       max_err = std::max(max_err, std::abs(v - f(t)));
+       max_cerr = std::max(max_cerr, std::abs(c - complex(f(t), -f(t))));
+   }
+   check("WindowedSinc: max error inside the data", max_err, 1e-3);
+   check("ComplexWindowedSinc: max error inside the data", max_cerr, 1.5e-3);
+
+   // NaN and infinite abscissas give NaN, far abscissas give zero
+   double nan = std::numeric_limits<double>::quiet_NaN(),
+          inf = std::numeric_limits<double>::infinity(), v;
+   complex c;
+   ws(nan, v);
+   check("WindowedSinc(NaN)", v, nan, 0.0);
+   ws(inf, v);
+   check("WindowedSinc(inf)", v, nan, 0.0);
+   ws(1e300, v);
+   check("WindowedSinc(1e300)", v, 0.0, 0.0);
+   ws(-1e300, v);
+   check("WindowedSinc(-1e300)", v, 0.0, 0.0);
+   check("WindowedSinc.at(NaN, true)", ws.at(nan, true), nan, 0.0);
+   cws(nan, c);
+   check("ComplexWindowedSinc(NaN)", c.real(), nan, 0.0);
+   cws(1e300, c);
+   check("ComplexWindowedSinc(1e300)", std::abs(c), 0.0, 0.0);
+
+   // Unevenly spaced axis
+   vector xu = x;
+   xu[n / 2] += 0.01;
+   bool thrown = false;
+   try { WindowedSinc wu(xu, y); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("WindowedSinc with an uneven axis throws", thrown);
+   thrown = false;
+   try { ComplexWindowedSinc cwu(xu, yc); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("ComplexWindowedSinc with an uneven axis throws", thrown);
+
+   return OslTest::report();
+}
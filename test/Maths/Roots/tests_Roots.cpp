@@ -1,15 +1,207 @@
 // ====== TESTS ROOTS ======
+#include "Osl.h"
+#include "OslTest.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace Osl;
+using OslTest::check;
+
+// Polynomial with its expected real roots in increasing order
+struct Poly
+{
+    std::string name;
+    std::vector<double> coeffs, roots;
+    double tol;
+};
+
+// Largest relative error of the found roots, infinite if their number is
+// wrong
+double roots_error(const double *x, std::size_t n, const std::vector<double> &roots)
+{
+    if (n != roots.size())
+        return std::numeric_limits<double>::infinity();
+    double err = 0.0;
+    for (std::size_t k = 0 ; k < n ; ++k)
+        err = std::max(err, std::abs(x[k] - roots[k]) / std::max(1.0, std::abs(roots[k])));
+    return err;
+}
+
+// Whether the missing roots are NaN
+bool missing_nan(const double *x, std::size_t n, std::size_t degree)
+{
+    bool ok = true;
+    for (std::size_t k = n ; k < degree ; ++k)
+        ok = ok && std::isnan(x[k]);
+    return ok;
+}
+
+// Same values, NaN included
+bool same(double a, double b)
+{
+    return (a == b) || (std::isnan(a) && std::isnan(b));
+}
+
+// Compares the batch (SoA) roots of random polynomials and of the given
+// ones to the scalar roots
+template <std::size_t degree>
+void test_batch(const std::vector<Poly> &polys, std::mt19937 &gen)
+{
+    std::uniform_real_distribution<double> u(-10.0, 10.0);
+    std::size_t n = polys.size() + 300;
+    std::vector<std::vector<double>> c(degree + 1, std::vector<double>(n)),
+                                     x(degree, std::vector<double>(n));
+    std::vector<std::size_t> nroots(n);
+    for (std::size_t i = 0 ; i < n ; ++i)
+        for (std::size_t j = 0 ; j <= degree ; ++j)
+            c[j][i] = (i < polys.size()) ? polys[i].coeffs[j] : u(gen);
+    if constexpr (degree == 2)
+        Maths::Roots::quadratic_roots(c[0].data(), c[1].data(), c[2].data(), n,
+                                      x[0].data(), x[1].data(), nroots.data());
+    else if constexpr (degree == 3)
+        Maths::Roots::cubic_roots(c[0].data(), c[1].data(), c[2].data(), c[3].data(), n,
+                                  x[0].data(), x[1].data(), x[2].data(), nroots.data());
+    else
+        Maths::Roots::quartic_roots(c[0].data(), c[1].data(), c[2].data(), c[3].data(),
+                                    c[4].data(), n,
+                                    x[0].data(), x[1].data(), x[2].data(), x[3].data(),
+                                    nroots.data());
+    bool ok = true;
+    std::size_t counts[5] = {0, 0, 0, 0, 0};
+    for (std::size_t i = 0 ; i < n ; ++i)
+    {
+        double r[degree];
+        std::size_t nr;
+        if constexpr (degree == 2)
+            nr = Maths::Roots::RealRoots::quadratic(c[0][i], c[1][i], c[2][i], r[0], r[1]);
+        else if constexpr (degree == 3)
+            nr = Maths::Roots::RealRoots::cubic(c[0][i], c[1][i], c[2][i], c[3][i], r[0], r[1], r[2]);
+        else
+            nr = Maths::Roots::RealRoots::quartic(c[0][i], c[1][i], c[2][i], c[3][i], c[4][i],
+                                                  r[0], r[1], r[2], r[3]);
+        ok = ok && (nr == nroots[i]);
+        for (std::size_t k = 0 ; k < degree ; ++k)
+            ok = ok && same(r[k], x[k][i]);
+        ++counts[nr];
+    }
+    // Number of polynomials with 0, 1, ... real roots
+    std::string name = "Degree " + std::to_string(degree) + ": batch vs scalar (";
+    for (std::size_t k = 0 ; k <= degree ; ++k)
+        name += std::to_string(counts[k]) + ((k < degree) ? "/" : ")");
+    check(name, ok);
+
+    // Zero leading coefficient
+    c[0][n / 2] = 0.0;
+    bool thrown = false;
+    try
+    {
+        if constexpr (degree == 2)
+            Maths::Roots::quadratic_roots(c[0].data(), c[1].data(), c[2].data(), n,
+                                          x[0].data(), x[1].data(), nroots.data());
+        else if constexpr (degree == 3)
+            Maths::Roots::cubic_roots(c[0].data(), c[1].data(), c[2].data(), c[3].data(), n,
+                                      x[0].data(), x[1].data(), x[2].data(), nroots.data());
+        else
+            Maths::Roots::quartic_roots(c[0].data(), c[1].data(), c[2].data(), c[3].data(),
+                                        c[4].data(), n,
+                                        x[0].data(), x[1].data(), x[2].data(), x[3].data(),
+                                        nroots.data());
+    }
+    catch (const std::invalid_argument &) { thrown = true; }
+    check("Degree " + std::to_string(degree) + ": batch with a zero leading coefficient throws", thrown);
+}
+
+} // namespace
+
 int main()
 {
-   double a(3), b(6), c(-123), d(-126), e(1080);
-   complex x1, x2, x3, x4;
-   Maths::Roots::quarticRoots(a, b, c, d, e, x1, x2, x3, x4);
+   const double eps = std::numeric_limits<double>::epsilon();
+   std::mt19937 gen(10);
+
+   // Quadratic polynomials
+   std::vector<Poly> quadratics = {
+       {"(x-1)(x-2)", {1.0, -3.0, 2.0}, {1.0, 2.0}, 4.0 * eps},
+       {"-2(x+3)(x-0.5)", {-2.0, -5.0, 3.0}, {-3.0, 0.5}, 4.0 * eps},
+       {"(x-1e-8)(x-1e8)", {1.0, -1e8 - 1e-8, 1.0}, {1e-8, 1e8}, 4.0 * eps},
+       {"(x-1)^2", {1.0, -2.0, 1.0}, {1.0, 1.0}, 4.0 * eps},
+       {"x^2", {1.0, 0.0, 0.0}, {0.0, 0.0}, 0.0},
+       {"x^2+1", {1.0, 0.0, 1.0}, {}, 0.0}};
+   for (const Poly &p : quadratics)
+   {
+       double x[2];
+       std::size_t n = Maths::Roots::quadratic_roots(p.coeffs[0], p.coeffs[1], p.coeffs[2], x[0], x[1]);
+       check("Quadratic " + p.name + ": roots", roots_error(x, n, p.roots), p.tol);
+       check("Quadratic " + p.name + ": missing roots are NaN", missing_nan(x, n, 2));
+   }
+
+   // Cubic polynomials
+   std::vector<Poly> cubics = {
+       {"(x-1)(x-2)(x-3)", {1.0, -6.0, 11.0, -6.0}, {1.0, 2.0, 3.0}, 16.0 * eps},
+       {"x^3-8", {1.0, 0.0, 0.0, -8.0}, {2.0}, 4.0 * eps},
+       {"2(x+1)(x^2+x+1)", {2.0, 4.0, 4.0, 2.0}, {-1.0}, 4.0 * eps},
+       {"(x-1)^2(x-2)", {1.0, -4.0, 5.0, -2.0}, {1.0, 1.0, 2.0}, 1e-7},
+       {"(x-1)^3", {1.0, -3.0, 3.0, -1.0}, {1.0, 1.0, 1.0}, 1e-5},
+       {"x^3", {1.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, 0.0}};
+   for (const Poly &p : cubics)
+   {
+       double x[3];
+       std::size_t n = Maths::Roots::cubic_roots(p.coeffs[0], p.coeffs[1], p.coeffs[2], p.coeffs[3],
+                                                 x[0], x[1], x[2]);
+       std::sort(x, x + n);
+       check("Cubic " + p.name + ": roots", roots_error(x, n, p.roots), p.tol);
+       check("Cubic " + p.name + ": missing roots are NaN", missing_nan(x, n, 3));
+   }
+
+   // Quartic polynomials, in the real-root regime
+   std::vector<Poly> quartics = {
+       {"3(x+6)(x+4)(x-3)(x-5)", {3.0, 6.0, -123.0, -126.0, 1080.0}, {-6.0, -4.0, 3.0, 5.0}, 16.0 * eps},
+       {"(x^2+1)(x-1)(x-2)", {1.0, -3.0, 3.0, -3.0, 2.0}, {1.0, 2.0}, 16.0 * eps},
+       {"(x-1)^2(x-2)(x-3)", {1.0, -7.0, 17.0, -17.0, 6.0}, {1.0, 1.0, 2.0, 3.0}, 1e-7},
+       {"(x^2-1)^2", {1.0, 0.0, -2.0, 0.0, 1.0}, {-1.0, -1.0, 1.0, 1.0}, 1e-7},
+       {"(x-1)^4", {1.0, -4.0, 6.0, -4.0, 1.0}, {1.0, 1.0, 1.0, 1.0}, 1e-3},
+       {"x^4", {1.0, 0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, 0.0},
+       {"x^4+1", {1.0, 0.0, 0.0, 0.0, 1.0}, {}, 0.0}};
+   for (const Poly &p : quartics)
+   {
+       double x[4];
+       std::size_t n = Maths::Roots::quartic_roots(p.coeffs[0], p.coeffs[1], p.coeffs[2], p.coeffs[3],
+                                                   p.coeffs[4], x[0], x[1], x[2], x[3]);
+       check("Quartic " + p.name + ": roots", roots_error(x, n, p.roots), p.tol);
+       check("Quartic " + p.name + ": missing roots are NaN", missing_nan(x, n, 4));
+   }
+
+   // Complex arithmetic path
+   complex z[4];
+   Maths::Roots::quartic_roots(3.0, 6.0, -123.0, -126.0, 1080.0, z[0], z[1], z[2], z[3]);
+   double x[4] = {z[0].real(), z[1].real(), z[2].real(), z[3].real()}, imag = 0.0;
+   for (const complex &zk : z)
+       imag = std::max(imag, std::abs(zk.imag()));
+   std::sort(x, x + 4);
+   check("Complex quartic 3(x+6)(x+4)(x-3)(x-5): roots", roots_error(x, 4, quartics[0].roots), 1e-12);
+   check("Complex quartic 3(x+6)(x+4)(x-3)(x-5): imaginary parts", imag, 1e-12);
+   Maths::Roots::quartic_roots(1.0, 0.0, 0.0, 0.0, 1.0, z[0], z[1], z[2], z[3]);
+   double err = 0.0;
+   for (const complex &zk : z)
+       err = std::max(err, std::abs(zk * zk * zk * zk + 1.0));
+   check("Complex quartic x^4+1: residuals", err, 1e-14);
+
+   // Zero leading coefficient
+   bool thrown = false;
+   try { Maths::Roots::quartic_roots(0.0, 1.0, 1.0, 1.0, 1.0, x[0], x[1], x[2], x[3]); }
+   catch (const std::invalid_argument &) { thrown = true; }
+   check("Quartic with a zero leading coefficient throws", thrown);
 
-   std::cout << std::scientific;
-   std::cout << "x1 = " << x1 << std::endl
-             << "x2 = " << x2 << std::endl
-             << "x3 = " << x3 << std::endl
-             << "x4 = " << x4 << std::endl << std::endl;
+   // Batch versions
+   test_batch<2>(quadratics, gen);
+   test_batch<3>(cubics, gen);
+   test_batch<4>(quartics, gen);
 
-   return 0;
+   return OslTest::report();
 }
@@ -0,0 +1,83 @@
+/*! ********************************************************************
+ * \file OslTest.h
+ * \brief Minimal check/report helpers shared by the Osl test programs.
+ *
+ * Each test program calls the check() functions, which print one line
+ * per check and count the failures, and returns OslTest::report() from
+ * main() so that CTest sees a non-zero exit code on failure.
+ *********************************************************************/
+
+#ifndef OSL_TEST_OSLTEST_H
+#define OSL_TEST_OSLTEST_H
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace OslTest { // OslTest namespace
+
+//! Number of failed checks of the test program
+inline std::size_t nfail = 0;
+
+/*! ********************************************************************
+ * \brief Checks a condition.
+ * \param [in] name The name of the check.
+ * \param [in] ok The result of the check.
+ * \return \em ok.
+ *********************************************************************/
+inline bool check(const std::string &name, bool ok)
+{
+    nfail += !ok;
+    std::cout << name << (ok ? " OK" : " FAILED") << std::endl;
+    return ok;
+}
+
+/*! ********************************************************************
+ * \brief Checks that a value is within a tolerance of a reference.
+ *
+ * A NaN value passes only against a NaN reference.
+ *
+ * \param [in] name The name of the check.
+ * \param [in] value The computed value.
+ * \param [in] ref The expected value.
+ * \param [in] tol The absolute tolerance.
+ * \return true if \f$|value-ref|\leq tol\f$.
+ *********************************************************************/
+inline bool check(const std::string &name, double value, double ref, double tol)
+{
+    bool ok = (std::abs(value - ref) <= tol) || (std::isnan(ref) && std::isnan(value));
+    nfail += !ok;
+    std::cout << name << " = " << value << " (expected " << ref << ")"
+              << (ok ? " OK" : " FAILED") << std::endl;
+    return ok;
+}
+
+/*! ********************************************************************
+ * \brief Checks that an error is below a tolerance.
+ * \param [in] name The name of the check.
+ * \param [in] err The computed error (fails if NaN).
+ * \param [in] tol The tolerance.
+ * \return true if \f$err\leq tol\f$.
+ *********************************************************************/
+inline bool check(const std::string &name, double err, double tol)
+{
+    bool ok = err <= tol;
+    nfail += !ok;
+    std::cout << name << " = " << err << (ok ? " OK" : " FAILED") << std::endl;
+    return ok;
+}
+
+/*! ********************************************************************
+ * \brief Prints the summary of the test program.
+ * \return The exit code of the test program: 0 if all checks passed.
+ *********************************************************************/
+inline int report()
+{
+    std::cout << ((nfail == 0) ? "All tests passed" : "Some tests FAILED") << std::endl;
+    return (nfail == 0) ? 0 : 1;
+}
+
+} // namespace OslTest
+
+#endif // OSL_TEST_OSLTEST_H